@@ -243,6 +243,16 @@ namespace AZ
             LoadAll = 1
         };
 
+        enum class AssetLoadLane : u8
+        {
+            // Uses the asset handler's default read priority and the default job priority
+            Default = 0,
+            // Gameplay critical content, reads and deserialization jobs are scheduled ahead of the default lane
+            Critical = 1,
+            // Cosmetic content, reads and deserialization jobs are scheduled behind the default lane
+            Cosmetic = 2
+        };
+
         struct AssetLoadParameters
         {
             AssetLoadParameters() : m_assetLoadFilterCB() {}
@@ -260,6 +270,13 @@ namespace AZ
             AZStd::optional<AZStd::chrono::milliseconds> m_deadline{ };
             AZStd::optional<IO::IStreamerTypes::Priority> m_priority{ };
             AssetDependencyLoadRules m_dependencyRules{ AssetDependencyLoadRules::Default };
+            // Lane used to schedule the reads and deserialization of the asset and its dependencies.  An explicit m_priority
+            // still takes precedence over the lane for the reads.
+            AssetLoadLane m_lane{ AssetLoadLane::Default };
+            // When loading through an AssetContainer, collect the reads of the whole dependency graph and hand them to the
+            // streamer as a single batch, with earlier deadlines for assets deeper in PreLoad chains, since those gate
+            // everything above them.
+            bool m_batchDependencyReads{ false };
             // If the asset we're requesting is already loaded and we don't want to check for any
             // depenencies that need loading, leave this as true.  If you wish to force a clean evaluation
             // for dependent assets set to false
@@ -274,7 +291,9 @@ namespace AZ
                 return emptyLoadFilter
                     && rhsEmptyLoadFilter
                     && m_deadline == rhs.m_deadline
-                    && m_priority == rhs.m_priority;
+                    && m_priority == rhs.m_priority
+                    && m_lane == rhs.m_lane
+                    && m_batchDependencyReads == rhs.m_batchDependencyReads;
             }
         };
 
@@ -62,7 +62,7 @@ namespace AZ::Data
             auto queuedDependentAsset = AssetManager::Instance().GetAssetInternal(
                 dependentAsset.GetId(), dependentAsset.GetType(),
                 AZ::Data::AssetLoadBehavior::Default, loadParamsCopyWithNoLoadingFilter,
-                dependentAssetInfo, HasPreloads(dependentAsset.GetId()));
+                dependentAssetInfo, HasPreloads(dependentAsset.GetId()), m_readBatch);
 
             // Verify that the returned asset reference matches the one that we found or created and queued to load.
             AZ_Assert(dependentAsset == queuedDependentAsset, "GetAssetInternal returned an unexpected asset reference for Asset %s",
@@ -164,6 +164,15 @@ namespace AZ::Data
         AddWaitingAssets(waitingList);
         SetupPreloadLists(move(preloadDependencies), rootAssetId);
 
+        // When requested, the reads for the whole graph are collected while queueing and handed to the streamer as a single batch,
+        // ordered so that the deepest PreLoad chains are read first.
+        AssetStreamerReadBatch readBatch;
+        if (loadParams.m_batchDependencyReads)
+        {
+            CalculatePreloadDepths(rootAssetId, readBatch);
+            m_readBatch = &readBatch;
+        }
+
         auto loadParamsCopyWithNoLoadingFilter = loadParams;
 
         // All asset dependencies below the root asset should be provided by the asset catalog, and therefore should *not*
@@ -233,7 +242,14 @@ namespace AZ::Data
         // it doesn't have any chance of serializing in until after all the dependent assets have been queued for loading and have
         // been added to the list of dependencies.
         auto thisAsset = AssetManager::Instance().GetAssetInternal(rootAssetId, rootAssetType, rootAsset.GetAutoLoadBehavior(),
-            loadParamsCopyWithNoLoadingFilter, AssetInfo(), HasPreloads(rootAssetId));
+            loadParamsCopyWithNoLoadingFilter, AssetInfo(), HasPreloads(rootAssetId), m_readBatch);
+
+        // The dependencies have been queued even if the root failed, so the batch is always submitted.
+        if (m_readBatch)
+        {
+            AssetManager::Instance().QueueStreamerReadBatch(readBatch);
+            m_readBatch = nullptr;
+        }
 
         if (!thisAsset)
         {
@@ -659,6 +675,49 @@ namespace AZ::Data
         return false;
     }
 
+    void AssetContainer::CalculatePreloadDepths(const AssetId& rootAssetId, AssetStreamerReadBatch& readBatch) const
+    {
+        AZStd::lock_guard<AZStd::recursive_mutex> preloadGuard(m_preloadMutex);
+
+        readBatch.m_preloadDepths.clear();
+        readBatch.m_maxPreloadDepth = 0;
+        readBatch.m_preloadDepths[rootAssetId] = 0;
+
+        // Relax the depths until they settle.  SetupPreloadLists only removes the direct cycles, so the number of passes is
+        // capped by the size of the graph to guarantee termination on longer ones.
+        bool depthChanged = true;
+        for (size_t pass = 0; depthChanged && pass <= m_preloadList.size(); ++pass)
+        {
+            depthChanged = false;
+            for (const auto& [waitingId, preloadIds] : m_preloadList)
+            {
+                auto waitingDepthIter = readBatch.m_preloadDepths.find(waitingId);
+                if (waitingDepthIter == readBatch.m_preloadDepths.end())
+                {
+                    continue;
+                }
+
+                const u32 preloadDepth = waitingDepthIter->second + 1;
+                for (const AssetId& preloadId : preloadIds)
+                {
+                    // Each waiting asset is also listed as its own preload
+                    if (preloadId == waitingId)
+                    {
+                        continue;
+                    }
+
+                    auto [depthIter, inserted] = readBatch.m_preloadDepths.emplace(preloadId, preloadDepth);
+                    if (inserted || depthIter->second < preloadDepth)
+                    {
+                        depthIter->second = preloadDepth;
+                        readBatch.m_maxPreloadDepth = AZStd::max(readBatch.m_maxPreloadDepth, preloadDepth);
+                        depthChanged = true;
+                    }
+                }
+            }
+        }
+    }
+
     Asset<AssetData> AssetContainer::GetAssetData(const AssetId& assetId) const
     {
         AZStd::lock_guard<AZStd::recursive_mutex> dependenciesGuard(m_dependencyMutex);
@@ -21,6 +21,7 @@ namespace AZ
     namespace Data
     {
         struct AssetLoadParameters;
+        struct AssetStreamerReadBatch;
 
         // AssetContainer loads an asset and all of its dependencies as a collection which is parallellized as much as possible.
         // With the container, the data will all load in parallel.  Dependent asset loads will still obey the expected rules
@@ -109,6 +110,9 @@ namespace AZ
             // all of an asset's preload dependencies are ready before completing the load cycle where OnAssetReady will be signalled and the asset
             // will be removed from the waiting list in the container
             void SetupPreloadLists(PreloadAssetListType&& preloadList, const AZ::Data::AssetId& rootAssetId);
+            // Depth of each PreLoad dependency below the root, using the longest chain of PreLoads that leads to it.  The deepest
+            // assets gate everything above them, so their reads are the most urgent.
+            void CalculatePreloadDepths(const AZ::Data::AssetId& rootAssetId, AssetStreamerReadBatch& readBatch) const;
             bool HasPreloads(const AZ::Data::AssetId& assetId) const;
 
             // Remove a specific id from the list an asset is waiting for and complete the load if everything is ready
@@ -145,6 +149,10 @@ namespace AZ
 
             // AssetId -> List of assets waiting on it
             PreloadAssetListType m_preloadWaitList;
+
+            // Collects the streamer reads of the whole graph while it is being queued when batched dependency reads were requested,
+            // only set for the duration of AddDependentAssets
+            AssetStreamerReadBatch* m_readBatch = nullptr;
         private:
             AssetContainer operator=(const AssetContainer& copyContainer) = delete;
             AssetContainer operator=(const AssetContainer&& copyContainer) = delete;
@@ -60,7 +60,7 @@ namespace AZ::Data
 
     void AssetDataStream::Open(const AZStd::string& filePath, size_t fileOffset, size_t assetSize,
         AZStd::chrono::milliseconds deadline, AZ::IO::IStreamerTypes::Priority priority,
-        OnCompleteCallback loadCallback)
+        OnCompleteCallback loadCallback, AZ::IO::FileRequestPtr* deferredRequest)
     {
         AZ_PROFILE_FUNCTION(AzCore);
 
@@ -129,7 +129,14 @@ namespace AZ::Data
             m_curPriority = priority;
             streamer->SetRequestCompleteCallback(m_curReadRequest, streamerCallback);
 
-            streamer->QueueRequest(m_curReadRequest);
+            if (deferredRequest)
+            {
+                *deferredRequest = m_curReadRequest;
+            }
+            else
+            {
+                streamer->QueueRequest(m_curReadRequest);
+            }
         }
         else
         {
@@ -35,11 +35,13 @@ namespace AZ::Data
         void Open(AZStd::vector<AZ::u8>&& data);
 
         // Open the AssetDataStream and load it via file streaming
+        // If deferredRequest is provided, the read request is returned through it instead of being queued, and the caller
+        // is responsible for queueing it with the streamer.
         using OnCompleteCallback = AZStd::function<void(AZ::IO::IStreamerTypes::RequestStatus)>;
         void Open(const AZStd::string& filePath, size_t fileOffset, size_t assetSize,
             AZStd::chrono::milliseconds deadline = AZ::IO::IStreamerTypes::s_noDeadline,
             AZ::IO::IStreamerTypes::Priority priority = AZ::IO::IStreamerTypes::s_priorityMedium,
-            OnCompleteCallback loadCallback = {});
+            OnCompleteCallback loadCallback = {}, AZ::IO::FileRequestPtr* deferredRequest = nullptr);
 
         // Reschedule the outstanding request.  Will only update with shorter deadline values or higher priority values
         void Reschedule(AZStd::chrono::milliseconds newDeadline, AZ::IO::IStreamerTypes::Priority newPriority);
@@ -17,6 +17,7 @@
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/string/osstring.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Memory/OSAllocator.h>
@@ -47,9 +48,9 @@ namespace AZ::Data
         , public Job
     {
     public:
-        AssetDatabaseAsyncJob(JobContext* jobContext, bool deleteWhenDone, AssetManager* owner, const Asset<AssetData>& asset, AssetHandler* assetHandler)
+        AssetDatabaseAsyncJob(JobContext* jobContext, bool deleteWhenDone, AssetManager* owner, const Asset<AssetData>& asset, AssetHandler* assetHandler, AZ::s8 priority = 0)
             : AssetDatabaseJob(owner, asset, assetHandler)
-            , Job(deleteWhenDone, jobContext)
+            , Job(deleteWhenDone, jobContext, false, priority)
         {
         }
 
@@ -106,6 +107,21 @@ namespace AZ::Data
 
     using BlockingAssetLoadBus = EBus<BlockingAssetLoadEvents>;
 
+    // Deserialization job priority for each AssetLoadLane, so that critical content loading alongside cosmetic content is
+    // processed first when the job threads are saturated.
+    static AZ::s8 GetLoadJobPriority(AssetLoadLane lane)
+    {
+        switch (lane)
+        {
+        case AssetLoadLane::Critical:
+            return 64;
+        case AssetLoadLane::Cosmetic:
+            return -64;
+        default:
+            return 0;
+        }
+    }
+
     /*
      * This class processes async AssetDatabase load jobs
      */
@@ -118,7 +134,7 @@ namespace AZ::Data
         LoadAssetJob(AssetManager* owner, const Asset<AssetData>& asset,
             AZStd::shared_ptr<AssetDataStream> dataStream, bool isReload, AZ::IO::IStreamerTypes::RequestStatus requestState,
             AssetHandler* handler, const AssetLoadParameters& loadParams, bool signalLoaded)
-            : AssetDatabaseAsyncJob(JobContext::GetGlobalContext(), true, owner, asset, handler)
+            : AssetDatabaseAsyncJob(JobContext::GetGlobalContext(), true, owner, asset, handler, GetLoadJobPriority(loadParams.m_lane))
             , m_dataStream(dataStream)
             , m_isReload(isReload)
             , m_requestState(requestState)
@@ -880,6 +896,14 @@ namespace AZ::Data
         {
             priority = loadParams.m_priority.value();
         }
+        else if (loadParams.m_lane == AssetLoadLane::Critical)
+        {
+            priority = AZStd::max(priority, AZ::IO::IStreamerTypes::s_priorityHigh);
+        }
+        else if (loadParams.m_lane == AssetLoadLane::Cosmetic)
+        {
+            priority = AZStd::min(priority, AZ::IO::IStreamerTypes::s_priorityLow);
+        }
 
         return make_pair(deadline, priority);
     }
@@ -938,7 +962,8 @@ namespace AZ::Data
     }
 
     Asset<AssetData> AssetManager::GetAssetInternal(const AssetId& assetId, [[maybe_unused]] const AssetType& assetType,
-        AssetLoadBehavior assetReferenceLoadBehavior, const AssetLoadParameters& loadParams, AssetInfo assetInfo /*= () */, bool signalLoaded /*= false */)
+        AssetLoadBehavior assetReferenceLoadBehavior, const AssetLoadParameters& loadParams, AssetInfo assetInfo /*= () */, bool signalLoaded /*= false */,
+        AssetStreamerReadBatch* readBatch /*= nullptr */)
     {
         AZ_PROFILE_FUNCTION(AzCore);
 
@@ -1085,7 +1110,7 @@ namespace AZ::Data
             AZ_Assert(loadInfo.IsValid(), "Expected valid stream info when dataStream is valid.");
             constexpr bool isReload = false;
             QueueAsyncStreamLoad(asset, dataStream, loadInfo, isReload,
-                handler, loadParams, signalLoaded);
+                handler, loadParams, signalLoaded, readBatch);
         }
         else
         {
@@ -1095,7 +1120,8 @@ namespace AZ::Data
             {
                 auto&& [deadline, priority] = GetEffectiveDeadlineAndPriority(*handler, assetData->GetType(), loadParams);
 
-                RescheduleStreamerRequest(assetData->GetId(), deadline, priority);
+                RescheduleStreamerRequest(assetData->GetId(),
+                    readBatch ? readBatch->GetDeadline(assetData->GetId(), deadline) : deadline, priority);
             }
 
             if (triggerAssetErrorNotification)
@@ -1596,7 +1622,7 @@ namespace AZ::Data
     //=========================================================================
     void AssetManager::QueueAsyncStreamLoad(Asset<AssetData> asset, AZStd::shared_ptr<AssetDataStream> dataStream,
         const AZ::Data::AssetStreamInfo& streamInfo, bool isReload,
-        AssetHandler* handler, const AssetLoadParameters& loadParams, bool signalLoaded)
+        AssetHandler* handler, const AssetLoadParameters& loadParams, bool signalLoaded, AssetStreamerReadBatch* readBatch)
     {
         AZ_PROFILE_FUNCTION(AzCore);
 
@@ -1683,11 +1709,79 @@ namespace AZ::Data
 
         // Track the load request and queue the asset data stream load.
         AddActiveStreamerRequest(asset.GetId(), dataStream);
-        dataStream->Open(
-            streamInfo.m_streamName,
-            streamInfo.m_dataOffset,
-            streamInfo.m_dataLen,
-            deadline, priority, assetDataStreamCallback);
+        if (readBatch)
+        {
+            const AZStd::chrono::milliseconds batchDeadline = readBatch->GetDeadline(asset.GetId(), deadline);
+            IO::FileRequestPtr readRequest;
+            dataStream->Open(
+                streamInfo.m_streamName,
+                streamInfo.m_dataOffset,
+                streamInfo.m_dataLen,
+                batchDeadline, priority, assetDataStreamCallback, &readRequest);
+
+            // Empty assets complete immediately without a read
+            if (readRequest)
+            {
+                readBatch->m_reads.push_back({ AZStd::move(readRequest), batchDeadline, readBatch->GetPreloadDepth(asset.GetId()) });
+            }
+        }
+        else
+        {
+            dataStream->Open(
+                streamInfo.m_streamName,
+                streamInfo.m_dataOffset,
+                streamInfo.m_dataLen,
+                deadline, priority, assetDataStreamCallback);
+        }
+    }
+
+    void AssetManager::QueueStreamerReadBatch(AssetStreamerReadBatch& readBatch)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        if (readBatch.m_reads.empty())
+        {
+            return;
+        }
+
+        // Earliest deadline first, and with equal deadlines the deepest PreLoad first, so that the streamer works through the
+        // critical path of the graph before the assets that nothing is waiting on.
+        AZStd::stable_sort(readBatch.m_reads.begin(), readBatch.m_reads.end(),
+            [](const AssetStreamerReadBatch::Read& lhs, const AssetStreamerReadBatch::Read& rhs)
+            {
+                return lhs.m_deadline < rhs.m_deadline
+                    || (lhs.m_deadline == rhs.m_deadline && lhs.m_preloadDepth > rhs.m_preloadDepth);
+            });
+
+        AZStd::vector<IO::FileRequestPtr> requests;
+        requests.reserve(readBatch.m_reads.size());
+        for (AssetStreamerReadBatch::Read& read : readBatch.m_reads)
+        {
+            requests.push_back(AZStd::move(read.m_request));
+        }
+        readBatch.m_reads.clear();
+
+        AZ::Interface<AZ::IO::IStreamer>::Get()->QueueRequestBatch(AZStd::move(requests));
+    }
+
+    AZStd::chrono::milliseconds AssetStreamerReadBatch::GetDeadline(const AssetId& assetId, AZStd::chrono::milliseconds deadline) const
+    {
+        const u32 preloadDepth = GetPreloadDepth(assetId);
+        const AZStd::chrono::milliseconds noDeadline =
+            AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(AZ::IO::IStreamerTypes::s_noDeadline);
+        if (preloadDepth == 0 || deadline >= noDeadline)
+        {
+            return deadline;
+        }
+
+        // Scale the deadline down linearly with depth, the deepest assets in the graph get 1 / (maxDepth + 1) of it
+        return deadline / (m_maxPreloadDepth + 1) * (m_maxPreloadDepth + 1 - preloadDepth);
+    }
+
+    u32 AssetStreamerReadBatch::GetPreloadDepth(const AssetId& assetId) const
+    {
+        auto depthIter = m_preloadDepths.find(assetId);
+        return depthIter != m_preloadDepths.end() ? depthIter->second : 0;
     }
 
     //=========================================================================
@@ -2191,5 +2285,7 @@ size_t AZStd::hash<AZ::Data::AssetContainerKey>::operator()(const AZ::Data::Asse
     hash_combine(h, obj.m_loadParameters.m_deadline.value_or(AZStd::chrono::milliseconds(-1)).count());
     hash_combine(h, obj.m_loadParameters.m_priority.value_or(-1));
     hash_combine(h, obj.m_loadParameters.m_dependencyRules);
+    hash_combine(h, obj.m_loadParameters.m_lane);
+    hash_combine(h, obj.m_loadParameters.m_batchDependencyReads);
     return h;
 }
@@ -99,6 +99,28 @@ namespace AZ
             u64             m_dataOffset;
         };
 
+        //! File reads collected while an AssetContainer queues its dependency graph, so that the streamer receives them in a
+        //! single deadline sorted batch instead of one at a time, in whatever order the catalog listed the dependencies.
+        struct AssetStreamerReadBatch
+        {
+            struct Read
+            {
+                IO::FileRequestPtr m_request;
+                AZStd::chrono::milliseconds m_deadline;
+                u32 m_preloadDepth;
+            };
+
+            //! Returns the deadline for an asset in the batch. Assets deeper in PreLoad chains are due earlier, as they gate
+            //! everything above them; the root and QueueLoad dependencies keep the requested deadline.
+            AZStd::chrono::milliseconds GetDeadline(const AssetId& assetId, AZStd::chrono::milliseconds deadline) const;
+            u32 GetPreloadDepth(const AssetId& assetId) const;
+
+            //! Number of PreLoad hops from the container root to each asset that is part of a PreLoad chain.
+            AZStd::unordered_map<AssetId, u32> m_preloadDepths;
+            u32 m_maxPreloadDepth = 0;
+            AZStd::vector<Read> m_reads;
+        };
+
         struct AssetDependencyEntry
         {
             AssetId     m_assetId;
@@ -352,7 +374,7 @@ namespace AZ
             void ValidateAndPostLoad(AZ::Data::Asset < AZ::Data::AssetData>& asset, bool loadSucceeded, bool isReload, AZ::Data::AssetHandler* assetHandler = nullptr);
             void PostLoad(AZ::Data::Asset < AZ::Data::AssetData>& asset, bool loadSucceeded, bool isReload, AZ::Data::AssetHandler* assetHandler = nullptr);
 
-            Asset<AssetData> GetAssetInternal(const AssetId& assetId, const AssetType& assetType, AssetLoadBehavior assetReferenceLoadBehavior, const AssetLoadParameters& loadParams = AssetLoadParameters{}, AssetInfo assetInfo = AssetInfo(), bool signalLoaded = false);
+            Asset<AssetData> GetAssetInternal(const AssetId& assetId, const AssetType& assetType, AssetLoadBehavior assetReferenceLoadBehavior, const AssetLoadParameters& loadParams = AssetLoadParameters{}, AssetInfo assetInfo = AssetInfo(), bool signalLoaded = false, AssetStreamerReadBatch* readBatch = nullptr);
 
             void UpdateDebugStatus(const AZ::Data::Asset<AZ::Data::AssetData>& asset);
 
@@ -397,9 +419,14 @@ namespace AZ
             AssetStreamInfo GetModifiedLoadStreamInfoForAsset(const Asset<AssetData>& asset, AssetHandler* handler);
 
             //! Queue an async file load with the AssetDataStream as the first step in an asset load
+            //! If readBatch is provided, the file read is added to it instead of being queued with the streamer.
             void QueueAsyncStreamLoad(Asset<AssetData> asset, AZStd::shared_ptr<AssetDataStream> dataStream,
                 const AZ::Data::AssetStreamInfo& streamInfo, bool isReload,
-                AssetHandler* handler, const AssetLoadParameters& loadParameters, bool signalLoaded);
+                AssetHandler* handler, const AssetLoadParameters& loadParameters, bool signalLoaded,
+                AssetStreamerReadBatch* readBatch = nullptr);
+
+            //! Queue all of the file reads collected in a batch with the streamer, earliest deadline first.
+            void QueueStreamerReadBatch(AssetStreamerReadBatch& readBatch);
 
             AssetHandlerMap         m_handlers;
             AssetCatalogMap         m_catalogs;
@@ -10,10 +10,12 @@
 
 #include <AzCore/Jobs/Job.h>
 #include <AzCore/Jobs/Internal/JobNotify.h>
+#include <AzCore/Threading/ThreadUtils.h>
 
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/string/fixed_string.h>
 
 #include <AzCore/Debug/Profiler.h>
@@ -30,52 +32,110 @@ bool CompareJobPriorities(AZ::s8 value, const Job* job)
     return value > job->GetPriority();
 }
 
-void WorkQueue::LocalInsert(Job* job)
+WorkQueue::Buffer::Buffer(AZ::s64 capacity)
+    : m_mask(capacity - 1)
 {
-    LockGuard lock(m_lock);
-    const AZStd::deque<Job*>::const_iterator locationToinsert = AZStd::upper_bound(m_queue.begin(),
-                                                                                   m_queue.end(),
-                                                                                   job->GetPriority(),
-                                                                                   CompareJobPriorities);
-    m_queue.insert(locationToinsert, job);
+    AZ_Assert((capacity & m_mask) == 0, "Work queue capacity must be a power of 2");
+    m_jobs = reinterpret_cast<AZStd::atomic<Job*>*>(azmalloc(sizeof(AZStd::atomic<Job*>) * static_cast<size_t>(capacity), alignof(AZStd::atomic<Job*>), SystemAllocator));
+    for (AZ::s64 i = 0; i < capacity; ++i)
+    {
+        new (&m_jobs[i]) AZStd::atomic<Job*>(nullptr);
+    }
 }
 
-Job* WorkQueue::LocalPopFront()
+WorkQueue::Buffer::~Buffer()
 {
-    LockGuard lock(m_lock);
+    azfree(m_jobs, SystemAllocator);
+}
 
-    Job* result = nullptr;
-    if (!m_queue.empty())
+WorkQueue::Buffer* WorkQueue::Buffer::Grow(AZ::s64 top, AZ::s64 bottom) const
+{
+    Buffer* buffer = aznew Buffer(GetCapacity() * 2);
+    for (AZ::s64 i = top; i < bottom; ++i)
     {
-        result = m_queue.front();
-        m_queue.pop_front();
+        buffer->Put(i, Get(i));
     }
+    return buffer;
+}
 
-    return result;
+WorkQueue::WorkQueue()
+    : m_buffer(aznew Buffer(InitialCapacity))
+{
 }
 
-Job* WorkQueue::TryStealFront()
+WorkQueue::~WorkQueue()
 {
-    AZStd::exponential_backoff backoff;
-    for (unsigned attempCount = 0; attempCount < TryStealSpinAttemps; ++attempCount)
+    for (Buffer* buffer : m_retiredBuffers)
     {
-        // Do a bounded spin with backoff to acquire the lock
-        if (m_lock.try_lock())
+        delete buffer;
+    }
+    delete m_buffer.load(AZStd::memory_order_relaxed);
+}
+
+void WorkQueue::LocalPush(Job* job)
+{
+    const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_relaxed);
+    const AZ::s64 top = m_top.load(AZStd::memory_order_acquire);
+    Buffer* buffer = m_buffer.load(AZStd::memory_order_relaxed);
+    if (bottom - top > buffer->GetCapacity() - 1)
+    {
+        // full, thieves may still be reading from the old buffer so it's only released with the queue
+        m_retiredBuffers.push_back(buffer);
+        buffer = buffer->Grow(top, bottom);
+        m_buffer.store(buffer, AZStd::memory_order_release);
+    }
+    buffer->Put(bottom, job);
+    AZStd::atomic_thread_fence(AZStd::memory_order_release);
+    m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+}
+
+Job* WorkQueue::LocalPop()
+{
+    const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_relaxed) - 1;
+    Buffer* buffer = m_buffer.load(AZStd::memory_order_relaxed);
+    m_bottom.store(bottom, AZStd::memory_order_relaxed);
+    AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+    AZ::s64 top = m_top.load(AZStd::memory_order_relaxed);
+
+    Job* result = nullptr;
+    if (top <= bottom)
+    {
+        result = buffer->Get(bottom);
+        if (top == bottom)
         {
-            Job* result = nullptr;
-            if (!m_queue.empty())
+            // last job in the queue, race the thieves for it
+            if (!m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
             {
-                result = m_queue.front();
-                m_queue.pop_front();
+                result = nullptr;
             }
+            m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+        }
+    }
+    else
+    {
+        // empty
+        m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+    }
+    return result;
+}
+
+Job* WorkQueue::TrySteal()
+{
+    AZ::s64 top = m_top.load(AZStd::memory_order_acquire);
+    AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+    const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_acquire);
 
-            m_lock.unlock();
+    if (top < bottom)
+    {
+        Buffer* buffer = m_buffer.load(AZStd::memory_order_acquire);
+        Job* result = buffer->Get(top);
+        if (m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+        {
             return result;
         }
-
-        backoff.wait();
     }
 
+    // empty, or another thread took the job first
     return nullptr;
 }
 
@@ -143,10 +203,11 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
 #endif
         }
     }
-    else if (info && info->m_isWorker && (info->m_owningManager == this))
+    else if (info && info->m_isWorker && (info->m_owningManager == this) && (job->GetPriority() == 0))
     {
-        //current thread is a worker, insert into the local queue based on the job's priority
-        info->m_pendingJobs.LocalInsert(job);
+        //current thread is a worker, push onto the local queue. The local queue doesn't sort by priority, so jobs with
+        //a non-default priority go to the global queue instead
+        info->m_pendingJobs.LocalPush(job);
 #ifdef JOBMANAGER_ENABLE_STATS
         ++info->m_jobsForked;
 #endif
@@ -155,7 +216,7 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
     }
     else
     {
-        //current thread is not a worker thread, insert into the global queue based on the job's priority
+        //current thread is not a worker thread or the job has a priority, insert into the global queue based on the job's priority
         if (IsAsynchronous())
         {
             AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
@@ -237,6 +298,14 @@ void JobManagerWorkStealing::StartJobAndAssistUntilComplete(Job* job)
 
 void JobManagerWorkStealing::ClearStats()
 {
+    for (ThreadInfo* info : m_workerThreads)
+    {
+        info->m_jobsStolenCount.store(0, AZStd::memory_order_relaxed);
+        info->m_failedStealCount.store(0, AZStd::memory_order_relaxed);
+        info->m_idleCount.store(0, AZStd::memory_order_relaxed);
+        info->m_idleTime.store(0, AZStd::memory_order_relaxed);
+    }
+
 #ifdef JOBMANAGER_ENABLE_STATS
     for (unsigned int i = 0; i < m_threads.size(); ++i)
     {
@@ -272,6 +341,25 @@ void JobManagerWorkStealing::PrintStats()
 }
 
 
+JobManagerWorkerStats JobManagerWorkStealing::GetWorkerStats(AZ::u32 workerId) const
+{
+    AZ_Assert(workerId < m_workerThreads.size(), "Invalid worker thread id %u", workerId);
+    const ThreadInfo* info = m_workerThreads[workerId];
+
+    JobManagerWorkerStats stats;
+    stats.m_jobsStolen = info->m_jobsStolenCount.load(AZStd::memory_order_relaxed);
+    stats.m_failedSteals = info->m_failedStealCount.load(AZStd::memory_order_relaxed);
+    stats.m_idleCount = info->m_idleCount.load(AZStd::memory_order_relaxed);
+    stats.m_idleTime = info->m_idleTime.load(AZStd::memory_order_relaxed);
+    return stats;
+}
+
+void JobManagerWorkStealing::IncrementCounter(AZStd::atomic<AZ::u64>& counter)
+{
+    // only the owning worker writes to its counters, so there's no need for an atomic increment
+    counter.store(counter.load(AZStd::memory_order_relaxed) + 1, AZStd::memory_order_relaxed);
+}
+
 Job* JobManagerWorkStealing::GetCurrentJob() const
 {
     const ThreadInfo* info = m_currentThreadInfo;
@@ -328,7 +416,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
 
     //get thread local job queue
     WorkQueue* pendingJobs = info->m_isWorker ? &info->m_pendingJobs : nullptr;
-    unsigned int victim = ((m_workerThreads.size() > 1) && (m_workerThreads[0] == info)) ? 1 : 0;
+    unsigned int victim = 0;
 
     while (true)
     {
@@ -371,8 +459,13 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 if (shouldSleep)
                 {
                     //no available work, so go to sleep (or we have already been signaled by another thread and will acquire the semaphore but not actually sleep)
+                    const AZStd::sys_time_t sleepStartTime = AZStd::GetTimeNowTicks();
                     info->m_waitEvent.acquire();
                     AZ_PROFILE_INTERVAL_END(JobManagerDetailed, info);
+                    IncrementCounter(info->m_idleCount);
+                    info->m_idleTime.store(
+                        info->m_idleTime.load(AZStd::memory_order_relaxed) + (AZStd::GetTimeNowTicks() - sleepStartTime),
+                        AZStd::memory_order_relaxed);
 
                     if (m_quitRequested)
                     {
@@ -404,7 +497,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
         if (!job && pendingJobs)
         {
             //nothing on the global queue, try to pop from the local queue
-            job = pendingJobs->LocalPopFront();
+            job = pendingJobs->LocalPop();
         }
 
         bool isTerminated = false;
@@ -434,7 +527,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 //pop a new job from the local queue
                 if (pendingJobs)
                 {
-                    job = pendingJobs->LocalPopFront();
+                    job = pendingJobs->LocalPop();
                     if (job)
                     {
                         // not necessary, just an optimization - wakeup sleeping threads, there's work to be done
@@ -457,9 +550,16 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
             }
             else
             {
-                //attempt to steal a job from another thread's queue
+                //attempt to steal a job from another thread's queue. Workers try the queues of the workers sharing a cache
+                //with them first, other threads go through all workers.
+                const unsigned int numVictims = info->m_isWorker ? static_cast<unsigned int>(info->m_stealOrder.size()) : static_cast<unsigned int>(m_workerThreads.size());
+                if (info->m_isWorker && victim >= info->m_numNearbyVictims)
+                {
+                    //the last successful steal was from a worker further away, check the nearby workers again first
+                    victim = 0;
+                }
                 unsigned int numStealAttempts = 0;
-                const unsigned int maxStealAttempts = (unsigned int)m_workerThreads.size() * 3; //try every thread a few times before giving up
+                const unsigned int maxStealAttempts = numVictims * 3; //try every thread a few times before giving up
                 while (!job)
                 {
                     //check if our suspended job is ready, before we try stealing a new job
@@ -469,20 +569,29 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                         return;
                     }
 
-                    //select a victim thread, using the same victim as the previous successful steal if possible
-                    WorkQueue* victimQueue = &m_workerThreads[victim]->m_pendingJobs;
+                    //select a victim queue, using the same victim as the previous successful steal if possible
+                    WorkQueue* victimQueue = info->m_isWorker ? info->m_stealOrder[victim] : &m_workerThreads[victim]->m_pendingJobs;
 
                     //attempt the steal
-                    job = victimQueue->TryStealFront();
+                    job = victimQueue->TrySteal();
                     if (job)
                     {
                         //success, continue with the stolen job
+                        if (info->m_isWorker)
+                        {
+                            IncrementCounter(info->m_jobsStolenCount);
+                        }
 #ifdef JOBMANAGER_ENABLE_STATS
                         ++info->m_jobsStolen;
 #endif
                         break;
                     }
 
+                    if (info->m_isWorker)
+                    {
+                        IncrementCounter(info->m_failedStealCount);
+                    }
+
                     ++numStealAttempts;
                     if (numStealAttempts > maxStealAttempts)
                     {
@@ -499,12 +608,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     }
 
                     //steal failed, choose a new victim for next time
-                    victim = (victim + 1) % m_workerThreads.size();
-                    if (m_workerThreads[victim] == info)
-                    {
-                        //don't steal from ourselves
-                        victim = (victim + 1) % m_workerThreads.size();
-                    }
+                    victim = (victim + 1) % numVictims;
                 }
             }
 #ifdef JOBMANAGER_ENABLE_STATS
@@ -625,6 +729,31 @@ JobManagerWorkStealing::ThreadList JobManagerWorkStealing::CreateWorkerThreads(c
     ThreadList workerThreads(workerDescList.size());
     m_threads.reserve(workerDescList.size());
 
+    // Find the cache group of each processor, and the order to pin workers in so workers fill up one group at a time.
+    const AZStd::vector<AZ::u32> processorCacheGroups = AZ::Threading::GetProcessorCacheGroups();
+    AZStd::vector<int> pinOrder;
+#if AZ_TRAIT_SET_JOB_PROCESSOR_ID
+    if (jmDesc.m_pinWorkerThreads)
+    {
+        const int processorCount = processorCacheGroups.empty()
+            ? static_cast<int>(AZStd::thread::hardware_concurrency())
+            : static_cast<int>(processorCacheGroups.size());
+        for (int processor = 0; processor < processorCount; ++processor)
+        {
+            pinOrder.push_back(processor);
+        }
+        if (!processorCacheGroups.empty())
+        {
+            AZStd::stable_sort(pinOrder.begin(), pinOrder.end(), [&processorCacheGroups](int lhs, int rhs)
+            {
+                return processorCacheGroups[lhs] < processorCacheGroups[rhs];
+            });
+        }
+    }
+#endif
+    AZStd::vector<AZ::u32> workerCacheGroups(workerDescList.size(), InvalidCacheGroup);
+    size_t nextPinnedProcessor = 0;
+
     for (unsigned int iThread = 0; iThread < workerDescList.size(); ++iThread)
     {
         const JobManagerThreadDesc& desc = workerDescList[iThread];
@@ -646,6 +775,17 @@ JobManagerWorkStealing::ThreadList JobManagerWorkStealing::CreateWorkerThreads(c
         {
             threadDesc.m_stackSize = desc.m_stackSize;
         }
+        if (threadDesc.m_cpuId == -1 && !pinOrder.empty())
+        {
+            threadDesc.m_cpuId = pinOrder[nextPinnedProcessor];
+            nextPinnedProcessor = (nextPinnedProcessor + 1) % pinOrder.size();
+        }
+#if AZ_TRAIT_SET_JOB_PROCESSOR_ID
+        if (threadDesc.m_cpuId >= 0 && static_cast<size_t>(threadDesc.m_cpuId) < processorCacheGroups.size())
+        {
+            workerCacheGroups[iThread] = processorCacheGroups[threadDesc.m_cpuId];
+        }
+#endif
 
         info->m_thread = AZStd::thread(
             threadDesc,
@@ -661,9 +801,50 @@ JobManagerWorkStealing::ThreadList JobManagerWorkStealing::CreateWorkerThreads(c
         m_threads.push_back(info);
     }
 
+    // The workers wait on m_initSemaphore before they steal, so the steal orders can be set up after they've been started.
+    BuildStealOrders(workerThreads, workerCacheGroups);
+
     return workerThreads;
 }
 
+void JobManagerWorkStealing::BuildStealOrders(const ThreadList& workerThreads, const AZStd::vector<AZ::u32>& workerCacheGroups)
+{
+    // Each worker steals from the workers that share its cache first, then from the others. Both sets start at the worker
+    // after itself so the workers don't all start stealing from the same victim.
+    const size_t workerCount = workerThreads.size();
+    for (size_t workerIndex = 0; workerIndex < workerCount; ++workerIndex)
+    {
+        ThreadInfo* info = workerThreads[workerIndex];
+        const AZ::u32 cacheGroup = workerCacheGroups[workerIndex];
+        info->m_stealOrder.reserve(workerCount - 1);
+
+        for (size_t offset = 1; offset < workerCount; ++offset)
+        {
+            const size_t victimIndex = (workerIndex + offset) % workerCount;
+            if (cacheGroup != InvalidCacheGroup && workerCacheGroups[victimIndex] == cacheGroup)
+            {
+                info->m_stealOrder.push_back(&workerThreads[victimIndex]->m_pendingJobs);
+            }
+        }
+        info->m_numNearbyVictims = static_cast<unsigned int>(info->m_stealOrder.size());
+
+        for (size_t offset = 1; offset < workerCount; ++offset)
+        {
+            const size_t victimIndex = (workerIndex + offset) % workerCount;
+            if (cacheGroup == InvalidCacheGroup || workerCacheGroups[victimIndex] != cacheGroup)
+            {
+                info->m_stealOrder.push_back(&workerThreads[victimIndex]->m_pendingJobs);
+            }
+        }
+
+        if (cacheGroup == InvalidCacheGroup)
+        {
+            // the topology isn't known, treat all workers as being nearby
+            info->m_numNearbyVictims = static_cast<unsigned int>(info->m_stealOrder.size());
+        }
+    }
+}
+
 inline void JobManagerWorkStealing::ActivateWorker()
 {
     // find an available worker thread (we do it brute force because the number of threads is small)
@@ -13,37 +13,82 @@
 #include <AzCore/Jobs/Internal/JobManagerBase.h>
 #include <AzCore/Jobs/JobManagerDesc.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
 
 #include <AzCore/std/containers/queue.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/semaphore.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/time.h>
 
 namespace AZ
 {
     class Job;
 
+    /**
+     * Counters of a single worker thread, see \ref JobManager::GetWorkerStats.
+     */
+    struct JobManagerWorkerStats
+    {
+        AZ::u64 m_jobsStolen = 0; ///< Jobs taken from the queue of another worker.
+        AZ::u64 m_failedSteals = 0; ///< Attempts to steal that found the queue empty or lost the race for the job.
+        AZ::u64 m_idleCount = 0; ///< Times the worker went to sleep because it found no work.
+        AZStd::sys_time_t m_idleTime = 0; ///< Time spent sleeping, in ticks of AZStd::GetTimeNowTicks.
+    };
+
     namespace Internal
     {
+        /**
+         * Lock-free work stealing deque, see "Dynamic Circular Work-Stealing Deque" by Chase and Lev, using the memory orderings
+         * from "Correct and Efficient Work-Stealing for Weak Memory Models" by Le et al.
+         * Only the owning worker pushes and pops jobs, which it does at the bottom (LIFO). Any other thread can steal the
+         * oldest job from the top. The buffer grows when it's full, the previous buffers are kept until the queue is
+         * destroyed because a thief may still be reading from them. Each buffer is twice the size of the previous one, so the
+         * retired buffers never take more memory than the current one.
+         */
         class WorkQueue final
         {
         public:
-            void LocalInsert(Job *job);
-            Job* LocalPopFront();
-            Job* TryStealFront();
+            WorkQueue();
+            ~WorkQueue();
+
+            void LocalPush(Job* job);
+            Job* LocalPop();
+            Job* TrySteal();
 
         private:
             enum
             {
-                TryStealSpinAttemps = 16,
+                InitialCapacity = 256,
             };
-            using LockType = AZStd::shared_mutex;
-            using LockGuard = AZStd::lock_guard<LockType>;
 
-            AZStd::deque<Job*> m_queue;
-            LockType m_lock;
+            class Buffer
+            {
+            public:
+                AZ_CLASS_ALLOCATOR(Buffer, SystemAllocator, 0);
+
+                explicit Buffer(AZ::s64 capacity);
+                ~Buffer();
+
+                AZ::s64 GetCapacity() const { return m_mask + 1; }
+                Job* Get(AZ::s64 index) const { return m_jobs[index & m_mask].load(AZStd::memory_order_relaxed); }
+                void Put(AZ::s64 index, Job* job) { m_jobs[index & m_mask].store(job, AZStd::memory_order_relaxed); }
+                Buffer* Grow(AZ::s64 top, AZ::s64 bottom) const;
+
+            private:
+                const AZ::s64 m_mask;
+                AZStd::atomic<Job*>* m_jobs;
+            };
+
+            // The owner and the thieves both write to top, only the owner writes to bottom, keep them on separate cache lines.
+            alignas(64) AZStd::atomic<AZ::s64> m_top{ 0 };
+            alignas(64) AZStd::atomic<AZ::s64> m_bottom{ 0 };
+            AZStd::atomic<Buffer*> m_buffer;
+            AZStd::vector<Buffer*> m_retiredBuffers; // only accessed by the owner
         };
 
         /**
@@ -72,7 +117,9 @@ namespace AZ
             void ClearStats();
             void PrintStats();
 
-            void CollectGarbage() {}
+            void CollectGarbage() {} // the deques release the buffers they outgrew when they are destroyed
+
+            JobManagerWorkerStats GetWorkerStats(AZ::u32 workerId) const;
 
             Job* GetCurrentJob() const;
 
@@ -81,6 +128,7 @@ namespace AZ
             AZ::u32 GetWorkerThreadId() const;
 
         private:
+            static const AZ::u32 InvalidCacheGroup = ~0u;
 
             void ActivateWorker();
 
@@ -99,6 +147,14 @@ namespace AZ
                 AZStd::binary_semaphore m_waitEvent;
                 WorkQueue m_pendingJobs;
                 unsigned int m_workerId = JobManagerBase::InvalidWorkerThreadId;
+                AZStd::vector<WorkQueue*> m_stealOrder; // queues of the other workers, the ones sharing a cache with this one first
+                unsigned int m_numNearbyVictims = 0; // number of queues at the start of m_stealOrder that share a cache with this worker
+
+                // only written by the worker itself
+                AZStd::atomic<AZ::u64> m_jobsStolenCount{0};
+                AZStd::atomic<AZ::u64> m_failedStealCount{0};
+                AZStd::atomic<AZ::u64> m_idleCount{0};
+                AZStd::atomic<AZStd::sys_time_t> m_idleTime{0};
 
 #ifdef JOBMANAGER_ENABLE_STATS
                 unsigned int m_globalJobs = 0;
@@ -116,6 +172,8 @@ namespace AZ
             void ProcessJobsSynchronous(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag);
             void ProcessJobsInternal(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag);
             ThreadList CreateWorkerThreads(const JobManagerDesc& jmDesc);
+            void BuildStealOrders(const ThreadList& workerThreads, const AZStd::vector<AZ::u32>& workerCacheGroups);
+            static void IncrementCounter(AZStd::atomic<AZ::u64>& counter);
 #ifndef AZ_MONOLITHIC_BUILD
             ThreadInfo* CrossModuleFindAndSetWorkerThreadInfo() const;
 #endif
@@ -59,6 +59,8 @@ namespace AZ
          * priority is used to sort jobs such that higher priority jobs are run before lower priority ones.
          *          The valid range is -128 (lowest priority) to 127 (highest priority), the default is 0,
          *          and jobs with equal priority values will be run in the same order as added to the queue.
+         *          The exception are jobs with the default priority started from a worker thread, which go to that worker's
+         *          own queue. The worker runs the most recently added of those first, other workers steal the oldest.
          */
         Job(bool isAutoDelete, JobContext* context, bool isCompletion = false, AZ::s8 priority = 0);
 
@@ -77,6 +77,12 @@ namespace AZ
         /// Returns 0 based worker index (for legacy Job compatibility)
         AZ::u32 GetWorkerThreadId() const { return m_impl.GetWorkerThreadId(); }
 
+        /**
+         * Returns the steal and idle counters of a worker thread, workerId must be less than GetNumWorkerThreads().
+         * The counters are always gathered and are reset by ClearStats.
+         */
+        JobManagerWorkerStats GetWorkerStats(AZ::u32 workerId) const { return m_impl.GetWorkerStats(workerId); }
+
     private:
         //non-copyable
         JobManager(const JobManager& manager);
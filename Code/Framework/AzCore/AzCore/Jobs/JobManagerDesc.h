@@ -55,5 +55,13 @@ namespace AZ
 
         using DescList = AZStd::fixed_vector<JobManagerThreadDesc, 64>;
         DescList m_workerThreads; ///< List of worker threads to create
+
+        /**
+         *  Pins each worker thread which doesn't specify a CPU id to a logical processor of its own. The processors that
+         *  share a last level cache (a core complex or a socket) are filled up before moving on to the next group, so that
+         *  workers stealing from each other stay close together.
+         *  Only supported on platforms where \ref JobManagerThreadDesc::m_cpuId is a core number, ignored on the others.
+         */
+        bool m_pinWorkerThreads = false;
     };
 }
@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/BatchMath.h>
+
+namespace AZ
+{
+    namespace BatchMath
+    {
+        namespace
+        {
+            using Vec4 = Simd::Vec4;
+            using FloatType = Simd::Vec4::FloatType;
+
+            AZ_MATH_INLINE FloatType Cross0(FloatType ay, FloatType az, FloatType by, FloatType bz)
+            {
+                return Vec4::Sub(Vec4::Mul(ay, bz), Vec4::Mul(az, by));
+            }
+
+            // Rotates a vector by a quaternion, using v' = v + w * t + cross(q, t) with t = 2 * cross(q, v)
+            AZ_MATH_INLINE void Rotate(
+                FloatType qx, FloatType qy, FloatType qz, FloatType qw,
+                FloatType vx, FloatType vy, FloatType vz,
+                FloatType& outX, FloatType& outY, FloatType& outZ)
+            {
+                const FloatType two = Vec4::Splat(2.0f);
+                const FloatType tx = Vec4::Mul(two, Cross0(qy, qz, vy, vz));
+                const FloatType ty = Vec4::Mul(two, Cross0(qz, qx, vz, vx));
+                const FloatType tz = Vec4::Mul(two, Cross0(qx, qy, vx, vy));
+                outX = Vec4::Add(Vec4::Madd(qw, tx, vx), Cross0(qy, qz, ty, tz));
+                outY = Vec4::Add(Vec4::Madd(qw, ty, vy), Cross0(qz, qx, tz, tx));
+                outZ = Vec4::Add(Vec4::Madd(qw, tz, vz), Cross0(qx, qy, tx, ty));
+            }
+
+            // All bits set for the lanes of the lane group that hold an element of a set of the given size, clear for the padding
+            AZ_MATH_INLINE FloatType CreateValidLaneMask(size_t laneGroup, size_t size)
+            {
+                const Vec4::Int32Type laneIndices = Vec4::Add(Vec4::LoadImmediate(0, 1, 2, 3), Vec4::Splat(static_cast<int32_t>(laneGroup * SoaLaneCount)));
+                return Vec4::CastToFloat(Vec4::CmpLt(laneIndices, Vec4::Splat(static_cast<int32_t>(size))));
+            }
+
+            AZ_MATH_INLINE float ReduceMin(FloatType value)
+            {
+                return AZStd::min(AZStd::min(Vec4::SelectFirst(value), Vec4::SelectSecond(value)), AZStd::min(Vec4::SelectThird(value), Vec4::SelectFourth(value)));
+            }
+
+            AZ_MATH_INLINE float ReduceMax(FloatType value)
+            {
+                return AZStd::max(AZStd::max(Vec4::SelectFirst(value), Vec4::SelectSecond(value)), AZStd::max(Vec4::SelectThird(value), Vec4::SelectFourth(value)));
+            }
+
+            Aabb GetAabbInternal(const Vector3Soa& minimums, const Vector3Soa& maximums)
+            {
+                const size_t size = minimums.GetSize();
+                if (size == 0)
+                {
+                    return Aabb::CreateNull();
+                }
+
+                const FloatType* minX = minimums.GetX().GetLaneGroups();
+                const FloatType* minY = minimums.GetY().GetLaneGroups();
+                const FloatType* minZ = minimums.GetZ().GetLaneGroups();
+                const FloatType* maxX = maximums.GetX().GetLaneGroups();
+                const FloatType* maxY = maximums.GetY().GetLaneGroups();
+                const FloatType* maxZ = maximums.GetZ().GetLaneGroups();
+
+                // Every lane group but the last is full, the padding of the last one is replaced by its first element which is always valid
+                const size_t lastLaneGroup = minimums.GetX().GetLaneGroupCount() - 1;
+                const FloatType validLanes = CreateValidLaneMask(lastLaneGroup, size);
+                FloatType resultMinX = Vec4::Select(minX[lastLaneGroup], Vec4::SplatFirst(minX[lastLaneGroup]), validLanes);
+                FloatType resultMinY = Vec4::Select(minY[lastLaneGroup], Vec4::SplatFirst(minY[lastLaneGroup]), validLanes);
+                FloatType resultMinZ = Vec4::Select(minZ[lastLaneGroup], Vec4::SplatFirst(minZ[lastLaneGroup]), validLanes);
+                FloatType resultMaxX = Vec4::Select(maxX[lastLaneGroup], Vec4::SplatFirst(maxX[lastLaneGroup]), validLanes);
+                FloatType resultMaxY = Vec4::Select(maxY[lastLaneGroup], Vec4::SplatFirst(maxY[lastLaneGroup]), validLanes);
+                FloatType resultMaxZ = Vec4::Select(maxZ[lastLaneGroup], Vec4::SplatFirst(maxZ[lastLaneGroup]), validLanes);
+
+                for (size_t i = 0; i < lastLaneGroup; ++i)
+                {
+                    resultMinX = Vec4::Min(resultMinX, minX[i]);
+                    resultMinY = Vec4::Min(resultMinY, minY[i]);
+                    resultMinZ = Vec4::Min(resultMinZ, minZ[i]);
+                    resultMaxX = Vec4::Max(resultMaxX, maxX[i]);
+                    resultMaxY = Vec4::Max(resultMaxY, maxY[i]);
+                    resultMaxZ = Vec4::Max(resultMaxZ, maxZ[i]);
+                }
+
+                return Aabb::CreateFromMinMax(
+                    Vector3(ReduceMin(resultMinX), ReduceMin(resultMinY), ReduceMin(resultMinZ)),
+                    Vector3(ReduceMax(resultMaxX), ReduceMax(resultMaxY), ReduceMax(resultMaxZ)));
+            }
+
+            // Negates to where from and to are more than 90 degrees apart, the same way Quaternion::Lerp picks the shortest path
+            AZ_MATH_INLINE void TakeShortestPath(
+                FloatType ax, FloatType ay, FloatType az, FloatType aw,
+                FloatType& bx, FloatType& by, FloatType& bz, FloatType& bw)
+            {
+                const FloatType dot = Vec4::Madd(aw, bw, Vec4::Madd(az, bz, Vec4::Madd(ay, by, Vec4::Mul(ax, bx))));
+                const FloatType positive = Vec4::CmpGtEq(dot, Vec4::ZeroFloat());
+                bx = Vec4::Select(bx, Vec4::Sub(Vec4::ZeroFloat(), bx), positive);
+                by = Vec4::Select(by, Vec4::Sub(Vec4::ZeroFloat(), by), positive);
+                bz = Vec4::Select(bz, Vec4::Sub(Vec4::ZeroFloat(), bz), positive);
+                bw = Vec4::Select(bw, Vec4::Sub(Vec4::ZeroFloat(), bw), positive);
+            }
+
+            template <bool Normalize>
+            void LerpInternal(const QuaternionSoa& from, const QuaternionSoa& to, const FloatSoa& t, QuaternionSoa& out)
+            {
+                AZ_MATH_ASSERT(from.GetSize() == to.GetSize() && from.GetSize() == t.GetSize(), "Input sizes don't match");
+                out.Resize(from.GetSize());
+
+                const FloatType* fromX = from.GetX().GetLaneGroups();
+                const FloatType* fromY = from.GetY().GetLaneGroups();
+                const FloatType* fromZ = from.GetZ().GetLaneGroups();
+                const FloatType* fromW = from.GetW().GetLaneGroups();
+                const FloatType* toX = to.GetX().GetLaneGroups();
+                const FloatType* toY = to.GetY().GetLaneGroups();
+                const FloatType* toZ = to.GetZ().GetLaneGroups();
+                const FloatType* toW = to.GetW().GetLaneGroups();
+                const FloatType* weights = t.GetLaneGroups();
+                FloatType* outX = out.GetX().GetLaneGroups();
+                FloatType* outY = out.GetY().GetLaneGroups();
+                FloatType* outZ = out.GetZ().GetLaneGroups();
+                FloatType* outW = out.GetW().GetLaneGroups();
+
+                const FloatType one = Vec4::Splat(1.0f);
+                const size_t laneGroupCount = t.GetLaneGroupCount();
+                for (size_t i = 0; i < laneGroupCount; ++i)
+                {
+                    FloatType bx = toX[i], by = toY[i], bz = toZ[i], bw = toW[i];
+                    TakeShortestPath(fromX[i], fromY[i], fromZ[i], fromW[i], bx, by, bz, bw);
+
+                    const FloatType sclA = Vec4::Sub(one, weights[i]);
+                    FloatType x = Vec4::Madd(fromX[i], sclA, Vec4::Mul(bx, weights[i]));
+                    FloatType y = Vec4::Madd(fromY[i], sclA, Vec4::Mul(by, weights[i]));
+                    FloatType z = Vec4::Madd(fromZ[i], sclA, Vec4::Mul(bz, weights[i]));
+                    FloatType w = Vec4::Madd(fromW[i], sclA, Vec4::Mul(bw, weights[i]));
+                    if constexpr (Normalize)
+                    {
+                        const FloatType lengthInv = Vec4::SqrtInv(Vec4::Madd(w, w, Vec4::Madd(z, z, Vec4::Madd(y, y, Vec4::Mul(x, x)))));
+                        x = Vec4::Mul(x, lengthInv);
+                        y = Vec4::Mul(y, lengthInv);
+                        z = Vec4::Mul(z, lengthInv);
+                        w = Vec4::Mul(w, lengthInv);
+                    }
+                    outX[i] = x;
+                    outY[i] = y;
+                    outZ[i] = z;
+                    outW[i] = w;
+                }
+            }
+        } // namespace
+
+        void TransformPoints(const Matrix3x4& matrix, const Vector3Soa& points, Vector3Soa& out)
+        {
+            out.Resize(points.GetSize());
+
+            const FloatType m00 = Vec4::Splat(matrix.GetElement(0, 0)), m01 = Vec4::Splat(matrix.GetElement(0, 1));
+            const FloatType m02 = Vec4::Splat(matrix.GetElement(0, 2)), m03 = Vec4::Splat(matrix.GetElement(0, 3));
+            const FloatType m10 = Vec4::Splat(matrix.GetElement(1, 0)), m11 = Vec4::Splat(matrix.GetElement(1, 1));
+            const FloatType m12 = Vec4::Splat(matrix.GetElement(1, 2)), m13 = Vec4::Splat(matrix.GetElement(1, 3));
+            const FloatType m20 = Vec4::Splat(matrix.GetElement(2, 0)), m21 = Vec4::Splat(matrix.GetElement(2, 1));
+            const FloatType m22 = Vec4::Splat(matrix.GetElement(2, 2)), m23 = Vec4::Splat(matrix.GetElement(2, 3));
+
+            const FloatType* inX = points.GetX().GetLaneGroups();
+            const FloatType* inY = points.GetY().GetLaneGroups();
+            const FloatType* inZ = points.GetZ().GetLaneGroups();
+            FloatType* outX = out.GetX().GetLaneGroups();
+            FloatType* outY = out.GetY().GetLaneGroups();
+            FloatType* outZ = out.GetZ().GetLaneGroups();
+
+            const size_t laneGroupCount = points.GetX().GetLaneGroupCount();
+            for (size_t i = 0; i < laneGroupCount; ++i)
+            {
+                const FloatType x = inX[i], y = inY[i], z = inZ[i];
+                outX[i] = Vec4::Madd(m02, z, Vec4::Madd(m01, y, Vec4::Madd(m00, x, m03)));
+                outY[i] = Vec4::Madd(m12, z, Vec4::Madd(m11, y, Vec4::Madd(m10, x, m13)));
+                outZ[i] = Vec4::Madd(m22, z, Vec4::Madd(m21, y, Vec4::Madd(m20, x, m23)));
+            }
+        }
+
+        void TransformVectors(const Matrix3x4& matrix, const Vector3Soa& vectors, Vector3Soa& out)
+        {
+            Matrix3x4 rotationAndScale = matrix;
+            rotationAndScale.SetTranslation(Vector3::CreateZero());
+            TransformPoints(rotationAndScale, vectors, out);
+        }
+
+        void TransformPoints(const Transform& transform, const Vector3Soa& points, Vector3Soa& out)
+        {
+            TransformPoints(Matrix3x4::CreateFromTransform(transform), points, out);
+        }
+
+        void TransformVectors(const Transform& transform, const Vector3Soa& vectors, Vector3Soa& out)
+        {
+            Transform rotationAndScale = transform;
+            rotationAndScale.SetTranslation(Vector3::CreateZero());
+            TransformPoints(Matrix3x4::CreateFromTransform(rotationAndScale), vectors, out);
+        }
+
+        void TransformNormals(const Transform& transform, const Vector3Soa& normals, Vector3Soa& out)
+        {
+            TransformPoints(Matrix3x4::CreateFromQuaternion(transform.GetRotation()), normals, out);
+        }
+
+        void TransformPoints(const TransformSoa& transforms, const Vector3Soa& points, Vector3Soa& out)
+        {
+            AZ_MATH_ASSERT(transforms.GetSize() == points.GetSize(), "Input sizes don't match");
+            out.Resize(points.GetSize());
+
+            const QuaternionSoa& rotation = transforms.GetRotation();
+            const FloatType* qx = rotation.GetX().GetLaneGroups();
+            const FloatType* qy = rotation.GetY().GetLaneGroups();
+            const FloatType* qz = rotation.GetZ().GetLaneGroups();
+            const FloatType* qw = rotation.GetW().GetLaneGroups();
+            const FloatType* scale = transforms.GetScale().GetLaneGroups();
+            const FloatType* tx = transforms.GetTranslation().GetX().GetLaneGroups();
+            const FloatType* ty = transforms.GetTranslation().GetY().GetLaneGroups();
+            const FloatType* tz = transforms.GetTranslation().GetZ().GetLaneGroups();
+            const FloatType* inX = points.GetX().GetLaneGroups();
+            const FloatType* inY = points.GetY().GetLaneGroups();
+            const FloatType* inZ = points.GetZ().GetLaneGroups();
+            FloatType* outX = out.GetX().GetLaneGroups();
+            FloatType* outY = out.GetY().GetLaneGroups();
+            FloatType* outZ = out.GetZ().GetLaneGroups();
+
+            const size_t laneGroupCount = points.GetX().GetLaneGroupCount();
+            for (size_t i = 0; i < laneGroupCount; ++i)
+            {
+                FloatType x, y, z;
+                Rotate(qx[i], qy[i], qz[i], qw[i], Vec4::Mul(inX[i], scale[i]), Vec4::Mul(inY[i], scale[i]), Vec4::Mul(inZ[i], scale[i]), x, y, z);
+                outX[i] = Vec4::Add(x, tx[i]);
+                outY[i] = Vec4::Add(y, ty[i]);
+                outZ[i] = Vec4::Add(z, tz[i]);
+            }
+        }
+
+        void Dot(const Vector3Soa& a, const Vector3Soa& b, FloatSoa& out)
+        {
+            AZ_MATH_ASSERT(a.GetSize() == b.GetSize(), "Input sizes don't match");
+            out.Resize(a.GetSize());
+
+            const FloatType* ax = a.GetX().GetLaneGroups();
+            const FloatType* ay = a.GetY().GetLaneGroups();
+            const FloatType* az = a.GetZ().GetLaneGroups();
+            const FloatType* bx = b.GetX().GetLaneGroups();
+            const FloatType* by = b.GetY().GetLaneGroups();
+            const FloatType* bz = b.GetZ().GetLaneGroups();
+            FloatType* result = out.GetLaneGroups();
+
+            const size_t laneGroupCount = a.GetX().GetLaneGroupCount();
+            for (size_t i = 0; i < laneGroupCount; ++i)
+            {
+                result[i] = Vec4::Madd(az[i], bz[i], Vec4::Madd(ay[i], by[i], Vec4::Mul(ax[i], bx[i])));
+            }
+        }
+
+        void Cross(const Vector3Soa& a, const Vector3Soa& b, Vector3Soa& out)
+        {
+            AZ_MATH_ASSERT(a.GetSize() == b.GetSize(), "Input sizes don't match");
+            out.Resize(a.GetSize());
+
+            const FloatType* ax = a.GetX().GetLaneGroups();
+            const FloatType* ay = a.GetY().GetLaneGroups();
+            const FloatType* az = a.GetZ().GetLaneGroups();
+            const FloatType* bx = b.GetX().GetLaneGroups();
+            const FloatType* by = b.GetY().GetLaneGroups();
+            const FloatType* bz = b.GetZ().GetLaneGroups();
+            FloatType* outX = out.GetX().GetLaneGroups();
+            FloatType* outY = out.GetY().GetLaneGroups();
+            FloatType* outZ = out.GetZ().GetLaneGroups();
+
+            const size_t laneGroupCount = a.GetX().GetLaneGroupCount();
+            for (size_t i = 0; i < laneGroupCount; ++i)
+            {
+                const FloatType x = Cross0(ay[i], az[i], by[i], bz[i]);
+                const FloatType y = Cross0(az[i], ax[i], bz[i], bx[i]);
+                const FloatType z = Cross0(ax[i], ay[i], bx[i], by[i]);
+                outX[i] = x;
+                outY[i] = y;
+                outZ[i] = z;
+            }
+        }
+
+        Aabb GetAabb(const Vector3Soa& points)
+        {
+            return GetAabbInternal(points, points);
+        }
+
+        Aabb GetAabbUnion(const Vector3Soa& minimums, const Vector3Soa& maximums)
+        {
+            AZ_MATH_ASSERT(minimums.GetSize() == maximums.GetSize(), "Input sizes don't match");
+            return GetAabbInternal(minimums, maximums);
+        }
+
+        size_t OverlapsFrustum(const Frustum& frustum, const Vector3Soa& centers, const FloatSoa& radii, AZStd::span<bool> out)
+        {
+            AZ_MATH_ASSERT(centers.GetSize() == radii.GetSize(), "Input sizes don't match");
+            AZ_MATH_ASSERT(out.size() >= centers.GetSize(), "Output array is too small");
+
+            FloatType planeX[Frustum::PlaneId::MAX], planeY[Frustum::PlaneId::MAX], planeZ[Frustum::PlaneId::MAX], planeD[Frustum::PlaneId::MAX];
+            for (int32_t planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                const Vector4 plane = frustum.GetPlane(static_cast<Frustum::PlaneId>(planeId)).GetPlaneEquationCoefficients();
+                planeX[planeId] = Vec4::Splat(plane.GetX());
+                planeY[planeId] = Vec4::Splat(plane.GetY());
+                planeZ[planeId] = Vec4::Splat(plane.GetZ());
+                planeD[planeId] = Vec4::Splat(plane.GetW());
+            }
+
+            const FloatType* centerX = centers.GetX().GetLaneGroups();
+            const FloatType* centerY = centers.GetY().GetLaneGroups();
+            const FloatType* centerZ = centers.GetZ().GetLaneGroups();
+            const FloatType* radius = radii.GetLaneGroups();
+
+            const size_t size = centers.GetSize();
+            const size_t laneGroupCount = radii.GetLaneGroupCount();
+            size_t overlapCount = 0;
+            for (size_t i = 0; i < laneGroupCount; ++i)
+            {
+                // A sphere overlaps unless it is fully behind one of the planes
+                FloatType overlaps = Vec4::CastToFloat(Vec4::Splat(-1));
+                for (int32_t planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+                {
+                    const FloatType distance = Vec4::Madd(planeZ[planeId], centerZ[i],
+                        Vec4::Madd(planeY[planeId], centerY[i], Vec4::Madd(planeX[planeId], centerX[i], planeD[planeId])));
+                    overlaps = Vec4::And(overlaps, Vec4::CmpGtEq(Vec4::Add(distance, radius[i]), Vec4::ZeroFloat()));
+                }
+
+                alignas(16) int32_t lanes[SoaLaneCount];
+                Vec4::StoreAligned(lanes, Vec4::CastToInt(overlaps));
+                const size_t laneCount = AZStd::min(SoaLaneCount, size - i * SoaLaneCount);
+                for (size_t lane = 0; lane < laneCount; ++lane)
+                {
+                    out[i * SoaLaneCount + lane] = (lanes[lane] != 0);
+                    overlapCount += (lanes[lane] != 0) ? 1 : 0;
+                }
+            }
+            return overlapCount;
+        }
+
+        void Lerp(const QuaternionSoa& from, const QuaternionSoa& to, const FloatSoa& t, QuaternionSoa& out)
+        {
+            LerpInternal<false>(from, to, t, out);
+        }
+
+        void NLerp(const QuaternionSoa& from, const QuaternionSoa& to, const FloatSoa& t, QuaternionSoa& out)
+        {
+            LerpInternal<true>(from, to, t, out);
+        }
+
+        void Slerp(const QuaternionSoa& from, const QuaternionSoa& to, const FloatSoa& t, QuaternionSoa& out)
+        {
+            AZ_MATH_ASSERT(from.GetSize() == to.GetSize() && from.GetSize() == t.GetSize(), "Input sizes don't match");
+            out.Resize(from.GetSize());
+
+            const FloatType* fromX = from.GetX().GetLaneGroups();
+            const FloatType* fromY = from.GetY().GetLaneGroups();
+            const FloatType* fromZ = from.GetZ().GetLaneGroups();
+            const FloatType* fromW = from.GetW().GetLaneGroups();
+            const FloatType* toX = to.GetX().GetLaneGroups();
+            const FloatType* toY = to.GetY().GetLaneGroups();
+            const FloatType* toZ = to.GetZ().GetLaneGroups();
+            const FloatType* toW = to.GetW().GetLaneGroups();
+            const FloatType* weights = t.GetLaneGroups();
+            FloatType* outX = out.GetX().GetLaneGroups();
+            FloatType* outY = out.GetY().GetLaneGroups();
+            FloatType* outZ = out.GetZ().GetLaneGroups();
+            FloatType* outW = out.GetW().GetLaneGroups();
+
+            const FloatType one = Vec4::Splat(1.0f);
+            const FloatType lerpThreshold = Vec4::Splat(0.9999f);
+            const size_t laneGroupCount = t.GetLaneGroupCount();
+            for (size_t i = 0; i < laneGroupCount; ++i)
+            {
+                const FloatType dot = Vec4::Madd(fromW[i], toW[i], Vec4::Madd(fromZ[i], toZ[i], Vec4::Madd(fromY[i], toY[i], Vec4::Mul(fromX[i], toX[i]))));
+                const FloatType cosom = Vec4::Abs(dot);
+
+                // Same weights as Quaternion::Slerp, falling back to a plain lerp where the quaternions are very close and taking the
+                // shortest path by negating the weight of from
+                const FloatType lerpA = Vec4::Sub(one, weights[i]);
+                const FloatType lerpB = weights[i];
+                const FloatType omega = Vec4::Acos(Vec4::Min(cosom, one));
+                const FloatType sinomInv = Vec4::Reciprocal(Vec4::Sin(omega));
+                const FloatType slerpA = Vec4::Mul(Vec4::Sin(Vec4::Mul(lerpA, omega)), sinomInv);
+                const FloatType slerpB = Vec4::Mul(Vec4::Sin(Vec4::Mul(lerpB, omega)), sinomInv);
+                const FloatType useLerp = Vec4::CmpGtEq(cosom, lerpThreshold);
+                const FloatType positiveSclA = Vec4::Select(lerpA, slerpA, useLerp);
+                const FloatType sclA = Vec4::Select(positiveSclA, Vec4::Sub(Vec4::ZeroFloat(), positiveSclA), Vec4::CmpGtEq(dot, Vec4::ZeroFloat()));
+                const FloatType sclB = Vec4::Select(lerpB, slerpB, useLerp);
+
+                outX[i] = Vec4::Madd(fromX[i], sclA, Vec4::Mul(toX[i], sclB));
+                outY[i] = Vec4::Madd(fromY[i], sclA, Vec4::Mul(toY[i], sclB));
+                outZ[i] = Vec4::Madd(fromZ[i], sclA, Vec4::Mul(toZ[i], sclB));
+                outW[i] = Vec4::Madd(fromW[i], sclA, Vec4::Mul(toW[i], sclB));
+            }
+        }
+    } // namespace BatchMath
+} // namespace AZ
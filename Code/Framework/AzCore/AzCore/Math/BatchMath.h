@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    //! Number of elements the batch math kernels process at once, the structure of arrays containers are padded to a multiple of it.
+    static constexpr size_t SoaLaneCount = static_cast<size_t>(Simd::Vec4::ElementCount);
+
+    //! Structure of arrays storage for a set of floats.
+    //! The values are stored in SIMD aligned memory padded with zeros to a multiple of SoaLaneCount, so kernels always operate on
+    //! full SIMD registers. The padding values are not part of the set and their content is undefined after running a kernel.
+    class FloatSoa
+    {
+    public:
+        FloatSoa() = default;
+        explicit FloatSoa(size_t size);
+        explicit FloatSoa(AZStd::span<const float> values);
+
+        //! Resizes the set, new values are initialized to zero.
+        void Resize(size_t size);
+        size_t GetSize() const;
+
+        void Set(size_t index, float value);
+        float Get(size_t index) const;
+
+        //! Copies the set to the provided array, which must hold at least GetSize() values.
+        void Store(AZStd::span<float> values) const;
+
+        //! Returns the values, readable and writable up to GetLaneGroupCount() * SoaLaneCount elements.
+        float* GetData();
+        const float* GetData() const;
+
+        //! Returns the values one SIMD register at a time.
+        Simd::Vec4::FloatType* GetLaneGroups();
+        const Simd::Vec4::FloatType* GetLaneGroups() const;
+        size_t GetLaneGroupCount() const;
+
+    private:
+        AZStd::vector<Simd::Vec4::FloatType> m_laneGroups;
+        size_t m_size = 0;
+    };
+
+    //! Structure of arrays storage for a set of Vector3s, each component is stored in its own FloatSoa.
+    class Vector3Soa
+    {
+    public:
+        Vector3Soa() = default;
+        explicit Vector3Soa(size_t size);
+        explicit Vector3Soa(AZStd::span<const Vector3> vectors);
+
+        //! Resizes the set, new vectors are initialized to zero.
+        void Resize(size_t size);
+        size_t GetSize() const;
+
+        void Set(size_t index, const Vector3& value);
+        Vector3 Get(size_t index) const;
+
+        //! Copies the set to the provided array, which must hold at least GetSize() vectors.
+        void Store(AZStd::span<Vector3> vectors) const;
+
+        FloatSoa& GetX();
+        FloatSoa& GetY();
+        FloatSoa& GetZ();
+        const FloatSoa& GetX() const;
+        const FloatSoa& GetY() const;
+        const FloatSoa& GetZ() const;
+
+    private:
+        FloatSoa m_x;
+        FloatSoa m_y;
+        FloatSoa m_z;
+    };
+
+    //! Structure of arrays storage for a set of Quaternions, each component is stored in its own FloatSoa.
+    class QuaternionSoa
+    {
+    public:
+        QuaternionSoa() = default;
+        explicit QuaternionSoa(size_t size);
+        explicit QuaternionSoa(AZStd::span<const Quaternion> quaternions);
+
+        //! Resizes the set, new quaternions are initialized to identity.
+        void Resize(size_t size);
+        size_t GetSize() const;
+
+        void Set(size_t index, const Quaternion& value);
+        Quaternion Get(size_t index) const;
+
+        //! Copies the set to the provided array, which must hold at least GetSize() quaternions.
+        void Store(AZStd::span<Quaternion> quaternions) const;
+
+        FloatSoa& GetX();
+        FloatSoa& GetY();
+        FloatSoa& GetZ();
+        FloatSoa& GetW();
+        const FloatSoa& GetX() const;
+        const FloatSoa& GetY() const;
+        const FloatSoa& GetZ() const;
+        const FloatSoa& GetW() const;
+
+    private:
+        FloatSoa m_x;
+        FloatSoa m_y;
+        FloatSoa m_z;
+        FloatSoa m_w;
+    };
+
+    //! Structure of arrays storage for a set of Transforms, split in rotation, uniform scale and translation like Transform itself.
+    class TransformSoa
+    {
+    public:
+        TransformSoa() = default;
+        explicit TransformSoa(size_t size);
+        explicit TransformSoa(AZStd::span<const Transform> transforms);
+
+        //! Resizes the set, new transforms are initialized to identity.
+        void Resize(size_t size);
+        size_t GetSize() const;
+
+        void Set(size_t index, const Transform& value);
+        Transform Get(size_t index) const;
+
+        //! Copies the set to the provided array, which must hold at least GetSize() transforms.
+        void Store(AZStd::span<Transform> transforms) const;
+
+        QuaternionSoa& GetRotation();
+        FloatSoa& GetScale();
+        Vector3Soa& GetTranslation();
+        const QuaternionSoa& GetRotation() const;
+        const FloatSoa& GetScale() const;
+        const Vector3Soa& GetTranslation() const;
+
+    private:
+        QuaternionSoa m_rotation;
+        FloatSoa m_scale;
+        Vector3Soa m_translation;
+    };
+
+    //! Kernels processing structure of arrays sets SoaLaneCount elements at a time, using the Simd::Vec4 backend of the platform.
+    //! Unless stated otherwise, the output set is resized to the size of the input sets, which must all have the same size.
+    //! The output may alias one of the inputs.
+    namespace BatchMath
+    {
+        //! Same as Matrix3x4::TransformPoint for every point.
+        void TransformPoints(const Matrix3x4& matrix, const Vector3Soa& points, Vector3Soa& out);
+
+        //! Same as Matrix3x4::TransformVector for every vector.
+        void TransformVectors(const Matrix3x4& matrix, const Vector3Soa& vectors, Vector3Soa& out);
+
+        //! Same as Transform::TransformPoint for every point.
+        void TransformPoints(const Transform& transform, const Vector3Soa& points, Vector3Soa& out);
+
+        //! Same as Transform::TransformVector for every vector.
+        void TransformVectors(const Transform& transform, const Vector3Soa& vectors, Vector3Soa& out);
+
+        //! Rotates every normal by the rotation of the transform, the uniform scale doesn't change the direction of a normal.
+        void TransformNormals(const Transform& transform, const Vector3Soa& normals, Vector3Soa& out);
+
+        //! Same as transforms[i].TransformPoint(points[i]) for every element.
+        void TransformPoints(const TransformSoa& transforms, const Vector3Soa& points, Vector3Soa& out);
+
+        //! Same as a[i].Dot(b[i]) for every element.
+        void Dot(const Vector3Soa& a, const Vector3Soa& b, FloatSoa& out);
+
+        //! Same as a[i].Cross(b[i]) for every element.
+        void Cross(const Vector3Soa& a, const Vector3Soa& b, Vector3Soa& out);
+
+        //! Returns the smallest Aabb containing all the points, or a null Aabb if there are none.
+        Aabb GetAabb(const Vector3Soa& points);
+
+        //! Returns the union of the Aabbs given by their minimums and maximums, or a null Aabb if there are none.
+        Aabb GetAabbUnion(const Vector3Soa& minimums, const Vector3Soa& maximums);
+
+        //! Same as ShapeIntersection::Overlaps(frustum, Sphere(centers[i], radii[i])) for every sphere.
+        //! @param out must hold at least centers.GetSize() values
+        //! @return the number of spheres overlapping the frustum
+        size_t OverlapsFrustum(const Frustum& frustum, const Vector3Soa& centers, const FloatSoa& radii, AZStd::span<bool> out);
+
+        //! Same as from[i].Lerp(to[i], t[i]) for every element.
+        void Lerp(const QuaternionSoa& from, const QuaternionSoa& to, const FloatSoa& t, QuaternionSoa& out);
+
+        //! Same as from[i].NLerp(to[i], t[i]) for every element.
+        void NLerp(const QuaternionSoa& from, const QuaternionSoa& to, const FloatSoa& t, QuaternionSoa& out);
+
+        //! Same as from[i].Slerp(to[i], t[i]) for every element.
+        void Slerp(const QuaternionSoa& from, const QuaternionSoa& to, const FloatSoa& t, QuaternionSoa& out);
+    } // namespace BatchMath
+} // namespace AZ
+
+#include <AzCore/Math/BatchMath.inl>
@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AZ
+{
+    AZ_MATH_INLINE FloatSoa::FloatSoa(size_t size)
+    {
+        Resize(size);
+    }
+
+    AZ_MATH_INLINE FloatSoa::FloatSoa(AZStd::span<const float> values)
+    {
+        Resize(values.size());
+        memcpy(GetData(), values.data(), values.size() * sizeof(float));
+    }
+
+    AZ_MATH_INLINE void FloatSoa::Resize(size_t size)
+    {
+        const size_t oldSize = m_size;
+        const size_t oldPaddedSize = m_laneGroups.size() * SoaLaneCount;
+        m_laneGroups.resize((size + SoaLaneCount - 1) / SoaLaneCount, Simd::Vec4::ZeroFloat());
+        m_size = size;
+
+        // The padding of the old last lane group may hold leftovers from kernels writing full lane groups
+        for (size_t i = oldSize; i < AZStd::min(size, oldPaddedSize); ++i)
+        {
+            GetData()[i] = 0.0f;
+        }
+    }
+
+    AZ_MATH_INLINE size_t FloatSoa::GetSize() const
+    {
+        return m_size;
+    }
+
+    AZ_MATH_INLINE void FloatSoa::Set(size_t index, float value)
+    {
+        AZ_MATH_ASSERT(index < m_size, "Index %zu out of range", index);
+        GetData()[index] = value;
+    }
+
+    AZ_MATH_INLINE float FloatSoa::Get(size_t index) const
+    {
+        AZ_MATH_ASSERT(index < m_size, "Index %zu out of range", index);
+        return GetData()[index];
+    }
+
+    AZ_MATH_INLINE void FloatSoa::Store(AZStd::span<float> values) const
+    {
+        AZ_MATH_ASSERT(values.size() >= m_size, "Output array is too small");
+        memcpy(values.data(), GetData(), m_size * sizeof(float));
+    }
+
+    AZ_MATH_INLINE float* FloatSoa::GetData()
+    {
+        return reinterpret_cast<float*>(m_laneGroups.data());
+    }
+
+    AZ_MATH_INLINE const float* FloatSoa::GetData() const
+    {
+        return reinterpret_cast<const float*>(m_laneGroups.data());
+    }
+
+    AZ_MATH_INLINE Simd::Vec4::FloatType* FloatSoa::GetLaneGroups()
+    {
+        return m_laneGroups.data();
+    }
+
+    AZ_MATH_INLINE const Simd::Vec4::FloatType* FloatSoa::GetLaneGroups() const
+    {
+        return m_laneGroups.data();
+    }
+
+    AZ_MATH_INLINE size_t FloatSoa::GetLaneGroupCount() const
+    {
+        return m_laneGroups.size();
+    }
+
+
+    AZ_MATH_INLINE Vector3Soa::Vector3Soa(size_t size)
+    {
+        Resize(size);
+    }
+
+    AZ_MATH_INLINE Vector3Soa::Vector3Soa(AZStd::span<const Vector3> vectors)
+    {
+        Resize(vectors.size());
+        for (size_t i = 0; i < vectors.size(); ++i)
+        {
+            Set(i, vectors[i]);
+        }
+    }
+
+    AZ_MATH_INLINE void Vector3Soa::Resize(size_t size)
+    {
+        m_x.Resize(size);
+        m_y.Resize(size);
+        m_z.Resize(size);
+    }
+
+    AZ_MATH_INLINE size_t Vector3Soa::GetSize() const
+    {
+        return m_x.GetSize();
+    }
+
+    AZ_MATH_INLINE void Vector3Soa::Set(size_t index, const Vector3& value)
+    {
+        m_x.Set(index, value.GetX());
+        m_y.Set(index, value.GetY());
+        m_z.Set(index, value.GetZ());
+    }
+
+    AZ_MATH_INLINE Vector3 Vector3Soa::Get(size_t index) const
+    {
+        return Vector3(m_x.Get(index), m_y.Get(index), m_z.Get(index));
+    }
+
+    AZ_MATH_INLINE void Vector3Soa::Store(AZStd::span<Vector3> vectors) const
+    {
+        AZ_MATH_ASSERT(vectors.size() >= GetSize(), "Output array is too small");
+        for (size_t i = 0; i < GetSize(); ++i)
+        {
+            vectors[i] = Get(i);
+        }
+    }
+
+    AZ_MATH_INLINE FloatSoa& Vector3Soa::GetX()
+    {
+        return m_x;
+    }
+
+    AZ_MATH_INLINE FloatSoa& Vector3Soa::GetY()
+    {
+        return m_y;
+    }
+
+    AZ_MATH_INLINE FloatSoa& Vector3Soa::GetZ()
+    {
+        return m_z;
+    }
+
+    AZ_MATH_INLINE const FloatSoa& Vector3Soa::GetX() const
+    {
+        return m_x;
+    }
+
+    AZ_MATH_INLINE const FloatSoa& Vector3Soa::GetY() const
+    {
+        return m_y;
+    }
+
+    AZ_MATH_INLINE const FloatSoa& Vector3Soa::GetZ() const
+    {
+        return m_z;
+    }
+
+
+    AZ_MATH_INLINE QuaternionSoa::QuaternionSoa(size_t size)
+    {
+        Resize(size);
+    }
+
+    AZ_MATH_INLINE QuaternionSoa::QuaternionSoa(AZStd::span<const Quaternion> quaternions)
+    {
+        Resize(quaternions.size());
+        for (size_t i = 0; i < quaternions.size(); ++i)
+        {
+            Set(i, quaternions[i]);
+        }
+    }
+
+    AZ_MATH_INLINE void QuaternionSoa::Resize(size_t size)
+    {
+        const size_t oldSize = GetSize();
+        m_x.Resize(size);
+        m_y.Resize(size);
+        m_z.Resize(size);
+        m_w.Resize(size);
+        for (size_t i = oldSize; i < size; ++i)
+        {
+            m_w.Set(i, 1.0f);
+        }
+    }
+
+    AZ_MATH_INLINE size_t QuaternionSoa::GetSize() const
+    {
+        return m_x.GetSize();
+    }
+
+    AZ_MATH_INLINE void QuaternionSoa::Set(size_t index, const Quaternion& value)
+    {
+        m_x.Set(index, value.GetX());
+        m_y.Set(index, value.GetY());
+        m_z.Set(index, value.GetZ());
+        m_w.Set(index, value.GetW());
+    }
+
+    AZ_MATH_INLINE Quaternion QuaternionSoa::Get(size_t index) const
+    {
+        return Quaternion(m_x.Get(index), m_y.Get(index), m_z.Get(index), m_w.Get(index));
+    }
+
+    AZ_MATH_INLINE void QuaternionSoa::Store(AZStd::span<Quaternion> quaternions) const
+    {
+        AZ_MATH_ASSERT(quaternions.size() >= GetSize(), "Output array is too small");
+        for (size_t i = 0; i < GetSize(); ++i)
+        {
+            quaternions[i] = Get(i);
+        }
+    }
+
+    AZ_MATH_INLINE FloatSoa& QuaternionSoa::GetX()
+    {
+        return m_x;
+    }
+
+    AZ_MATH_INLINE FloatSoa& QuaternionSoa::GetY()
+    {
+        return m_y;
+    }
+
+    AZ_MATH_INLINE FloatSoa& QuaternionSoa::GetZ()
+    {
+        return m_z;
+    }
+
+    AZ_MATH_INLINE FloatSoa& QuaternionSoa::GetW()
+    {
+        return m_w;
+    }
+
+    AZ_MATH_INLINE const FloatSoa& QuaternionSoa::GetX() const
+    {
+        return m_x;
+    }
+
+    AZ_MATH_INLINE const FloatSoa& QuaternionSoa::GetY() const
+    {
+        return m_y;
+    }
+
+    AZ_MATH_INLINE const FloatSoa& QuaternionSoa::GetZ() const
+    {
+        return m_z;
+    }
+
+    AZ_MATH_INLINE const FloatSoa& QuaternionSoa::GetW() const
+    {
+        return m_w;
+    }
+
+
+    AZ_MATH_INLINE TransformSoa::TransformSoa(size_t size)
+    {
+        Resize(size);
+    }
+
+    AZ_MATH_INLINE TransformSoa::TransformSoa(AZStd::span<const Transform> transforms)
+    {
+        Resize(transforms.size());
+        for (size_t i = 0; i < transforms.size(); ++i)
+        {
+            Set(i, transforms[i]);
+        }
+    }
+
+    AZ_MATH_INLINE void TransformSoa::Resize(size_t size)
+    {
+        const size_t oldSize = GetSize();
+        m_rotation.Resize(size);
+        m_scale.Resize(size);
+        m_translation.Resize(size);
+        for (size_t i = oldSize; i < size; ++i)
+        {
+            m_scale.Set(i, 1.0f);
+        }
+    }
+
+    AZ_MATH_INLINE size_t TransformSoa::GetSize() const
+    {
+        return m_scale.GetSize();
+    }
+
+    AZ_MATH_INLINE void TransformSoa::Set(size_t index, const Transform& value)
+    {
+        m_rotation.Set(index, value.GetRotation());
+        m_scale.Set(index, value.GetUniformScale());
+        m_translation.Set(index, value.GetTranslation());
+    }
+
+    AZ_MATH_INLINE Transform TransformSoa::Get(size_t index) const
+    {
+        return Transform(m_translation.Get(index), m_rotation.Get(index), m_scale.Get(index));
+    }
+
+    AZ_MATH_INLINE void TransformSoa::Store(AZStd::span<Transform> transforms) const
+    {
+        AZ_MATH_ASSERT(transforms.size() >= GetSize(), "Output array is too small");
+        for (size_t i = 0; i < GetSize(); ++i)
+        {
+            transforms[i] = Get(i);
+        }
+    }
+
+    AZ_MATH_INLINE QuaternionSoa& TransformSoa::GetRotation()
+    {
+        return m_rotation;
+    }
+
+    AZ_MATH_INLINE FloatSoa& TransformSoa::GetScale()
+    {
+        return m_scale;
+    }
+
+    AZ_MATH_INLINE Vector3Soa& TransformSoa::GetTranslation()
+    {
+        return m_translation;
+    }
+
+    AZ_MATH_INLINE const QuaternionSoa& TransformSoa::GetRotation() const
+    {
+        return m_rotation;
+    }
+
+    AZ_MATH_INLINE const FloatSoa& TransformSoa::GetScale() const
+    {
+        return m_scale;
+    }
+
+    AZ_MATH_INLINE const Vector3Soa& TransformSoa::GetTranslation() const
+    {
+        return m_translation;
+    }
+} // namespace AZ
@@ -346,7 +346,24 @@ namespace AZ
 
         virtual void PushClosure(lua_State* lua, const char* debugDescription) = 0;
 
+        //! Returns false if this sends an EBus event while the script context doesn't allow it.
+        bool IsCallAllowed(lua_State* lua) const
+        {
+#ifndef _RELEASE
+            if (m_isEBusEvent && !ScriptContext::FromNativeContext(lua)->DebugAreEBusEventsAllowed())
+            {
+                AZ_Assert(false, "EBus event %s was sent from Lua while the script context doesn't allow it, for example from OnParallelTick.",
+                    m_method->m_name.c_str());
+                return false;
+            }
+#else
+            AZ_UNUSED(lua);
+#endif // !_RELEASE
+            return true;
+        }
+
         BehaviorMethod* m_method;
+        bool m_isEBusEvent = false;
     };
 
     namespace Internal
@@ -3450,6 +3467,10 @@ LUA_API const Node* lua_getDummyNode()
             static int Call(lua_State* lua)
             {
                 LuaScriptCaller* thisPtr = reinterpret_cast<LuaScriptCaller*>(lua_touserdata(lua, lua_upvalueindex(1)));
+                if (!thisPtr->IsCallAllowed(lua))
+                {
+                    return 0;
+                }
 
                 // check number of arguments
                 int numElementsOnStack = lua_gettop(lua);
@@ -3625,6 +3646,10 @@ LUA_API const Node* lua_getDummyNode()
                 ScriptContext::StackVariableAllocator tempData;
 
                 LuaGenericCaller* thisPtr = reinterpret_cast<LuaGenericCaller*>(lua_touserdata(lua, lua_upvalueindex(1)));
+                if (!thisPtr->IsCallAllowed(lua))
+                {
+                    return 0;
+                }
 
                 int argc = lua_gettop(lua);
                 int luaNumArguments;
@@ -4237,6 +4262,13 @@ LUA_API const Node* lua_getDummyNode()
 
             static int FromLua(lua_State* lua)
             {
+#ifndef _RELEASE
+                if (!ScriptContext::FromNativeContext(lua)->DebugAreEBusEventsAllowed())
+                {
+                    AZ_Assert(false, "EBus QueueFunction was called from Lua while the script context doesn't allow it, for example from OnParallelTick.");
+                    return 0;
+                }
+#endif // !_RELEASE
                 int numArguments = lua_gettop(lua);
 
                 // cache the function and all parameter for a later call
@@ -4625,7 +4657,7 @@ LUA_API const Node* lua_getDummyNode()
                 return binder;
             }
 
-            void BindMethodOnStack(BehaviorContext* behaviorContext, BehaviorMethod* method)
+            void BindMethodOnStack(BehaviorContext* behaviorContext, BehaviorMethod* method, bool isEBusEvent = false)
             {
                 LSV_BEGIN(m_lua, 1);
 
@@ -4643,6 +4675,7 @@ LUA_API const Node* lua_getDummyNode()
                 }
 
                 LuaCaller* binder = CreateLuaCaller(behaviorContext, method);
+                binder->m_isEBusEvent = isEBusEvent;
                 if (method->m_debugDescription)
                 {
                     binder->PushClosure(m_lua, method->m_debugDescription);
@@ -5268,7 +5301,7 @@ LUA_API const Node* lua_getDummyNode()
                                 continue; // skip this event
                             }
                             lua_pushstring(m_lua, ValidateName(eventIt.first.c_str())); // push even name
-                            BindMethodOnStack(m_context, eventSender.m_broadcast);
+                            BindMethodOnStack(m_context, eventSender.m_broadcast, true);
                             lua_rawset(m_lua, -3); // push the event in the broadcast table
                             isTableUsed = true;
                         }
@@ -5299,7 +5332,7 @@ LUA_API const Node* lua_getDummyNode()
                             continue; // skip this event
                         }
                         lua_pushstring(m_lua, ValidateName(eventIt.first.c_str())); // push even name
-                        BindMethodOnStack(m_context, eventSender.m_event);
+                        BindMethodOnStack(m_context, eventSender.m_event, true);
                         lua_rawset(m_lua, -3); // push the event in the event table
                         isTableUsed = true;
                     }
@@ -5332,7 +5365,7 @@ LUA_API const Node* lua_getDummyNode()
                                 continue; // skip this event
                             }
                             lua_pushstring(m_lua, ValidateName(eventIt.first.c_str())); // push even name
-                            BindMethodOnStack(m_context, eventSender.m_queueBroadcast);
+                            BindMethodOnStack(m_context, eventSender.m_queueBroadcast, true);
                             lua_rawset(m_lua, -3); // push the event in the queue broadcast table
                             isTableUsed = true;
                         }
@@ -5363,7 +5396,7 @@ LUA_API const Node* lua_getDummyNode()
                             continue; // skip this event
                         }
                         lua_pushstring(m_lua, ValidateName(eventIt.first.c_str())); // push even name
-                        BindMethodOnStack(m_context, eventSender.m_queueEvent);
+                        BindMethodOnStack(m_context, eventSender.m_queueEvent, true);
                         lua_rawset(m_lua, -3); // push the event in the queue event table
                         isTableUsed = true;
                     }
@@ -5826,6 +5859,7 @@ LUA_API const Node* lua_getDummyNode()
             ScriptTypeFactory                   m_scriptPropertyTableFactory;
             AllocatorWrapper<Internal::LuaSystemAllocator> m_luaAllocator;
             AZStd::thread::id m_ownerThreadId; // Check if Lua methods (including EBus handlers) are called from background threads.
+            bool m_ebusEventsAllowed = true; // Check if Lua sends EBus events while the context runs on a background thread.
         };
 
     ScriptContext::ScriptContext(ScriptContextId id, IAllocatorAllocate* allocator, lua_State* nativeContext)
@@ -6085,6 +6119,21 @@ LUA_API const Node* lua_getDummyNode()
         return m_impl->m_ownerThreadId == AZStd::this_thread::get_id();
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    void ScriptContext::DebugSetEBusEventsAllowed(bool allowed)
+    {
+        AZ_UNUSED(allowed);
+#ifndef _RELEASE
+        m_impl->m_ebusEventsAllowed = allowed;
+#endif // !_RELEASE
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    bool ScriptContext::DebugAreEBusEventsAllowed() const
+    {
+        return m_impl->m_ebusEventsAllowed;
+    }
+
     //////////////////////////////////////////////////////////////////////////
     void ScriptContext::SetErrorHook(ErrorHook cb)
     {
@@ -913,6 +913,17 @@ namespace AZ
         */        
         bool DebugIsCallingThreadTheOwner() const;                 
 
+        /**
+         * Allows or disallows sending EBus events from Lua in this context, sending one while it's disallowed asserts and skips the event.
+         * Use this while the context runs scripts on another thread, which may only touch their own context. Has no effect in release builds.
+         */
+        void DebugSetEBusEventsAllowed(bool allowed);
+
+        /**
+         * Returns false while sending EBus events from Lua in this context is disallowed.
+         */
+        bool DebugAreEBusEventsAllowed() const;
+
         void SetErrorHook(ErrorHook cb);
         ErrorHook GetErrorHook() const;
 
@@ -14,6 +14,7 @@
 #include <AzCore/Serialization/Json/JsonMerger.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/JsonSerializer.h>
+#include <AzCore/Serialization/Json/JsonStreamingDeserializer.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/std/sort.h>
@@ -246,6 +247,38 @@ namespace AZ
         return result;
     }
 
+    JsonSerializationResult::ResultCode JsonSerialization::LoadFromString(
+        void* object, const Uuid& objectType, AZStd::string_view jsonText, const JsonDeserializerSettings& settings)
+    {
+        // Explicitly make a copy to call the correct overloaded version and avoid infinite recursion on this function.
+        JsonDeserializerSettings settingsCopy{settings};
+        return LoadFromString(object, objectType, jsonText, settingsCopy);
+    }
+
+    JsonSerializationResult::ResultCode JsonSerialization::LoadFromString(
+        void* object, const Uuid& objectType, AZStd::string_view jsonText, JsonDeserializerSettings& settings)
+    {
+        using namespace JsonSerializationResult;
+
+        AZStd::string scratchBuffer;
+        auto issueReportingCallback = [&scratchBuffer](AZStd::string_view message, ResultCode result, AZStd::string_view target) -> ResultCode
+        {
+            return JsonSerialization::DefaultIssueReporter(scratchBuffer, message, result, target);
+        };
+        if (!settings.m_reporting)
+        {
+            settings.m_reporting = issueReportingCallback;
+        }
+
+        ResultCode result = JsonSerializationInternal::GetContexts(settings, settings.m_serializeContext, settings.m_registrationContext);
+        if (result.GetOutcome() == Outcomes::Success)
+        {
+            JsonDeserializerContext context(settings);
+            result = JsonStreamingDeserializer::Load(object, objectType, jsonText, context);
+        }
+        return result;
+    }
+
     JsonSerializationResult::ResultCode JsonSerialization::LoadTypeId(
         Uuid& typeId, const rapidjson::Value& input, const Uuid* baseClassTypeId, AZStd::string_view jsonPath,
         const JsonDeserializerSettings& settings)
@@ -156,6 +156,43 @@ namespace AZ
         static JsonSerializationResult::ResultCode Load(
             void* object, const Uuid& objectType, const rapidjson::Value& root, JsonDeserializerSettings& settings);
 
+        //! Loads the data from the provided json text into the supplied object while the text is being parsed. This avoids first
+        //! parsing the full text into a rapidjson::Document, which keeps the memory needed for loading large files low.
+        //! The object is expected to be created before calling load.
+        //! Note: Pointer objects are loaded as they're read if their "$type" field comes first, which is where it's stored by the
+        //!     Json Serializer. Otherwise the object may be buffered first. If the text can't be parsed the object may be left
+        //!     partially loaded.
+        //! @param object Object where the data will be loaded into.
+        //! @param jsonText The json text the deserializer will read data from.
+        //! @param settings Optional additional settings to control the way document is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode LoadFromString(
+            T& object, AZStd::string_view jsonText, const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the data from the provided json text into the supplied object while the text is being parsed.
+        //! See the other LoadFromString functions for details.
+        //! @param object Object where the data will be loaded into.
+        //! @param jsonText The json text the deserializer will read data from.
+        //! @param settings Additional settings to control the way document is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode LoadFromString(T& object, AZStd::string_view jsonText, JsonDeserializerSettings& settings);
+        //! Loads the data from the provided json text into the supplied object while the text is being parsed.
+        //! See the other LoadFromString functions for details.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param jsonText The json text the deserializer will read data from.
+        //! @param settings Optional additional settings to control the way document is deserialized.
+        static JsonSerializationResult::ResultCode LoadFromString(
+            void* object, const Uuid& objectType, AZStd::string_view jsonText,
+            const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the data from the provided json text into the supplied object while the text is being parsed.
+        //! See the other LoadFromString functions for details.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param jsonText The json text the deserializer will read data from.
+        //! @param settings Additional settings to control the way document is deserialized.
+        static JsonSerializationResult::ResultCode LoadFromString(
+            void* object, const Uuid& objectType, AZStd::string_view jsonText, JsonDeserializerSettings& settings);
+
         //! Loads the type id from the provided input.
         //! Note: it's not recommended to use this function (frequently) as it requires users of the json file to have knowledge of the internal
         //!     type structure and is therefore harder to use.
@@ -331,6 +368,20 @@ namespace AZ
         return Load(&object, azrtti_typeid(object), root, settings);
     }
 
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::LoadFromString(
+        T& object, AZStd::string_view jsonText, const JsonDeserializerSettings& settings)
+    {
+        return LoadFromString(&object, azrtti_typeid(object), jsonText, settings);
+    }
+
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::LoadFromString(
+        T& object, AZStd::string_view jsonText, JsonDeserializerSettings& settings)
+    {
+        return LoadFromString(&object, azrtti_typeid(object), jsonText, settings);
+    }
+
     template<typename T>
     JsonSerializationResult::ResultCode JsonSerialization::Store(
         rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator, const T& object, const JsonSerializerSettings& settings)
@@ -0,0 +1,1023 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/JSON/error/en.h>
+#include <AzCore/JSON/error/error.h>
+#include <AzCore/JSON/memorystream.h>
+#include <AzCore/JSON/reader.h>
+#include <AzCore/Serialization/Json/BaseJsonSerializer.h>
+#include <AzCore/Serialization/Json/BasicContainerSerializer.h>
+#include <AzCore/Serialization/Json/JsonDeserializer.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/JsonStreamingDeserializer.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    namespace JsonStreamingDeserializerInternal
+    {
+        //! Collected values are stored in a memory pool that's only cleared once it grows beyond this size, so collecting many
+        //! small values, such as vectors or strings handled by custom serializers, doesn't allocate a new memory chunk each time.
+        static constexpr size_t MaxRetainedCaptureMemory = 64 * 1024;
+        //! The amount of memory the fields of a pointer object can use while looking for a "$type" that isn't the first field.
+        //! Once exceeded the object is collected as a whole instead.
+        static constexpr size_t MaxPointerLookaheadMemory = 16 * 1024;
+    }
+
+    JsonStreamingDeserializer::Frame::Frame(FrameType type)
+        : m_type(type)
+    {
+    }
+
+    JsonStreamingDeserializer::JsonStreamingDeserializer(JsonDeserializerContext& context)
+        : m_context(context)
+        , m_captureWriter(m_capturedValue, m_captureAllocator)
+        , m_lookaheadWriter(m_lookaheadValue, m_lookaheadAllocator)
+    {
+        m_frames.reserve(32);
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::Load(void* object, const Uuid& typeId, AZStd::string_view jsonText,
+        JsonDeserializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        if (!object)
+        {
+            return context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+                "Target object for Json Serialization is pointing to nothing during loading.");
+        }
+
+        JsonStreamingDeserializer deserializer(context);
+        deserializer.m_target.m_address = object;
+        deserializer.m_target.m_typeId = typeId;
+
+        rapidjson::Reader reader;
+        Dom::Json::RapidJsonReadHandler handler(&deserializer, Dom::Lifetime::Temporary);
+        rapidjson::MemoryStream stream(jsonText.data(), jsonText.size());
+        reader.Parse<rapidjson::kParseCommentsFlag>(stream, handler);
+
+        // If loading was halted the parser was stopped on purpose and the reason has already been reported.
+        if (reader.HasParseError() && !deserializer.IsHalted())
+        {
+            size_t lineNumber = 1;
+            const size_t errorOffset = reader.GetErrorOffset();
+            for (size_t searchOffset = jsonText.find('\n');
+                searchOffset < errorOffset && searchOffset < AZStd::string_view::npos;
+                searchOffset = jsonText.find('\n', searchOffset + 1))
+            {
+                lineNumber++;
+            }
+
+            ResultCode result = context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+                AZStd::string::format("JSON parse error at line %zu: %s", lineNumber, rapidjson::GetParseError_En(reader.GetParseErrorCode())));
+            deserializer.Unwind();
+            return result;
+        }
+        return deserializer.m_result;
+    }
+
+    Dom::VisitorFlags JsonStreamingDeserializer::GetVisitorFlags() const
+    {
+        return Dom::VisitorFlags::SupportsRawKeys | Dom::VisitorFlags::SupportsArrays | Dom::VisitorFlags::SupportsObjects;
+    }
+
+    template<typename WriteFunction, typename CreateFunction>
+    Dom::Visitor::Result JsonStreamingDeserializer::Scalar(WriteFunction&& write, CreateFunction&& create)
+    {
+        switch (RouteValue())
+        {
+        case ValueRoute::Target:
+            CompleteValue(LoadValue(m_target, create()));
+            break;
+        case ValueRoute::Capture:
+            // Values are only collected for objects and arrays, so a single value never finishes a capture.
+            return write(m_captureWriter);
+        case ValueRoute::Lookahead:
+            return write(m_lookaheadWriter);
+        case ValueRoute::Skip:
+            if (m_frames.back().m_depth == 0)
+            {
+                m_frames.pop_back();
+            }
+            break;
+        }
+        return GetVisitorResult();
+    }
+
+    Dom::Visitor::Result JsonStreamingDeserializer::Null()
+    {
+        return Scalar(
+            [](Visitor& writer) { return writer.Null(); },
+            []() { return rapidjson::Value(); });
+    }
+
+    Dom::Visitor::Result JsonStreamingDeserializer::Bool(bool value)
+    {
+        return Scalar(
+            [value](Visitor& writer) { return writer.Bool(value); },
+            [value]() { return rapidjson::Value(value); });
+    }
+
+    Dom::Visitor::Result JsonStreamingDeserializer::Int64(AZ::s64 value)
+    {
+        return Scalar(
+            [value](Visitor& writer) { return writer.Int64(value); },
+            [value]() { return rapidjson::Value(static_cast<int64_t>(value)); });
+    }
+
+    Dom::Visitor::Result JsonStreamingDeserializer::Uint64(AZ::u64 value)
+    {
+        return Scalar(
+            [value](Visitor& writer) { return writer.Uint64(value); },
+            [value]() { return rapidjson::Value(static_cast<uint64_t>(value)); });
+    }
+
+    Dom::Visitor::Result JsonStreamingDeserializer::Double(double value)
+    {
+        return Scalar(
+            [value](Visitor& writer) { return writer.Double(value); },
+            [value]() { return rapidjson::Value(value); });
+    }
+
+    Dom::Visitor::Result JsonStreamingDeserializer::String(AZStd::string_view value, Dom::Lifetime lifetime)
+    {
+        // The parser keeps strings null-terminated and alive until the callback returns, which is as long as a value that's
+        // loaded directly is used, so they can be referenced instead of copied.
+        rapidjson::Value stringValue(rapidjson::StringRef(value.data(), aznumeric_cast<rapidjson::SizeType>(value.size())));
+
+        if (!m_frames.empty())
+        {
+            const Frame& frame = m_frames.back();
+            if (frame.m_type == FrameType::PendingPointer)
+            {
+                // This is the value of the "$type" field, which is all that's needed to resolve the pointer.
+                ResolvePendingPointer(value);
+                return GetVisitorResult();
+            }
+            if (frame.m_type == FrameType::PointerLookahead && frame.m_hasTypeField)
+            {
+                return ResolvePointerLookahead(value);
+            }
+        }
+
+        return Scalar(
+            [value, lifetime](Visitor& writer) { return writer.String(value, lifetime); },
+            [&stringValue]() { return AZStd::move(stringValue); });
+    }
+
+    Dom::Visitor::Result JsonStreamingDeserializer::StartObject()
+    {
+        switch (RouteValue())
+        {
+        case ValueRoute::Target:
+            BeginObject(m_target);
+            break;
+        case ValueRoute::Capture:
+            ++m_frames.back().m_depth;
+            return m_captureWriter.StartObject();
+        case ValueRoute::Lookahead:
+            ++m_frames.back().m_depth;
+            return m_lookaheadWriter.StartObject();
+        case ValueRoute::Skip:
+            ++m_frames.back().m_depth;
+            break;
+        }
+        return GetVisitorResult();
+    }
+
+    Dom::Visitor::Result JsonStreamingDeserializer::EndObject(AZ::u64 attributeCount)
+    {
+        if (m_frames.back().m_type == FrameType::PendingPointer)
+        {
+            // An empty object, so there's no type information. Leave it to the JsonDeserializer as it has special rules for this.
+            CapturePendingPointer();
+        }
+
+        Frame& frame = m_frames.back();
+        switch (frame.m_type)
+        {
+        case FrameType::Class:
+            CompleteClass();
+            break;
+        case FrameType::Capture:
+        {
+            Result result = m_captureWriter.EndObject(attributeCount);
+            if (!result.IsSuccess())
+            {
+                return result;
+            }
+            if (--frame.m_depth == 0)
+            {
+                CompleteCapture();
+            }
+            break;
+        }
+        case FrameType::PointerLookahead:
+        {
+            Result result = m_lookaheadWriter.EndObject(attributeCount);
+            if (!result.IsSuccess())
+            {
+                return result;
+            }
+            if (--frame.m_depth == 0)
+            {
+                CompleteLookahead();
+            }
+            break;
+        }
+        case FrameType::Skip:
+            if (--frame.m_depth == 0)
+            {
+                m_frames.pop_back();
+            }
+            break;
+        default:
+            AZ_Assert(false, "Json object ended while a different type of value was being read.");
+            break;
+        }
+        return GetVisitorResult();
+    }
+
+    Dom::Visitor::Result JsonStreamingDeserializer::RawKey(AZStd::string_view key, Dom::Lifetime lifetime)
+    {
+        Frame& frame = m_frames.back();
+        switch (frame.m_type)
+        {
+        case FrameType::Class:
+            ReadMemberName(key);
+            break;
+        case FrameType::PendingPointer:
+            if (key == JsonSerialization::TypeIdFieldIdentifier)
+            {
+                frame.m_hasTypeField = true;
+                break;
+            }
+            // There's no "$type" at the start of the object, so buffer the fields until it's found.
+            BeginPointerLookahead();
+            return ReadLookaheadKey(key, lifetime);
+        case FrameType::PointerLookahead:
+            return ReadLookaheadKey(key, lifetime);
+        case FrameType::Capture:
+            return m_captureWriter.RawKey(key, lifetime);
+        default:
+            break;
+        }
+        return GetVisitorResult();
+    }
+
+    Dom::Visitor::Result JsonStreamingDeserializer::StartArray()
+    {
+        switch (RouteValue())
+        {
+        case ValueRoute::Target:
+            BeginArray(m_target);
+            break;
+        case ValueRoute::Capture:
+            ++m_frames.back().m_depth;
+            return m_captureWriter.StartArray();
+        case ValueRoute::Lookahead:
+            ++m_frames.back().m_depth;
+            return m_lookaheadWriter.StartArray();
+        case ValueRoute::Skip:
+            ++m_frames.back().m_depth;
+            break;
+        }
+        return GetVisitorResult();
+    }
+
+    Dom::Visitor::Result JsonStreamingDeserializer::EndArray(AZ::u64 elementCount)
+    {
+        Frame& frame = m_frames.back();
+        switch (frame.m_type)
+        {
+        case FrameType::Container:
+            CompleteContainer(elementCount);
+            break;
+        case FrameType::Capture:
+        {
+            Result result = m_captureWriter.EndArray(elementCount);
+            if (!result.IsSuccess())
+            {
+                return result;
+            }
+            if (--frame.m_depth == 0)
+            {
+                CompleteCapture();
+            }
+            break;
+        }
+        case FrameType::PointerLookahead:
+        {
+            // The buffered object is the outer value, so an array never finishes the lookahead.
+            Result result = m_lookaheadWriter.EndArray(elementCount);
+            if (!result.IsSuccess())
+            {
+                return result;
+            }
+            --frame.m_depth;
+            break;
+        }
+        case FrameType::Skip:
+            if (--frame.m_depth == 0)
+            {
+                m_frames.pop_back();
+            }
+            break;
+        default:
+            AZ_Assert(false, "Json array ended while a different type of value was being read.");
+            break;
+        }
+        return GetVisitorResult();
+    }
+
+    Dom::Visitor::Result JsonStreamingDeserializer::GetVisitorResult() const
+    {
+        return IsHalted()
+            ? VisitorFailure(Dom::VisitorErrorCode::InternalError, "Json Serialization halted loading.")
+            : VisitorSuccess();
+    }
+
+    bool JsonStreamingDeserializer::IsHalted() const
+    {
+        return m_isDone && m_result.GetProcessing() == JsonSerializationResult::Processing::Halted;
+    }
+
+    JsonStreamingDeserializer::StreamMode JsonStreamingDeserializer::GetStreamMode(const Uuid& typeId) const
+    {
+        // This follows the same steps as JsonDeserializer::Load to determine if the value would be loaded as a class or by the
+        // basic container serializer.
+        const JsonRegistrationContext* registrationContext = m_context.GetRegistrationContext();
+        if (const BaseJsonSerializer* serializer = registrationContext->GetSerializerForType(typeId))
+        {
+            return IsBasicContainerSerializer(serializer) ? StreamMode::BasicContainer : StreamMode::Capture;
+        }
+
+        SerializeContext* serializeContext = m_context.GetSerializeContext();
+        const SerializeContext::ClassData* classData = serializeContext->FindClassData(typeId);
+        if (!classData)
+        {
+            return StreamMode::Capture;
+        }
+
+        if (classData->m_azRtti && classData->m_azRtti->GetGenericTypeId() != typeId)
+        {
+            if (((classData->m_azRtti->GetTypeTraits() & (AZ::TypeTraits::is_signed | AZ::TypeTraits::is_unsigned)) != AZ::TypeTraits{0}) &&
+                serializeContext->GetUnderlyingTypeId(typeId) == classData->m_typeId)
+            {
+                return StreamMode::Capture;
+            }
+
+            if (const BaseJsonSerializer* serializer = registrationContext->GetSerializerForType(classData->m_azRtti->GetGenericTypeId()))
+            {
+                return IsBasicContainerSerializer(serializer) ? StreamMode::BasicContainer : StreamMode::Capture;
+            }
+        }
+
+        if (classData->m_azRtti && (classData->m_azRtti->GetTypeTraits() & AZ::TypeTraits::is_enum) == AZ::TypeTraits::is_enum)
+        {
+            return StreamMode::Capture;
+        }
+        return classData->m_container ? StreamMode::Capture : StreamMode::Class;
+    }
+
+    bool JsonStreamingDeserializer::IsBasicContainerSerializer(const BaseJsonSerializer* serializer)
+    {
+        // Only the exact type is checked as serializers derived from it may load containers differently.
+        return azrtti_typeid(serializer) == azrtti_typeid<JsonBasicContainerSerializer>();
+    }
+
+    bool JsonStreamingDeserializer::CanResolvePointer(const Target& target) const
+    {
+        // If any of these are missing the JsonDeserializer reports the problem when loading the collected value.
+        if (target.m_classElement && !target.m_classElement->m_azRtti)
+        {
+            return false;
+        }
+        const SerializeContext::ClassData* classData = m_context.GetSerializeContext()->FindClassData(target.m_typeId);
+        return classData && classData->m_azRtti;
+    }
+
+    JsonStreamingDeserializer::ValueRoute JsonStreamingDeserializer::RouteValue()
+    {
+        if (m_frames.empty())
+        {
+            // The root value, which is already set as the target.
+            return ValueRoute::Target;
+        }
+
+        Frame& frame = m_frames.back();
+        switch (frame.m_type)
+        {
+        case FrameType::Class:
+            m_target = frame.m_member;
+            return ValueRoute::Target;
+        case FrameType::Container:
+            return BeginElement(frame);
+        case FrameType::PendingPointer:
+            // The "$type" field doesn't hold a string. Leave it to the JsonDeserializer to report on.
+            CapturePendingPointer();
+            return ValueRoute::Capture;
+        case FrameType::Capture:
+            return ValueRoute::Capture;
+        case FrameType::PointerLookahead:
+            if (frame.m_hasTypeField)
+            {
+                // The "$type" field doesn't hold a string. Stop looking for the type and leave it to the JsonDeserializer to
+                // report on when the object is loaded as a whole.
+                frame.m_hasTypeField = false;
+                frame.m_isTypeSearchDone = true;
+                m_lookaheadWriter.RawKey(JsonSerialization::TypeIdFieldIdentifier, Dom::Lifetime::Persistent);
+            }
+            return ValueRoute::Lookahead;
+        default:
+            return ValueRoute::Skip;
+        }
+    }
+
+    JsonStreamingDeserializer::ValueRoute JsonStreamingDeserializer::BeginElement(Frame& frame)
+    {
+        using namespace JsonSerializationResult;
+
+        if (frame.m_isFull)
+        {
+            m_frames.emplace_back(FrameType::Skip);
+            return ValueRoute::Skip;
+        }
+
+        m_context.PushPath(frame.m_elementIndex++);
+
+        size_t expectedSize = frame.m_container->Size(frame.m_target.m_address) + 1;
+        if (expectedSize > frame.m_capacity)
+        {
+            frame.m_result.Combine(m_context.Report(Tasks::ReadField, Outcomes::Skipped,
+                "Unable to load more entries in basic container because it's full."));
+            m_context.PopPath();
+            frame.m_isFull = true;
+            m_frames.emplace_back(FrameType::Skip);
+            return ValueRoute::Skip;
+        }
+
+        void* elementAddress = frame.m_container->ReserveElement(frame.m_target.m_address, frame.m_elementInfo);
+        if (!elementAddress)
+        {
+            ResultCode result = m_context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+                "Failed to allocate an item in the basic container.");
+            m_context.PopPath();
+            FinishFrame(result);
+            // Skip the remainder of the array, starting with the current element.
+            Frame& skipFrame = m_frames.emplace_back(FrameType::Skip);
+            skipFrame.m_depth = 1;
+            return ValueRoute::Skip;
+        }
+
+        const bool isPointer = (frame.m_elementInfo->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER) != 0;
+        if (isPointer)
+        {
+            *reinterpret_cast<void**>(elementAddress) = nullptr;
+        }
+
+        frame.m_reservedElement = elementAddress;
+        frame.m_expectedSize = expectedSize;
+        frame.m_hasActivePath = true;
+
+        m_target = Target{};
+        m_target.m_address = elementAddress;
+        m_target.m_typeId = frame.m_elementInfo->m_typeId;
+        m_target.m_isPointer = isPointer;
+        m_target.m_isNewInstance = true;
+        return ValueRoute::Target;
+    }
+
+    void JsonStreamingDeserializer::BeginObject(const Target& target)
+    {
+        if (target.m_isPointer)
+        {
+            if (CanResolvePointer(target))
+            {
+                Frame& frame = m_frames.emplace_back(FrameType::PendingPointer);
+                frame.m_target = target;
+            }
+            else
+            {
+                BeginCapture(target);
+                m_captureWriter.StartObject();
+            }
+        }
+        else if (GetStreamMode(target.m_typeId) == StreamMode::Class)
+        {
+            const SerializeContext::ClassData* classData = m_context.GetSerializeContext()->FindClassData(target.m_typeId);
+            BeginClass(target, target.m_address, *classData);
+        }
+        else
+        {
+            BeginCapture(target);
+            m_captureWriter.StartObject();
+        }
+    }
+
+    void JsonStreamingDeserializer::BeginArray(const Target& target)
+    {
+        if (!target.m_isPointer && GetStreamMode(target.m_typeId) == StreamMode::BasicContainer)
+        {
+            BeginContainer(target);
+        }
+        else
+        {
+            BeginCapture(target);
+            m_captureWriter.StartArray();
+        }
+    }
+
+    JsonStreamingDeserializer::Frame& JsonStreamingDeserializer::BeginClass(
+        const Target& target, void* object, const SerializeContext::ClassData& classData)
+    {
+        AZ_Assert(m_context.GetRegistrationContext() && m_context.GetSerializeContext(), "Expected valid registration context and serialize context.");
+
+        Frame& frame = m_frames.emplace_back(FrameType::Class);
+        frame.m_target = target;
+        frame.m_object = object;
+        frame.m_classData = &classData;
+        return frame;
+    }
+
+    void JsonStreamingDeserializer::BeginContainer(const Target& target)
+    {
+        // This mirrors JsonBasicContainerSerializer::LoadContainer, but with the elements loaded as they're read.
+        namespace JSR = JsonSerializationResult; // Used to remove name conflicts in AzCore in uber builds.
+
+        SerializeContext* serializeContext = m_context.GetSerializeContext();
+        const SerializeContext::ClassData* containerClass = serializeContext->FindClassData(target.m_typeId);
+        if (!containerClass)
+        {
+            FailValue(m_context.Report(JSR::Tasks::RetrieveInfo, JSR::Outcomes::Unsupported,
+                "Unable to retrieve information for definition of the basic container."));
+            return;
+        }
+
+        SerializeContext::IDataContainer* container = containerClass->m_container;
+        if (!container)
+        {
+            FailValue(m_context.Report(JSR::Tasks::RetrieveInfo, JSR::Outcomes::Unsupported,
+                "Unable to retrieve container meta information for the basic container."));
+            return;
+        }
+
+        const SerializeContext::ClassElement* classElement = nullptr;
+        auto typeEnumCallback = [&classElement](const Uuid&, const SerializeContext::ClassElement* genericClassElement)
+        {
+            AZ_Assert(!classElement, "There are multiple class elements registered for a basic container where only one was expected.");
+            classElement = genericClassElement;
+            return true;
+        };
+        container->EnumTypes(typeEnumCallback);
+        AZ_Assert(classElement, "No class element found for the type in the basic container.");
+
+        JSR::ResultCode retVal(JSR::Tasks::ReadField);
+        size_t containerSize = container->Size(target.m_address);
+        if (containerSize > 0 && m_context.ShouldClearContainers())
+        {
+            JSR::Result result = m_context.Report(JSR::Tasks::Clear, JSR::Outcomes::Success, "Clearing basic container.");
+            if (result.GetResultCode().GetOutcome() == JSR::Outcomes::Success)
+            {
+                container->ClearElements(target.m_address, serializeContext);
+                containerSize = container->Size(target.m_address);
+                result = m_context.Report(JSR::Tasks::Clear, containerSize == 0 ? JSR::Outcomes::Success : JSR::Outcomes::Unsupported,
+                    containerSize == 0 ? "Cleared basic container." : "Failed to clear basic container.");
+            }
+            if (result.GetResultCode().GetProcessing() != JSR::Processing::Completed)
+            {
+                FailValue(result);
+                return;
+            }
+            retVal.Combine(result);
+        }
+
+        Frame& frame = m_frames.emplace_back(FrameType::Container);
+        frame.m_target = target;
+        frame.m_result = retVal;
+        frame.m_container = container;
+        frame.m_elementInfo = classElement;
+        frame.m_capacity = container->IsFixedCapacity() ? container->Capacity(target.m_address) : std::numeric_limits<size_t>::max();
+        frame.m_initialSize = containerSize;
+    }
+
+    void JsonStreamingDeserializer::BeginCapture(const Target& target)
+    {
+        Frame& frame = m_frames.emplace_back(FrameType::Capture);
+        frame.m_target = target;
+        frame.m_depth = 1;
+    }
+
+    void JsonStreamingDeserializer::ReadMemberName(AZStd::string_view name)
+    {
+        // This mirrors the loop in JsonDeserializer::LoadClass, but for a single member.
+        using namespace JsonSerializationResult;
+
+        Frame& frame = m_frames.back();
+        frame.m_fieldCount++;
+        if (name == JsonSerialization::TypeIdFieldIdentifier)
+        {
+            m_frames.emplace_back(FrameType::Skip);
+            return;
+        }
+
+        Crc32 nameCrc(name);
+        JsonDeserializer::ElementDataResult foundElementData =
+            JsonDeserializer::FindElementByNameCrc(*m_context.GetSerializeContext(), frame.m_object, *frame.m_classData, nameCrc);
+
+        m_context.PushPath(name);
+        if (foundElementData.m_found)
+        {
+            frame.m_hasActivePath = true;
+            frame.m_member = Target{};
+            frame.m_member.m_address = foundElementData.m_data;
+            frame.m_member.m_typeId = foundElementData.m_info->m_typeId;
+            frame.m_member.m_classElement = foundElementData.m_info;
+            frame.m_member.m_isPointer = (foundElementData.m_info->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER) != 0;
+        }
+        else
+        {
+            frame.m_result.Combine(m_context.Report(Tasks::ReadField, Outcomes::Skipped,
+                "Skipping field as there's no matching variable in the target."));
+            m_context.PopPath();
+            m_frames.emplace_back(FrameType::Skip);
+        }
+    }
+
+    void JsonStreamingDeserializer::ResolvePendingPointer(AZStd::string_view typeName)
+    {
+        // This mirrors JsonDeserializer::LoadToPointer, but with only the "$type" field available.
+        using namespace JsonSerializationResult;
+
+        const Target target = m_frames.back().m_target;
+        m_frames.pop_back();
+
+        char buffer[1024];
+        rapidjson::Document::AllocatorType allocator(buffer, sizeof(buffer));
+        rapidjson::Value pointerData(rapidjson::kObjectType);
+        pointerData.AddMember(rapidjson::StringRef(JsonSerialization::TypeIdFieldIdentifier),
+            rapidjson::StringRef(typeName.data(), aznumeric_cast<rapidjson::SizeType>(typeName.size())), allocator);
+
+        SerializeContext* serializeContext = m_context.GetSerializeContext();
+        const SerializeContext::ClassData* classData = serializeContext->FindClassData(target.m_typeId);
+        void** pointer = reinterpret_cast<void**>(target.m_address);
+        ResolvedPointer resolvedPointer;
+        resolvedPointer.m_pointer = pointer;
+        resolvedPointer.m_typeId = target.m_typeId;
+        resolvedPointer.m_resolvedTypeId = target.m_typeId;
+        resolvedPointer.m_wasNull = *pointer == nullptr;
+
+        ResultCode status(Tasks::RetrieveInfo);
+        if (JsonDeserializer::ResolvePointer(pointer, resolvedPointer.m_resolvedTypeId, status, pointerData, *classData->m_azRtti, m_context) ==
+            JsonDeserializer::ResolvePointerResult::FullyProcessed)
+        {
+            FailValue(status);
+            return;
+        }
+
+        resolvedPointer.m_resolvedClassData = serializeContext->FindClassData(resolvedPointer.m_resolvedTypeId);
+        if (!resolvedPointer.m_resolvedClassData)
+        {
+            FailValue(m_context.Report(Tasks::RetrieveInfo, Outcomes::Unknown,
+                AZStd::string::format("Failed to retrieve serialization information for pointer type %s.", target.m_typeId.ToString<AZStd::string>().c_str())));
+            return;
+        }
+
+        if (GetStreamMode(resolvedPointer.m_resolvedTypeId) == StreamMode::Class)
+        {
+            Frame& classFrame = BeginClass(target, *pointer, *resolvedPointer.m_resolvedClassData);
+            classFrame.m_pointer = resolvedPointer;
+            classFrame.m_hasPointer = true;
+            classFrame.m_fieldCount = 1;
+        }
+        else
+        {
+            // The instance is loaded by the JsonDeserializer, so collect the object, starting with the already read field.
+            BeginCapture(target);
+            Frame& captureFrame = m_frames.back();
+            captureFrame.m_pointer = resolvedPointer;
+            captureFrame.m_hasPointer = true;
+
+            m_captureWriter.StartObject();
+            m_captureWriter.RawKey(JsonSerialization::TypeIdFieldIdentifier, Dom::Lifetime::Persistent);
+            m_captureWriter.String(typeName, Dom::Lifetime::Temporary);
+        }
+    }
+
+    void JsonStreamingDeserializer::CapturePendingPointer()
+    {
+        Frame& frame = m_frames.back();
+        const Target target = frame.m_target;
+        const bool hasTypeField = frame.m_hasTypeField;
+        m_frames.pop_back();
+
+        // Nothing has been resolved yet, so the collected object is loaded into the pointer as a whole.
+        BeginCapture(target);
+        m_captureWriter.StartObject();
+        if (hasTypeField)
+        {
+            m_captureWriter.RawKey(JsonSerialization::TypeIdFieldIdentifier, Dom::Lifetime::Persistent);
+        }
+    }
+
+    void JsonStreamingDeserializer::BeginPointerLookahead()
+    {
+        const Target target = m_frames.back().m_target;
+        m_frames.pop_back();
+
+        Frame& frame = m_frames.emplace_back(FrameType::PointerLookahead);
+        frame.m_target = target;
+        frame.m_depth = 1;
+        frame.m_lookaheadStart = m_lookaheadAllocator.Size();
+        m_lookaheadWriter.StartObject();
+    }
+
+    Dom::Visitor::Result JsonStreamingDeserializer::ReadLookaheadKey(AZStd::string_view key, Dom::Lifetime lifetime)
+    {
+        Frame& frame = m_frames.back();
+        if (frame.m_depth == 1 && !frame.m_isTypeSearchDone)
+        {
+            if (key == JsonSerialization::TypeIdFieldIdentifier)
+            {
+                // The key is only buffered if the value turns out not to be a type name.
+                frame.m_hasTypeField = true;
+                return VisitorSuccess();
+            }
+            if (m_lookaheadAllocator.Size() - frame.m_lookaheadStart > JsonStreamingDeserializerInternal::MaxPointerLookaheadMemory)
+            {
+                frame.m_isTypeSearchDone = true;
+            }
+        }
+        return m_lookaheadWriter.RawKey(key, lifetime);
+    }
+
+    Dom::Visitor::Result JsonStreamingDeserializer::ResolvePointerLookahead(AZStd::string_view typeName)
+    {
+        // Close the buffered object so the writer can be used again, then take the buffered fields out as loading them can
+        // start another lookahead.
+        Result result = m_lookaheadWriter.EndObject(m_lookaheadValue.MemberCount());
+        if (!result.IsSuccess())
+        {
+            return result;
+        }
+        rapidjson::Value bufferedFields(AZStd::move(m_lookaheadValue));
+        ResolvePendingPointer(typeName);
+
+        // Load the buffered fields as if they're read after the "$type".
+        ++m_lookaheadReplayDepth;
+        for (auto field = bufferedFields.MemberBegin(); field != bufferedFields.MemberEnd() && result.IsSuccess(); ++field)
+        {
+            result = RawKey(AZStd::string_view(field->name.GetString(), field->name.GetStringLength()), Dom::Lifetime::Temporary);
+            if (result.IsSuccess())
+            {
+                result = Dom::Json::VisitRapidJsonValue(field->value, *this, Dom::Lifetime::Temporary);
+            }
+        }
+        --m_lookaheadReplayDepth;
+        ReleaseLookahead();
+        return result.IsSuccess() ? GetVisitorResult() : result;
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::LoadValue(const Target& target, const rapidjson::Value& value)
+    {
+        if (target.m_classElement)
+        {
+            return JsonDeserializer::LoadWithClassElement(target.m_address, value, *target.m_classElement, m_context);
+        }
+        if (target.m_isPointer)
+        {
+            return JsonDeserializer::LoadToPointer(target.m_address, target.m_typeId, value, JsonDeserializer::UseTypeDeserializer::Yes, m_context);
+        }
+        return JsonDeserializer::Load(
+            target.m_address, target.m_typeId, value, target.m_isNewInstance, JsonDeserializer::UseTypeDeserializer::Yes, m_context);
+    }
+
+    void JsonStreamingDeserializer::CompleteCapture()
+    {
+        const Frame& frame = m_frames.back();
+        JsonSerializationResult::ResultCode result = frame.m_hasPointer
+            ? JsonDeserializer::Load(*frame.m_pointer.m_pointer, frame.m_pointer.m_resolvedTypeId, m_capturedValue, true,
+                JsonDeserializer::UseTypeDeserializer::Yes, m_context)
+            : LoadValue(frame.m_target, m_capturedValue);
+        ReleaseCapture();
+        FinishFrame(result);
+    }
+
+    void JsonStreamingDeserializer::CompleteLookahead()
+    {
+        // The object has been buffered as a whole, either because it has no "$type" or because it was found too late, so load
+        // it in the same way as a collected value.
+        const Target target = m_frames.back().m_target;
+        m_frames.pop_back();
+        JsonSerializationResult::ResultCode result = LoadValue(target, m_lookaheadValue);
+        ReleaseLookahead();
+        CompleteValue(result);
+    }
+
+    void JsonStreamingDeserializer::CompleteValue(JsonSerializationResult::ResultCode result)
+    {
+        using namespace JsonSerializationResult;
+
+        if (m_frames.empty())
+        {
+            m_result = result;
+            m_isDone = true;
+            return;
+        }
+
+        Frame& frame = m_frames.back();
+        if (frame.m_type == FrameType::Class)
+        {
+            frame.m_result.Combine(result);
+            if (result.GetProcessing() == Processing::Halted)
+            {
+                ResultCode failure = m_context.Report(result, "Loading of element has failed.");
+                m_context.PopPath();
+                frame.m_hasActivePath = false;
+                FinishFrame(failure);
+                // The class no longer has a target, so skip the remaining members and the end of the object.
+                Frame& skipFrame = m_frames.emplace_back(FrameType::Skip);
+                skipFrame.m_depth = 1;
+                return;
+            }
+            else if (result.GetProcessing() != Processing::Altered)
+            {
+                frame.m_numLoads++;
+            }
+        }
+        else
+        {
+            AZ_Assert(frame.m_type == FrameType::Container, "Only classes and containers can receive the result of a loaded value.");
+
+            SerializeContext* serializeContext = m_context.GetSerializeContext();
+            void* containerAddress = frame.m_target.m_address;
+            void* elementAddress = frame.m_reservedElement;
+            frame.m_reservedElement = nullptr;
+            if (result.GetProcessing() == Processing::Halted)
+            {
+                frame.m_container->FreeReservedElement(containerAddress, elementAddress, serializeContext);
+                ResultCode failure = m_context.Report(frame.m_result, "Failed to read element for basic container.");
+                m_context.PopPath();
+                frame.m_hasActivePath = false;
+                FinishFrame(failure);
+                // The container no longer has a target, so skip the remaining elements and the end of the array.
+                Frame& skipFrame = m_frames.emplace_back(FrameType::Skip);
+                skipFrame.m_depth = 1;
+                return;
+            }
+            else if (result.GetProcessing() == Processing::Altered)
+            {
+                frame.m_container->FreeReservedElement(containerAddress, elementAddress, serializeContext);
+                frame.m_result.Combine(result);
+            }
+            else
+            {
+                frame.m_container->StoreElement(containerAddress, elementAddress);
+                if (frame.m_container->Size(containerAddress) != frame.m_expectedSize)
+                {
+                    frame.m_result.Combine(m_context.Report(Tasks::ReadField, Outcomes::Unavailable,
+                        "Unable to store element to basic container."));
+                }
+                else
+                {
+                    frame.m_result.Combine(result);
+                }
+            }
+        }
+        m_context.PopPath();
+        frame.m_hasActivePath = false;
+    }
+
+    void JsonStreamingDeserializer::CompleteClass()
+    {
+        using namespace JsonSerializationResult;
+
+        Frame& frame = m_frames.back();
+        if (frame.m_fieldCount == 0)
+        {
+            FinishFrame(m_context.Report(Tasks::ReadField, Outcomes::DefaultsUsed, "Value has an explicit default."));
+            return;
+        }
+
+        size_t elementCount = JsonDeserializer::CountElements(*m_context.GetSerializeContext(), *frame.m_classData);
+        if (elementCount > frame.m_numLoads)
+        {
+            frame.m_result.Combine(ResultCode(Tasks::ReadField, frame.m_numLoads == 0 ? Outcomes::DefaultsUsed : Outcomes::PartialDefaults));
+        }
+        FinishFrame(frame.m_result);
+    }
+
+    void JsonStreamingDeserializer::CompleteContainer(AZ::u64 elementCount)
+    {
+        namespace JSR = JsonSerializationResult; // Used to remove name conflicts in AzCore in uber builds.
+
+        Frame& frame = m_frames.back();
+        if (!frame.m_result.HasDoneWork() && elementCount == 0)
+        {
+            FinishFrame(m_context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Success, "No values provided for basic container."));
+            return;
+        }
+
+        size_t addedCount = frame.m_container->Size(frame.m_target.m_address) - frame.m_initialSize;
+        if (addedCount > 0)
+        {
+            // Values were added which means the container is no longer in its default state of being empty.
+            frame.m_result.Combine(JSR::ResultCode(JSR::Tasks::ReadField, JSR::Outcomes::Success));
+        }
+        AZStd::string_view message =
+            addedCount >= elementCount ? "Successfully read basic container.":
+            addedCount == 0 ? "Unable to read data for basic container." :
+            "Partially read data for basic container.";
+        FinishFrame(m_context.Report(frame.m_result, message));
+    }
+
+    void JsonStreamingDeserializer::FinishFrame(JsonSerializationResult::ResultCode result)
+    {
+        const Frame& frame = m_frames.back();
+        if (frame.m_hasPointer)
+        {
+            result = FinishPointer(frame.m_pointer, result);
+        }
+        m_frames.pop_back();
+        CompleteValue(result);
+    }
+
+    void JsonStreamingDeserializer::FailValue(JsonSerializationResult::ResultCode result)
+    {
+        // The value has been fully processed before all of it was read, so skip the remainder of the object or array.
+        CompleteValue(result);
+        Frame& skipFrame = m_frames.emplace_back(FrameType::Skip);
+        skipFrame.m_depth = 1;
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::FinishPointer(
+        const ResolvedPointer& pointer, JsonSerializationResult::ResultCode status)
+    {
+        using namespace JsonSerializationResult;
+
+        *pointer.m_pointer = pointer.m_resolvedClassData->m_azRtti->Cast(*pointer.m_pointer, pointer.m_typeId);
+
+        if (pointer.m_wasNull && (status.GetProcessing() == Processing::Halted || status.GetProcessing() == Processing::Altered))
+        {
+            // If the pointer was null an instance was created to load to. If loading fails, that step has to be undone to adhere
+            // to the no-side effects rule.
+            AZ_Assert(pointer.m_resolvedClassData->m_factory,
+                "Expected class data to have a factory as it was previously used in the Json Deserializer to create a new instance.");
+            pointer.m_resolvedClassData->m_factory->Destroy(*pointer.m_pointer);
+            *pointer.m_pointer = nullptr;
+        }
+        return status;
+    }
+
+    void JsonStreamingDeserializer::ReleaseCapture()
+    {
+        m_capturedValue.SetNull();
+        if (m_captureAllocator.Size() > JsonStreamingDeserializerInternal::MaxRetainedCaptureMemory)
+        {
+            m_captureAllocator.Clear();
+        }
+    }
+
+    void JsonStreamingDeserializer::ReleaseLookahead()
+    {
+        m_lookaheadValue.SetNull();
+        // Buffered objects that are still being loaded live in the same memory, so only clear it once they're done.
+        if (m_lookaheadReplayDepth == 0 && m_lookaheadAllocator.Size() > JsonStreamingDeserializerInternal::MaxRetainedCaptureMemory)
+        {
+            m_lookaheadAllocator.Clear();
+        }
+    }
+
+    void JsonStreamingDeserializer::Unwind()
+    {
+        using namespace JsonSerializationResult;
+
+        // Loading stopped half way through because of a parse error, so release anything that was only partially loaded.
+        while (!m_frames.empty())
+        {
+            Frame& frame = m_frames.back();
+            if (frame.m_hasActivePath)
+            {
+                m_context.PopPath();
+            }
+            if (frame.m_reservedElement)
+            {
+                frame.m_container->FreeReservedElement(frame.m_target.m_address, frame.m_reservedElement, m_context.GetSerializeContext());
+            }
+            if (frame.m_hasPointer)
+            {
+                FinishPointer(frame.m_pointer, ResultCode(Tasks::ReadField, Outcomes::Catastrophic));
+            }
+            m_frames.pop_back();
+        }
+        ReleaseCapture();
+        ReleaseLookahead();
+    }
+} // namespace AZ
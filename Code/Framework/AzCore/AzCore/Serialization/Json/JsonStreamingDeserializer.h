@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/DOM/Backends/JSON/JsonSerializationUtils.h>
+#include <AzCore/DOM/DomVisitor.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Json/JsonSerializationResult.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ
+{
+    class BaseJsonSerializer;
+    class JsonDeserializerContext;
+
+    //! Loads json text into an object while the text is being parsed, instead of first parsing the full text into a
+    //! rapidjson::Document and loading from that.
+    //! Reflected classes, pointers to reflected classes and basic containers such as AZStd::vector are filled in member by
+    //! member and element by element as the parser reports them. Any other value, such as values handled by a custom
+    //! serializer or enums, is collected into a temporary rapidjson::Value and passed to the regular JsonDeserializer. This
+    //! way the memory needed for loading is bounded by the largest of these values instead of the size of the whole text.
+    //! The type of a pointer is read from the "$type" field, which the Json Serializer stores as the first field. If another
+    //! field comes first, the fields are buffered until the "$type" is found. If the buffered fields grow too large, or the
+    //! object doesn't have a "$type", the whole object is collected and passed to the regular JsonDeserializer.
+    class JsonStreamingDeserializer final
+        : public Dom::Visitor
+    {
+    public:
+        static JsonSerializationResult::ResultCode Load(void* object, const Uuid& typeId, AZStd::string_view jsonText,
+            JsonDeserializerContext& context);
+
+        ~JsonStreamingDeserializer() override = default;
+
+        Dom::VisitorFlags GetVisitorFlags() const override;
+        Result Null() override;
+        Result Bool(bool value) override;
+        Result Int64(AZ::s64 value) override;
+        Result Uint64(AZ::u64 value) override;
+        Result Double(double value) override;
+        Result String(AZStd::string_view value, Dom::Lifetime lifetime) override;
+        Result StartObject() override;
+        Result EndObject(AZ::u64 attributeCount) override;
+        Result RawKey(AZStd::string_view key, Dom::Lifetime lifetime) override;
+        Result StartArray() override;
+        Result EndArray(AZ::u64 elementCount) override;
+
+    private:
+        enum class StreamMode : u8
+        {
+            Class, // Members are loaded as they're read.
+            BasicContainer, // Elements are loaded as they're read.
+            Capture // The value is collected and passed to the JsonDeserializer.
+        };
+
+        enum class ValueRoute : u8
+        {
+            Target, // The value is loaded into the current target.
+            Capture, // The value is part of a value that's being collected.
+            Lookahead, // The value is part of the fields that are buffered while looking for the "$type" of a pointer.
+            Skip // The value is ignored.
+        };
+
+        enum class FrameType : u8
+        {
+            Class,
+            Container,
+            PendingPointer, // Object for a pointer of which the type isn't known yet because the "$type" hasn't been read.
+            PointerLookahead, // Object for a pointer of which the fields are buffered because the "$type" isn't the first field.
+            Capture,
+            Skip
+        };
+
+        //! The location a value will be loaded into.
+        struct Target
+        {
+            void* m_address{ nullptr };
+            Uuid m_typeId{ Uuid::CreateNull() };
+            const SerializeContext::ClassElement* m_classElement{ nullptr }; // Only set for members of a class.
+            bool m_isPointer{ false };
+            bool m_isNewInstance{ false };
+        };
+
+        //! Information about a pointer for which an instance has been resolved, needed to finish the pointer once it's loaded.
+        struct ResolvedPointer
+        {
+            void** m_pointer{ nullptr };
+            Uuid m_typeId{ Uuid::CreateNull() };
+            Uuid m_resolvedTypeId{ Uuid::CreateNull() };
+            const SerializeContext::ClassData* m_resolvedClassData{ nullptr };
+            bool m_wasNull{ false };
+        };
+
+        struct Frame
+        {
+            explicit Frame(FrameType type);
+
+            FrameType m_type;
+            //! The value this frame loads. Its result is passed to the frame below.
+            Target m_target;
+            ResolvedPointer m_pointer;
+            bool m_hasPointer{ false };
+            //! Whether a path entry has been pushed for the member or element currently being loaded.
+            bool m_hasActivePath{ false };
+            JsonSerializationResult::ResultCode m_result{ JsonSerializationResult::Tasks::ReadField };
+
+            // Class frames
+            void* m_object{ nullptr };
+            const SerializeContext::ClassData* m_classData{ nullptr };
+            Target m_member;
+            size_t m_numLoads{ 0 };
+            size_t m_fieldCount{ 0 };
+
+            // Container frames
+            SerializeContext::IDataContainer* m_container{ nullptr };
+            const SerializeContext::ClassElement* m_elementInfo{ nullptr };
+            void* m_reservedElement{ nullptr };
+            size_t m_capacity{ 0 };
+            size_t m_initialSize{ 0 };
+            size_t m_expectedSize{ 0 };
+            size_t m_elementIndex{ 0 };
+            bool m_isFull{ false };
+
+            // Capture, skip and pending pointer frames
+            u32 m_depth{ 0 };
+            bool m_hasTypeField{ false };
+
+            // Pointer lookahead frames
+            size_t m_lookaheadStart{ 0 };
+            bool m_isTypeSearchDone{ false };
+        };
+
+        explicit JsonStreamingDeserializer(JsonDeserializerContext& context);
+
+        Result GetVisitorResult() const;
+        bool IsHalted() const;
+
+        StreamMode GetStreamMode(const Uuid& typeId) const;
+        static bool IsBasicContainerSerializer(const BaseJsonSerializer* serializer);
+        bool CanResolvePointer(const Target& target) const;
+
+        ValueRoute RouteValue();
+        ValueRoute BeginElement(Frame& frame);
+        template<typename WriteFunction, typename CreateFunction>
+        Result Scalar(WriteFunction&& write, CreateFunction&& create);
+
+        void BeginObject(const Target& target);
+        void BeginArray(const Target& target);
+        Frame& BeginClass(const Target& target, void* object, const SerializeContext::ClassData& classData);
+        void BeginContainer(const Target& target);
+        void BeginCapture(const Target& target);
+        void ReadMemberName(AZStd::string_view name);
+        void ResolvePendingPointer(AZStd::string_view typeName);
+        void CapturePendingPointer();
+        void BeginPointerLookahead();
+        Result ReadLookaheadKey(AZStd::string_view key, Dom::Lifetime lifetime);
+        Result ResolvePointerLookahead(AZStd::string_view typeName);
+
+        JsonSerializationResult::ResultCode LoadValue(const Target& target, const rapidjson::Value& value);
+        void CompleteCapture();
+        void CompleteLookahead();
+        void CompleteValue(JsonSerializationResult::ResultCode result);
+        void CompleteClass();
+        void CompleteContainer(AZ::u64 elementCount);
+        void FinishFrame(JsonSerializationResult::ResultCode result);
+        void FailValue(JsonSerializationResult::ResultCode result);
+        JsonSerializationResult::ResultCode FinishPointer(const ResolvedPointer& pointer, JsonSerializationResult::ResultCode status);
+        void ReleaseCapture();
+        void ReleaseLookahead();
+        void Unwind();
+
+        JsonDeserializerContext& m_context;
+        AZStd::vector<Frame> m_frames;
+        //! The target the value that's currently being read is loaded into. This starts out as the root object.
+        Target m_target;
+        //! Holds the value that's collected for the JsonDeserializer. Only one value is collected at a time.
+        rapidjson::Document::AllocatorType m_captureAllocator;
+        rapidjson::Value m_capturedValue;
+        Dom::Json::RapidJsonValueWriter m_captureWriter;
+        //! Holds the fields of a pointer object that are read before its "$type". This is separate from the collected value as
+        //! the buffered fields can contain values that need to be collected when they're loaded.
+        rapidjson::Document::AllocatorType m_lookaheadAllocator;
+        rapidjson::Value m_lookaheadValue;
+        Dom::Json::RapidJsonValueWriter m_lookaheadWriter;
+        //! The number of buffered objects that are being loaded. Pointers in these can start a new lookahead, so the memory of
+        //! the buffered objects needs to be kept until they're all loaded.
+        u32 m_lookaheadReplayDepth{ 0 };
+        JsonSerializationResult::ResultCode m_result{ JsonSerializationResult::Tasks::ReadField };
+        bool m_isDone{ false };
+    };
+} // namespace AZ
@@ -116,10 +116,20 @@ namespace AZ
             /// Starts the operation
             bool Start();
 
-            bool LoadClass(IO::GenericStream& stream, SerializeContext::DataElementNode& convertedClassElement, const SerializeContext::ClassData* parentClassInfo, void* parentClassPtr, int flags);
+            /// Position in the read plan of the class whose members are being loaded.
+            struct ReadPlanCursor
+            {
+                const SerializeContext::ClassReadPlan* m_plan = nullptr;
+                size_t m_nextStep = 0;
+                const SerializeContext::ClassReadPlan::Step* m_step = nullptr; ///< Step of the last element read, if it matched a member.
+            };
+
+            bool LoadClass(IO::GenericStream& stream, SerializeContext::DataElementNode& convertedClassElement, const SerializeContext::ClassData* parentClassInfo, void* parentClassPtr, int flags,
+                const SerializeContext::ClassReadPlan* readPlan = nullptr);
 
             // returns true if an element was found at the requested level
-            bool ReadElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool nextLevel, bool isTopElement);
+            bool ReadElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool nextLevel, bool isTopElement,
+                ReadPlanCursor* readPlanCursor = nullptr);
             // used during load to skip the rest of the element including any subelements
             void SkipElement();
 
@@ -369,7 +379,8 @@ namespace AZ
         // LoadClass
         // [4/25/2012]
         //=========================================================================
-        bool ObjectStreamImpl::LoadClass(IO::GenericStream& stream, SerializeContext::DataElementNode& convertedClassElement, const SerializeContext::ClassData* parentClassInfo, void* parentClassPtr, int flags)
+        bool ObjectStreamImpl::LoadClass(IO::GenericStream& stream, SerializeContext::DataElementNode& convertedClassElement, const SerializeContext::ClassData* parentClassInfo, void* parentClassPtr, int flags,
+            const SerializeContext::ClassReadPlan* readPlan)
         {
             bool result = true;
 
@@ -386,10 +397,14 @@ namespace AZ
 
             size_t currentContainerElementIndex = 0;    // used to load container elements
 
+            ReadPlanCursor readPlanCursor;
+            readPlanCursor.m_plan = readPlan;
+
             while (true)
             {
                 // reset the class info
                 const SerializeContext::ClassData* classData = nullptr;
+                readPlanCursor.m_step = nullptr;
 
                 bool isConvertedData = false;
                 // read from the converted list (if we have something)
@@ -417,7 +432,7 @@ namespace AZ
                 }
                 else // read from the stream
                 {
-                    if (!ReadElement(*m_sc, classData, element, parentClassInfo, nextLevel, parentClassInfo == nullptr))
+                    if (!ReadElement(*m_sc, classData, element, parentClassInfo, nextLevel, parentClassInfo == nullptr, &readPlanCursor))
                     {
                         // we have reached the end of this branch, so exit the loop
                         break;
@@ -598,7 +613,13 @@ namespace AZ
                     }
                     else
                     {
-                        for (size_t i = 0; i < parentClassInfo->m_elements.size(); ++i)
+                        // The steps of the read plan follow the class elements, so a matched step tells where the member is
+                        size_t firstElementIndex = 0;
+                        if (readPlanCursor.m_step && readPlanCursor.m_step->m_classElement->m_nameCrc == element.m_nameCrc)
+                        {
+                            firstElementIndex = static_cast<size_t>(readPlanCursor.m_step - readPlanCursor.m_plan->m_steps.data());
+                        }
+                        for (size_t i = firstElementIndex; i < parentClassInfo->m_elements.size(); ++i)
                         {
                             const SerializeContext::ClassElement* childElement = &parentClassInfo->m_elements[i];
                             if (childElement->m_nameCrc == element.m_nameCrc)
@@ -822,8 +843,16 @@ namespace AZ
                     classData->m_container->ClearElements(dataAddress, m_sc);
                 }
 
+                // Members of classes stored at their reflected version are matched through the class read plan
+                const SerializeContext::ClassReadPlan* childReadPlan = nullptr;
+                if (GetType() == ST_BINARY && m_version == s_objectStreamVersion && !isConvertedData && element.m_version == classData->m_version &&
+                    !classData->m_container && !classData->m_elements.empty())
+                {
+                    childReadPlan = m_sc->FindClassReadPlan(classData);
+                }
+
                 // Read child nodes
-                result = LoadClass(stream, *convertedNode, classData, dataAddress, flags) && result;
+                result = LoadClass(stream, *convertedNode, classData, dataAddress, flags, childReadPlan) && result;
 
                 if (classContainer)
                 {
@@ -1010,7 +1039,8 @@ namespace AZ
         // [4/19/2012]
         //=========================================================================
         bool
-        ObjectStreamImpl::ReadElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool nextLevel, bool isTopElement)
+        ObjectStreamImpl::ReadElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool nextLevel, bool isTopElement,
+            ReadPlanCursor* readPlanCursor)
         {
             AZ_Assert(element.m_stream != nullptr, "You must provide a stream to store the values!");
             element.m_version = 0;
@@ -1341,15 +1371,31 @@ namespace AZ
 
                 element.m_dataType = SerializeContext::DataElement::DT_BINARY_BE;
 
+                const SerializeContext::ClassReadPlan::Step* readPlanStep = nullptr;
+                if (readPlanCursor && readPlanCursor->m_plan)
+                {
+                    readPlanCursor->m_step = readPlanCursor->m_plan->FindStep(element.m_nameCrc, readPlanCursor->m_nextStep);
+                    readPlanStep = readPlanCursor->m_step;
+                }
 
-                // find the registered class data
-                cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
-                if (cd)
+                // The read plan resolved the class data of members ahead of time, unless the element is of another type than the member,
+                // like a derived class stored through a pointer.
+                if (readPlanStep && readPlanStep->m_classData && element.m_id == readPlanStep->m_classElement->m_typeId)
                 {
-                    // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
-                    if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
+                    cd = readPlanStep->m_classData;
+                    element.m_id = readPlanStep->m_elementId;
+                }
+                else
+                {
+                    // find the registered class data
+                    cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
+                    if (cd)
                     {
-                        element.m_id = genericClassInfo->GetSpecializedTypeId();
+                        // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
+                        if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
+                        {
+                            element.m_id = genericClassInfo->GetSpecializedTypeId();
+                        }
                     }
                 }
 
@@ -23,6 +23,7 @@
 #include <AzCore/std/bind/bind.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/containers/stack.h>
+#include <AzCore/std/parallel/lock.h>
 
 #include <AzCore/Math/MathReflection.h>
 #include <AzCore/Math/MathUtils.h>
@@ -568,7 +569,12 @@ namespace AZ
     {
         if (IsRemovingReflection())
         {
-            m_uuidMap.erase(typeUuid);
+            auto mapIt = m_uuidMap.find(typeUuid);
+            if (mapIt != m_uuidMap.end())
+            {
+                RemoveClassData(&mapIt->second);
+                m_uuidMap.erase(mapIt);
+            }
             return;
         }
 
@@ -678,6 +684,65 @@ namespace AZ
         return cd;
     }
 
+    //=========================================================================
+    // FindClassReadPlan
+    //=========================================================================
+    const SerializeContext::ClassReadPlan* SerializeContext::FindClassReadPlan(const ClassData* classData) const
+    {
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_classReadPlansMutex);
+            auto planIt = m_classReadPlans.find(classData);
+            if (planIt != m_classReadPlans.end())
+            {
+                return &planIt->second;
+            }
+        }
+
+        // Resolve the members the same way ObjectStream does for an element of the member type
+        ClassReadPlan plan;
+        plan.m_steps.reserve(classData->m_elements.size());
+        for (const ClassElement& classElement : classData->m_elements)
+        {
+            ClassReadPlan::Step& step = plan.m_steps.emplace_back();
+            step.m_classElement = &classElement;
+            step.m_classData = FindClassData(classElement.m_typeId, classData, classElement.m_nameCrc);
+            step.m_elementId = classElement.m_typeId;
+            if (step.m_classData)
+            {
+                if (GenericClassInfo* genericClassInfo = FindGenericClassInfo(step.m_classData->m_typeId))
+                {
+                    step.m_elementId = genericClassInfo->GetSpecializedTypeId();
+                }
+            }
+        }
+
+        // If another thread built the same plan in the meantime, its plan is kept and this one is dropped.
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_classReadPlansMutex);
+        return &m_classReadPlans.emplace(classData, AZStd::move(plan)).first->second;
+    }
+
+    //=========================================================================
+    // ClassReadPlan::FindStep
+    //=========================================================================
+    auto SerializeContext::ClassReadPlan::FindStep(u32 elementNameCrc, size_t& nextStep) const -> const Step*
+    {
+        if (nextStep < m_steps.size() && m_steps[nextStep].m_classElement->m_nameCrc == elementNameCrc)
+        {
+            return &m_steps[nextStep++];
+        }
+
+        // Members missing from the stream or written by an older reflection of the class, search them all.
+        for (size_t stepIndex = 0; stepIndex < m_steps.size(); ++stepIndex)
+        {
+            if (m_steps[stepIndex].m_classElement->m_nameCrc == elementNameCrc)
+            {
+                nextStep = stepIndex + 1;
+                return &m_steps[stepIndex];
+            }
+        }
+        return nullptr;
+    }
+
     //=========================================================================
     // FindGenericClassInfo
     //=========================================================================
@@ -2803,6 +2868,10 @@ namespace AZ
         {
             m_editContext->RemoveClassData(classData);
         }
+
+        // Any plan can refer to the removed class data through its members, so they are all rebuilt on next use.
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_classReadPlansMutex);
+        m_classReadPlans.clear();
     }
 
     void SerializeContext::RemoveGenericClassInfo(GenericClassInfo* genericClassInfo)
@@ -28,6 +28,7 @@
 #include <AzCore/std/typetraits/is_base_of.h>
 #include <AzCore/std/any.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 
 #include <AzCore/std/functional.h>
 
@@ -113,6 +114,7 @@ namespace AZ
         class EnumBuilder;
 
         class ClassData;
+        class ClassReadPlan;
         struct EnumerateInstanceCallContext;
         struct ClassElement;
         struct DataElement;
@@ -650,6 +652,28 @@ namespace AZ
             }
         };
 
+        /**
+         * Read plan of a class, used by the ObjectStream to load the members of a class from a binary stream without resolving
+         * every element from scratch. Binary streams store the members in reflection order, so the plan lists the class elements
+         * in that order along with the class data of their types, which is looked up once when the plan is built.
+         */
+        class ClassReadPlan
+        {
+        public:
+            struct Step
+            {
+                const ClassElement* m_classElement = nullptr;
+                const ClassData* m_classData = nullptr;     ///< Class data of the member type, nullptr if it couldn't be resolved.
+                Uuid m_elementId = Uuid::CreateNull();      ///< Id of the loaded data element, the specialized type id for generic types.
+            };
+
+            /// Finds the step of the member with the supplied name.
+            /// @param nextStep index of the step expected to be read next, it's moved past the returned step.
+            const Step* FindStep(u32 elementNameCrc, size_t& nextStep) const;
+
+            AZStd::vector<Step> m_steps;
+        };
+
         /**
          * Interface for creating and destroying object from the serializer.
          */
@@ -1059,6 +1083,9 @@ namespace AZ
         /// Find a class data (stored information) based on a class ID and possible parent class data.
         const ClassData* FindClassData(const Uuid& classId, const SerializeContext::ClassData* parent = nullptr, u32 elementNameCrc = 0) const;
 
+        /// Find the read plan of a class. Plans are built on first use and kept until reflection is removed from the context.
+        const ClassReadPlan* FindClassReadPlan(const ClassData* classData) const;
+
         /// Find a class data (stored information) based on a class name
         AZStd::vector<AZ::Uuid> FindClassId(const AZ::Crc32& classNameCrc) const;
 
@@ -1345,6 +1372,8 @@ namespace AZ
         AZStd::unordered_map<Uuid, CreateAnyFunc>  m_uuidAnyCreationMap;      ///< Uuid to Any creation function map
         AZStd::unordered_map<TypeId, TypeId> m_enumTypeIdToUnderlyingTypeIdMap; ///< Uuid to keep track of the correspond underlying type id for an enum type that is reflected as a Field within the SerializeContext
         AZStd::vector<AZStd::unique_ptr<IDataContainer>> m_dataContainers; ///< Takes care of all related IDataContainer's lifetimes
+        mutable AZStd::unordered_map<const ClassData*, ClassReadPlan> m_classReadPlans; ///< Read plans built by FindClassReadPlan
+        mutable AZStd::shared_mutex m_classReadPlansMutex; ///< Guards m_classReadPlans, as object streams can load on several threads
 
         class PerModuleGenericClassInfo;
         AZStd::unordered_set<PerModuleGenericClassInfo*>  m_perModuleSet; ///< Stores the static PerModuleGenericClass structures keeps track of reflected GenericClassInfo per module
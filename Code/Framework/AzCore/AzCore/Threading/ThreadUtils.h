@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AZ::Threading
 {
@@ -19,4 +20,10 @@ namespace AZ::Threading
     //! @param reservedNumThreads number of hardware threads to reserve for O3DE system threads. Value clamped to num_hardware_threads.
     //! @return number of worker threads for the calling system to allocate
     uint32_t CalcNumWorkerThreads(float workerThreadsRatio, uint32_t minNumWorkerThreads, uint32_t reservedNumThreads);
+
+    //! Returns for each logical processor an id of the group of processors that share its last level cache, such as a core
+    //! complex or a socket. The ids are only meaningful when compared with each other.
+    //! @return the group id for each logical processor, indexed by processor number, or an empty vector if the platform
+    //!         doesn't report its processor topology.
+    AZStd::vector<uint32_t> GetProcessorCacheGroups();
 };
@@ -239,6 +239,9 @@ set(FILES
     Math/Aabb.cpp
     Math/Aabb.h
     Math/Aabb.inl
+    Math/BatchMath.cpp
+    Math/BatchMath.h
+    Math/BatchMath.inl
     Math/Color.cpp
     Math/Color.h
     Math/Color.inl
@@ -526,6 +529,8 @@ set(FILES
     Serialization/Json/JsonSerializationSettings.h
     Serialization/Json/JsonSerializer.h
     Serialization/Json/JsonSerializer.cpp
+    Serialization/Json/JsonStreamingDeserializer.h
+    Serialization/Json/JsonStreamingDeserializer.cpp
     Serialization/Json/JsonStringConversionUtils.h
     Serialization/Json/JsonSystemComponent.h
     Serialization/Json/JsonSystemComponent.cpp
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/flat_hash_table.h>
+#include <AzCore/std/tuple.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+        struct FlatHashMapTableTraits
+        {
+            using key_type = Key;
+            using key_eq = EqualKey;
+            using hasher = Hasher;
+            using value_type = AZStd::pair<Key, MappedType>;
+            using allocator_type = Allocator;
+
+            static AZ_FORCE_INLINE const key_type& key_from_value(const value_type& value) { return value.first; }
+            static AZ_FORCE_INLINE void transfer(value_type* destination, value_type* source)
+            {
+                new (destination) value_type(AZStd::move(*source));
+                source->~value_type();
+            }
+        };
+    }
+
+    /**
+     * Open addressing hash map, a drop in replacement for \ref unordered_map where lookups are hot and iterator/reference stability
+     * over inserts isn't needed. Values are stored inline, see \ref flat_hash_table for the details and trade offs.
+     * Heterogeneous lookup is enabled when both the Hasher and EqualKey have an is_transparent type.
+     */
+    template<class Key, class MappedType, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_hash_map
+        : public flat_hash_table<Internal::FlatHashMapTableTraits<Key, MappedType, Hasher, EqualKey, Allocator>>
+    {
+        using this_type = flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>;
+        using base_type = flat_hash_table<Internal::FlatHashMapTableTraits<Key, MappedType, Hasher, EqualKey, Allocator>>;
+
+    public:
+        using key_type = typename base_type::key_type;
+        using key_eq = typename base_type::key_eq;
+        using hasher = typename base_type::hasher;
+        using mapped_type = MappedType;
+
+        using allocator_type = typename base_type::allocator_type;
+        using size_type = typename base_type::size_type;
+        using difference_type = typename base_type::difference_type;
+        using pointer = typename base_type::pointer;
+        using const_pointer = typename base_type::const_pointer;
+        using reference = typename base_type::reference;
+        using const_reference = typename base_type::const_reference;
+        using value_type = typename base_type::value_type;
+
+        using iterator = typename base_type::iterator;
+        using const_iterator = typename base_type::const_iterator;
+        using pair_iter_bool = AZStd::pair<iterator, bool>;
+
+        flat_hash_map()
+            : base_type(hasher(), key_eq(), allocator_type())
+        {
+        }
+        explicit flat_hash_map(const allocator_type& allocator)
+            : base_type(hasher(), key_eq(), allocator)
+        {
+        }
+        /// This constructor is AZStd extension (so we don't rehash/allocate memory)
+        flat_hash_map(const hasher& hash, const key_eq& keyEqual, const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+        }
+        explicit flat_hash_map(size_type numBucketsHint, const hasher& hash = hasher(), const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::rehash(numBucketsHint);
+        }
+        template<class Iterator>
+        flat_hash_map(Iterator first, Iterator last, size_type numBucketsHint = 0, const hasher& hash = hasher(), const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::rehash(numBucketsHint);
+            base_type::insert(first, last);
+        }
+        flat_hash_map(std::initializer_list<value_type> list, const hasher& hash = hasher(), const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::insert(list);
+        }
+        flat_hash_map(const this_type& rhs) = default;
+        flat_hash_map(this_type&& rhs) = default;
+
+        this_type& operator=(const this_type& rhs) = default;
+        this_type& operator=(this_type&& rhs) = default;
+
+        /**
+         * Look up operator if element doesn't exists inserts a new one with (key,mapped_type()).
+         */
+        mapped_type& operator[](const key_type& key)
+        {
+            return try_emplace(key).first->second;
+        }
+        mapped_type& operator[](key_type&& key)
+        {
+            return try_emplace(AZStd::move(key)).first->second;
+        }
+
+        /**
+         * Returns mapped type with based on the key, if the element doesn't exist an assert it triggered!
+         */
+        mapped_type& at(const key_type& key)
+        {
+            iterator iter = base_type::find(key);
+            AZSTD_CONTAINER_ASSERT(iter != base_type::end(), "Element with key is not present");
+            return iter->second;
+        }
+        const mapped_type& at(const key_type& key) const
+        {
+            const_iterator iter = base_type::find(key);
+            AZSTD_CONTAINER_ASSERT(iter != base_type::end(), "Element with key is not present");
+            return iter->second;
+        }
+
+        //! C++17 try_emplace function that does nothing to the arguments if the key exist in the container,
+        //! otherwise it constructs the value type as if invoking
+        //! value_type(AZStd::piecewise_construct, AZStd::forward_as_tuple(AZStd::forward<KeyType>(key)),
+        //!  AZStd::forward_as_tuple(AZStd::forward<Args>(args)...))
+        template<typename... Args>
+        pair_iter_bool try_emplace(const key_type& key, Args&&... arguments)
+        {
+            return base_type::insert_unique(key, AZStd::piecewise_construct, AZStd::forward_as_tuple(key),
+                AZStd::forward_as_tuple(AZStd::forward<Args>(arguments)...));
+        }
+        template<typename... Args>
+        pair_iter_bool try_emplace(key_type&& key, Args&&... arguments)
+        {
+            return base_type::insert_unique(key, AZStd::piecewise_construct, AZStd::forward_as_tuple(AZStd::move(key)),
+                AZStd::forward_as_tuple(AZStd::forward<Args>(arguments)...));
+        }
+        template<typename... Args>
+        iterator try_emplace(const_iterator, const key_type& key, Args&&... arguments)
+        {
+            return try_emplace(key, AZStd::forward<Args>(arguments)...).first;
+        }
+        template<typename... Args>
+        iterator try_emplace(const_iterator, key_type&& key, Args&&... arguments)
+        {
+            return try_emplace(AZStd::move(key), AZStd::forward<Args>(arguments)...).first;
+        }
+
+        //! C++17 insert_or_assign function assigns the element to the mapped_type if the key exist in the container
+        //! Otherwise a new value is inserted into the container
+        template<typename M>
+        pair_iter_bool insert_or_assign(const key_type& key, M&& value)
+        {
+            pair_iter_bool result = try_emplace(key, AZStd::forward<M>(value));
+            if (!result.second)
+            {
+                result.first->second = AZStd::forward<M>(value);
+            }
+            return result;
+        }
+        template<typename M>
+        pair_iter_bool insert_or_assign(key_type&& key, M&& value)
+        {
+            pair_iter_bool result = try_emplace(AZStd::move(key), AZStd::forward<M>(value));
+            if (!result.second)
+            {
+                result.first->second = AZStd::forward<M>(value);
+            }
+            return result;
+        }
+        template<typename M>
+        iterator insert_or_assign(const_iterator, const key_type& key, M&& value)
+        {
+            return insert_or_assign(key, AZStd::forward<M>(value)).first;
+        }
+        template<typename M>
+        iterator insert_or_assign(const_iterator, key_type&& key, M&& value)
+        {
+            return insert_or_assign(AZStd::move(key), AZStd::forward<M>(value)).first;
+        }
+
+        /**
+         * \anchor FlatHashMapExtensions
+         * \name Extensions
+         * @{
+         */
+        /**
+         * Insert a pair with default value base on a key only (AKA lazy insert).
+         */
+        pair_iter_bool insert_key(const key_type& key)
+        {
+            return try_emplace(key);
+        }
+        /// @}
+    };
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE void swap(flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& left, flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& right)
+    {
+        left.swap(right);
+    }
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    bool operator==(const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& a, const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& b)
+    {
+        if (a.size() != b.size())
+        {
+            return false;
+        }
+        for (const auto& value : a)
+        {
+            auto it = b.find(value.first);
+            if (it == b.end() || !(it->second == value.second))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE bool operator!=(const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& a, const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& b)
+    {
+        return !(a == b);
+    }
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator, class Predicate>
+    decltype(auto) erase_if(flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& container, Predicate predicate)
+    {
+        auto originalSize = container.size();
+        for (auto iter = container.begin(); iter != container.end();)
+        {
+            if (predicate(*iter))
+            {
+                iter = container.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+        return originalSize - container.size();
+    }
+} // namespace AZStd
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/flat_hash_table.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class Hasher, class EqualKey, class Allocator>
+        struct FlatHashSetTableTraits
+        {
+            using key_type = Key;
+            using key_eq = EqualKey;
+            using hasher = Hasher;
+            using value_type = Key;
+            using allocator_type = Allocator;
+
+            static AZ_FORCE_INLINE const key_type& key_from_value(const value_type& value) { return value; }
+            static AZ_FORCE_INLINE void transfer(value_type* destination, value_type* source)
+            {
+                new (destination) value_type(AZStd::move(*source));
+                source->~value_type();
+            }
+        };
+    }
+
+    /**
+     * Open addressing hash set, a drop in replacement for \ref unordered_set where lookups are hot and iterator/reference stability
+     * over inserts isn't needed. Values are stored inline, see \ref flat_hash_table for the details and trade offs.
+     * Heterogeneous lookup is enabled when both the Hasher and EqualKey have an is_transparent type.
+     */
+    template<class Key, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_hash_set
+        : public flat_hash_table<Internal::FlatHashSetTableTraits<Key, Hasher, EqualKey, Allocator>>
+    {
+        using this_type = flat_hash_set<Key, Hasher, EqualKey, Allocator>;
+        using base_type = flat_hash_table<Internal::FlatHashSetTableTraits<Key, Hasher, EqualKey, Allocator>>;
+
+    public:
+        using key_type = typename base_type::key_type;
+        using key_eq = typename base_type::key_eq;
+        using hasher = typename base_type::hasher;
+
+        using allocator_type = typename base_type::allocator_type;
+        using size_type = typename base_type::size_type;
+        using difference_type = typename base_type::difference_type;
+        using pointer = typename base_type::pointer;
+        using const_pointer = typename base_type::const_pointer;
+        using reference = typename base_type::reference;
+        using const_reference = typename base_type::const_reference;
+        using value_type = typename base_type::value_type;
+
+        using iterator = typename base_type::iterator;
+        using const_iterator = typename base_type::const_iterator;
+
+        flat_hash_set()
+            : base_type(hasher(), key_eq(), allocator_type())
+        {
+        }
+        explicit flat_hash_set(const allocator_type& allocator)
+            : base_type(hasher(), key_eq(), allocator)
+        {
+        }
+        /// This constructor is AZStd extension (so we don't rehash/allocate memory)
+        flat_hash_set(const hasher& hash, const key_eq& keyEqual, const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+        }
+        explicit flat_hash_set(size_type numBucketsHint, const hasher& hash = hasher(), const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::rehash(numBucketsHint);
+        }
+        template<class Iterator>
+        flat_hash_set(Iterator first, Iterator last, size_type numBucketsHint = 0, const hasher& hash = hasher(), const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::rehash(numBucketsHint);
+            base_type::insert(first, last);
+        }
+        flat_hash_set(std::initializer_list<value_type> list, const hasher& hash = hasher(), const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::insert(list);
+        }
+        flat_hash_set(const this_type& rhs) = default;
+        flat_hash_set(this_type&& rhs) = default;
+
+        this_type& operator=(const this_type& rhs) = default;
+        this_type& operator=(this_type&& rhs) = default;
+    };
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE void swap(flat_hash_set<Key, Hasher, EqualKey, Allocator>& left, flat_hash_set<Key, Hasher, EqualKey, Allocator>& right)
+    {
+        left.swap(right);
+    }
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    bool operator==(const flat_hash_set<Key, Hasher, EqualKey, Allocator>& a, const flat_hash_set<Key, Hasher, EqualKey, Allocator>& b)
+    {
+        if (a.size() != b.size())
+        {
+            return false;
+        }
+        for (const auto& value : a)
+        {
+            if (!b.contains(value))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE bool operator!=(const flat_hash_set<Key, Hasher, EqualKey, Allocator>& a, const flat_hash_set<Key, Hasher, EqualKey, Allocator>& b)
+    {
+        return !(a == b);
+    }
+
+    template<class Key, class Hasher, class EqualKey, class Allocator, class Predicate>
+    decltype(auto) erase_if(flat_hash_set<Key, Hasher, EqualKey, Allocator>& container, Predicate predicate)
+    {
+        auto originalSize = container.size();
+        for (auto iter = container.begin(); iter != container.end();)
+        {
+            if (predicate(*iter))
+            {
+                iter = container.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+        return originalSize - container.size();
+    }
+} // namespace AZStd
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/flat_tree.h>
+#include <AzCore/std/tuple.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class MappedType, class KeyEq, class Allocator>
+        struct FlatMapTreeTraits
+        {
+            using key_type = Key;
+            using key_eq = KeyEq;
+            using value_type = AZStd::pair<Key, MappedType>;
+            using allocator_type = Allocator;
+            static AZ_FORCE_INLINE const key_type& key_from_value(const value_type& value) { return value.first; }
+        };
+    }
+
+    /**
+     * Ordered map stored as a sorted vector, interface compatible with \ref map for unique keys.
+     * Use it for small maps or maps that are built once and looked up/iterated often, see \ref flat_tree for the trade offs.
+     * Heterogeneous lookup is enabled when Compare has an is_transparent type (e.g. AZStd::less<>).
+     */
+    template<class Key, class MappedType, class Compare = AZStd::less<Key>, class Allocator = AZStd::allocator>
+    class flat_map
+        : public flat_tree<Internal::FlatMapTreeTraits<Key, MappedType, Compare, Allocator>>
+    {
+        using this_type = flat_map<Key, MappedType, Compare, Allocator>;
+        using base_type = flat_tree<Internal::FlatMapTreeTraits<Key, MappedType, Compare, Allocator>>;
+
+    public:
+        using key_type = typename base_type::key_type;
+        using key_compare = typename base_type::key_compare;
+        using mapped_type = MappedType;
+        using value_type = typename base_type::value_type;
+
+        using allocator_type = typename base_type::allocator_type;
+        using size_type = typename base_type::size_type;
+        using difference_type = typename base_type::difference_type;
+        using pointer = typename base_type::pointer;
+        using const_pointer = typename base_type::const_pointer;
+        using reference = typename base_type::reference;
+        using const_reference = typename base_type::const_reference;
+
+        using iterator = typename base_type::iterator;
+        using const_iterator = typename base_type::const_iterator;
+        using reverse_iterator = typename base_type::reverse_iterator;
+        using const_reverse_iterator = typename base_type::const_reverse_iterator;
+        using pair_iter_bool = AZStd::pair<iterator, bool>;
+
+        flat_map()
+            : base_type(key_compare(), allocator_type())
+        {
+        }
+        explicit flat_map(const allocator_type& allocator)
+            : base_type(key_compare(), allocator)
+        {
+        }
+        explicit flat_map(const key_compare& compare, const allocator_type& allocator = allocator_type())
+            : base_type(compare, allocator)
+        {
+        }
+        template<class InputIterator>
+        flat_map(InputIterator first, InputIterator last, const key_compare& compare = key_compare(), const allocator_type& allocator = allocator_type())
+            : base_type(compare, allocator)
+        {
+            base_type::insert(first, last);
+        }
+        flat_map(std::initializer_list<value_type> list, const key_compare& compare = key_compare(), const allocator_type& allocator = allocator_type())
+            : base_type(compare, allocator)
+        {
+            base_type::insert(list);
+        }
+        flat_map(const this_type& rhs) = default;
+        flat_map(this_type&& rhs) = default;
+
+        this_type& operator=(const this_type& rhs) = default;
+        this_type& operator=(this_type&& rhs) = default;
+
+        /**
+         * Look up operator if element doesn't exists inserts a new one with (key,mapped_type()).
+         */
+        mapped_type& operator[](const key_type& key)
+        {
+            return try_emplace(key).first->second;
+        }
+        mapped_type& operator[](key_type&& key)
+        {
+            return try_emplace(AZStd::move(key)).first->second;
+        }
+
+        /**
+         * Returns mapped type with based on the key, if the element doesn't exist an assert it triggered!
+         */
+        mapped_type& at(const key_type& key)
+        {
+            iterator iter = base_type::find(key);
+            AZSTD_CONTAINER_ASSERT(iter != base_type::end(), "Element with key is not present");
+            return iter->second;
+        }
+        const mapped_type& at(const key_type& key) const
+        {
+            const_iterator iter = base_type::find(key);
+            AZSTD_CONTAINER_ASSERT(iter != base_type::end(), "Element with key is not present");
+            return iter->second;
+        }
+
+        //! C++17 try_emplace function that does nothing to the arguments if the key exist in the container,
+        //! otherwise it constructs the value type as if invoking
+        //! value_type(AZStd::piecewise_construct, AZStd::forward_as_tuple(AZStd::forward<KeyType>(key)),
+        //!  AZStd::forward_as_tuple(AZStd::forward<Args>(args)...))
+        template<typename... Args>
+        pair_iter_bool try_emplace(const key_type& key, Args&&... arguments)
+        {
+            return base_type::insert_unique(key, AZStd::piecewise_construct, AZStd::forward_as_tuple(key),
+                AZStd::forward_as_tuple(AZStd::forward<Args>(arguments)...));
+        }
+        template<typename... Args>
+        pair_iter_bool try_emplace(key_type&& key, Args&&... arguments)
+        {
+            return base_type::insert_unique(key, AZStd::piecewise_construct, AZStd::forward_as_tuple(AZStd::move(key)),
+                AZStd::forward_as_tuple(AZStd::forward<Args>(arguments)...));
+        }
+        template<typename... Args>
+        iterator try_emplace(const_iterator, const key_type& key, Args&&... arguments)
+        {
+            return try_emplace(key, AZStd::forward<Args>(arguments)...).first;
+        }
+        template<typename... Args>
+        iterator try_emplace(const_iterator, key_type&& key, Args&&... arguments)
+        {
+            return try_emplace(AZStd::move(key), AZStd::forward<Args>(arguments)...).first;
+        }
+
+        //! C++17 insert_or_assign function assigns the element to the mapped_type if the key exist in the container
+        //! Otherwise a new value is inserted into the container
+        template<typename M>
+        pair_iter_bool insert_or_assign(const key_type& key, M&& value)
+        {
+            pair_iter_bool result = try_emplace(key, AZStd::forward<M>(value));
+            if (!result.second)
+            {
+                result.first->second = AZStd::forward<M>(value);
+            }
+            return result;
+        }
+        template<typename M>
+        pair_iter_bool insert_or_assign(key_type&& key, M&& value)
+        {
+            pair_iter_bool result = try_emplace(AZStd::move(key), AZStd::forward<M>(value));
+            if (!result.second)
+            {
+                result.first->second = AZStd::forward<M>(value);
+            }
+            return result;
+        }
+        template<typename M>
+        iterator insert_or_assign(const_iterator, const key_type& key, M&& value)
+        {
+            return insert_or_assign(key, AZStd::forward<M>(value)).first;
+        }
+        template<typename M>
+        iterator insert_or_assign(const_iterator, key_type&& key, M&& value)
+        {
+            return insert_or_assign(AZStd::move(key), AZStd::forward<M>(value)).first;
+        }
+    };
+
+    template<class Key, class MappedType, class Compare, class Allocator>
+    AZ_FORCE_INLINE void swap(flat_map<Key, MappedType, Compare, Allocator>& left, flat_map<Key, MappedType, Compare, Allocator>& right)
+    {
+        left.swap(right);
+    }
+
+    template<class Key, class MappedType, class Compare, class Allocator>
+    inline bool operator==(const flat_map<Key, MappedType, Compare, Allocator>& left, const flat_map<Key, MappedType, Compare, Allocator>& right)
+    {
+        return (left.size() == right.size()
+                && equal(left.begin(), left.end(), right.begin()));
+    }
+
+    template<class Key, class MappedType, class Compare, class Allocator>
+    inline bool operator!=(const flat_map<Key, MappedType, Compare, Allocator>& left, const flat_map<Key, MappedType, Compare, Allocator>& right)
+    {
+        return (!(left == right));
+    }
+
+    template<class Key, class MappedType, class Compare, class Allocator, class Predicate>
+    decltype(auto) erase_if(flat_map<Key, MappedType, Compare, Allocator>& container, Predicate predicate)
+    {
+        auto originalSize = container.size();
+        container.erase(AZStd::remove_if(container.begin(), container.end(), predicate), container.end());
+        return originalSize - container.size();
+    }
+} // namespace AZStd
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/flat_tree.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class KeyEq, class Allocator>
+        struct FlatSetTreeTraits
+        {
+            using key_type = Key;
+            using key_eq = KeyEq;
+            using value_type = Key;
+            using allocator_type = Allocator;
+            static AZ_FORCE_INLINE const key_type& key_from_value(const value_type& value) { return value; }
+        };
+    }
+
+    /**
+     * Ordered set stored as a sorted vector, interface compatible with \ref set.
+     * Use it for small sets or sets that are built once and looked up/iterated often, see \ref flat_tree for the trade offs.
+     * Heterogeneous lookup is enabled when Compare has an is_transparent type (e.g. AZStd::less<>).
+     */
+    template<class Key, class Compare = AZStd::less<Key>, class Allocator = AZStd::allocator>
+    class flat_set
+        : public flat_tree<Internal::FlatSetTreeTraits<Key, Compare, Allocator>>
+    {
+        using this_type = flat_set<Key, Compare, Allocator>;
+        using base_type = flat_tree<Internal::FlatSetTreeTraits<Key, Compare, Allocator>>;
+
+    public:
+        using key_type = typename base_type::key_type;
+        using key_compare = typename base_type::key_compare;
+        using value_type = typename base_type::value_type;
+
+        using allocator_type = typename base_type::allocator_type;
+        using size_type = typename base_type::size_type;
+        using difference_type = typename base_type::difference_type;
+        using pointer = typename base_type::pointer;
+        using const_pointer = typename base_type::const_pointer;
+        using reference = typename base_type::reference;
+        using const_reference = typename base_type::const_reference;
+
+        using iterator = typename base_type::iterator;
+        using const_iterator = typename base_type::const_iterator;
+        using reverse_iterator = typename base_type::reverse_iterator;
+        using const_reverse_iterator = typename base_type::const_reverse_iterator;
+
+        flat_set()
+            : base_type(key_compare(), allocator_type())
+        {
+        }
+        explicit flat_set(const allocator_type& allocator)
+            : base_type(key_compare(), allocator)
+        {
+        }
+        explicit flat_set(const key_compare& compare, const allocator_type& allocator = allocator_type())
+            : base_type(compare, allocator)
+        {
+        }
+        template<class InputIterator>
+        flat_set(InputIterator first, InputIterator last, const key_compare& compare = key_compare(), const allocator_type& allocator = allocator_type())
+            : base_type(compare, allocator)
+        {
+            base_type::insert(first, last);
+        }
+        flat_set(std::initializer_list<value_type> list, const key_compare& compare = key_compare(), const allocator_type& allocator = allocator_type())
+            : base_type(compare, allocator)
+        {
+            base_type::insert(list);
+        }
+        flat_set(const this_type& rhs) = default;
+        flat_set(this_type&& rhs) = default;
+
+        this_type& operator=(const this_type& rhs) = default;
+        this_type& operator=(this_type&& rhs) = default;
+    };
+
+    template<class Key, class Compare, class Allocator>
+    AZ_FORCE_INLINE void swap(flat_set<Key, Compare, Allocator>& left, flat_set<Key, Compare, Allocator>& right)
+    {
+        left.swap(right);
+    }
+
+    template<class Key, class Compare, class Allocator>
+    inline bool operator==(const flat_set<Key, Compare, Allocator>& left, const flat_set<Key, Compare, Allocator>& right)
+    {
+        return (left.size() == right.size()
+                && equal(left.begin(), left.end(), right.begin()));
+    }
+
+    template<class Key, class Compare, class Allocator>
+    inline bool operator!=(const flat_set<Key, Compare, Allocator>& left, const flat_set<Key, Compare, Allocator>& right)
+    {
+        return (!(left == right));
+    }
+
+    template<class Key, class Compare, class Allocator, class Predicate>
+    decltype(auto) erase_if(flat_set<Key, Compare, Allocator>& container, Predicate predicate)
+    {
+        auto originalSize = container.size();
+        container.erase(AZStd::remove_if(container.begin(), container.end(), predicate), container.end());
+        return originalSize - container.size();
+    }
+} // namespace AZStd
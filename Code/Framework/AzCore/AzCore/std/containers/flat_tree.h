@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional_basic.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/typetraits/is_convertible.h>
+
+namespace AZStd
+{
+    /**
+     * Sorted vector of unique keys, the base of \ref flat_map and \ref flat_set.
+     * Lookups are binary searches over contiguous memory and iteration is a linear walk, which makes it a better fit than the node
+     * based \ref rbtree for small or mostly read containers. Inserting and erasing are linear in the size of the container, use
+     * the range insert to add many values at once.
+     * Like a vector, any insert or erase invalidates the iterators, pointers and references after the modified position.
+     *
+     * Traits must provide key_type, value_type, key_eq (the key compare), allocator_type and key_from_value(value).
+     */
+    template<class Traits>
+    class flat_tree
+    {
+        using this_type = flat_tree<Traits>;
+
+    public:
+        using traits_type = Traits;
+
+        using key_type = typename Traits::key_type;
+        using value_type = typename Traits::value_type;
+        using key_compare = typename Traits::key_eq;
+        using allocator_type = typename Traits::allocator_type;
+        using container_type = AZStd::vector<value_type, allocator_type>;
+
+        using size_type = typename container_type::size_type;
+        using difference_type = typename container_type::difference_type;
+        using pointer = typename container_type::pointer;
+        using const_pointer = typename container_type::const_pointer;
+        using reference = typename container_type::reference;
+        using const_reference = typename container_type::const_reference;
+
+        using iterator = typename container_type::iterator;
+        using const_iterator = typename container_type::const_iterator;
+        using reverse_iterator = typename container_type::reverse_iterator;
+        using const_reverse_iterator = typename container_type::const_reverse_iterator;
+
+        //! Compares values by their keys.
+        class value_compare
+        {
+        public:
+            explicit value_compare(const key_compare& compare)
+                : m_compare(compare)
+            {
+            }
+            bool operator()(const value_type& left, const value_type& right) const
+            {
+                return m_compare(Traits::key_from_value(left), Traits::key_from_value(right));
+            }
+
+        private:
+            key_compare m_compare;
+        };
+
+        flat_tree(const key_compare& compare, const allocator_type& allocator)
+            : m_values(allocator)
+            , m_compare(compare)
+        {
+        }
+
+        iterator begin() { return m_values.begin(); }
+        const_iterator begin() const { return m_values.begin(); }
+        iterator end() { return m_values.end(); }
+        const_iterator end() const { return m_values.end(); }
+        const_iterator cbegin() const { return m_values.begin(); }
+        const_iterator cend() const { return m_values.end(); }
+        reverse_iterator rbegin() { return m_values.rbegin(); }
+        const_reverse_iterator rbegin() const { return m_values.rbegin(); }
+        reverse_iterator rend() { return m_values.rend(); }
+        const_reverse_iterator rend() const { return m_values.rend(); }
+        const_reverse_iterator crbegin() const { return m_values.rbegin(); }
+        const_reverse_iterator crend() const { return m_values.rend(); }
+
+        bool empty() const { return m_values.empty(); }
+        size_type size() const { return m_values.size(); }
+        size_type max_size() const { return m_values.max_size(); }
+        size_type capacity() const { return m_values.capacity(); }
+        void reserve(size_type numElements) { m_values.reserve(numElements); }
+        void shrink_to_fit() { m_values.shrink_to_fit(); }
+        void clear() { m_values.clear(); }
+
+        //! The values in key order, as an array.
+        const value_type* data() const { return m_values.data(); }
+
+        key_compare key_comp() const { return m_compare; }
+        value_compare value_comp() const { return value_compare(m_compare); }
+
+        /// The only difference from the standard is that we return the allocator instance, not a copy.
+        allocator_type& get_allocator() { return m_values.get_allocator(); }
+        const allocator_type& get_allocator() const { return m_values.get_allocator(); }
+
+        AZStd::pair<iterator, bool> insert(const value_type& value)
+        {
+            return insert_unique(Traits::key_from_value(value), value);
+        }
+        AZStd::pair<iterator, bool> insert(value_type&& value)
+        {
+            return insert_unique(Traits::key_from_value(value), AZStd::move(value));
+        }
+
+        //! Inserts next to the hint if it is the right position, which makes inserting already sorted values constant time.
+        iterator insert(const_iterator hint, const value_type& value)
+        {
+            return insert_hint(hint, value);
+        }
+        iterator insert(const_iterator hint, value_type&& value)
+        {
+            return insert_hint(hint, AZStd::move(value));
+        }
+
+        //! Appends the values and sorts them in once, instead of shifting the container for every value.
+        //! Like the single value insert, values with a key already in the container or earlier in the range are skipped.
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last)
+        {
+            const size_type oldSize = m_values.size();
+            for (; first != last; ++first)
+            {
+                m_values.emplace_back(*first);
+            }
+            if (m_values.size() == oldSize)
+            {
+                return;
+            }
+
+            const value_compare compare = value_comp();
+            AZStd::stable_sort(m_values.begin() + oldSize, m_values.end(), compare);
+            if (oldSize > 0 && compare(m_values[oldSize - 1], m_values[oldSize]))
+            {
+                // Every new value goes after the existing ones, only duplicates within the range need removing
+                m_values.erase(AZStd::unique(m_values.begin() + oldSize, m_values.end(), equivalent_values(compare)), m_values.end());
+                return;
+            }
+            std::inplace_merge(m_values.begin(), m_values.begin() + oldSize, m_values.end(), compare);
+            m_values.erase(AZStd::unique(m_values.begin(), m_values.end(), equivalent_values(compare)), m_values.end());
+        }
+
+        void insert(std::initializer_list<value_type> list)
+        {
+            insert(list.begin(), list.end());
+        }
+
+        template<class... Args>
+        AZStd::pair<iterator, bool> emplace(Args&&... args)
+        {
+            value_type value(AZStd::forward<Args>(args)...);
+            return insert_unique(Traits::key_from_value(value), AZStd::move(value));
+        }
+
+        template<class... Args>
+        iterator emplace_hint(const_iterator hint, Args&&... args)
+        {
+            return insert_hint(hint, value_type(AZStd::forward<Args>(args)...));
+        }
+
+        iterator erase(const_iterator it)
+        {
+            return m_values.erase(it);
+        }
+        iterator erase(iterator it)
+        {
+            return m_values.erase(it);
+        }
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            return m_values.erase(first, last);
+        }
+
+        template<class ComparableToKey>
+        auto erase(const ComparableToKey& key)
+            -> enable_if_t<Internal::is_transparent<key_compare, ComparableToKey>::value || AZStd::is_convertible_v<ComparableToKey, key_type>, size_type>
+        {
+            iterator it = find(key);
+            if (it == end())
+            {
+                return 0;
+            }
+            m_values.erase(it);
+            return 1;
+        }
+
+        template<class ComparableToKey>
+        auto lower_bound(const ComparableToKey& key)
+            -> enable_if_t<Internal::is_transparent<key_compare, ComparableToKey>::value || AZStd::is_convertible_v<ComparableToKey, key_type>, iterator>
+        {
+            return AZStd::lower_bound(m_values.begin(), m_values.end(), key,
+                [this](const value_type& value, const ComparableToKey& searchKey) { return m_compare(Traits::key_from_value(value), searchKey); });
+        }
+        template<class ComparableToKey>
+        auto lower_bound(const ComparableToKey& key) const
+            -> enable_if_t<Internal::is_transparent<key_compare, ComparableToKey>::value || AZStd::is_convertible_v<ComparableToKey, key_type>, const_iterator>
+        {
+            return const_cast<flat_tree*>(this)->lower_bound(key);
+        }
+
+        template<class ComparableToKey>
+        auto upper_bound(const ComparableToKey& key)
+            -> enable_if_t<Internal::is_transparent<key_compare, ComparableToKey>::value || AZStd::is_convertible_v<ComparableToKey, key_type>, iterator>
+        {
+            return AZStd::upper_bound(m_values.begin(), m_values.end(), key,
+                [this](const ComparableToKey& searchKey, const value_type& value) { return m_compare(searchKey, Traits::key_from_value(value)); });
+        }
+        template<class ComparableToKey>
+        auto upper_bound(const ComparableToKey& key) const
+            -> enable_if_t<Internal::is_transparent<key_compare, ComparableToKey>::value || AZStd::is_convertible_v<ComparableToKey, key_type>, const_iterator>
+        {
+            return const_cast<flat_tree*>(this)->upper_bound(key);
+        }
+
+        template<class ComparableToKey>
+        auto equal_range(const ComparableToKey& key)
+            -> enable_if_t<Internal::is_transparent<key_compare, ComparableToKey>::value || AZStd::is_convertible_v<ComparableToKey, key_type>, AZStd::pair<iterator, iterator>>
+        {
+            iterator first = lower_bound(key);
+            iterator last = (first != end() && !m_compare(key, Traits::key_from_value(*first))) ? first + 1 : first;
+            return { first, last };
+        }
+        template<class ComparableToKey>
+        auto equal_range(const ComparableToKey& key) const
+            -> enable_if_t<Internal::is_transparent<key_compare, ComparableToKey>::value || AZStd::is_convertible_v<ComparableToKey, key_type>, AZStd::pair<const_iterator, const_iterator>>
+        {
+            auto range = const_cast<flat_tree*>(this)->equal_range(key);
+            return { range.first, range.second };
+        }
+
+        template<class ComparableToKey>
+        auto find(const ComparableToKey& key)
+            -> enable_if_t<Internal::is_transparent<key_compare, ComparableToKey>::value || AZStd::is_convertible_v<ComparableToKey, key_type>, iterator>
+        {
+            iterator it = lower_bound(key);
+            return (it != end() && !m_compare(key, Traits::key_from_value(*it))) ? it : end();
+        }
+        template<class ComparableToKey>
+        auto find(const ComparableToKey& key) const
+            -> enable_if_t<Internal::is_transparent<key_compare, ComparableToKey>::value || AZStd::is_convertible_v<ComparableToKey, key_type>, const_iterator>
+        {
+            return const_cast<flat_tree*>(this)->find(key);
+        }
+
+        template<class ComparableToKey>
+        auto contains(const ComparableToKey& key) const
+            -> enable_if_t<Internal::is_transparent<key_compare, ComparableToKey>::value || AZStd::is_convertible_v<ComparableToKey, key_type>, bool>
+        {
+            return find(key) != end();
+        }
+
+        template<class ComparableToKey>
+        auto count(const ComparableToKey& key) const
+            -> enable_if_t<Internal::is_transparent<key_compare, ComparableToKey>::value || AZStd::is_convertible_v<ComparableToKey, key_type>, size_type>
+        {
+            return contains(key) ? 1 : 0;
+        }
+
+        void swap(this_type& rhs)
+        {
+            m_values.swap(rhs.m_values);
+            AZStd::swap(m_compare, rhs.m_compare);
+        }
+
+        bool validate() const
+        {
+            const value_compare compare = value_comp();
+            for (size_type i = 1; i < m_values.size(); ++i)
+            {
+                if (!compare(m_values[i - 1], m_values[i]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    protected:
+        //! Inserts the value if no value with the same key is in the container.
+        template<class ComparableToKey, class... Args>
+        AZStd::pair<iterator, bool> insert_unique(const ComparableToKey& key, Args&&... args)
+        {
+            iterator it = lower_bound(key);
+            if (it != end() && !m_compare(key, Traits::key_from_value(*it)))
+            {
+                return { it, false };
+            }
+            return { m_values.emplace(it, AZStd::forward<Args>(args)...), true };
+        }
+
+        template<class Value>
+        iterator insert_hint(const_iterator hint, Value&& value)
+        {
+            const key_type& key = Traits::key_from_value(value);
+            const bool afterPrevious = hint == cbegin() || m_compare(Traits::key_from_value(*(hint - 1)), key);
+            const bool beforeHint = hint == cend() || m_compare(key, Traits::key_from_value(*hint));
+            if (afterPrevious && beforeHint)
+            {
+                return m_values.emplace(hint, AZStd::forward<Value>(value));
+            }
+            return insert_unique(key, AZStd::forward<Value>(value)).first;
+        }
+
+        static auto equivalent_values(const value_compare& compare)
+        {
+            return [compare](const value_type& left, const value_type& right) { return !compare(left, right) && !compare(right, left); };
+        }
+
+        container_type m_values;
+        key_compare m_compare;
+    };
+} // namespace AZStd
@@ -0,0 +1,957 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/allocator_traits.h>
+#include <AzCore/std/functional_basic.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/typetraits/alignment_of.h>
+#include <AzCore/std/typetraits/is_destructible.h>
+#include <AzCore/std/utils.h>
+#include <AzCore/Math/MathIntrinsics.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#   include <emmintrin.h>
+#elif AZ_TRAIT_USE_PLATFORM_SIMD_NEON
+#   include <arm_neon.h>
+#endif
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        //! Control byte of a flat hash table slot. Full slots store the low 7 bits of the hash of their key, so a whole group of slots
+        //! can be filtered with a single compare before any key is compared. Empty and deleted slots have the sign bit set.
+        using flat_hash_ctrl = int8_t;
+        static constexpr flat_hash_ctrl flat_hash_ctrl_empty = -128;
+        static constexpr flat_hash_ctrl flat_hash_ctrl_deleted = -2;
+        // Never stored, empty and deleted are the only control values below it.
+        static constexpr flat_hash_ctrl flat_hash_ctrl_sentinel = -1;
+
+        //! One bit (or one bit every 2^Shift bits) per slot of a group, set for the slots matching a query.
+        template<class MaskType, uint32_t Shift>
+        class flat_hash_bitmask
+        {
+        public:
+            explicit flat_hash_bitmask(MaskType mask)
+                : m_mask(mask)
+            {
+            }
+
+            explicit operator bool() const
+            {
+                return m_mask != 0;
+            }
+
+            //! Index in the group of the first matching slot, the mask must not be empty.
+            uint32_t lowest() const
+            {
+                if constexpr (sizeof(MaskType) == sizeof(uint64_t))
+                {
+                    return static_cast<uint32_t>(az_ctz_u64(m_mask)) >> Shift;
+                }
+                else
+                {
+                    return static_cast<uint32_t>(az_ctz_u32(m_mask)) >> Shift;
+                }
+            }
+
+            //! Removes the first matching slot.
+            void pop()
+            {
+                m_mask &= (m_mask - 1);
+            }
+
+        private:
+            MaskType m_mask;
+        };
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        //! Control bytes of 16 consecutive slots, probed together with SSE2 compares.
+        class flat_hash_group
+        {
+        public:
+            static constexpr size_t width = 16;
+            using bitmask = flat_hash_bitmask<uint32_t, 0>;
+
+            explicit flat_hash_group(const flat_hash_ctrl* ctrl)
+                : m_ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)))
+            {
+            }
+
+            bitmask match(flat_hash_ctrl h2) const
+            {
+                return bitmask(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_ctrl))));
+            }
+
+            bitmask match_empty() const
+            {
+                return match(flat_hash_ctrl_empty);
+            }
+
+            bitmask match_empty_or_deleted() const
+            {
+                return bitmask(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(flat_hash_ctrl_sentinel), m_ctrl))));
+            }
+
+        private:
+            __m128i m_ctrl;
+        };
+#elif AZ_TRAIT_USE_PLATFORM_SIMD_NEON
+        //! Control bytes of 8 consecutive slots, probed together with NEON compares.
+        class flat_hash_group
+        {
+        public:
+            static constexpr size_t width = 8;
+            using bitmask = flat_hash_bitmask<uint64_t, 3>;
+
+            explicit flat_hash_group(const flat_hash_ctrl* ctrl)
+                : m_ctrl(vld1_s8(ctrl))
+            {
+            }
+
+            bitmask match(flat_hash_ctrl h2) const
+            {
+                return to_bitmask(vceq_s8(vdup_n_s8(h2), m_ctrl));
+            }
+
+            bitmask match_empty() const
+            {
+                return match(flat_hash_ctrl_empty);
+            }
+
+            bitmask match_empty_or_deleted() const
+            {
+                return to_bitmask(vcgt_s8(vdup_n_s8(flat_hash_ctrl_sentinel), m_ctrl));
+            }
+
+        private:
+            static bitmask to_bitmask(uint8x8_t lanes)
+            {
+                return bitmask(vget_lane_u64(vreinterpret_u64_u8(lanes), 0) & 0x8080808080808080ull);
+            }
+
+            int8x8_t m_ctrl;
+        };
+#else
+        //! Control bytes of 8 consecutive slots, probed together with 64 bit integer operations.
+        class flat_hash_group
+        {
+        public:
+            static constexpr size_t width = 8;
+            using bitmask = flat_hash_bitmask<uint64_t, 3>;
+
+            explicit flat_hash_group(const flat_hash_ctrl* ctrl)
+            {
+                memcpy(&m_ctrl, ctrl, sizeof(m_ctrl));
+            }
+
+            //! May report a full slot following a real match as a false positive, which the key compare filters out.
+            bitmask match(flat_hash_ctrl h2) const
+            {
+                const uint64_t x = m_ctrl ^ (Lsbs * static_cast<uint8_t>(h2));
+                return bitmask((x - Lsbs) & ~x & Msbs);
+            }
+
+            bitmask match_empty() const
+            {
+                return bitmask((m_ctrl & (~m_ctrl << 6)) & Msbs);
+            }
+
+            bitmask match_empty_or_deleted() const
+            {
+                return bitmask((m_ctrl & (~m_ctrl << 7)) & Msbs);
+            }
+
+        private:
+            static constexpr uint64_t Lsbs = 0x0101010101010101ull;
+            static constexpr uint64_t Msbs = 0x8080808080808080ull;
+
+            uint64_t m_ctrl;
+        };
+#endif
+
+        //! AZStd::hash is the identity for integral types, spread every bit of the hash over both the probe start and the control byte.
+        inline size_t flat_hash_mix(size_t hash)
+        {
+            if constexpr (sizeof(size_t) == sizeof(uint64_t))
+            {
+                const uint64_t mixed = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+                return static_cast<size_t>(mixed ^ (mixed >> 32));
+            }
+            else
+            {
+                const uint32_t mixed = static_cast<uint32_t>(hash) * 0x9E3779B9u;
+                return static_cast<size_t>(mixed ^ (mixed >> 16));
+            }
+        }
+    } // namespace Internal
+
+    /**
+     * Open addressing hash table, the base of \ref flat_hash_map and \ref flat_hash_set.
+     * Values are stored inline in a single allocation together with one control byte per slot. Lookups probe a group of slots
+     * at a time (16 with SSE, 8 otherwise) by comparing 7 bits of the hash of the key with every control byte of the group at once,
+     * so a lookup usually compares a single key and touches one or two cache lines, compared to a list node per element for
+     * \ref hash_table.
+     *
+     * Unlike \ref hash_table, an insert that grows the table invalidates all the iterators, pointers and references to its values,
+     * and values must be move constructible. The table is kept at most 7/8th full.
+     *
+     * Traits must provide key_type, value_type, hasher, key_eq, allocator_type, key_from_value(value) and
+     * transfer(destination, source), which move constructs a value to an uninitialized slot and destroys the source.
+     */
+    template<class Traits>
+    class flat_hash_table
+    {
+        using this_type = flat_hash_table<Traits>;
+        using ctrl_type = Internal::flat_hash_ctrl;
+        using group_type = Internal::flat_hash_group;
+
+    public:
+        using traits_type = Traits;
+
+        using key_type = typename Traits::key_type;
+        using key_eq = typename Traits::key_eq;
+        using hasher = typename Traits::hasher;
+        using value_type = typename Traits::value_type;
+        using allocator_type = typename Traits::allocator_type;
+
+        using size_type = typename allocator_type::size_type;
+        using difference_type = typename allocator_type::difference_type;
+        using pointer = value_type*;
+        using const_pointer = const value_type*;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+
+        template<bool IsConst>
+        class iterator_impl
+        {
+            friend class flat_hash_table;
+            template<bool>
+            friend class iterator_impl;
+
+        public:
+            using iterator_category = forward_iterator_tag;
+            using value_type = typename Traits::value_type;
+            using difference_type = typename flat_hash_table::difference_type;
+            using pointer = conditional_t<IsConst, const value_type*, value_type*>;
+            using reference = conditional_t<IsConst, const value_type&, value_type&>;
+
+            iterator_impl() = default;
+
+            template<bool OtherIsConst, class = enable_if_t<IsConst && !OtherIsConst>>
+            iterator_impl(const iterator_impl<OtherIsConst>& rhs)
+                : m_ctrl(rhs.m_ctrl)
+                , m_slot(rhs.m_slot)
+                , m_end(rhs.m_end)
+            {
+            }
+
+            reference operator*() const
+            {
+                return *m_slot;
+            }
+
+            pointer operator->() const
+            {
+                return m_slot;
+            }
+
+            iterator_impl& operator++()
+            {
+                ++m_ctrl;
+                ++m_slot;
+                skip_free_slots();
+                return *this;
+            }
+
+            iterator_impl operator++(int)
+            {
+                iterator_impl result = *this;
+                ++(*this);
+                return result;
+            }
+
+            template<bool OtherIsConst>
+            bool operator==(const iterator_impl<OtherIsConst>& rhs) const
+            {
+                return m_ctrl == rhs.m_ctrl;
+            }
+
+            template<bool OtherIsConst>
+            bool operator!=(const iterator_impl<OtherIsConst>& rhs) const
+            {
+                return m_ctrl != rhs.m_ctrl;
+            }
+
+        private:
+            iterator_impl(const ctrl_type* ctrl, pointer slot, const ctrl_type* end)
+                : m_ctrl(ctrl)
+                , m_slot(slot)
+                , m_end(end)
+            {
+            }
+
+            void skip_free_slots()
+            {
+                while (m_ctrl != m_end && *m_ctrl < 0)
+                {
+                    ++m_ctrl;
+                    ++m_slot;
+                }
+            }
+
+            const ctrl_type* m_ctrl = nullptr;
+            pointer m_slot = nullptr;
+            const ctrl_type* m_end = nullptr;
+        };
+
+        using iterator = iterator_impl<false>;
+        using const_iterator = iterator_impl<true>;
+
+        static constexpr size_type group_width = group_type::width;
+
+        flat_hash_table(const hasher& hash, const key_eq& keyEqual, const allocator_type& allocator)
+            : m_hasher(hash)
+            , m_keyEqual(keyEqual)
+            , m_allocator(allocator)
+        {
+        }
+
+        flat_hash_table(const flat_hash_table& rhs)
+            : m_hasher(rhs.m_hasher)
+            , m_keyEqual(rhs.m_keyEqual)
+            , m_allocator(rhs.m_allocator)
+        {
+            copy_from(rhs);
+        }
+
+        flat_hash_table(flat_hash_table&& rhs)
+            : m_hasher(AZStd::move(rhs.m_hasher))
+            , m_keyEqual(AZStd::move(rhs.m_keyEqual))
+            , m_allocator(rhs.m_allocator)
+        {
+            steal(rhs);
+        }
+
+        ~flat_hash_table()
+        {
+            destroy_values();
+            deallocate();
+        }
+
+        flat_hash_table& operator=(const flat_hash_table& rhs)
+        {
+            if (this != &rhs)
+            {
+                clear();
+                m_hasher = rhs.m_hasher;
+                m_keyEqual = rhs.m_keyEqual;
+                copy_from(rhs);
+            }
+            return *this;
+        }
+
+        flat_hash_table& operator=(flat_hash_table&& rhs)
+        {
+            if (this != &rhs)
+            {
+                destroy_values();
+                deallocate();
+                m_hasher = AZStd::move(rhs.m_hasher);
+                m_keyEqual = AZStd::move(rhs.m_keyEqual);
+                if (m_allocator == rhs.m_allocator)
+                {
+                    steal(rhs);
+                }
+                else
+                {
+                    // Different allocators, move the values one at a time
+                    reserve(rhs.m_size);
+                    for (value_type& value : rhs)
+                    {
+                        emplace_unchecked(AZStd::move(value));
+                    }
+                    rhs.clear();
+                }
+            }
+            return *this;
+        }
+
+        iterator begin()
+        {
+            iterator it(m_ctrl, m_slots, m_ctrl + m_capacity);
+            it.skip_free_slots();
+            return it;
+        }
+        const_iterator begin() const
+        {
+            return const_cast<flat_hash_table*>(this)->begin();
+        }
+        iterator end()
+        {
+            return iterator(m_ctrl + m_capacity, m_slots + m_capacity, m_ctrl + m_capacity);
+        }
+        const_iterator end() const
+        {
+            return const_cast<flat_hash_table*>(this)->end();
+        }
+        const_iterator cbegin() const
+        {
+            return begin();
+        }
+        const_iterator cend() const
+        {
+            return end();
+        }
+
+        bool empty() const
+        {
+            return m_size == 0;
+        }
+        size_type size() const
+        {
+            return m_size;
+        }
+        size_type max_size() const
+        {
+            return AZStd::allocator_traits<allocator_type>::max_size(m_allocator) / (sizeof(value_type) + sizeof(ctrl_type));
+        }
+
+        //! Number of slots of the table, the table grows when more than 7/8th of them are used.
+        size_type bucket_count() const
+        {
+            return m_capacity;
+        }
+        float load_factor() const
+        {
+            return m_capacity > 0 ? static_cast<float>(m_size) / static_cast<float>(m_capacity) : 0.0f;
+        }
+        float max_load_factor() const
+        {
+            return 7.0f / 8.0f;
+        }
+
+        //! Makes room for at least numElements values without growing.
+        void reserve(size_type numElements)
+        {
+            const size_type capacity = capacity_for(numElements);
+            if (capacity > m_capacity)
+            {
+                resize(capacity);
+            }
+        }
+
+        //! Rebuilds the table with at least numBuckets slots (or as many as needed for the current values), dropping the deleted slots.
+        void rehash(size_type numBuckets)
+        {
+            const size_type capacity = AZStd::max(capacity_for(m_size), numBuckets > 0 ? round_up_capacity(numBuckets) : size_type(0));
+            if (capacity == 0)
+            {
+                destroy_values();
+                deallocate();
+            }
+            else
+            {
+                resize(capacity);
+            }
+        }
+
+        template<class... Args>
+        pair<iterator, bool> emplace(Args&&... args)
+        {
+            // The key is needed before finding the slot, construct the value aside and move it in if it's not a duplicate
+            value_type value(AZStd::forward<Args>(args)...);
+            return insert_unique(Traits::key_from_value(value), AZStd::move(value));
+        }
+
+        template<class... Args>
+        iterator emplace_hint(const_iterator, Args&&... args)
+        {
+            return emplace(AZStd::forward<Args>(args)...).first;
+        }
+
+        pair<iterator, bool> insert(const value_type& value)
+        {
+            return insert_unique(Traits::key_from_value(value), value);
+        }
+
+        pair<iterator, bool> insert(value_type&& value)
+        {
+            return insert_unique(Traits::key_from_value(value), AZStd::move(value));
+        }
+
+        iterator insert(const_iterator, const value_type& value)
+        {
+            return insert(value).first;
+        }
+
+        iterator insert(const_iterator, value_type&& value)
+        {
+            return insert(AZStd::move(value)).first;
+        }
+
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last)
+        {
+            for (; first != last; ++first)
+            {
+                insert(*first);
+            }
+        }
+
+        void insert(std::initializer_list<value_type> list)
+        {
+            reserve(m_size + list.size());
+            insert(list.begin(), list.end());
+        }
+
+        iterator erase(const_iterator it)
+        {
+            const size_type index = static_cast<size_type>(it.m_ctrl - m_ctrl);
+            erase_at(index);
+            iterator next(m_ctrl + index, m_slots + index, m_ctrl + m_capacity);
+            next.skip_free_slots();
+            return next;
+        }
+
+        iterator erase(iterator it)
+        {
+            return erase(const_iterator(it));
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            while (first != last)
+            {
+                first = erase(first);
+            }
+            return iterator(const_cast<ctrl_type*>(last.m_ctrl), const_cast<pointer>(last.m_slot), last.m_end);
+        }
+
+        template<class ComparableToKey>
+        auto erase(const ComparableToKey& key)
+            -> enable_if_t<(Internal::is_transparent<key_eq, ComparableToKey>::value && Internal::is_transparent<hasher, ComparableToKey>::value) || AZStd::is_convertible_v<ComparableToKey, key_type>, size_type>
+        {
+            const size_type index = find_index(key, hash_key(key));
+            if (index == npos)
+            {
+                return 0;
+            }
+            erase_at(index);
+            return 1;
+        }
+
+        //! Destroys every value, keeping the slots allocated.
+        void clear()
+        {
+            if (m_capacity > 0)
+            {
+                destroy_values();
+                reset_ctrl();
+                m_size = 0;
+                m_growthLeft = growth_limit(m_capacity);
+            }
+        }
+
+        template<class ComparableToKey>
+        auto find(const ComparableToKey& key)
+            -> enable_if_t<(Internal::is_transparent<key_eq, ComparableToKey>::value && Internal::is_transparent<hasher, ComparableToKey>::value) || AZStd::is_convertible_v<ComparableToKey, key_type>, iterator>
+        {
+            const size_type index = find_index(key, hash_key(key));
+            return index != npos ? iterator_at(index) : end();
+        }
+
+        template<class ComparableToKey>
+        auto find(const ComparableToKey& key) const
+            -> enable_if_t<(Internal::is_transparent<key_eq, ComparableToKey>::value && Internal::is_transparent<hasher, ComparableToKey>::value) || AZStd::is_convertible_v<ComparableToKey, key_type>, const_iterator>
+        {
+            return const_cast<flat_hash_table*>(this)->find(key);
+        }
+
+        template<class ComparableToKey>
+        auto contains(const ComparableToKey& key) const
+            -> enable_if_t<(Internal::is_transparent<key_eq, ComparableToKey>::value && Internal::is_transparent<hasher, ComparableToKey>::value) || AZStd::is_convertible_v<ComparableToKey, key_type>, bool>
+        {
+            return find_index(key, hash_key(key)) != npos;
+        }
+
+        template<class ComparableToKey>
+        auto count(const ComparableToKey& key) const
+            -> enable_if_t<(Internal::is_transparent<key_eq, ComparableToKey>::value && Internal::is_transparent<hasher, ComparableToKey>::value) || AZStd::is_convertible_v<ComparableToKey, key_type>, size_type>
+        {
+            return contains(key) ? 1 : 0;
+        }
+
+        void swap(this_type& rhs)
+        {
+            if (m_allocator == rhs.m_allocator)
+            {
+                AZStd::swap(m_hasher, rhs.m_hasher);
+                AZStd::swap(m_keyEqual, rhs.m_keyEqual);
+                AZStd::swap(m_ctrl, rhs.m_ctrl);
+                AZStd::swap(m_slots, rhs.m_slots);
+                AZStd::swap(m_capacity, rhs.m_capacity);
+                AZStd::swap(m_size, rhs.m_size);
+                AZStd::swap(m_growthLeft, rhs.m_growthLeft);
+            }
+            else
+            {
+                this_type temp(AZStd::move(*this));
+                *this = AZStd::move(rhs);
+                rhs = AZStd::move(temp);
+            }
+        }
+
+        hasher hash_function() const
+        {
+            return m_hasher;
+        }
+        key_eq key_eq_function() const
+        {
+            return m_keyEqual;
+        }
+
+        /// The only difference from the standard is that we return the allocator instance, not a copy.
+        allocator_type& get_allocator()
+        {
+            return m_allocator;
+        }
+        const allocator_type& get_allocator() const
+        {
+            return m_allocator;
+        }
+
+        //! Bytes allocated by the table for its slots and control bytes.
+        size_type get_allocated_size() const
+        {
+            return m_capacity > 0 ? allocation_size(m_capacity) : 0;
+        }
+
+        bool validate() const
+        {
+            size_type numFull = 0;
+            size_type numDeleted = 0;
+            for (size_type i = 0; i < m_capacity; ++i)
+            {
+                if (m_ctrl[i] >= 0)
+                {
+                    ++numFull;
+                    const key_type& key = Traits::key_from_value(m_slots[i]);
+                    const size_t hash = hash_key(key);
+                    if (m_ctrl[i] != h2(hash) || find_index(key, hash) != i)
+                    {
+                        return false;
+                    }
+                }
+                else if (m_ctrl[i] == Internal::flat_hash_ctrl_deleted)
+                {
+                    ++numDeleted;
+                }
+                if (i < group_width && m_ctrl[m_capacity + i] != m_ctrl[i])
+                {
+                    return false;
+                }
+            }
+            return numFull == m_size && (m_capacity == 0 || m_growthLeft == growth_limit(m_capacity) - m_size - numDeleted);
+        }
+
+    protected:
+        static constexpr size_type npos = static_cast<size_type>(-1);
+
+        template<class ComparableToKey>
+        size_t hash_key(const ComparableToKey& key) const
+        {
+            return Internal::flat_hash_mix(m_hasher(key));
+        }
+
+        iterator iterator_at(size_type index)
+        {
+            return iterator(m_ctrl + index, m_slots + index, m_ctrl + m_capacity);
+        }
+
+        //! Returns the slot holding the value with the key, or npos.
+        template<class ComparableToKey>
+        size_type find_index(const ComparableToKey& key, size_t hash) const
+        {
+            if (m_capacity == 0)
+            {
+                return npos;
+            }
+
+            const ctrl_type hashBits = h2(hash);
+            const size_type mask = m_capacity - 1;
+            size_type offset = h1(hash) & mask;
+            size_type step = 0;
+            // Triangular probing visits every group once before repeating, and the table always has an empty slot to stop at
+            while (true)
+            {
+                const group_type group(m_ctrl + offset);
+                for (auto match = group.match(hashBits); match; match.pop())
+                {
+                    const size_type index = (offset + match.lowest()) & mask;
+                    if (m_keyEqual(Traits::key_from_value(m_slots[index]), key))
+                    {
+                        return index;
+                    }
+                }
+                if (group.match_empty())
+                {
+                    return npos;
+                }
+                step += group_width;
+                offset = (offset + step) & mask;
+            }
+        }
+
+        //! Inserts the value if no value with the same key is in the table.
+        template<class ComparableToKey, class... Args>
+        pair<iterator, bool> insert_unique(const ComparableToKey& key, Args&&... args)
+        {
+            const size_t hash = hash_key(key);
+            size_type index = find_index(key, hash);
+            if (index != npos)
+            {
+                return { iterator_at(index), false };
+            }
+            index = prepare_insert(hash);
+            new (m_slots + index) value_type(AZStd::forward<Args>(args)...);
+            return { iterator_at(index), true };
+        }
+
+        //! Inserts a value whose key is known not to be in the table.
+        template<class... Args>
+        void emplace_unchecked(Args&&... args)
+        {
+            value_type value(AZStd::forward<Args>(args)...);
+            const size_type index = prepare_insert(hash_key(Traits::key_from_value(value)));
+            new (m_slots + index) value_type(AZStd::move(value));
+        }
+
+        //! Claims a free slot for a value with the hash, growing the table if needed.
+        size_type prepare_insert(size_t hash)
+        {
+            if (m_capacity == 0)
+            {
+                resize(group_width);
+            }
+            size_type index = find_first_free(hash);
+            if (m_growthLeft == 0 && m_ctrl[index] != Internal::flat_hash_ctrl_deleted)
+            {
+                // Rebuild in place when deleted slots take most of the room, otherwise double the capacity
+                resize(m_size <= growth_limit(m_capacity) / 2 ? m_capacity : m_capacity * 2);
+                index = find_first_free(hash);
+            }
+            if (m_ctrl[index] == Internal::flat_hash_ctrl_empty)
+            {
+                --m_growthLeft;
+            }
+            set_ctrl(index, h2(hash));
+            ++m_size;
+            return index;
+        }
+
+        size_type find_first_free(size_t hash) const
+        {
+            const size_type mask = m_capacity - 1;
+            size_type offset = h1(hash) & mask;
+            size_type step = 0;
+            while (true)
+            {
+                const auto freeSlots = group_type(m_ctrl + offset).match_empty_or_deleted();
+                if (freeSlots)
+                {
+                    return (offset + freeSlots.lowest()) & mask;
+                }
+                step += group_width;
+                offset = (offset + step) & mask;
+            }
+        }
+
+        void erase_at(size_type index)
+        {
+            m_slots[index].~value_type();
+            // Probe sequences may have run past this slot, it can't become empty without breaking their lookups
+            set_ctrl(index, Internal::flat_hash_ctrl_deleted);
+            --m_size;
+        }
+
+        void resize(size_type newCapacity)
+        {
+            ctrl_type* oldCtrl = m_ctrl;
+            pointer oldSlots = m_slots;
+            const size_type oldCapacity = m_capacity;
+
+            m_capacity = newCapacity;
+            if (newCapacity > 0)
+            {
+                m_ctrl = reinterpret_cast<ctrl_type*>(m_allocator.allocate(allocation_size(newCapacity), allocation_alignment()));
+                m_slots = reinterpret_cast<pointer>(reinterpret_cast<char*>(m_ctrl) + slots_offset(newCapacity));
+                reset_ctrl();
+                m_growthLeft = growth_limit(newCapacity) - m_size;
+            }
+            else
+            {
+                m_ctrl = nullptr;
+                m_slots = nullptr;
+                m_growthLeft = 0;
+            }
+
+            for (size_type i = 0; i < oldCapacity; ++i)
+            {
+                if (oldCtrl[i] >= 0)
+                {
+                    const size_t hash = hash_key(Traits::key_from_value(oldSlots[i]));
+                    const size_type index = find_first_free(hash);
+                    set_ctrl(index, h2(hash));
+                    Traits::transfer(m_slots + index, oldSlots + i);
+                }
+            }
+
+            if (oldCapacity > 0)
+            {
+                m_allocator.deallocate(oldCtrl, allocation_size(oldCapacity), allocation_alignment());
+            }
+        }
+
+        void copy_from(const flat_hash_table& rhs)
+        {
+            reserve(rhs.m_size);
+            for (const value_type& value : rhs)
+            {
+                const size_type index = prepare_insert(hash_key(Traits::key_from_value(value)));
+                new (m_slots + index) value_type(value);
+            }
+        }
+
+        void steal(flat_hash_table& rhs)
+        {
+            m_ctrl = rhs.m_ctrl;
+            m_slots = rhs.m_slots;
+            m_capacity = rhs.m_capacity;
+            m_size = rhs.m_size;
+            m_growthLeft = rhs.m_growthLeft;
+            rhs.m_ctrl = nullptr;
+            rhs.m_slots = nullptr;
+            rhs.m_capacity = 0;
+            rhs.m_size = 0;
+            rhs.m_growthLeft = 0;
+        }
+
+        void destroy_values()
+        {
+            if constexpr (!is_trivially_destructible_v<value_type>)
+            {
+                for (size_type i = 0; i < m_capacity; ++i)
+                {
+                    if (m_ctrl[i] >= 0)
+                    {
+                        m_slots[i].~value_type();
+                    }
+                }
+            }
+        }
+
+        void deallocate()
+        {
+            if (m_capacity > 0)
+            {
+                m_allocator.deallocate(m_ctrl, allocation_size(m_capacity), allocation_alignment());
+                m_ctrl = nullptr;
+                m_slots = nullptr;
+                m_capacity = 0;
+                m_size = 0;
+                m_growthLeft = 0;
+            }
+        }
+
+        //! The control bytes of the first group are repeated after the last slot, so a group can be loaded from any slot without wrapping.
+        void set_ctrl(size_type index, ctrl_type value)
+        {
+            m_ctrl[index] = value;
+            if (index < group_width)
+            {
+                m_ctrl[m_capacity + index] = value;
+            }
+        }
+
+        void reset_ctrl()
+        {
+            memset(m_ctrl, static_cast<uint8_t>(Internal::flat_hash_ctrl_empty), m_capacity + group_width);
+        }
+
+        static size_t h1(size_t hash)
+        {
+            return hash >> 7;
+        }
+
+        static ctrl_type h2(size_t hash)
+        {
+            return static_cast<ctrl_type>(hash & 0x7f);
+        }
+
+        static size_type growth_limit(size_type capacity)
+        {
+            return capacity - capacity / 8;
+        }
+
+        //! Smallest power of two capacity, of at least a group, with room for numElements values.
+        static size_type capacity_for(size_type numElements)
+        {
+            if (numElements == 0)
+            {
+                return 0;
+            }
+            size_type capacity = group_width;
+            while (growth_limit(capacity) < numElements)
+            {
+                capacity *= 2;
+            }
+            return capacity;
+        }
+
+        static size_type round_up_capacity(size_type numBuckets)
+        {
+            size_type capacity = group_width;
+            while (capacity < numBuckets)
+            {
+                capacity *= 2;
+            }
+            return capacity;
+        }
+
+        static size_type allocation_alignment()
+        {
+            return AZStd::max(alignment_of<value_type>::value, alignment_of<size_type>::value);
+        }
+
+        static size_type slots_offset(size_type capacity)
+        {
+            const size_type alignment = alignment_of<value_type>::value;
+            return (capacity + group_width + alignment - 1) & ~(alignment - 1);
+        }
+
+        static size_type allocation_size(size_type capacity)
+        {
+            return slots_offset(capacity) + capacity * sizeof(value_type);
+        }
+
+        ctrl_type* m_ctrl = nullptr;
+        pointer m_slots = nullptr;
+        size_type m_capacity = 0;
+        size_type m_size = 0;
+        //! Number of empty slots that can still be filled before the table has to grow.
+        size_type m_growthLeft = 0;
+        hasher m_hasher;
+        key_eq m_keyEqual;
+        allocator_type m_allocator;
+    };
+} // namespace AZStd
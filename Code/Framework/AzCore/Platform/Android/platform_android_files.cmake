@@ -60,6 +60,7 @@ set(FILES
     AzCore/Socket/AzSocket_fwd_Platform.h
     AzCore/Socket/AzSocket_Platform.h
     ../Common/UnixLike/AzCore/std/time_UnixLike.cpp
+    ../Common/Default/AzCore/Threading/ThreadUtils_Default.cpp
     AzCore/Utils/Utils_Android.cpp
     ../Common/Unimplemented/AzCore/Utils/Utils_Unimplemented.cpp
     ../../AzCore/Android/AndroidEnv.cpp
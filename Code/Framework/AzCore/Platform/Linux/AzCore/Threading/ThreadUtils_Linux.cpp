@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Threading/ThreadUtils.h>
+#include <AzCore/std/string/fixed_string.h>
+
+#include <stdio.h>
+#include <unistd.h>
+
+namespace AZ::Threading
+{
+    namespace Platform
+    {
+        // Reads the first number from a sysfs file, e.g. the lowest processor in a "0-7,64-71" list.
+        bool ReadFirstNumber(const char* path, uint32_t& value)
+        {
+            FILE* file = fopen(path, "r");
+            if (!file)
+            {
+                return false;
+            }
+            const bool result = fscanf(file, "%u", &value) == 1;
+            fclose(file);
+            return result;
+        }
+    } // namespace Platform
+
+    AZStd::vector<uint32_t> GetProcessorCacheGroups()
+    {
+        const long processorCount = sysconf(_SC_NPROCESSORS_CONF);
+        if (processorCount <= 0)
+        {
+            return {};
+        }
+
+        // Processors are grouped by the processors they share their L3 cache with, which is the lowest processor number in
+        // that list. Systems without an L3 cache are grouped by socket instead.
+        uint32_t value = 0;
+        const bool hasL3Cache = Platform::ReadFirstNumber("/sys/devices/system/cpu/cpu0/cache/index3/shared_cpu_list", value);
+        const char* format = hasL3Cache
+            ? "/sys/devices/system/cpu/cpu%ld/cache/index3/shared_cpu_list"
+            : "/sys/devices/system/cpu/cpu%ld/topology/physical_package_id";
+
+        AZStd::vector<uint32_t> groups;
+        groups.reserve(processorCount);
+        for (long processor = 0; processor < processorCount; ++processor)
+        {
+            const auto path = AZStd::fixed_string<128>::format(format, processor);
+            if (!Platform::ReadFirstNumber(path.c_str(), value))
+            {
+                return {};
+            }
+            groups.push_back(value);
+        }
+        return groups;
+    }
+} // namespace AZ::Threading
@@ -64,6 +64,7 @@ set(FILES
     AzCore/Socket/AzSocket_fwd_Platform.h
     AzCore/Socket/AzSocket_Platform.h
     ../Common/UnixLike/AzCore/std/time_UnixLike.cpp
+    AzCore/Threading/ThreadUtils_Linux.cpp
     AzCore/Utils/Utils_Linux.cpp
     ../Common/UnixLike/AzCore/Utils/Utils_UnixLike.cpp
 )
@@ -66,6 +66,7 @@ set(FILES
     AzCore/Socket/AzSocket_fwd_Platform.h
     AzCore/Socket/AzSocket_Platform.h
     ../Common/Apple/AzCore/std/time_Apple.cpp
+    ../Common/Default/AzCore/Threading/ThreadUtils_Default.cpp
     AzCore/Utils/Utils_Mac.cpp
     ../Common/Apple/AzCore/Utils/Utils_Apple.cpp
     ../Common/UnixLike/AzCore/Utils/Utils_UnixLike.cpp
@@ -70,6 +70,7 @@ set(FILES
     AzCore/Socket/AzSocket_fwd_Platform.h
     AzCore/Socket/AzSocket_fwd_Windows.h
     AzCore/std/time_Windows.cpp
+    ../Common/Default/AzCore/Threading/ThreadUtils_Default.cpp
     ../Common/WinAPI/AzCore/Utils/Utils_WinAPI.cpp
     AzCore/Utils/Utils_Windows.cpp
 )
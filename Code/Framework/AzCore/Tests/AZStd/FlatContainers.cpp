@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include "UserTypes.h"
+#include <AzCore/std/containers/flat_hash_map.h>
+#include <AzCore/std/containers/flat_hash_set.h>
+#include <AzCore/std/containers/flat_map.h>
+#include <AzCore/std/containers/flat_set.h>
+#include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
+using namespace AZStd;
+using namespace UnitTestInternal;
+
+namespace UnitTest
+{
+    class FlatContainers
+        : public AllocatorsFixture
+    {
+    public:
+        //! Hasher and key compare that accept string_view, so lookups don't need to build a string.
+        struct TransparentStringHash
+        {
+            using is_transparent = void;
+            size_t operator()(AZStd::string_view value) const { return AZStd::hash<AZStd::string_view>()(value); }
+        };
+        struct TransparentStringEqual
+        {
+            using is_transparent = void;
+            bool operator()(AZStd::string_view left, AZStd::string_view right) const { return left == right; }
+        };
+    };
+
+    TEST_F(FlatContainers, FlatHashMap_InsertFindErase_MatchesUnorderedMap)
+    {
+        flat_hash_map<int, int> flatMap;
+        unordered_map<int, int> referenceMap;
+
+        // Fixed seed, so a failure reproduces.
+        unsigned int seed = 1;
+        auto next = [&seed]() { seed = seed * 1103515245 + 12345; return (seed >> 16) & 0x7fff; };
+        for (int i = 0; i < 20000; ++i)
+        {
+            const int key = static_cast<int>(next() % 500);
+            switch (next() % 3)
+            {
+            case 0:
+                flatMap[key] = i;
+                referenceMap[key] = i;
+                break;
+            case 1:
+                EXPECT_EQ(referenceMap.erase(key), flatMap.erase(key));
+                break;
+            default:
+            {
+                auto flatIt = flatMap.find(key);
+                auto referenceIt = referenceMap.find(key);
+                ASSERT_EQ(referenceIt == referenceMap.end(), flatIt == flatMap.end());
+                if (flatIt != flatMap.end())
+                {
+                    EXPECT_EQ(referenceIt->second, flatIt->second);
+                }
+                break;
+            }
+            }
+        }
+
+        EXPECT_TRUE(flatMap.validate());
+        EXPECT_EQ(referenceMap.size(), flatMap.size());
+        size_t numIterated = 0;
+        for (const auto& keyValue : flatMap)
+        {
+            EXPECT_EQ(referenceMap[keyValue.first], keyValue.second);
+            ++numIterated;
+        }
+        EXPECT_EQ(referenceMap.size(), numIterated);
+    }
+
+    TEST_F(FlatContainers, FlatHashMap_Growth_KeepsAllValues)
+    {
+        flat_hash_map<int, int> flatMap;
+        EXPECT_EQ(0, flatMap.bucket_count());
+        for (int i = 0; i < 10000; ++i)
+        {
+            EXPECT_TRUE(flatMap.emplace(i, i * 2).second);
+        }
+        EXPECT_TRUE(flatMap.validate());
+        EXPECT_EQ(10000, flatMap.size());
+        EXPECT_LE(flatMap.load_factor(), flatMap.max_load_factor());
+        for (int i = 0; i < 10000; ++i)
+        {
+            EXPECT_EQ(i * 2, flatMap.at(i));
+        }
+
+        flatMap.reserve(50000);
+        EXPECT_GE(flatMap.bucket_count(), 50000);
+        EXPECT_TRUE(flatMap.validate());
+        EXPECT_EQ(9999 * 2, flatMap.at(9999));
+
+        flatMap.clear();
+        flatMap.rehash(0);
+        EXPECT_EQ(0, flatMap.bucket_count());
+        EXPECT_EQ(0, flatMap.get_allocated_size());
+    }
+
+    TEST_F(FlatContainers, FlatHashSet_EraseInsertChurn_ReusesDeletedSlots)
+    {
+        flat_hash_set<int> flatSet;
+        flatSet.insert(-1);
+        flatSet.reserve(64);
+        const size_t bucketCount = flatSet.bucket_count();
+        for (int i = 0; i < 100000; ++i)
+        {
+            flatSet.insert(i);
+            flatSet.erase(i);
+        }
+        // Tombstones are reclaimed in place, constant size churn must not grow the table.
+        EXPECT_EQ(bucketCount, flatSet.bucket_count());
+        EXPECT_EQ(1, flatSet.size());
+        EXPECT_TRUE(flatSet.contains(-1));
+        EXPECT_TRUE(flatSet.validate());
+    }
+
+    TEST_F(FlatContainers, FlatHashMap_TransparentLookup_FindsWithoutKeyConversion)
+    {
+        flat_hash_map<AZStd::string, int, TransparentStringHash, TransparentStringEqual> flatMap;
+        flatMap.emplace("first", 1);
+        flatMap.emplace("second", 2);
+
+        const AZStd::string_view first = "first";
+        auto it = flatMap.find(first);
+        ASSERT_NE(flatMap.end(), it);
+        EXPECT_EQ(1, it->second);
+        EXPECT_TRUE(flatMap.contains(AZStd::string_view("second")));
+        EXPECT_EQ(0, flatMap.count(AZStd::string_view("third")));
+        EXPECT_EQ(1, flatMap.erase(AZStd::string_view("second")));
+        EXPECT_EQ(1, flatMap.size());
+    }
+
+    TEST_F(FlatContainers, FlatHashMap_TryEmplaceAndInsertOrAssign_MatchMapSemantics)
+    {
+        flat_hash_map<int, MyClass> flatMap;
+        auto result = flatMap.try_emplace(1, 10);
+        EXPECT_TRUE(result.second);
+        EXPECT_EQ(10, result.first->second.m_data);
+
+        result = flatMap.try_emplace(1, 20);
+        EXPECT_FALSE(result.second);
+        EXPECT_EQ(10, result.first->second.m_data);
+
+        result = flatMap.insert_or_assign(1, MyClass(30));
+        EXPECT_FALSE(result.second);
+        EXPECT_EQ(30, flatMap[1].m_data);
+
+        result = flatMap.insert_or_assign(2, MyClass(40));
+        EXPECT_TRUE(result.second);
+        EXPECT_EQ(2, flatMap.size());
+        EXPECT_EQ(1, erase_if(flatMap, [](const auto& keyValue) { return keyValue.second.m_data == 40; }));
+        EXPECT_EQ(1, flatMap.size());
+    }
+
+    TEST_F(FlatContainers, FlatHashMap_CopyAndMove_PreserveContents)
+    {
+        flat_hash_map<int, AZStd::string> flatMap{ { 1, "one" }, { 2, "two" }, { 3, "three" } };
+        flat_hash_map<int, AZStd::string> copy(flatMap);
+        EXPECT_EQ(flatMap, copy);
+        EXPECT_TRUE(copy.validate());
+
+        flat_hash_map<int, AZStd::string> moved(AZStd::move(copy));
+        EXPECT_EQ(flatMap, moved);
+        EXPECT_TRUE(copy.empty());
+
+        moved[4] = "four";
+        EXPECT_NE(flatMap, moved);
+        swap(flatMap, moved);
+        EXPECT_EQ(4, flatMap.size());
+        EXPECT_EQ(3, moved.size());
+    }
+
+    TEST_F(FlatContainers, FlatMap_Insert_KeepsKeysSortedAndUnique)
+    {
+        flat_map<int, int> flatMap;
+        map<int, int> referenceMap;
+        for (int i = 0; i < 1000; ++i)
+        {
+            const int key = (i * 7919) % 613;
+            EXPECT_EQ(referenceMap.emplace(key, i).second, flatMap.emplace(key, i).second);
+        }
+        EXPECT_TRUE(flatMap.validate());
+        ASSERT_EQ(referenceMap.size(), flatMap.size());
+        EXPECT_TRUE(AZStd::equal(referenceMap.begin(), referenceMap.end(), flatMap.begin()));
+
+        EXPECT_EQ(referenceMap.erase(5), flatMap.erase(5));
+        EXPECT_EQ(referenceMap.lower_bound(5)->first, flatMap.lower_bound(5)->first);
+        EXPECT_EQ(referenceMap.upper_bound(6)->first, flatMap.upper_bound(6)->first);
+        EXPECT_FALSE(flatMap.contains(5));
+    }
+
+    TEST_F(FlatContainers, FlatMap_RangeInsert_SkipsDuplicatesKeepingFirst)
+    {
+        flat_map<int, int> flatMap{ { 2, 0 }, { 4, 0 } };
+        vector<pair<int, int>> values{ { 5, 1 }, { 1, 1 }, { 4, 1 }, { 1, 2 }, { 3, 1 } };
+        flatMap.insert(values.begin(), values.end());
+        EXPECT_TRUE(flatMap.validate());
+        ASSERT_EQ(5, flatMap.size());
+        EXPECT_EQ(1, flatMap[1]);
+        EXPECT_EQ(0, flatMap[2]);
+        EXPECT_EQ(1, flatMap[3]);
+        EXPECT_EQ(0, flatMap[4]);
+        EXPECT_EQ(1, flatMap[5]);
+
+        // Values that all sort after the existing ones take the append only path.
+        flatMap.insert({ { 7, 1 }, { 6, 1 }, { 7, 2 } });
+        EXPECT_TRUE(flatMap.validate());
+        EXPECT_EQ(7, flatMap.size());
+        EXPECT_EQ(1, flatMap.at(7));
+    }
+
+    TEST_F(FlatContainers, FlatSet_HintAndTransparentLookup_Work)
+    {
+        flat_set<AZStd::string, AZStd::less<>> flatSet{ "b", "d", "a", "b" };
+        EXPECT_EQ(3, flatSet.size());
+        EXPECT_EQ("a", *flatSet.begin());
+
+        auto it = flatSet.insert(flatSet.end(), "e");
+        EXPECT_EQ("e", *it);
+        // A wrong hint still places the value in order.
+        it = flatSet.insert(flatSet.begin(), "c");
+        EXPECT_EQ("c", *it);
+        EXPECT_TRUE(flatSet.validate());
+
+        EXPECT_TRUE(flatSet.contains(AZStd::string_view("d")));
+        EXPECT_EQ(flatSet.find("d"), flatSet.lower_bound(AZStd::string_view("cz")));
+        EXPECT_EQ(1, flatSet.erase(AZStd::string_view("a")));
+        EXPECT_EQ("b", *flatSet.begin());
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    //! Forwards to AZStd::allocator, counting the bytes in use so node based and flat containers can be compared.
+    class CountingAllocator
+    {
+    public:
+        using pointer_type = void*;
+        using size_type = AZStd::size_t;
+        using difference_type = AZStd::ptrdiff_t;
+        using allow_memory_leaks = AZStd::false_type;
+
+        CountingAllocator(const char* name = "CountingAllocator")
+            : m_allocator(name)
+        {
+        }
+        const char* get_name() const { return m_allocator.get_name(); }
+        void set_name(const char* name) { m_allocator.set_name(name); }
+
+        pointer_type allocate(size_type byteSize, size_type alignment, int flags = 0)
+        {
+            s_bytesInUse += byteSize;
+            return m_allocator.allocate(byteSize, alignment, flags);
+        }
+        void deallocate(pointer_type ptr, size_type byteSize, size_type alignment)
+        {
+            s_bytesInUse -= byteSize;
+            m_allocator.deallocate(ptr, byteSize, alignment);
+        }
+        size_type resize(pointer_type, size_type) { return 0; }
+        size_type max_size() const { return m_allocator.max_size(); }
+        size_type get_allocated_size() const { return s_bytesInUse; }
+
+        static size_type s_bytesInUse;
+
+    private:
+        AZStd::allocator m_allocator;
+    };
+    CountingAllocator::size_type CountingAllocator::s_bytesInUse = 0;
+
+    inline bool operator==(const CountingAllocator&, const CountingAllocator&) { return true; }
+    inline bool operator!=(const CountingAllocator&, const CountingAllocator&) { return false; }
+
+    using UnorderedMap = AZStd::unordered_map<int, int, AZStd::hash<int>, AZStd::equal_to<int>, CountingAllocator>;
+    using FlatHashMap = AZStd::flat_hash_map<int, int, AZStd::hash<int>, AZStd::equal_to<int>, CountingAllocator>;
+    using Map = AZStd::map<int, int, AZStd::less<int>, CountingAllocator>;
+    using FlatMap = AZStd::flat_map<int, int, AZStd::less<int>, CountingAllocator>;
+
+    //! Scrambles the keys so neither container benefits from sequential hashes or sorted inserts.
+    inline int BenchmarkKey(int64_t index)
+    {
+        return static_cast<int>((index * 2654435761u) & 0x7fffffff);
+    }
+
+    template<class Container>
+    static void BM_FlatContainers_Insert(::benchmark::State& state)
+    {
+        const int64_t count = state.range(0);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            Container container;
+            for (int64_t i = 0; i < count; ++i)
+            {
+                container.emplace(BenchmarkKey(i), static_cast<int>(i));
+            }
+            benchmark::DoNotOptimize(container.size());
+        }
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    template<class Container>
+    static void BM_FlatContainers_Lookup(::benchmark::State& state)
+    {
+        const int64_t count = state.range(0);
+        Container container;
+        for (int64_t i = 0; i < count; ++i)
+        {
+            container.emplace(BenchmarkKey(i), static_cast<int>(i));
+        }
+        for ([[maybe_unused]] auto _ : state)
+        {
+            int64_t sum = 0;
+            // Half hits and half misses.
+            for (int64_t i = 0; i < count; ++i)
+            {
+                auto it = container.find(BenchmarkKey(i * 2));
+                sum += it != container.end() ? it->second : 0;
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    template<class Container>
+    static void BM_FlatContainers_Iterate(::benchmark::State& state)
+    {
+        const int64_t count = state.range(0);
+        Container container;
+        for (int64_t i = 0; i < count; ++i)
+        {
+            container.emplace(BenchmarkKey(i), static_cast<int>(i));
+        }
+        for ([[maybe_unused]] auto _ : state)
+        {
+            int64_t sum = 0;
+            for (const auto& keyValue : container)
+            {
+                sum += keyValue.second;
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    //! Reports the bytes allocated per element, the iteration time itself is just the fill.
+    template<class Container>
+    static void BM_FlatContainers_Footprint(::benchmark::State& state)
+    {
+        const int64_t count = state.range(0);
+        CountingAllocator::size_type bytesInUse = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const CountingAllocator::size_type bytesBefore = CountingAllocator::s_bytesInUse;
+            Container container;
+            for (int64_t i = 0; i < count; ++i)
+            {
+                container.emplace(BenchmarkKey(i), static_cast<int>(i));
+            }
+            bytesInUse = CountingAllocator::s_bytesInUse - bytesBefore;
+        }
+        state.counters["BytesPerElement"] = static_cast<double>(bytesInUse) / static_cast<double>(count);
+    }
+
+    BENCHMARK_TEMPLATE(BM_FlatContainers_Insert, UnorderedMap)->RangeMultiplier(8)->Range(64, 32768);
+    BENCHMARK_TEMPLATE(BM_FlatContainers_Insert, FlatHashMap)->RangeMultiplier(8)->Range(64, 32768);
+    BENCHMARK_TEMPLATE(BM_FlatContainers_Insert, Map)->RangeMultiplier(8)->Range(64, 32768);
+    BENCHMARK_TEMPLATE(BM_FlatContainers_Insert, FlatMap)->RangeMultiplier(8)->Range(64, 32768);
+
+    BENCHMARK_TEMPLATE(BM_FlatContainers_Lookup, UnorderedMap)->RangeMultiplier(8)->Range(64, 32768);
+    BENCHMARK_TEMPLATE(BM_FlatContainers_Lookup, FlatHashMap)->RangeMultiplier(8)->Range(64, 32768);
+    BENCHMARK_TEMPLATE(BM_FlatContainers_Lookup, Map)->RangeMultiplier(8)->Range(64, 32768);
+    BENCHMARK_TEMPLATE(BM_FlatContainers_Lookup, FlatMap)->RangeMultiplier(8)->Range(64, 32768);
+
+    BENCHMARK_TEMPLATE(BM_FlatContainers_Iterate, UnorderedMap)->RangeMultiplier(8)->Range(64, 32768);
+    BENCHMARK_TEMPLATE(BM_FlatContainers_Iterate, FlatHashMap)->RangeMultiplier(8)->Range(64, 32768);
+    BENCHMARK_TEMPLATE(BM_FlatContainers_Iterate, Map)->RangeMultiplier(8)->Range(64, 32768);
+    BENCHMARK_TEMPLATE(BM_FlatContainers_Iterate, FlatMap)->RangeMultiplier(8)->Range(64, 32768);
+
+    BENCHMARK_TEMPLATE(BM_FlatContainers_Footprint, UnorderedMap)->Arg(32768);
+    BENCHMARK_TEMPLATE(BM_FlatContainers_Footprint, FlatHashMap)->Arg(32768);
+    BENCHMARK_TEMPLATE(BM_FlatContainers_Footprint, Map)->Arg(32768);
+    BENCHMARK_TEMPLATE(BM_FlatContainers_Footprint, FlatMap)->Arg(32768);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
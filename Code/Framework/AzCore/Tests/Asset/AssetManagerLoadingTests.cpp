@@ -25,6 +25,7 @@
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/time.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UnitTest/Mocks/MockFileIOBase.h>
 #include <AZTestShared/Utils/Utils.h>
@@ -34,6 +35,10 @@
 #include <Tests/SerializeContextFixture.h>
 #include <Tests/TestCatalog.h>
 
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
 namespace UnitTest
 {
     using namespace AZ;
@@ -1709,6 +1714,108 @@ namespace UnitTest
         m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
     }
 
+#if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    TEST_F(AssetJobsFloodTest, DISABLED_ContainerLoadTest_BatchDependencyReads_DeepestPreloadsReadFirst)
+#else
+    TEST_F(AssetJobsFloodTest, ContainerLoadTest_BatchDependencyReads_DeepestPreloadsReadFirst)
+#endif // !AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    {
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusConnect();
+        // Setup has already created/destroyed assets
+        m_assetHandlerAndCatalog->m_numCreations = 0;
+        m_assetHandlerAndCatalog->m_numDestructions = 0;
+        m_streamerWrapper->m_queuedReads.clear();
+        m_streamerWrapper->m_queuedBatches = 0;
+        {
+            ContainerReadyListener readyListener(PreloadAssetRootId);
+
+            AssetLoadParameters loadParams;
+            loadParams.m_batchDependencyReads = true;
+            loadParams.m_deadline = AZStd::chrono::milliseconds(300);
+
+            auto asset = m_testAssetManager->FindOrCreateAsset(PreloadAssetRootId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>(), AZ::Data::AssetLoadBehavior::Default);
+            auto containerReady = m_testAssetManager->GetAssetContainer(asset, loadParams);
+
+            auto maxTimeout = AZStd::chrono::system_clock::now() + DefaultTimeoutSeconds;
+
+            while (!readyListener.m_ready)
+            {
+                m_testAssetManager->DispatchEvents();
+                if (AZStd::chrono::system_clock::now() > maxTimeout)
+                {
+                    break;
+                }
+                AZStd::this_thread::yield();
+            }
+            EXPECT_EQ(containerReady->IsReady(), true);
+            EXPECT_EQ(containerReady->GetDependencies().size(), 6);
+
+            // The whole graph is handed to the streamer at once
+            EXPECT_EQ(m_streamerWrapper->m_queuedBatches, 1);
+            ASSERT_EQ(m_streamerWrapper->m_queuedReads.size(), 7);
+
+            // PreLoadB gates PreLoadA, which gates the root, so they are due first and in that order.  Everything else keeps the
+            // requested deadline.
+            const auto& queuedReads = m_streamerWrapper->m_queuedReads;
+            EXPECT_TRUE(queuedReads[0].m_path.ends_with("PreLoadB.txt"));
+            EXPECT_EQ(queuedReads[0].m_deadline, AZStd::chrono::milliseconds(100));
+            EXPECT_TRUE(queuedReads[1].m_path.ends_with("PreLoadA.txt"));
+            EXPECT_EQ(queuedReads[1].m_deadline, AZStd::chrono::milliseconds(200));
+            for (size_t index = 2; index < queuedReads.size(); ++index)
+            {
+                EXPECT_EQ(queuedReads[index].m_deadline, AZStd::chrono::milliseconds(300));
+            }
+        }
+
+        CheckFinishedCreationsAndDestructions();
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
+    }
+
+#if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    TEST_F(AssetJobsFloodTest, DISABLED_ContainerLoadTest_CriticalLane_ReadsUseHighPriority)
+#else
+    TEST_F(AssetJobsFloodTest, ContainerLoadTest_CriticalLane_ReadsUseHighPriority)
+#endif // !AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    {
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusConnect();
+        // Setup has already created/destroyed assets
+        m_assetHandlerAndCatalog->m_numCreations = 0;
+        m_assetHandlerAndCatalog->m_numDestructions = 0;
+        m_streamerWrapper->m_queuedReads.clear();
+        {
+            ContainerReadyListener readyListener(PreloadAssetAId);
+
+            AssetLoadParameters loadParams;
+            loadParams.m_lane = AssetLoadLane::Critical;
+
+            auto asset = m_testAssetManager->FindOrCreateAsset(PreloadAssetAId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>(), AZ::Data::AssetLoadBehavior::Default);
+            auto containerReady = m_testAssetManager->GetAssetContainer(asset, loadParams);
+
+            auto maxTimeout = AZStd::chrono::system_clock::now() + DefaultTimeoutSeconds;
+
+            while (!readyListener.m_ready)
+            {
+                m_testAssetManager->DispatchEvents();
+                if (AZStd::chrono::system_clock::now() > maxTimeout)
+                {
+                    break;
+                }
+                AZStd::this_thread::yield();
+            }
+            EXPECT_EQ(containerReady->IsReady(), true);
+
+            // The handler defaults to medium priority, the critical lane raises every read in the graph
+            ASSERT_EQ(m_streamerWrapper->m_queuedReads.size(), 3);
+            for (const auto& queuedRead : m_streamerWrapper->m_queuedReads)
+            {
+                EXPECT_EQ(queuedRead.m_priority, AZ::IO::IStreamerTypes::s_priorityHigh);
+            }
+        }
+
+        CheckFinishedCreationsAndDestructions();
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
+    }
+
     // If our preload list contains assets we can't load we should catch the errors and load what we can
 #if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
     TEST_F(AssetJobsFloodTest, DISABLED_ContainerLoadTest_RootHasBrokenPreloads_LoadsRoot)
@@ -3234,3 +3341,122 @@ namespace UnitTest
         }
     }
 }
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    // Level load style timing of the PreLoad tree of AssetJobsFloodTest. The iteration time is until the whole container is ready,
+    // the CriticalPath counter is the time until the root signals OnAssetReady.
+    class AssetContainerLoadBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+        // Inheriting to add a default implementation for the virtual abstract method, SetUp and TearDown are called by the benchmark.
+        class AssetJobsFloodSetup
+            : public UnitTest::AssetJobsFloodTest
+        {
+        public:
+            void TestBody() override {}
+        };
+
+        void internalSetUp()
+        {
+            m_assetTest = AZStd::make_unique<AssetJobsFloodSetup>();
+            m_assetTest->SetUp();
+            m_assetTest->m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusConnect();
+        }
+
+        void internalTearDown()
+        {
+            m_assetTest->m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
+            m_assetTest->TearDown();
+            m_assetTest.reset();
+        }
+
+    public:
+        void SetUp(const ::benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(::benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void TearDown(const ::benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(::benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+    protected:
+        AZStd::unique_ptr<AssetJobsFloodSetup> m_assetTest;
+    };
+
+    BENCHMARK_DEFINE_F(AssetContainerLoadBenchmarkFixture, BM_LoadPreloadTreeContainer)(benchmark::State& state)
+    {
+        using namespace AZ::Data;
+
+        UnitTest::TestAssetManager* assetManager = m_assetTest->m_testAssetManager;
+        const AssetId rootAssetId(UnitTest::AssetJobsFloodTest::PreloadAssetRootId);
+        const auto timeout = UnitTest::AssetJobsFloodTest::DefaultTimeoutSeconds;
+
+        AssetLoadParameters loadParams;
+        loadParams.m_batchDependencyReads = state.range(0) != 0;
+        loadParams.m_deadline = AZStd::chrono::milliseconds(100);
+        loadParams.m_lane = AssetLoadLane::Critical;
+
+        AZStd::sys_time_t criticalPathTime = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const AZStd::sys_time_t startTime = AZStd::GetTimeNowMicroSecond();
+
+            auto asset = assetManager->FindOrCreateAsset(rootAssetId, azrtti_typeid<UnitTest::AssetWithQueueAndPreLoadReferences>(),
+                AssetLoadBehavior::Default);
+            auto container = assetManager->GetAssetContainer(asset, loadParams);
+
+            bool rootReady = false;
+            auto maxTimeout = AZStd::chrono::system_clock::now() + timeout;
+            while (!container->IsReady() && AZStd::chrono::system_clock::now() < maxTimeout)
+            {
+                assetManager->DispatchEvents();
+                if (!rootReady && asset.IsReady())
+                {
+                    rootReady = true;
+                    criticalPathTime += AZStd::GetTimeNowMicroSecond() - startTime;
+                }
+            }
+            if (!container->IsReady())
+            {
+                state.SkipWithError("Timed out waiting for the asset container to be ready.");
+                break;
+            }
+            if (!rootReady)
+            {
+                criticalPathTime += AZStd::GetTimeNowMicroSecond() - startTime;
+            }
+
+            // Release everything so that the next iteration loads from scratch
+            state.PauseTiming();
+            asset = {};
+            container = {};
+            maxTimeout = AZStd::chrono::system_clock::now() + timeout;
+            while (assetManager->FindAsset(rootAssetId, AssetLoadBehavior::Default) && AZStd::chrono::system_clock::now() < maxTimeout)
+            {
+                assetManager->DispatchEvents();
+                AZStd::this_thread::yield();
+            }
+            state.ResumeTiming();
+        }
+
+        state.counters["CriticalPath"] = benchmark::Counter(
+            static_cast<double>(criticalPathTime) / 1000000.0, benchmark::Counter::kAvgIterations);
+    }
+    BENCHMARK_REGISTER_F(AssetContainerLoadBenchmarkFixture, BM_LoadPreloadTreeContainer)
+        ->ArgName("BatchDependencyReads")
+        ->Arg(0)
+        ->Arg(1)
+        ->Unit(benchmark::kMicrosecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -210,6 +210,7 @@ namespace UnitTest
                 // Save off the requested deadline and priority
                 request.m_deadline = deadline;
                 request.m_priority = priority;
+                request.m_path = relativePath;
                 request.m_data = allocator.Allocate(size, size, 8);
 
                 const auto* virtualFile = FindFile(relativePath);
@@ -244,26 +245,26 @@ namespace UnitTest
         ON_CALL(m_mockStreamer, QueueRequest(_))
             .WillByDefault([this](const auto& fileRequest)
             {
-                if (!m_suspended)
-                {
-                    decltype(ReadRequest::m_callback) onCompleteCallback;
-
-                    AZStd::unique_lock lock(m_mutex);
-                    ReadRequest* readRequest = GetReadRequest(fileRequest);
-                    onCompleteCallback = readRequest->m_callback;
-
-                    if (onCompleteCallback)
-                    {
-                        onCompleteCallback(fileRequest);
+                QueueReadRequest(fileRequest);
+            });
 
-                        m_readRequests.erase(readRequest);
-                    }
-                }
-                else
+        ON_CALL(m_mockStreamer, QueueRequestBatch(::testing::An<const AZStd::vector<FileRequestPtr>&>()))
+            .WillByDefault([this](const AZStd::vector<FileRequestPtr>& requests)
+            {
+                ++m_queuedBatches;
+                for (const auto& fileRequest : requests)
                 {
-                    AZStd::unique_lock lock(m_mutex);
+                    QueueReadRequest(fileRequest);
+                }
+            });
 
-                    m_processingQueue.push(fileRequest);
+        ON_CALL(m_mockStreamer, QueueRequestBatch(::testing::An<AZStd::vector<FileRequestPtr>&&>()))
+            .WillByDefault([this](AZStd::vector<FileRequestPtr>&& requests)
+            {
+                ++m_queuedBatches;
+                for (const auto& fileRequest : requests)
+                {
+                    QueueReadRequest(fileRequest);
                 }
             });
 
@@ -306,6 +307,33 @@ namespace UnitTest
             });
     }
 
+    void MemoryStreamerWrapper::QueueReadRequest(const FileRequestPtr& fileRequest)
+    {
+        AZStd::unique_lock lock(m_mutex);
+
+        ReadRequest* readRequest = GetReadRequest(fileRequest);
+        if (readRequest != m_readRequests.end())
+        {
+            m_queuedReads.push_back({ readRequest->m_path, readRequest->m_deadline, readRequest->m_priority });
+        }
+
+        if (!m_suspended)
+        {
+            decltype(ReadRequest::m_callback) onCompleteCallback = readRequest->m_callback;
+
+            if (onCompleteCallback)
+            {
+                onCompleteCallback(fileRequest);
+
+                m_readRequests.erase(readRequest);
+            }
+        }
+        else
+        {
+            m_processingQueue.push(fileRequest);
+        }
+    }
+
     ReadRequest* MemoryStreamerWrapper::GetReadRequest(FileRequestHandle request)
     {
         auto itr = AZStd::find_if(
@@ -95,6 +95,15 @@ namespace UnitTest
         IO::IStreamerTypes::RequestMemoryAllocatorResult m_data{ nullptr, 0, IO::IStreamerTypes::MemoryType::ReadWrite };
         AZ::IO::IStreamer::OnCompleteCallback m_callback;
         IO::FileRequestPtr m_request;
+        AZStd::string m_path;
+    };
+
+    // Record of a read as it was queued with the streamer, kept after the read itself has completed
+    struct QueuedRead
+    {
+        AZStd::string m_path;
+        AZStd::chrono::milliseconds m_deadline{};
+        AZ::IO::IStreamerTypes::Priority m_priority{};
     };
 
     struct MemoryStreamerWrapper
@@ -103,6 +112,7 @@ namespace UnitTest
         ~MemoryStreamerWrapper() = default;
 
         ReadRequest* GetReadRequest(IO::FileRequestHandle request);
+        void QueueReadRequest(const IO::FileRequestPtr& fileRequest);
 
         template<typename TObject>
         bool WriteMemoryFile(const AZStd::string& filePath, TObject* object, AZ::SerializeContext* context)
@@ -122,6 +132,8 @@ namespace UnitTest
         AZStd::recursive_mutex m_mutex;
         AZStd::queue<FileRequestHandle> m_processingQueue; // Keeps tracks of requests that have been queued while processing is suspended
         AZStd::vector<ReadRequest> m_readRequests;
+        AZStd::vector<QueuedRead> m_queuedReads;
+        AZStd::atomic_int m_queuedBatches{ 0 };
         AZStd::unordered_map<AZStd::string, AZStd::vector<char>> m_virtualFiles;
     };
 
@@ -2016,5 +2016,114 @@ namespace Benchmark
 
     BENCHMARK(BM_ComponentDependencySort)->Arg(6)->Arg(60);
 
+    // Components for the entity activation benchmark, each connects to a bus on activation like most game components do.
+    class ActivationBenchmarkRequests
+        : public EBusTraits
+    {
+    public:
+        static const EBusAddressPolicy AddressPolicy = EBusAddressPolicy::ById;
+        using BusIdType = EntityId;
+
+        virtual void Ping() = 0;
+    };
+    using ActivationBenchmarkBus = EBus<ActivationBenchmarkRequests>;
+
+    class ActivationBenchmarkComponentBase
+        : public Component
+        , public ActivationBenchmarkBus::Handler
+    {
+    public:
+        AZ_RTTI(ActivationBenchmarkComponentBase, "{15766719-4200-4178-A272-6EEC5CDCE71F}", Component);
+
+        void Activate() override { ActivationBenchmarkBus::Handler::BusConnect(GetEntityId()); }
+        void Deactivate() override { ActivationBenchmarkBus::Handler::BusDisconnect(); }
+        void Ping() override {}
+    };
+
+    class ActivationBenchmarkComponentA
+        : public ActivationBenchmarkComponentBase
+    {
+    public:
+        AZ_COMPONENT(ActivationBenchmarkComponentA, "{4F2E82B3-1D52-4755-9992-2244052C299C}", ActivationBenchmarkComponentBase);
+        static void Reflect(ReflectContext* /*reflection*/) {}
+    };
+
+    class ActivationBenchmarkComponentB
+        : public ActivationBenchmarkComponentBase
+    {
+    public:
+        AZ_COMPONENT(ActivationBenchmarkComponentB, "{B39A3965-4090-4A39-97E0-FD8773A491CE}", ActivationBenchmarkComponentBase);
+        static void Reflect(ReflectContext* /*reflection*/) {}
+    };
+
+    class ActivationBenchmarkComponentC
+        : public ActivationBenchmarkComponentBase
+    {
+    public:
+        AZ_COMPONENT(ActivationBenchmarkComponentC, "{D024FF49-7879-4ABD-A35C-677A8FA41461}", ActivationBenchmarkComponentBase);
+        static void Reflect(ReflectContext* /*reflection*/) {}
+    };
+
+    class ActivationBenchmarkComponentD
+        : public ActivationBenchmarkComponentBase
+    {
+    public:
+        AZ_COMPONENT(ActivationBenchmarkComponentD, "{85E0DDD4-C1A3-4DBA-BCBC-22EEEE9A01E1}", ActivationBenchmarkComponentBase);
+        static void Reflect(ReflectContext* /*reflection*/) {}
+    };
+
+    // Activates range(0) entities with four components each, one entity at a time as the game entity context does.
+    static void BM_ActivateEntities(::benchmark::State& state)
+    {
+        // descriptors are cleaned up when ComponentApplication shuts down
+        aznew ActivationBenchmarkComponentA::DescriptorType;
+        aznew ActivationBenchmarkComponentB::DescriptorType;
+        aznew ActivationBenchmarkComponentC::DescriptorType;
+        aznew ActivationBenchmarkComponentD::DescriptorType;
+
+        ComponentApplication componentApp;
+
+        ComponentApplication::Descriptor desc;
+        desc.m_useExistingAllocator = true;
+
+        ComponentApplication::StartupParameters startupParams;
+        startupParams.m_allocator = &AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+
+        Entity* systemEntity = componentApp.Create(desc, startupParams);
+        systemEntity->Init();
+
+        while (state.KeepRunning())
+        {
+            state.PauseTiming();
+            AZStd::vector<Entity*> entities;
+            entities.reserve(state.range(0));
+            for (int64_t i = 0; i < state.range(0); ++i)
+            {
+                Entity* entity = aznew Entity();
+                entity->CreateComponent<ActivationBenchmarkComponentA>();
+                entity->CreateComponent<ActivationBenchmarkComponentB>();
+                entity->CreateComponent<ActivationBenchmarkComponentC>();
+                entity->CreateComponent<ActivationBenchmarkComponentD>();
+                entity->Init();
+                entities.push_back(entity);
+            }
+            state.ResumeTiming();
+
+            for (Entity* entity : entities)
+            {
+                entity->Activate();
+            }
+
+            state.PauseTiming();
+            for (Entity* entity : entities)
+            {
+                delete entity;
+            }
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_ActivateEntities)->Arg(1000)->Arg(10000);
+
 } // Benchmark
 #endif // HAVE_BENCHMARK
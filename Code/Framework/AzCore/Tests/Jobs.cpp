@@ -69,9 +69,11 @@ namespace UnitTest
         JobManager* m_jobManager = nullptr;
         JobContext* m_jobContext = nullptr;
         unsigned int m_numWorkerThreads;
+        bool m_pinWorkerThreads;
     public:
-        DefaultJobManagerSetupFixture(unsigned int numWorkerThreads = 0)
+        DefaultJobManagerSetupFixture(unsigned int numWorkerThreads = 0, bool pinWorkerThreads = false)
             : m_numWorkerThreads(numWorkerThreads)
+            , m_pinWorkerThreads(pinWorkerThreads)
         {
         }
 
@@ -83,9 +85,12 @@ namespace UnitTest
             AllocatorInstance<ThreadPoolAllocator>::Create();
 
             JobManagerDesc desc;
+            desc.m_pinWorkerThreads = m_pinWorkerThreads;
             JobManagerThreadDesc threadDesc;
+            // Don't set processors IDs on windows
 #if AZ_TRAIT_SET_JOB_PROCESSOR_ID
-            threadDesc.m_cpuId = 0; // Don't set processors IDs on windows
+            // Leave the processor IDs for the job manager to choose when it's asked to pin the worker threads
+            threadDesc.m_cpuId = m_pinWorkerThreads ? -1 : 0;
 #endif // AZ_TRAIT_SET_JOB_PROCESSOR_ID
 
             if (m_numWorkerThreads == 0)
@@ -97,7 +102,10 @@ namespace UnitTest
             {
                 desc.m_workerThreads.push_back(threadDesc);
 #if AZ_TRAIT_SET_JOB_PROCESSOR_ID
-                threadDesc.m_cpuId++;
+                if (!m_pinWorkerThreads)
+                {
+                    threadDesc.m_cpuId++;
+                }
 #endif // AZ_TRAIT_SET_JOB_PROCESSOR_ID
             }
 
@@ -367,6 +375,109 @@ namespace UnitTest
     }
     // FibonacciJobExample-End
 
+    class JobWorkStealingPinnedTest
+        : public DefaultJobManagerSetupFixture
+    {
+    public:
+        JobWorkStealingPinnedTest()
+            : DefaultJobManagerSetupFixture(0, true)
+        {
+        }
+
+        void run()
+        {
+            m_jobManager->ClearStats();
+
+            int result = 0;
+            Job* job = aznew FibonacciJobFork(g_fibonacciSlow, &result, m_jobContext);
+            JobCompletionSpin doneJob(m_jobContext);
+            job->SetDependent(&doneJob);
+            job->Start();
+            doneJob.StartAndWaitForCompletion();
+            EXPECT_EQ(g_fibonacciSlowResult, result);
+        }
+    };
+
+    TEST_F(JobWorkStealingPinnedTest, ForkedJobs_AllComplete)
+    {
+        run();
+    }
+
+    using JobWorkQueueTest = AllocatorsTestFixture;
+
+    TEST_F(JobWorkQueueTest, GrowWhileStealing_EveryJobIsTakenOnce)
+    {
+        // Well past the initial capacity of the queue, so its buffer grows several times while the thieves are reading from it
+        constexpr int JobCount = 8192;
+        constexpr int JobsPushedBeforeStealing = 300;
+
+        // The queue only stores the job pointers, they are never dereferenced
+        AZStd::array<char, JobCount> jobs;
+        AZStd::array<AZStd::atomic<int>, JobCount> takenCounts;
+        for (int i = 0; i < JobCount; ++i)
+        {
+            takenCounts[i] = 0;
+        }
+        auto takeJob = [&jobs, &takenCounts](Job* job)
+        {
+            takenCounts[reinterpret_cast<char*>(job) - jobs.data()].fetch_add(1, AZStd::memory_order_relaxed);
+        };
+
+        Internal::WorkQueue queue;
+        int pushedJobs = 0;
+        for (; pushedJobs < JobsPushedBeforeStealing; ++pushedJobs)
+        {
+            queue.LocalPush(reinterpret_cast<Job*>(&jobs[pushedJobs]));
+        }
+
+        AZStd::atomic<bool> ownerDone{ false };
+        AZStd::vector<AZStd::thread> thieves;
+        const unsigned int numThieves = AZStd::GetMax(2u, AZStd::thread::hardware_concurrency() - 1);
+        for (unsigned int i = 0; i < numThieves; ++i)
+        {
+            thieves.emplace_back([&queue, &ownerDone, &takeJob]()
+            {
+                while (!ownerDone.load(AZStd::memory_order_acquire))
+                {
+                    if (Job* job = queue.TrySteal())
+                    {
+                        takeJob(job);
+                    }
+                }
+            });
+        }
+
+        // Keep the owner popping now and then so it races the thieves for the last jobs too
+        for (; pushedJobs < JobCount; ++pushedJobs)
+        {
+            queue.LocalPush(reinterpret_cast<Job*>(&jobs[pushedJobs]));
+            if (pushedJobs % 7 == 0)
+            {
+                if (Job* job = queue.LocalPop())
+                {
+                    takeJob(job);
+                }
+            }
+        }
+        while (Job* job = queue.LocalPop())
+        {
+            takeJob(job);
+        }
+
+        // The queue is empty and nothing is pushed anymore, the thieves can't find anything else
+        ownerDone.store(true, AZStd::memory_order_release);
+        for (AZStd::thread& thief : thieves)
+        {
+            thief.join();
+        }
+
+        EXPECT_EQ(nullptr, queue.TrySteal());
+        for (int i = 0; i < JobCount; ++i)
+        {
+            EXPECT_EQ(1, takenCounts[i].load()) << "Job " << i << " was taken " << takenCounts[i].load() << " times";
+        }
+    }
+
     // FibonacciJob2Example-Begin
     class FibonacciJob2
         : public Job
@@ -2028,6 +2139,131 @@ namespace Benchmark
             RunMultipleCalculatePiJobsWithRandomDepthAndRandomPriority(LARGE_NUMBER_OF_JOBS);
         }
     }
+
+    // Splits itself in two until the wanted depth is reached, so nearly all jobs are started from worker threads and
+    // spread between them by work stealing.
+    class TestJobForkCalculatePi : public Job
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TestJobForkCalculatePi, ThreadPoolAllocator, 0)
+
+        TestJobForkCalculatePi(AZ::u32 forkDepth, JobContext* context)
+            : Job(true, context)
+            , m_forkDepth(forkDepth)
+        {
+        }
+
+        void Process() override
+        {
+            if (m_forkDepth == 0)
+            {
+                benchmark::DoNotOptimize(CalculatePi(JobBenchmarkFixture::MEDIUM_WEIGHT_JOB_CALCULATE_PI_DEPTH));
+                return;
+            }
+            StartAsChild(aznew TestJobForkCalculatePi(m_forkDepth - 1, GetContext()));
+            StartAsChild(aznew TestJobForkCalculatePi(m_forkDepth - 1, GetContext()));
+            WaitForChildren();
+        }
+    private:
+        const AZ::u32 m_forkDepth;
+    };
+
+    //! Measures how fork heavy work scales with the number of worker threads, which is the first argument.
+    //! The second argument enables pinning the workers to cores. Reports the steal and idle counters of the workers.
+    class JobWorkStealingBenchmarkFixture : public ::benchmark::Fixture
+    {
+    public:
+        static const AZ::u32 FORK_DEPTH = 14;
+
+        void internalSetUp(const ::benchmark::State& state)
+        {
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+
+            JobManagerDesc desc;
+            desc.m_pinWorkerThreads = state.range(1) != 0;
+            for (int64_t i = 0; i < state.range(0); ++i)
+            {
+                desc.m_workerThreads.push_back(JobManagerThreadDesc());
+            }
+
+            m_jobManager = aznew JobManager(desc);
+            m_jobContext = aznew JobContext(*m_jobManager);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(const ::benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void internalTearDown()
+        {
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+        }
+        void TearDown(::benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(const ::benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void ReportWorkerStats(::benchmark::State& state)
+        {
+            JobManagerWorkerStats total;
+            for (AZ::u32 workerId = 0; workerId < m_jobManager->GetNumWorkerThreads(); ++workerId)
+            {
+                const JobManagerWorkerStats stats = m_jobManager->GetWorkerStats(workerId);
+                total.m_jobsStolen += stats.m_jobsStolen;
+                total.m_failedSteals += stats.m_failedSteals;
+                total.m_idleCount += stats.m_idleCount;
+                total.m_idleTime += stats.m_idleTime;
+            }
+            state.counters["JobsStolen"] = ::benchmark::Counter(static_cast<double>(total.m_jobsStolen), ::benchmark::Counter::kAvgIterations);
+            state.counters["FailedSteals"] = ::benchmark::Counter(static_cast<double>(total.m_failedSteals), ::benchmark::Counter::kAvgIterations);
+            state.counters["IdleCount"] = ::benchmark::Counter(static_cast<double>(total.m_idleCount), ::benchmark::Counter::kAvgIterations);
+            state.counters["IdleMicroseconds"] = ::benchmark::Counter(static_cast<double>(total.m_idleTime) * 1000000.0 / static_cast<double>(AZStd::GetTimeTicksPerSecond()), ::benchmark::Counter::kAvgIterations);
+        }
+
+    protected:
+        JobManager* m_jobManager = nullptr;
+        JobContext* m_jobContext = nullptr;
+    };
+
+    BENCHMARK_DEFINE_F(JobWorkStealingBenchmarkFixture, RunForkedJobs)(benchmark::State& state)
+    {
+        m_jobManager->ClearStats();
+        for (auto _ : state)
+        {
+            Job* job = aznew TestJobForkCalculatePi(FORK_DEPTH, m_jobContext);
+            JobCompletion doneJob(m_jobContext);
+            job->SetDependent(&doneJob);
+            job->Start();
+            doneJob.StartAndWaitForCompletion();
+        }
+        ReportWorkerStats(state);
+    }
+    BENCHMARK_REGISTER_F(JobWorkStealingBenchmarkFixture, RunForkedJobs)
+        ->Args({ 1, 0 })
+        ->Args({ 1, 1 })
+        ->Args({ 2, 0 })
+        ->Args({ 2, 1 })
+        ->Args({ 4, 0 })
+        ->Args({ 4, 1 })
+        ->Args({ 8, 0 })
+        ->Args({ 8, 1 })
+        ->Args({ 16, 0 })
+        ->Args({ 16, 1 })
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
 } // Benchmark
 
 #endif // HAVE_BENCHMARK
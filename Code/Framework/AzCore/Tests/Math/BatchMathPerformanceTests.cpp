@@ -0,0 +1,357 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/BatchMath.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/Sphere.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#if defined(HAVE_BENCHMARK)
+
+#include <random>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    // Compares looping over arrays of the scalar math types with running the batch kernels on the same data
+    class BM_MathBatch
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+        void internalSetUp()
+        {
+            static constexpr size_t NumElements = 4096;
+
+            const unsigned int seed = 1;
+            std::mt19937_64 rng(seed);
+            std::uniform_real_distribution<float> unif(-1.0f, 1.0f);
+            const auto randomVector = [&unif, &rng]()
+            {
+                return AZ::Vector3(unif(rng), unif(rng), unif(rng));
+            };
+            const auto randomRotation = [&unif, &rng, &randomVector]()
+            {
+                return AZ::Quaternion::CreateFromAxisAngle(randomVector().GetNormalizedSafe(), unif(rng) * AZ::Constants::Pi);
+            };
+
+            m_frustum = AZ::Frustum(AZ::ViewFrustumAttributes(AZ::Transform::CreateIdentity(), 1.0f, 2.0f * atanf(0.5f), 10.0f, 90.0f));
+            m_transform = AZ::Transform(randomVector() * 10.0f, randomRotation(), 2.0f);
+            for (size_t i = 0; i < NumElements; ++i)
+            {
+                m_vectorsA.push_back(randomVector() * 100.0f);
+                m_vectorsB.push_back(randomVector() * 100.0f);
+                m_rotationsA.push_back(randomRotation());
+                m_rotationsB.push_back(randomRotation());
+                m_weights.push_back(unif(rng) * 0.5f + 0.5f);
+                m_radii.push_back(unif(rng) * 5.0f + 5.0f);
+                m_maximums.push_back(m_vectorsA.back() + m_vectorsB.back().GetAbs());
+                m_transforms.push_back(AZ::Transform(randomVector() * 10.0f, randomRotation(), 1.0f));
+            }
+
+            m_vectorsSoaA = AZ::Vector3Soa(m_vectorsA);
+            m_vectorsSoaB = AZ::Vector3Soa(m_vectorsB);
+            m_maximumsSoa = AZ::Vector3Soa(m_maximums);
+            m_rotationsSoaA = AZ::QuaternionSoa(m_rotationsA);
+            m_rotationsSoaB = AZ::QuaternionSoa(m_rotationsB);
+            m_weightsSoa = AZ::FloatSoa(m_weights);
+            m_radiiSoa = AZ::FloatSoa(m_radii);
+            m_transformsSoa = AZ::TransformSoa(m_transforms);
+            m_floatsOut.resize(NumElements);
+            m_vectorsOut.resize(NumElements);
+            m_rotationsOut.resize(NumElements);
+            m_overlaps = AZStd::make_unique<bool[]>(NumElements);
+        }
+
+        void internalTearDown()
+        {
+            m_vectorsA = {};
+            m_vectorsB = {};
+            m_rotationsA = {};
+            m_rotationsB = {};
+            m_weights = {};
+            m_radii = {};
+            m_maximums = {};
+            m_transforms = {};
+            m_floatsOut = {};
+            m_vectorsOut = {};
+            m_rotationsOut = {};
+            m_vectorsSoaA = {};
+            m_vectorsSoaB = {};
+            m_vectorsSoaOut = {};
+            m_maximumsSoa = {};
+            m_rotationsSoaA = {};
+            m_rotationsSoaB = {};
+            m_rotationsSoaOut = {};
+            m_weightsSoa = {};
+            m_radiiSoa = {};
+            m_dotsSoa = {};
+            m_transformsSoa = {};
+            m_overlaps.reset();
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        AZ::Frustum m_frustum;
+        AZ::Transform m_transform;
+        AZStd::vector<AZ::Vector3> m_vectorsA;
+        AZStd::vector<AZ::Vector3> m_vectorsB;
+        AZStd::vector<AZ::Quaternion> m_rotationsA;
+        AZStd::vector<AZ::Quaternion> m_rotationsB;
+        AZStd::vector<float> m_weights;
+        AZStd::vector<float> m_radii;
+        AZStd::vector<AZ::Vector3> m_maximums;
+        AZStd::vector<AZ::Transform> m_transforms;
+        AZStd::vector<float> m_floatsOut;
+        AZStd::vector<AZ::Vector3> m_vectorsOut;
+        AZStd::vector<AZ::Quaternion> m_rotationsOut;
+
+        AZ::Vector3Soa m_vectorsSoaA;
+        AZ::Vector3Soa m_vectorsSoaB;
+        AZ::Vector3Soa m_vectorsSoaOut;
+        AZ::Vector3Soa m_maximumsSoa;
+        AZ::QuaternionSoa m_rotationsSoaA;
+        AZ::QuaternionSoa m_rotationsSoaB;
+        AZ::QuaternionSoa m_rotationsSoaOut;
+        AZ::FloatSoa m_weightsSoa;
+        AZ::FloatSoa m_radiiSoa;
+        AZ::FloatSoa m_dotsSoa;
+        AZ::TransformSoa m_transformsSoa;
+        AZStd::unique_ptr<bool[]> m_overlaps;
+    };
+
+    BENCHMARK_F(BM_MathBatch, TransformPoints_Scalar)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < m_vectorsA.size(); ++i)
+            {
+                m_vectorsOut[i] = m_transform.TransformPoint(m_vectorsA[i]);
+            }
+            benchmark::DoNotOptimize(m_vectorsOut.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectorsA.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, TransformPoints_Batch)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::BatchMath::TransformPoints(m_transform, m_vectorsSoaA, m_vectorsSoaOut);
+            benchmark::DoNotOptimize(m_vectorsSoaOut.GetX().GetData());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectorsA.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, TransformNormals_Scalar)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < m_vectorsA.size(); ++i)
+            {
+                m_vectorsOut[i] = m_transform.GetRotation().TransformVector(m_vectorsA[i]);
+            }
+            benchmark::DoNotOptimize(m_vectorsOut.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectorsA.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, TransformNormals_Batch)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::BatchMath::TransformNormals(m_transform, m_vectorsSoaA, m_vectorsSoaOut);
+            benchmark::DoNotOptimize(m_vectorsSoaOut.GetX().GetData());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectorsA.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, TransformPointsPerElement_Scalar)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < m_vectorsA.size(); ++i)
+            {
+                m_vectorsOut[i] = m_transforms[i].TransformPoint(m_vectorsA[i]);
+            }
+            benchmark::DoNotOptimize(m_vectorsOut.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectorsA.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, TransformPointsPerElement_Batch)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::BatchMath::TransformPoints(m_transformsSoa, m_vectorsSoaA, m_vectorsSoaOut);
+            benchmark::DoNotOptimize(m_vectorsSoaOut.GetX().GetData());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectorsA.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, Dot_Scalar)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < m_vectorsA.size(); ++i)
+            {
+                m_floatsOut[i] = m_vectorsA[i].Dot(m_vectorsB[i]);
+            }
+            benchmark::DoNotOptimize(m_floatsOut.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectorsA.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, Dot_Batch)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::BatchMath::Dot(m_vectorsSoaA, m_vectorsSoaB, m_dotsSoa);
+            benchmark::DoNotOptimize(m_dotsSoa.GetData());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectorsA.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, Cross_Scalar)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < m_vectorsA.size(); ++i)
+            {
+                m_vectorsOut[i] = m_vectorsA[i].Cross(m_vectorsB[i]);
+            }
+            benchmark::DoNotOptimize(m_vectorsOut.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectorsA.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, Cross_Batch)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::BatchMath::Cross(m_vectorsSoaA, m_vectorsSoaB, m_vectorsSoaOut);
+            benchmark::DoNotOptimize(m_vectorsSoaOut.GetX().GetData());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectorsA.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, AabbUnion_Scalar)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::Aabb aabb = AZ::Aabb::CreateNull();
+            for (size_t i = 0; i < m_vectorsA.size(); ++i)
+            {
+                aabb.AddAabb(AZ::Aabb::CreateFromMinMax(m_vectorsA[i], m_maximums[i]));
+            }
+            benchmark::DoNotOptimize(aabb);
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectorsA.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, AabbUnion_Batch)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::Aabb aabb = AZ::BatchMath::GetAabbUnion(m_vectorsSoaA, m_maximumsSoa);
+            benchmark::DoNotOptimize(aabb);
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectorsA.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, FrustumSphere_Scalar)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < m_vectorsA.size(); ++i)
+            {
+                m_overlaps[i] = AZ::ShapeIntersection::Overlaps(m_frustum, AZ::Sphere(m_vectorsA[i], m_radii[i]));
+            }
+            benchmark::DoNotOptimize(m_overlaps.get());
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectorsA.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, FrustumSphere_Batch)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            const size_t overlapCount = AZ::BatchMath::OverlapsFrustum(
+                m_frustum, m_vectorsSoaA, m_radiiSoa, AZStd::span<bool>(m_overlaps.get(), m_vectorsA.size()));
+            benchmark::DoNotOptimize(overlapCount);
+        }
+        state.SetItemsProcessed(state.iterations() * m_vectorsA.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, NLerp_Scalar)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < m_rotationsA.size(); ++i)
+            {
+                m_rotationsOut[i] = m_rotationsA[i].NLerp(m_rotationsB[i], m_weights[i]);
+            }
+            benchmark::DoNotOptimize(m_rotationsOut.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_rotationsA.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, NLerp_Batch)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::BatchMath::NLerp(m_rotationsSoaA, m_rotationsSoaB, m_weightsSoa, m_rotationsSoaOut);
+            benchmark::DoNotOptimize(m_rotationsSoaOut.GetX().GetData());
+        }
+        state.SetItemsProcessed(state.iterations() * m_rotationsA.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, Slerp_Scalar)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < m_rotationsA.size(); ++i)
+            {
+                m_rotationsOut[i] = m_rotationsA[i].Slerp(m_rotationsB[i], m_weights[i]);
+            }
+            benchmark::DoNotOptimize(m_rotationsOut.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_rotationsA.size());
+    }
+
+    BENCHMARK_F(BM_MathBatch, Slerp_Batch)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::BatchMath::Slerp(m_rotationsSoaA, m_rotationsSoaB, m_weightsSoa, m_rotationsSoaOut);
+            benchmark::DoNotOptimize(m_rotationsSoaOut.GetX().GetData());
+        }
+        state.SetItemsProcessed(state.iterations() * m_rotationsA.size());
+    }
+} // namespace Benchmark
+
+#endif
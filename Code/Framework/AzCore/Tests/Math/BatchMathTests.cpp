@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/BatchMath.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/Sphere.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AZTestShared/Math/MathTestHelpers.h>
+
+#include <random>
+
+namespace UnitTest
+{
+    // 37 elements, so the last lane group is partially filled whatever the lane count
+    class MATH_BatchMath
+        : public AllocatorsFixture
+    {
+    protected:
+        static constexpr size_t NumElements = 37;
+
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+
+            std::mt19937_64 rng(1);
+            std::uniform_real_distribution<float> unif(-1.0f, 1.0f);
+            const auto randomVector = [&unif, &rng]()
+            {
+                return AZ::Vector3(unif(rng), unif(rng), unif(rng));
+            };
+            const auto randomRotation = [&unif, &rng, &randomVector]()
+            {
+                return AZ::Quaternion::CreateFromAxisAngle(randomVector().GetNormalizedSafe(), unif(rng) * AZ::Constants::Pi);
+            };
+
+            m_transform = AZ::Transform(randomVector() * 10.0f, randomRotation(), 2.5f);
+            for (size_t i = 0; i < NumElements; ++i)
+            {
+                m_vectorsA.push_back(randomVector() * 100.0f);
+                m_vectorsB.push_back(randomVector() * 100.0f);
+                m_rotationsA.push_back(randomRotation());
+                m_rotationsB.push_back(randomRotation());
+                m_weights.push_back(unif(rng) * 0.5f + 0.5f);
+                m_transforms.push_back(AZ::Transform(randomVector() * 10.0f, randomRotation(), unif(rng) + 2.0f));
+            }
+            // Nearly identical rotations take the lerp path of Slerp
+            m_rotationsB[3] = m_rotationsA[3];
+        }
+
+        void TearDown() override
+        {
+            m_vectorsA = {};
+            m_vectorsB = {};
+            m_rotationsA = {};
+            m_rotationsB = {};
+            m_weights = {};
+            m_transforms = {};
+
+            AllocatorsFixture::TearDown();
+        }
+
+        AZ::Transform m_transform;
+        AZStd::vector<AZ::Vector3> m_vectorsA;
+        AZStd::vector<AZ::Vector3> m_vectorsB;
+        AZStd::vector<AZ::Quaternion> m_rotationsA;
+        AZStd::vector<AZ::Quaternion> m_rotationsB;
+        AZStd::vector<float> m_weights;
+        AZStd::vector<AZ::Transform> m_transforms;
+    };
+
+    TEST_F(MATH_BatchMath, Soa_RoundTrip)
+    {
+        AZ::Vector3Soa vectors(m_vectorsA);
+        EXPECT_EQ(vectors.GetSize(), NumElements);
+        EXPECT_EQ(vectors.GetX().GetLaneGroupCount() * AZ::SoaLaneCount, (NumElements + AZ::SoaLaneCount - 1) / AZ::SoaLaneCount * AZ::SoaLaneCount);
+
+        AZStd::vector<AZ::Vector3> stored(NumElements);
+        vectors.Store(stored);
+        EXPECT_EQ(stored, m_vectorsA);
+
+        AZ::TransformSoa transforms(m_transforms);
+        for (size_t i = 0; i < NumElements; ++i)
+        {
+            EXPECT_THAT(transforms.Get(i), IsClose(m_transforms[i]));
+        }
+    }
+
+    TEST_F(MATH_BatchMath, Soa_ResizeInitializesNewElements)
+    {
+        AZ::Vector3Soa vectors(m_vectorsA);
+        vectors.Resize(2);
+        vectors.Resize(6);
+        EXPECT_THAT(vectors.Get(1), IsClose(m_vectorsA[1]));
+        EXPECT_THAT(vectors.Get(2), IsClose(AZ::Vector3::CreateZero()));
+        EXPECT_THAT(vectors.Get(5), IsClose(AZ::Vector3::CreateZero()));
+
+        AZ::TransformSoa transforms(3);
+        EXPECT_THAT(transforms.Get(2), IsClose(AZ::Transform::CreateIdentity()));
+    }
+
+    TEST_F(MATH_BatchMath, TransformPoints_MatchesTransform)
+    {
+        const AZ::Vector3Soa points(m_vectorsA);
+        AZ::Vector3Soa transformedPoints;
+        AZ::Vector3Soa transformedVectors;
+        AZ::Vector3Soa transformedNormals;
+        AZ::BatchMath::TransformPoints(m_transform, points, transformedPoints);
+        AZ::BatchMath::TransformVectors(m_transform, points, transformedVectors);
+        AZ::BatchMath::TransformNormals(m_transform, points, transformedNormals);
+
+        ASSERT_EQ(transformedPoints.GetSize(), NumElements);
+        for (size_t i = 0; i < NumElements; ++i)
+        {
+            EXPECT_THAT(transformedPoints.Get(i), IsCloseTolerance(m_transform.TransformPoint(m_vectorsA[i]), 1e-3f));
+            EXPECT_THAT(transformedVectors.Get(i), IsCloseTolerance(m_transform.TransformVector(m_vectorsA[i]), 1e-3f));
+            EXPECT_THAT(transformedNormals.Get(i), IsCloseTolerance(m_transform.GetRotation().TransformVector(m_vectorsA[i]), 1e-3f));
+        }
+    }
+
+    TEST_F(MATH_BatchMath, TransformPoints_MatchesMatrix3x4)
+    {
+        const AZ::Matrix3x4 matrix = AZ::Matrix3x4::CreateFromTransform(m_transform) * AZ::Matrix3x4::CreateScale(AZ::Vector3(1.0f, 2.0f, 3.0f));
+        AZ::Vector3Soa points(m_vectorsA);
+        AZ::Vector3Soa transformedVectors;
+        AZ::BatchMath::TransformVectors(matrix, points, transformedVectors);
+
+        // Transforming in place
+        AZ::BatchMath::TransformPoints(matrix, points, points);
+        for (size_t i = 0; i < NumElements; ++i)
+        {
+            EXPECT_THAT(points.Get(i), IsCloseTolerance(matrix.TransformPoint(m_vectorsA[i]), 1e-3f));
+            EXPECT_THAT(transformedVectors.Get(i), IsCloseTolerance(matrix.TransformVector(m_vectorsA[i]), 1e-3f));
+        }
+    }
+
+    TEST_F(MATH_BatchMath, TransformPoints_PerElementTransforms)
+    {
+        const AZ::TransformSoa transforms(m_transforms);
+        const AZ::Vector3Soa points(m_vectorsA);
+        AZ::Vector3Soa out;
+        AZ::BatchMath::TransformPoints(transforms, points, out);
+
+        for (size_t i = 0; i < NumElements; ++i)
+        {
+            EXPECT_THAT(out.Get(i), IsCloseTolerance(m_transforms[i].TransformPoint(m_vectorsA[i]), 1e-3f));
+        }
+    }
+
+    TEST_F(MATH_BatchMath, DotAndCross_MatchVector3)
+    {
+        const AZ::Vector3Soa a(m_vectorsA);
+        const AZ::Vector3Soa b(m_vectorsB);
+        AZ::FloatSoa dots;
+        AZ::Vector3Soa crosses;
+        AZ::BatchMath::Dot(a, b, dots);
+        AZ::BatchMath::Cross(a, b, crosses);
+
+        for (size_t i = 0; i < NumElements; ++i)
+        {
+            EXPECT_NEAR(dots.Get(i), m_vectorsA[i].Dot(m_vectorsB[i]), 1e-1f);
+            EXPECT_THAT(crosses.Get(i), IsCloseTolerance(m_vectorsA[i].Cross(m_vectorsB[i]), 1e-1f));
+        }
+    }
+
+    TEST_F(MATH_BatchMath, GetAabb_MatchesAabb)
+    {
+        AZ::Aabb expected = AZ::Aabb::CreateNull();
+        for (const AZ::Vector3& point : m_vectorsA)
+        {
+            expected.AddPoint(point);
+        }
+        EXPECT_THAT(AZ::BatchMath::GetAabb(AZ::Vector3Soa(m_vectorsA)), IsClose(expected));
+
+        // All points in positive space, the zero padding of the last lane group must not be included
+        AZStd::vector<AZ::Vector3> offsetPoints;
+        AZ::Aabb expectedOffset = AZ::Aabb::CreateNull();
+        for (const AZ::Vector3& point : m_vectorsA)
+        {
+            offsetPoints.push_back(point + AZ::Vector3(1000.0f));
+            expectedOffset.AddPoint(offsetPoints.back());
+        }
+        EXPECT_THAT(AZ::BatchMath::GetAabb(AZ::Vector3Soa(offsetPoints)), IsClose(expectedOffset));
+
+        EXPECT_FALSE(AZ::BatchMath::GetAabb(AZ::Vector3Soa()).IsValid());
+    }
+
+    TEST_F(MATH_BatchMath, GetAabbUnion_MatchesAabb)
+    {
+        AZStd::vector<AZ::Vector3> minimums;
+        AZStd::vector<AZ::Vector3> maximums;
+        AZ::Aabb expected = AZ::Aabb::CreateNull();
+        for (size_t i = 0; i < NumElements; ++i)
+        {
+            const AZ::Aabb aabb = AZ::Aabb::CreateCenterHalfExtents(m_vectorsA[i] + AZ::Vector3(500.0f), m_vectorsB[i].GetAbs());
+            minimums.push_back(aabb.GetMin());
+            maximums.push_back(aabb.GetMax());
+            expected.AddAabb(aabb);
+        }
+        EXPECT_THAT(AZ::BatchMath::GetAabbUnion(AZ::Vector3Soa(minimums), AZ::Vector3Soa(maximums)), IsClose(expected));
+    }
+
+    TEST_F(MATH_BatchMath, OverlapsFrustum_MatchesShapeIntersection)
+    {
+        const AZ::Frustum frustum(AZ::ViewFrustumAttributes(AZ::Transform::CreateIdentity(), 1.0f, 2.0f * atanf(0.5f), 10.0f, 90.0f));
+        AZStd::vector<float> radii;
+        AZStd::vector<AZ::Vector3> centers;
+        for (size_t i = 0; i < NumElements; ++i)
+        {
+            centers.push_back(m_vectorsA[i] * AZ::Vector3(0.5f, 1.0f, 0.5f) + AZ::Vector3(0.0f, 50.0f, 0.0f));
+            radii.push_back(m_weights[i] * 10.0f);
+        }
+
+        AZStd::unique_ptr<bool[]> results = AZStd::make_unique<bool[]>(NumElements);
+        const size_t overlapCount = AZ::BatchMath::OverlapsFrustum(frustum, AZ::Vector3Soa(centers), AZ::FloatSoa(radii), AZStd::span<bool>(results.get(), NumElements));
+
+        size_t expectedCount = 0;
+        for (size_t i = 0; i < NumElements; ++i)
+        {
+            const bool expected = AZ::ShapeIntersection::Overlaps(frustum, AZ::Sphere(centers[i], radii[i]));
+            EXPECT_EQ(results[i], expected);
+            expectedCount += expected ? 1 : 0;
+        }
+        EXPECT_EQ(overlapCount, expectedCount);
+        EXPECT_GT(overlapCount, 0u);
+        EXPECT_LT(overlapCount, NumElements);
+    }
+
+    TEST_F(MATH_BatchMath, Interpolation_MatchesQuaternion)
+    {
+        const AZ::QuaternionSoa from(m_rotationsA);
+        const AZ::QuaternionSoa to(m_rotationsB);
+        const AZ::FloatSoa t(m_weights);
+        AZ::QuaternionSoa lerp;
+        AZ::QuaternionSoa nlerp;
+        AZ::QuaternionSoa slerp;
+        AZ::BatchMath::Lerp(from, to, t, lerp);
+        AZ::BatchMath::NLerp(from, to, t, nlerp);
+        AZ::BatchMath::Slerp(from, to, t, slerp);
+
+        for (size_t i = 0; i < NumElements; ++i)
+        {
+            EXPECT_THAT(lerp.Get(i), IsCloseTolerance(m_rotationsA[i].Lerp(m_rotationsB[i], m_weights[i]), 1e-4f));
+            EXPECT_THAT(nlerp.Get(i), IsCloseTolerance(m_rotationsA[i].NLerp(m_rotationsB[i], m_weights[i]), 1e-4f));
+            EXPECT_THAT(slerp.Get(i), IsCloseTolerance(m_rotationsA[i].Slerp(m_rotationsB[i], m_weights[i]), 1e-3f));
+        }
+    }
+} // namespace UnitTest
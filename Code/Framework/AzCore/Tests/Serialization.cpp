@@ -8245,5 +8245,153 @@ namespace UnitTest
             PathSerializationParams{ AZ::IO::WindowsPathSeparator, "test/foo/../bar" }
         )
     );
-}
 
+    /*
+    * Read plans used by the ObjectStream to load binary data
+    */
+    class ClassReadPlanTest
+        : public AllocatorsFixture
+    {
+    public:
+        struct ReadPlanTestClass
+        {
+            AZ_TYPE_INFO(ReadPlanTestClass, "{DB61EA79-170C-4422-978F-7702EEC11463}");
+
+            int m_int = 0;
+            float m_float = 0.0f;
+            AZStd::vector<int> m_vector;
+            AZStd::string m_string;
+            int m_extra = 7;
+        };
+
+        static void Reflect(SerializeContext& sc)
+        {
+            sc.Class<ReadPlanTestClass>()
+                ->Field("Int", &ReadPlanTestClass::m_int)
+                ->Field("Float", &ReadPlanTestClass::m_float)
+                ->Field("Vector", &ReadPlanTestClass::m_vector)
+                ->Field("String", &ReadPlanTestClass::m_string)
+                ;
+        }
+
+        // Same class reflected with its members in another order and a member that isn't in older data
+        static void ReflectReordered(SerializeContext& sc)
+        {
+            sc.Class<ReadPlanTestClass>()
+                ->Field("String", &ReadPlanTestClass::m_string)
+                ->Field("Extra", &ReadPlanTestClass::m_extra)
+                ->Field("Vector", &ReadPlanTestClass::m_vector)
+                ->Field("Float", &ReadPlanTestClass::m_float)
+                ->Field("Int", &ReadPlanTestClass::m_int)
+                ;
+        }
+
+        static ReadPlanTestClass CreateTestData()
+        {
+            ReadPlanTestClass data;
+            data.m_int = 42;
+            data.m_float = 1.5f;
+            data.m_vector = { 1, 2, 3 };
+            data.m_string = "Read plan";
+            return data;
+        }
+
+        static void SaveBinary(SerializeContext& sc, const ReadPlanTestClass& data, AZStd::vector<char>& buffer)
+        {
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+            ObjectStream* objStream = ObjectStream::Create(&stream, sc, ObjectStream::ST_BINARY);
+            objStream->WriteClass(&data);
+            objStream->Finalize();
+        }
+    };
+
+    TEST_F(ClassReadPlanTest, FindClassReadPlan_StepsFollowReflectedMembers)
+    {
+        SerializeContext sc;
+        Reflect(sc);
+
+        const SerializeContext::ClassData* classData = sc.FindClassData(azrtti_typeid<ReadPlanTestClass>());
+        ASSERT_NE(nullptr, classData);
+        const SerializeContext::ClassReadPlan* plan = sc.FindClassReadPlan(classData);
+        ASSERT_NE(nullptr, plan);
+        ASSERT_EQ(classData->m_elements.size(), plan->m_steps.size());
+        for (size_t i = 0; i < plan->m_steps.size(); ++i)
+        {
+            EXPECT_EQ(&classData->m_elements[i], plan->m_steps[i].m_classElement);
+            EXPECT_NE(nullptr, plan->m_steps[i].m_classData);
+        }
+        EXPECT_EQ(sc.FindClassData(azrtti_typeid<int>()), plan->m_steps[0].m_classData);
+        EXPECT_EQ(azrtti_typeid<AZStd::vector<int>>(), plan->m_steps[2].m_elementId);
+
+        // The plan is built once
+        EXPECT_EQ(plan, sc.FindClassReadPlan(classData));
+    }
+
+    TEST_F(ClassReadPlanTest, FindStep_MembersOutOfOrder_FoundByName)
+    {
+        SerializeContext sc;
+        Reflect(sc);
+        const SerializeContext::ClassReadPlan* plan = sc.FindClassReadPlan(sc.FindClassData(azrtti_typeid<ReadPlanTestClass>()));
+        ASSERT_NE(nullptr, plan);
+
+        size_t nextStep = 0;
+        EXPECT_EQ(&plan->m_steps[0], plan->FindStep(AZ_CRC_CE("Int"), nextStep));
+        EXPECT_EQ(1, nextStep);
+        EXPECT_EQ(&plan->m_steps[3], plan->FindStep(AZ_CRC_CE("String"), nextStep));
+        EXPECT_EQ(4, nextStep);
+        EXPECT_EQ(&plan->m_steps[1], plan->FindStep(AZ_CRC_CE("Float"), nextStep));
+        EXPECT_EQ(2, nextStep);
+        EXPECT_EQ(nullptr, plan->FindStep(AZ_CRC_CE("Extra"), nextStep));
+        EXPECT_EQ(2, nextStep);
+    }
+
+    TEST_F(ClassReadPlanTest, LoadBinary_MembersReorderedSinceSave_LoadedByName)
+    {
+        AZStd::vector<char> buffer;
+        {
+            SerializeContext saveContext;
+            Reflect(saveContext);
+            SaveBinary(saveContext, CreateTestData(), buffer);
+        }
+
+        SerializeContext loadContext;
+        ReflectReordered(loadContext);
+        ReadPlanTestClass loadedData;
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromBufferInPlace(buffer.data(), buffer.size(), loadedData, &loadContext));
+
+        const ReadPlanTestClass expectedData = CreateTestData();
+        EXPECT_EQ(expectedData.m_int, loadedData.m_int);
+        EXPECT_EQ(expectedData.m_float, loadedData.m_float);
+        EXPECT_EQ(expectedData.m_vector, loadedData.m_vector);
+        EXPECT_EQ(expectedData.m_string, loadedData.m_string);
+        EXPECT_EQ(7, loadedData.m_extra);
+    }
+
+    TEST_F(ClassReadPlanTest, LoadBinary_ReflectionReplaced_PlanRebuilt)
+    {
+        SerializeContext sc;
+        Reflect(sc);
+        AZStd::vector<char> buffer;
+        SaveBinary(sc, CreateTestData(), buffer);
+
+        ReadPlanTestClass loadedData;
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromBufferInPlace(buffer.data(), buffer.size(), loadedData, &sc));
+        EXPECT_EQ(42, loadedData.m_int);
+
+        sc.EnableRemoveReflection();
+        Reflect(sc);
+        sc.DisableRemoveReflection();
+        ReflectReordered(sc);
+
+        // The plan is built again from the new reflection of the class
+        const SerializeContext::ClassData* classData = sc.FindClassData(azrtti_typeid<ReadPlanTestClass>());
+        const SerializeContext::ClassReadPlan* plan = sc.FindClassReadPlan(classData);
+        ASSERT_EQ(classData->m_elements.size(), plan->m_steps.size());
+        EXPECT_EQ(&classData->m_elements[0], plan->m_steps[0].m_classElement);
+
+        ReadPlanTestClass reloadedData;
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromBufferInPlace(buffer.data(), buffer.size(), reloadedData, &sc));
+        EXPECT_EQ(42, reloadedData.m_int);
+        EXPECT_EQ("Read plan", reloadedData.m_string);
+    }
+}
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/JsonSystemComponent.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+
+namespace Benchmark
+{
+    namespace JsonSerializationBenchmarkClasses
+    {
+        class BaseComponent
+        {
+        public:
+            AZ_RTTI(BaseComponent, "{6E2E3C7A-0C0C-4C38-9C3B-7D0B7C56E2A1}");
+            AZ_CLASS_ALLOCATOR(BaseComponent, AZ::SystemAllocator, 0);
+
+            virtual ~BaseComponent() = default;
+
+            AZ::u64 m_id{ 0 };
+        };
+
+        class TransformComponent
+            : public BaseComponent
+        {
+        public:
+            AZ_RTTI(TransformComponent, "{0F4C1A57-2D3B-4B8E-9B0B-5B1E61A0D7C2}", BaseComponent);
+            AZ_CLASS_ALLOCATOR(TransformComponent, AZ::SystemAllocator, 0);
+
+            AZStd::vector<float> m_translation;
+            AZStd::vector<float> m_rotation;
+            float m_scale{ 1.0f };
+            AZ::u64 m_parentId{ 0 };
+        };
+
+        class MeshComponent
+            : public BaseComponent
+        {
+        public:
+            AZ_RTTI(MeshComponent, "{C3D5E3F1-8E44-4A4A-A9C7-3E6E3F8B9B25}", BaseComponent);
+            AZ_CLASS_ALLOCATOR(MeshComponent, AZ::SystemAllocator, 0);
+
+            AZStd::string m_modelAsset;
+            AZStd::vector<AZStd::string> m_materials;
+            bool m_castShadows{ true };
+        };
+
+        struct Entity
+        {
+            AZ_TYPE_INFO(Entity, "{5A6D6F0C-4E93-4D4B-8F16-0B7B6F1E3C8D}");
+            AZ_CLASS_ALLOCATOR(Entity, AZ::SystemAllocator, 0);
+
+            Entity() = default;
+            Entity(const Entity&) = delete;
+            ~Entity()
+            {
+                for (BaseComponent* component : m_components)
+                {
+                    delete component;
+                }
+            }
+
+            AZ::u64 m_id{ 0 };
+            AZStd::string m_name;
+            AZStd::vector<BaseComponent*> m_components;
+        };
+
+        struct Prefab
+        {
+            AZ_TYPE_INFO(Prefab, "{A1B7E4C2-77C5-4F0B-8F7E-2F7C7A1D6E39}");
+
+            Prefab() = default;
+            Prefab(const Prefab&) = delete;
+            ~Prefab()
+            {
+                for (Entity* entity : m_entities)
+                {
+                    delete entity;
+                }
+            }
+
+            AZStd::string m_name;
+            AZStd::vector<Entity*> m_entities;
+        };
+
+        void Reflect(AZ::SerializeContext* context)
+        {
+            context->Class<BaseComponent>()
+                ->Field("Id", &BaseComponent::m_id);
+            context->Class<TransformComponent, BaseComponent>()
+                ->Field("Translation", &TransformComponent::m_translation)
+                ->Field("Rotation", &TransformComponent::m_rotation)
+                ->Field("Scale", &TransformComponent::m_scale)
+                ->Field("Parent", &TransformComponent::m_parentId);
+            context->Class<MeshComponent, BaseComponent>()
+                ->Field("Model", &MeshComponent::m_modelAsset)
+                ->Field("Materials", &MeshComponent::m_materials)
+                ->Field("CastShadows", &MeshComponent::m_castShadows);
+            context->Class<Entity>()
+                ->Field("Id", &Entity::m_id)
+                ->Field("Name", &Entity::m_name)
+                ->Field("Components", &Entity::m_components);
+            context->Class<Prefab>()
+                ->Field("Name", &Prefab::m_name)
+                ->Field("Entities", &Prefab::m_entities);
+        }
+    } // namespace JsonSerializationBenchmarkClasses
+
+    //! Compares loading a large prefab-like json file by first parsing it into a rapidjson::Document with loading it while it's
+    //! being parsed. Besides the time, the highest number of bytes allocated from the SystemAllocator while loading is reported
+    //! as "PeakBytes". This is sampled whenever an issue is reported and once the json has been loaded.
+    //! The argument is the number of entities in the file.
+    class JsonSerializationBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& st) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
+            internalSetUp(st);
+        }
+
+        void SetUp(::benchmark::State& st) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
+            internalSetUp(st);
+        }
+
+        void TearDown(::benchmark::State& st) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
+        }
+
+        void TearDown(const ::benchmark::State& st) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
+        }
+
+    protected:
+        void internalSetUp(const ::benchmark::State& st)
+        {
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_jsonRegistrationContext = AZStd::make_unique<AZ::JsonRegistrationContext>();
+            m_jsonSystemComponent = AZ::JsonSystemComponent::CreateDescriptor();
+            m_jsonSystemComponent->Reflect(m_serializeContext.get());
+            m_jsonSystemComponent->Reflect(m_jsonRegistrationContext.get());
+            JsonSerializationBenchmarkClasses::Reflect(m_serializeContext.get());
+
+            m_settings.m_serializeContext = m_serializeContext.get();
+            m_settings.m_registrationContext = m_jsonRegistrationContext.get();
+            m_settings.m_reporting = [this](AZStd::string_view, AZ::JsonSerializationResult::ResultCode result, AZStd::string_view)
+            {
+                SamplePeakMemory();
+                return result;
+            };
+
+            m_json = GeneratePrefab(st.range(0));
+        }
+
+        void internalTearDown()
+        {
+            m_json = {};
+            m_settings = {};
+
+            m_jsonRegistrationContext->EnableRemoveReflection();
+            m_jsonSystemComponent->Reflect(m_jsonRegistrationContext.get());
+            m_jsonRegistrationContext->DisableRemoveReflection();
+            delete m_jsonSystemComponent;
+            m_jsonSystemComponent = nullptr;
+
+            m_jsonRegistrationContext.reset();
+            m_serializeContext.reset();
+        }
+
+        static AZStd::string GeneratePrefab(int64_t entityCount)
+        {
+            AZStd::string json = R"({"Name":"BenchmarkPrefab","Entities":[)";
+            for (int64_t i = 0; i < entityCount; ++i)
+            {
+                json += AZStd::string::format(
+                    R"(%s{"Id":%lld,"Name":"Entity_%lld","Components":[)"
+                    R"({"$type":"TransformComponent","Id":%lld,"Translation":[%lld.5,2.0,-3.25],"Rotation":[0.0,0.0,0.7071,0.7071],)"
+                    R"("Scale":2.0,"Parent":%lld},)"
+                    R"({"$type":"MeshComponent","Id":%lld,"Model":"objects/props/prop_%lld.azmodel",)"
+                    R"("Materials":["materials/default.azmaterial","materials/prop_%lld.azmaterial"],"CastShadows":false}]})",
+                    i == 0 ? "" : ",", static_cast<long long>(i), static_cast<long long>(i), static_cast<long long>(i * 2),
+                    static_cast<long long>(i), static_cast<long long>(i / 2), static_cast<long long>(i * 2 + 1),
+                    static_cast<long long>(i % 64), static_cast<long long>(i % 16));
+            }
+            json += "]}";
+            return json;
+        }
+
+        void SamplePeakMemory()
+        {
+            m_peakBytes = AZStd::max(m_peakBytes, AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes());
+        }
+
+        void ReportPeakMemory(::benchmark::State& st, size_t startBytes)
+        {
+            st.counters["PeakBytes"] = ::benchmark::Counter(aznumeric_cast<double>(m_peakBytes - startBytes));
+            st.SetBytesProcessed(st.iterations() * m_json.size());
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::JsonRegistrationContext> m_jsonRegistrationContext;
+        AZ::ComponentDescriptor* m_jsonSystemComponent{ nullptr };
+        AZ::JsonDeserializerSettings m_settings;
+        AZStd::string m_json;
+        size_t m_peakBytes{ 0 };
+    };
+
+    BENCHMARK_DEFINE_F(JsonSerializationBenchmark, BM_LoadFromDocument)(benchmark::State& state)
+    {
+        const size_t startBytes = AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes();
+        m_peakBytes = startBytes;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            JsonSerializationBenchmarkClasses::Prefab prefab;
+            {
+                rapidjson::Document document;
+                document.Parse<rapidjson::kParseCommentsFlag>(m_json.c_str(), m_json.size());
+                SamplePeakMemory();
+                AZ::JsonSerialization::Load(prefab, document, m_settings);
+                SamplePeakMemory();
+            }
+            benchmark::DoNotOptimize(prefab.m_entities.data());
+        }
+        ReportPeakMemory(state, startBytes);
+    }
+    BENCHMARK_REGISTER_F(JsonSerializationBenchmark, BM_LoadFromDocument)
+        ->Arg(100)
+        ->Arg(1000)
+        ->Arg(10000)
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(JsonSerializationBenchmark, BM_LoadFromString)(benchmark::State& state)
+    {
+        const size_t startBytes = AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes();
+        m_peakBytes = startBytes;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            JsonSerializationBenchmarkClasses::Prefab prefab;
+            AZ::JsonSerialization::LoadFromString(prefab, m_json, m_settings);
+            SamplePeakMemory();
+            benchmark::DoNotOptimize(prefab.m_entities.data());
+        }
+        ReportPeakMemory(state, startBytes);
+    }
+    BENCHMARK_REGISTER_F(JsonSerializationBenchmark, BM_LoadFromString)
+        ->Arg(100)
+        ->Arg(1000)
+        ->Arg(10000)
+        ->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+
+#endif // defined(HAVE_BENCHMARK)
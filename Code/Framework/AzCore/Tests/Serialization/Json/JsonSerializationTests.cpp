@@ -205,6 +205,69 @@ namespace JsonSerializationTests
         EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
     }
 
+    TYPED_TEST(TypedJsonSerializationTests, LoadFromString_JsonWithoutDefaults_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithoutDefaults();
+
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromString(loadInstance, description.m_json, *this->m_deserializationSettings);
+        ASSERT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
+    TYPED_TEST(TypedJsonSerializationTests, LoadFromString_JsonWithSomeDefaults_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithSomeDefaults();
+
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromString(
+            loadInstance, description.m_jsonWithStrippedDefaults, *this->m_deserializationSettings);
+        bool validResult =
+            loadResult.GetOutcome() == Outcomes::Success ||
+            loadResult.GetOutcome() == Outcomes::DefaultsUsed ||
+            loadResult.GetOutcome() == Outcomes::PartialDefaults;
+        EXPECT_TRUE(validResult);
+        EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
+    TYPED_TEST(TypedJsonSerializationTests, LoadFromString_JsonWithSomeDefaultsKept_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithSomeDefaults();
+
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromString(
+            loadInstance, description.m_jsonWithKeptDefaults, *this->m_deserializationSettings);
+        ASSERT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
+    // Loading while parsing should report the same outcome as loading from a parsed document.
+    TYPED_TEST(TypedJsonSerializationTests, LoadFromString_JsonWithSomeDefaults_ResultMatchesLoad)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithSomeDefaults();
+        this->m_jsonDocument->Parse(description.m_jsonWithStrippedDefaults);
+
+        TypeParam documentInstance;
+        ResultCode documentResult = AZ::JsonSerialization::Load(documentInstance, *this->m_jsonDocument, *this->m_deserializationSettings);
+        TypeParam streamInstance;
+        ResultCode streamResult = AZ::JsonSerialization::LoadFromString(
+            streamInstance, description.m_jsonWithStrippedDefaults, *this->m_deserializationSettings);
+        EXPECT_EQ(documentResult.GetOutcome(), streamResult.GetOutcome());
+        EXPECT_EQ(documentResult.GetProcessing(), streamResult.GetProcessing());
+    }
+
     // Load
 
     TEST_F(JsonSerializationTests, Load_PrimitiveAtTheRoot_SucceedsAndObjectMatches)
@@ -334,6 +397,229 @@ namespace JsonSerializationTests
         EXPECT_EQ(Processing::Halted, loadResult.GetProcessing());
     }
 
+    // LoadFromString
+
+    TEST_F(JsonSerializationTests, LoadFromString_ArrayAtTheRoot_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        auto genericInfo = AZ::SerializeGenericTypeInfo<AZStd::vector<int>>::GetGenericInfo();
+        ASSERT_NE(nullptr, genericInfo);
+        genericInfo->Reflect(m_serializeContext.get());
+
+        AZStd::vector<int> loadValues;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromString(loadValues, "[13,42,88]", *m_deserializationSettings);
+        ASSERT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        EXPECT_EQ(loadValues, AZStd::vector<int>({ 13, 42, 88 }));
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromString_PointerToSameClass_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        ComplexNullInheritedPointer::Reflect(m_serializeContext, true);
+
+        ComplexNullInheritedPointer instance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromString(instance,
+            R"({
+                    "pointer":
+                    {
+                        "$type": "BaseClass"
+                    }
+                })",
+            *m_deserializationSettings);
+        ASSERT_EQ(Outcomes::DefaultsUsed, loadResult.GetOutcome());
+
+        ASSERT_NE(nullptr, instance.m_pointer);
+        EXPECT_EQ(azrtti_typeid(instance.m_pointer), azrtti_typeid<BaseClass>());
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromString_InvalidPointerName_FailsToConvert)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        ComplexNullInheritedPointer::Reflect(m_serializeContext, true);
+
+        ComplexNullInheritedPointer instance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromString(instance,
+            R"({
+                    "pointer":
+                    {
+                        "$type": "Invalid"
+                    }
+                })",
+            *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Unknown, loadResult.GetOutcome());
+        EXPECT_EQ(Processing::Halted, loadResult.GetProcessing());
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromString_UnrelatedPointerType_FailsToCast)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        ComplexNullInheritedPointer::Reflect(m_serializeContext, true);
+        SimpleClass::Reflect(m_serializeContext, true);
+
+        ComplexNullInheritedPointer instance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromString(instance,
+            R"({
+                    "pointer":
+                    {
+                        "$type": "SimpleClass"
+                    }
+                })",
+            *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::TypeMismatch, loadResult.GetOutcome());
+        EXPECT_EQ(Processing::Halted, loadResult.GetProcessing());
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromString_TypeAfterOtherFields_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        ComplexNullInheritedPointer::Reflect(m_serializeContext, true);
+
+        ComplexNullInheritedPointer instance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromString(instance,
+            R"({
+                    "pointer":
+                    {
+                        "var2": 88.0,
+                        "base_var": 13.0,
+                        "$type": "SimpleInheritence",
+                        "var1": 7
+                    }
+                })",
+            *m_deserializationSettings);
+        ASSERT_EQ(Processing::Completed, loadResult.GetProcessing());
+
+        ASSERT_NE(nullptr, instance.m_pointer);
+        ASSERT_EQ(azrtti_typeid(instance.m_pointer), azrtti_typeid<SimpleInheritence>());
+        const SimpleInheritence* pointer = static_cast<const SimpleInheritence*>(instance.m_pointer);
+        EXPECT_EQ(7, pointer->m_var1);
+        EXPECT_FLOAT_EQ(88.0f, pointer->m_var2);
+        EXPECT_FLOAT_EQ(13.0f, pointer->m_baseVar);
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromString_TypeAfterLargeFields_SucceedsAndResultMatchesLoad)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        ComplexNullInheritedPointer::Reflect(m_serializeContext, true);
+
+        // The unknown field is too large to keep looking for the "$type", so the object is loaded as a whole.
+        AZStd::string json = AZStd::string::format(R"({ "pointer": { "padding": "%s", "var2": 88.0, "$type": "SimpleInheritence" } })",
+            AZStd::string(32 * 1024, 'x').c_str());
+
+        m_jsonDocument->Parse(json.c_str());
+        ASSERT_FALSE(m_jsonDocument->HasParseError());
+        ComplexNullInheritedPointer expected;
+        ResultCode expectedResult = AZ::JsonSerialization::Load(expected, *m_jsonDocument, *m_deserializationSettings);
+
+        ComplexNullInheritedPointer instance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromString(instance, json, *m_deserializationSettings);
+        EXPECT_EQ(expectedResult.GetOutcome(), loadResult.GetOutcome());
+        EXPECT_EQ(expectedResult.GetProcessing(), loadResult.GetProcessing());
+
+        ASSERT_NE(nullptr, instance.m_pointer);
+        ASSERT_EQ(azrtti_typeid(instance.m_pointer), azrtti_typeid<SimpleInheritence>());
+        EXPECT_FLOAT_EQ(88.0f, static_cast<const SimpleInheritence*>(instance.m_pointer)->m_var2);
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromString_PointerWithoutType_LoadsDeclaredType)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        ComplexNullInheritedPointer::Reflect(m_serializeContext, true);
+
+        ComplexNullInheritedPointer instance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromString(instance, R"({ "pointer": { "base_var": 13.0 } })",
+            *m_deserializationSettings);
+        ASSERT_EQ(Processing::Completed, loadResult.GetProcessing());
+
+        ASSERT_NE(nullptr, instance.m_pointer);
+        EXPECT_EQ(azrtti_typeid(instance.m_pointer), azrtti_typeid<BaseClass>());
+        EXPECT_FLOAT_EQ(13.0f, instance.m_pointer->m_baseVar);
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromString_HaltedClassMemberFollowedByMoreMembers_SkipsRemainderAndResultMatchesLoad)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        InheritedPointerInContainer::Reflect(m_serializeContext, true);
+
+        // "var1" can't be read from an array, which halts loading of the first element while its other members and the
+        // remaining elements still have to be read.
+        const char* json = R"({
+                "array":
+                [
+                    { "$type": "SimpleInheritence", "var1": [ 42 ], "var2": 88.0, "base_var": { "nested": [ 1, 2 ] } },
+                    { "$type": "SimpleInheritence", "var1": 7 },
+                    [ 13 ]
+                ]
+            })";
+
+        m_jsonDocument->Parse(json);
+        ASSERT_FALSE(m_jsonDocument->HasParseError());
+        InheritedPointerInContainer expected;
+        ResultCode expectedResult = AZ::JsonSerialization::Load(expected, *m_jsonDocument, *m_deserializationSettings);
+
+        InheritedPointerInContainer instance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromString(instance, json, *m_deserializationSettings);
+        EXPECT_EQ(expectedResult.GetOutcome(), loadResult.GetOutcome());
+        EXPECT_EQ(expectedResult.GetProcessing(), loadResult.GetProcessing());
+        EXPECT_EQ(expected.m_array.size(), instance.m_array.size());
+        EXPECT_TRUE(instance.m_array.empty());
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromString_HaltedContainerElementFollowedByMoreElements_SkipsRemainderAndResultMatchesLoad)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        InheritedPointerInContainer::Reflect(m_serializeContext, true);
+
+        // The unknown type halts loading of the first element while the remaining elements still have to be read.
+        const char* json = R"({
+                "array":
+                [
+                    { "$type": "Invalid", "base_var": 13.0 },
+                    { "$type": "SimpleInheritence", "var1": 7, "var2": [ 88.0 ] },
+                    { "base_var": 42.0 }
+                ]
+            })";
+
+        m_jsonDocument->Parse(json);
+        ASSERT_FALSE(m_jsonDocument->HasParseError());
+        InheritedPointerInContainer expected;
+        ResultCode expectedResult = AZ::JsonSerialization::Load(expected, *m_jsonDocument, *m_deserializationSettings);
+
+        InheritedPointerInContainer instance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromString(instance, json, *m_deserializationSettings);
+        EXPECT_EQ(expectedResult.GetOutcome(), loadResult.GetOutcome());
+        EXPECT_EQ(expectedResult.GetProcessing(), loadResult.GetProcessing());
+        EXPECT_EQ(expected.m_array.size(), instance.m_array.size());
+        EXPECT_TRUE(instance.m_array.empty());
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromString_LoadToNullPtr_ReturnsCatastrophic)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromString(nullptr, azrtti_typeid<int>(), "42", *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Catastrophic, loadResult.GetOutcome());
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromString_InvalidJson_ReturnsCatastrophic)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        SimpleClass::Reflect(m_serializeContext, true);
+
+        SimpleClass instance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromString(instance, R"({ "var1": 42, )", *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Catastrophic, loadResult.GetOutcome());
+    }
+
     // Store
 
     TEST_F(JsonSerializationTests, Store_PrimitiveAtTheRoot_ReturnsSuccessAndTheValueAtTheRoot)
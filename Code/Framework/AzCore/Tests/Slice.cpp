@@ -892,5 +892,59 @@ namespace Benchmark
 
     BENCHMARK(BM_Slice_GenerateNewIdsAndFixRefs)->Arg(10)->Arg(1000);
 
+    // Measures the throughput of loading slice entities from a binary object stream, the format of slices, legacy assets and
+    // save data. The argument is the number of entities.
+    static void BM_Slice_LoadBinaryObjectStream(benchmark::State& state)
+    {
+        AZ::ComponentApplication componentApp;
+
+        AZ::ComponentApplication::Descriptor desc;
+        desc.m_useExistingAllocator = true;
+
+        AZ::ComponentApplication::StartupParameters startupParams;
+        startupParams.m_allocator = &AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+
+        componentApp.Create(desc, startupParams);
+
+        AZ::SerializeContext* serializeContext = componentApp.GetSerializeContext();
+        UnitTest::MyTestComponent1::Reflect(serializeContext);
+        UnitTest::MyTestComponent2::Reflect(serializeContext);
+
+        AZ::SliceComponent::InstantiatedContainer container;
+        for (int64_t entityI = 0; entityI < state.range(0); ++entityI)
+        {
+            auto entity = aznew AZ::Entity(AZStd::string::format("Entity%lld", static_cast<long long>(entityI)));
+            auto component1 = entity->CreateComponent<UnitTest::MyTestComponent1>();
+            component1->m_float = static_cast<float>(entityI);
+            component1->m_int = static_cast<int>(entityI);
+            entity->CreateComponent<UnitTest::MyTestComponent1>();
+            auto component2 = entity->CreateComponent<UnitTest::MyTestComponent2>();
+            if (entityI != 0)
+            {
+                component2->m_entityId = container.m_entities.back()->GetId();
+            }
+            container.m_entities.push_back(entity);
+        }
+
+        AZStd::vector<char> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        AZ::ObjectStream* objStream = AZ::ObjectStream::Create(&stream, *serializeContext, AZ::ObjectStream::ST_BINARY);
+        objStream->WriteClass(&container);
+        objStream->Finalize();
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::SliceComponent::InstantiatedContainer* loadedContainer =
+                AZ::Utils::LoadObjectFromBuffer<AZ::SliceComponent::InstantiatedContainer>(buffer.data(), buffer.size(), serializeContext);
+
+            state.PauseTiming();
+            delete loadedContainer;
+            state.ResumeTiming();
+        }
+        state.SetBytesProcessed(state.iterations() * buffer.size());
+    }
+
+    BENCHMARK(BM_Slice_LoadBinaryObjectStream)->Arg(10)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
 } // namespace Benchmark
 #endif // HAVE_BENCHMARK
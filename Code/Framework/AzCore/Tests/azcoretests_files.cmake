@@ -101,6 +101,7 @@ set(FILES
     Serialization/Json/DoubleSerializerTests.cpp
     Serialization/Json/IntSerializerTests.cpp
     Serialization/Json/JsonRegistrationContextTests.cpp
+    Serialization/Json/JsonSerializationBenchmarks.cpp
     Serialization/Json/JsonSerializationMetadataTests.cpp
     Serialization/Json/JsonSerializationResultTests.cpp
     Serialization/Json/JsonSerializationTests.h
@@ -133,6 +134,8 @@ set(FILES
     Serialization/Json/UuidSerializerTests.cpp
     Time/TimeTests.cpp
     Math/AabbTests.cpp
+    Math/BatchMathPerformanceTests.cpp
+    Math/BatchMathTests.cpp
     Math/ColorTests.cpp
     Math/CrcTests.cpp
     Math/CrcTestsCompileTimeLiterals.h
@@ -188,6 +191,7 @@ set(FILES
     AZStd/ChronoTests.cpp
     AZStd/DequeAndSimilar.cpp
     AZStd/Examples.cpp
+    AZStd/FlatContainers.cpp
     AZStd/FunctionalBasic.cpp
     AZStd/FunctorsBind.cpp
     AZStd/Hashed.cpp
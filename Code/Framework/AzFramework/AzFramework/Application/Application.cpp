@@ -57,6 +57,7 @@
 #include <AzFramework/Archive/ArchiveFileIO.h>
 #include <AzFramework/Script/ScriptRemoteDebugging.h>
 #include <AzFramework/Script/ScriptComponent.h>
+#include <AzFramework/Script/ScriptVMPoolComponent.h>
 #include <AzFramework/Spawnable/SpawnableSystemComponent.h>
 #include <AzFramework/StreamingInstall/StreamingInstall.h>
 #include <AzFramework/SurfaceData/SurfaceData.h>
@@ -351,6 +352,10 @@ namespace AzFramework
             AZ::Uuid("{624a7be2-3c7e-4119-aee2-1db2bdb6cc89}"), // ScriptDebugAgent
             });
 
+#if !defined(AZCORE_EXCLUDE_LUA)
+        components.push_back(azrtti_typeid<AzFramework::ScriptVMPoolComponent>());
+#endif // #if !defined(AZCORE_EXCLUDE_LUA)
+
         return components;
     }
 
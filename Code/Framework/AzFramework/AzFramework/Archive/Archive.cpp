@@ -51,6 +51,9 @@ namespace AZ::IO
     AZ_CVAR(int32_t, az_archive_verbosity, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
         "Sets the verbosity level for logging Archive operations\n"
         ">=1 - Turns on verbose logging of all operations");
+    AZ_CVAR(bool, sys_PakMemoryMapped, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If set, paks opened afterwards are memory mapped as a whole and looked up through a flat sorted table.\n"
+        "Stored files are then served without copies, at the cost of address space for the whole pak");
 }
 
 namespace AZ::IO::ArchiveInternal
@@ -1162,7 +1165,11 @@ namespace AZ::IO
             }
         }
 
-        const int flags = INestedArchive::FLAGS_OPTIMIZED_READ_ONLY | INestedArchive::FLAGS_ABSOLUTE_PATHS;
+        int flags = INestedArchive::FLAGS_OPTIMIZED_READ_ONLY | INestedArchive::FLAGS_ABSOLUTE_PATHS;
+        if (sys_PakMemoryMapped)
+        {
+            flags |= INestedArchive::FLAGS_MEMORY_MAPPED;
+        }
 
         desc.pArchive = OpenArchive(szFullPath, szBindRoot, flags, pData);
         if (!desc.pArchive)
@@ -1540,6 +1547,30 @@ namespace AZ::IO
         return m_pFileData;
     }
 
+    const void* CCachedFileData::GetDataView()
+    {
+        // stored files in a memory mapped archive are handed out as views into the mapping, without copying them
+        if (m_pZip->IsMemoryMapped() && m_pFileEntry->nMethod == ZipFile::METHOD_STORE)
+        {
+            return GetMappedData();
+        }
+        return GetData();
+    }
+
+    const uint8_t* CCachedFileData::GetMappedData()
+    {
+        const uint8_t* pMappedData = m_pZip->GetMappedFileData(m_pFileEntry);
+        if (pMappedData && m_pFileEntry->bCheckCRCNextRead)
+        {
+            AZStd::scoped_lock lock(m_pFileEntry->m_readLock);
+            if (m_pZip->CheckStoredFileCRC(m_pFileEntry, pMappedData) != ZipDir::ZD_ERROR_SUCCESS)
+            {
+                return nullptr;
+            }
+        }
+        return pMappedData;
+    }
+
     //////////////////////////////////////////////////////////////////////////
     int64_t CCachedFileData::ReadData(void* pBuffer, int64_t nFileOffset, int64_t nReadSize)
     {
@@ -1563,7 +1594,17 @@ namespace AZ::IO
             return 0;
         }
 
-        if (m_pFileEntry->nMethod == ZipFile::METHOD_STORE) //Can't use this technique for METHOD_STORE_AND_STREAMCIPHER_KEYTABLE as seeking with encryption performs poorly
+        if (m_pFileEntry->nMethod == ZipFile::METHOD_STORE && m_pZip->IsMemoryMapped())
+        {
+            // the file is already in memory, only copy the requested range
+            const uint8_t* pSrcBuffer = GetMappedData();
+            if (!pSrcBuffer)
+            {
+                return -1;
+            }
+            memcpy(pBuffer, pSrcBuffer + nFileOffset, static_cast<size_t>(nReadSize));
+        }
+        else if (m_pFileEntry->nMethod == ZipFile::METHOD_STORE) //Can't use this technique for METHOD_STORE_AND_STREAMCIPHER_KEYTABLE as seeking with encryption performs poorly
         {
             AZStd::scoped_lock lock(m_pFileEntry->m_readLock);
             // Uncompressed read.
@@ -1625,6 +1666,11 @@ namespace AZ::IO
         if (nFlags & INestedArchive::FLAGS_READ_ONLY)
         {
             nFactoryFlags |= ZipDir::CacheFactory::FLAGS_READ_ONLY;
+
+            if (nFlags & INestedArchive::FLAGS_MEMORY_MAPPED)
+            {
+                nFactoryFlags |= ZipDir::CacheFactory::FLAGS_MEMORY_MAPPED;
+            }
         }
 
 
@@ -2141,7 +2187,7 @@ namespace AZ::IO
         AZ::SerializeContext* serializeContext = nullptr;
         AZ::ComponentApplicationBus::BroadcastResult(serializeContext, &AZ::ComponentApplicationBus::Events::GetSerializeContext);
         AZ_Assert(serializeContext, "Failed to retrieve serialize context.");
-        auto manifestInfo = AZStd::shared_ptr<AzFramework::AssetBundleManifest>(AZ::Utils::LoadObjectFromBuffer<AzFramework::AssetBundleManifest>(fileData->GetData(), fileData->GetFileEntry()->desc.lSizeUncompressed));
+        auto manifestInfo = AZStd::shared_ptr<AzFramework::AssetBundleManifest>(AZ::Utils::LoadObjectFromBuffer<AzFramework::AssetBundleManifest>(fileData->GetDataView(), fileData->GetFileEntry()->desc.lSizeUncompressed));
 
         return manifestInfo;
     }
@@ -2201,7 +2247,7 @@ namespace AZ::IO
         AZ::SerializeContext* serializeContext = nullptr;
         AZ::ComponentApplicationBus::BroadcastResult(serializeContext, &AZ::ComponentApplicationBus::Events::GetSerializeContext);
         AZ_Assert(serializeContext, "Failed to retrieve serialize context.");
-        auto catalogInfo = AZStd::shared_ptr<AzFramework::AssetRegistry>(AZ::Utils::LoadObjectFromBuffer<AzFramework::AssetRegistry>(fileData->GetData(), fileData->GetFileEntry()->desc.lSizeUncompressed));
+        auto catalogInfo = AZStd::shared_ptr<AzFramework::AssetRegistry>(AZ::Utils::LoadObjectFromBuffer<AzFramework::AssetRegistry>(fileData->GetDataView(), fileData->GetFileEntry()->desc.lSizeUncompressed));
 
         return catalogInfo;
     }
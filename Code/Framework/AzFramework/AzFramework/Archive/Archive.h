@@ -56,7 +56,11 @@ namespace AZ::IO
         // the cache is refreshed. Otherwise, it returns whatever cache is (nullptr if the data isn't cached yet)
         // decompress can be harmlessly set to true if you want the data back decompressed.
         // set them to false only if you want to operate on the raw data while its still compressed.
+        // the returned data is owned by this object and can be modified by the caller.
         void* GetData(bool bRefreshCache = true, bool decompress = true);
+        // return the decompressed data in the file for reading only, or nullptr if error.
+        // Stored files in a memory mapped archive are returned as views into the mapping, other files are cached as with GetData
+        const void* GetDataView();
         // Uncompress file data directly to provided memory.
         bool GetDataTo(void* pFileData, int nDataSize, bool bDecompress = true);
 
@@ -68,6 +72,9 @@ namespace AZ::IO
 
         uint32_t GetFileDataOffset();
 
+        // return the data of a stored file inside the memory mapped archive once its CRC check (if any) passed, or nullptr
+        const uint8_t* GetMappedData();
+
         void* m_pFileData;
 
         // the zip file in which this file is opened
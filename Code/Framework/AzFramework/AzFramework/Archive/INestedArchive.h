@@ -73,6 +73,10 @@ namespace AZ::IO
             // multiple times
             FLAGS_DONT_COMPACT = 1 << 5,
 
+            // if this is set together with FLAGS_READ_ONLY, the whole archive is memory mapped and files are
+            // found through a flat sorted table instead of the directory tree. Stored files are read without copies
+            FLAGS_MEMORY_MAPPED = 1 << 6,
+
             // if this is set, validate header data when opening the archive
             FLAGS_VALIDATE_HEADERS = 1 << 9,
 
@@ -9,6 +9,7 @@
 
 #include <AzCore/Console/Console.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/string/conversions.h>
 
 #include <AzFramework/Archive/ZipFileFormat.h>
@@ -20,6 +21,7 @@
 #include <AzFramework/Archive/ZipDirFind.h>
 #include <AzFramework/IO/FileOperations.h>
 
+#include <cctype>
 #include <locale>
 #include <random>
 #include <cinttypes>
@@ -61,6 +63,41 @@ namespace AZ::IO::ZipDir
             return memoryBlock;
         }
 
+        // PathView comparisons, and therefore the FileEntryTree, are case-insensitive on platforms with a non-posix separator
+        inline constexpr bool LookupPathIsCaseSensitive = AZ_TRAIT_OS_PATH_SEPARATOR == AZ::IO::PosixPathSeparator;
+
+        // appends the segment to the lookup path, the lookup paths are the segments of the tree joined by '/'
+        static void AppendLookupPathSegment(AZ::IO::FixedMaxPathString& lookupPath, AZStd::string_view segment)
+        {
+            if (!lookupPath.empty() && lookupPath.back() != AZ::IO::PosixPathSeparator)
+            {
+                lookupPath.push_back(AZ::IO::PosixPathSeparator);
+            }
+            for (char c : segment)
+            {
+                lookupPath.push_back(LookupPathIsCaseSensitive ? c : static_cast<char>(tolower(c)));
+            }
+        }
+
+        // calls the visitor with the lookup path of every file in the tree
+        template<class Visitor>
+        static void VisitLookupPaths(FileEntryTree& tree, AZ::IO::FixedMaxPathString& lookupPath, Visitor& visitor)
+        {
+            const size_t parentLength = lookupPath.size();
+            for (auto it = tree.GetFileBegin(); it != tree.GetFileEnd(); ++it)
+            {
+                AppendLookupPathSegment(lookupPath, tree.GetFileName(it));
+                visitor(AZStd::string_view(lookupPath), tree.GetFileEntry(it));
+                lookupPath.resize(parentLength);
+            }
+            for (auto it = tree.GetDirBegin(); it != tree.GetDirEnd(); ++it)
+            {
+                AppendLookupPathSegment(lookupPath, tree.GetDirName(it));
+                VisitLookupPaths(*tree.GetDirEntry(it), lookupPath, visitor);
+                lookupPath.resize(parentLength);
+            }
+        }
+
         // generates random file name
         static AZStd::fixed_string<8> GetRandomName(int nAttempt)
         {
@@ -179,7 +216,11 @@ namespace AZ::IO::ZipDir
             }
         }
         m_allocator = nullptr;
+        m_lookupTable = {};
+        m_lookupTablePaths = {};
         m_treeDir.Clear();
+        m_mappedFile.reset();
+        m_nFlags &= ~FLAGS_MEMORY_MAPPED;
     }
 
     bool Cache::WriteCompressedData(uint8_t* data, size_t size, bool)
@@ -695,36 +736,66 @@ namespace AZ::IO::ZipDir
             return nError;
         }
 
-        if (!AZ::IO::FileIOBase::GetDirectInstance()->Seek(m_fileHandle, pFileEntry->nFileDataOffset, AZ::IO::SeekType::SeekFromStart))
-        {
-            return ZD_ERROR_IO_FAILED;
-        }
-
         AZStd::intrusive_ptr<AZ::IO::MemoryBlock> memoryBlock;
 
-        void* pBuffer = pCompressed; // the buffer where the compressed data will go
-
-        if (pFileEntry->nMethod == 0 && pUncompressed)
-        {
-            // we can directly read into the uncompress buffer
-            pBuffer = pUncompressed;
-        }
+        const void* pBuffer = pCompressed; // the buffer where the compressed data will go
 
-        if (!pBuffer)
+        if (const uint8_t* pMappedData = GetMappedFileData(pFileEntry); pMappedData)
         {
-            if (!pUncompressed)
+            // the data is already in memory, copy or decompress it straight out of the mapping
+            if (!pCompressed && !pUncompressed)
             {
-                // what's the sense of it - no buffers at all?
                 return ZD_ERROR_INVALID_CALL;
             }
 
-            memoryBlock = ZipDirCacheInternal::CreateMemoryBlock(pFileEntry->desc.lSizeCompressed, "Cache::ReadFile");
-            pBuffer = memoryBlock->m_address.get();
-        }
+            if (pCompressed)
+            {
+                memcpy(pCompressed, pMappedData, pFileEntry->desc.lSizeCompressed);
+            }
 
-        if (!AZ::IO::FileIOBase::GetDirectInstance()->Read(m_fileHandle, pBuffer, pFileEntry->desc.lSizeCompressed, true))
+            pBuffer = pMappedData;
+            if (pFileEntry->nMethod == 0 && pUncompressed)
+            {
+                if (ErrorEnum crcError = CheckStoredFileCRC(pFileEntry, pMappedData); crcError != ZD_ERROR_SUCCESS)
+                {
+                    return crcError;
+                }
+                memcpy(pUncompressed, pMappedData, pFileEntry->desc.lSizeCompressed);
+                pBuffer = pUncompressed;
+            }
+        }
+        else
         {
-            return ZD_ERROR_IO_FAILED;
+            if (!AZ::IO::FileIOBase::GetDirectInstance()->Seek(m_fileHandle, pFileEntry->nFileDataOffset, AZ::IO::SeekType::SeekFromStart))
+            {
+                return ZD_ERROR_IO_FAILED;
+            }
+
+            void* pReadBuffer = pCompressed;
+
+            if (pFileEntry->nMethod == 0 && pUncompressed)
+            {
+                // we can directly read into the uncompress buffer
+                pReadBuffer = pUncompressed;
+            }
+
+            if (!pReadBuffer)
+            {
+                if (!pUncompressed)
+                {
+                    // what's the sense of it - no buffers at all?
+                    return ZD_ERROR_INVALID_CALL;
+                }
+
+                memoryBlock = ZipDirCacheInternal::CreateMemoryBlock(pFileEntry->desc.lSizeCompressed, "Cache::ReadFile");
+                pReadBuffer = memoryBlock->m_address.get();
+            }
+
+            if (!AZ::IO::FileIOBase::GetDirectInstance()->Read(m_fileHandle, pReadBuffer, pFileEntry->desc.lSizeCompressed, true))
+            {
+                return ZD_ERROR_IO_FAILED;
+            }
+            pBuffer = pReadBuffer;
         }
 
         // if there's a buffer for uncompressed data, uncompress it to that buffer
@@ -764,8 +835,16 @@ namespace AZ::IO::ZipDir
     {
         AZ::IO::PathView szPath{ szPathSrc };
 
-        ZipDir::FindFile fd(GetRoot());
-        FileEntry* fileEntry = fd.FindExact(szPath);
+        FileEntry* fileEntry = nullptr;
+        if (m_nFlags & FLAGS_MEMORY_MAPPED)
+        {
+            fileEntry = FindFileInLookupTable(szPathSrc);
+        }
+        else
+        {
+            ZipDir::FindFile fd(GetRoot());
+            fileEntry = fd.FindExact(szPath);
+        }
         if (!fileEntry)
         {
             if (az_archive_zip_directory_cache_verbosity)
@@ -777,6 +856,89 @@ namespace AZ::IO::ZipDir
         return fileEntry;
     }
 
+    FileEntry* Cache::FindFileInLookupTable(AZStd::string_view szPath) const
+    {
+        AZ::IO::FixedMaxPathString lookupPath;
+        for (AZ::IO::PathView segment : AZ::IO::PathView{ szPath })
+        {
+            ZipDirCacheInternal::AppendLookupPathSegment(lookupPath, segment.Native());
+        }
+
+        const size_t hash = AZStd::hash<AZStd::string_view>{}(AZStd::string_view(lookupPath));
+        auto it = AZStd::lower_bound(m_lookupTable.begin(), m_lookupTable.end(), hash,
+            [](const LookupEntry& entry, size_t value)
+            {
+                return entry.m_hash < value;
+            });
+        for (; it != m_lookupTable.end() && it->m_hash == hash; ++it)
+        {
+            AZStd::string_view entryPath{ m_lookupTablePaths.data() + it->m_pathOffset, it->m_pathLength };
+            if (entryPath == AZStd::string_view(lookupPath))
+            {
+                return it->m_fileEntry;
+            }
+        }
+        return nullptr;
+    }
+
+    void Cache::BuildLookupTable()
+    {
+        m_lookupTable.clear();
+        m_lookupTable.reserve(m_treeDir.NumFilesTotal());
+        m_lookupTablePaths.clear();
+
+        auto addFile = [this](AZStd::string_view path, FileEntry* fileEntry)
+        {
+            m_lookupTable.push_back({ AZStd::hash<AZStd::string_view>{}(path), aznumeric_cast<uint32_t>(m_lookupTablePaths.size()),
+                aznumeric_cast<uint32_t>(path.size()), fileEntry });
+            m_lookupTablePaths.insert(m_lookupTablePaths.end(), path.begin(), path.end());
+        };
+        AZ::IO::FixedMaxPathString lookupPath;
+        ZipDirCacheInternal::VisitLookupPaths(m_treeDir, lookupPath, addFile);
+
+        AZStd::sort(m_lookupTable.begin(), m_lookupTable.end(),
+            [paths = m_lookupTablePaths.data()](const LookupEntry& lhs, const LookupEntry& rhs)
+            {
+                if (lhs.m_hash != rhs.m_hash)
+                {
+                    return lhs.m_hash < rhs.m_hash;
+                }
+                return AZStd::string_view(paths + lhs.m_pathOffset, lhs.m_pathLength) <
+                    AZStd::string_view(paths + rhs.m_pathOffset, rhs.m_pathLength);
+            });
+    }
+
+    const uint8_t* Cache::GetMappedFileData(const FileEntryBase* pFileEntry) const
+    {
+        if (!m_mappedFile || pFileEntry->nFileDataOffset == FileEntryBase::INVALID_DATA_OFFSET)
+        {
+            return nullptr;
+        }
+
+        const size_t endOffset = static_cast<size_t>(pFileEntry->nFileDataOffset) + pFileEntry->desc.lSizeCompressed;
+        if (endOffset > m_mappedFile->GetSize())
+        {
+            AZ_Warning("Archive", false, "ZD_ERROR_DATA_IS_CORRUPT: File data lies outside of the mapped archive %s", m_strFilePath.c_str());
+            return nullptr;
+        }
+        return m_mappedFile->GetData() + pFileEntry->nFileDataOffset;
+    }
+
+    ErrorEnum Cache::CheckStoredFileCRC(FileEntry* pFileEntry, const void* pData) const
+    {
+        if (pFileEntry->bCheckCRCNextRead)
+        {
+            pFileEntry->bCheckCRCNextRead = false;
+            uLong uCRC32 = AZ::Crc32(pData, pFileEntry->desc.lSizeUncompressed);
+            if (uCRC32 != pFileEntry->desc.lCRC32)
+            {
+                AZ_Warning("Archive", false, "ZD_ERROR_CRC32_CHECK: Stored file CRC32 check failed in the mapped archive %s", m_strFilePath.c_str());
+                return ZD_ERROR_CRC32_CHECK;
+            }
+        }
+        return ZD_ERROR_SUCCESS;
+    }
+
     // refreshes information about the given file entry into this file entry
     ErrorEnum Cache::Refresh(FileEntryBase* pFileEntry)
     {
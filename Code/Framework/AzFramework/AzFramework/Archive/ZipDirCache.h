@@ -19,8 +19,10 @@
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzFramework/Archive/Codec.h>
+#include <AzFramework/Archive/ZipDirMappedFile.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
 #include <AzFramework/Archive/ZipDirTree.h>
 
@@ -83,6 +85,19 @@ namespace AZ::IO::ZipDir
 
         ErrorEnum ReadFile(FileEntry* pFileEntry, void* pCompressed, void* pUncompressed);
 
+        // returns true if the whole archive is mapped into memory, see CacheFactory::FLAGS_MEMORY_MAPPED
+        bool IsMemoryMapped() const
+        {
+            return (m_nFlags & FLAGS_MEMORY_MAPPED) != 0;
+        }
+
+        // returns the (compressed) data of the file entry inside the memory mapped archive, or nullptr if the archive isn't mapped.
+        // The mapping is shared by every reader of the archive, the data must not be modified.
+        const uint8_t* GetMappedFileData(const FileEntryBase* pFileEntry) const;
+
+        // checks the CRC of the data of a stored file entry if the entry is marked for it (see InitMethod::FullValidation)
+        ErrorEnum CheckStoredFileCRC(FileEntry* pFileEntry, const void* pData) const;
+
         void Free(void* ptr)
         {
             m_allocator->DeAllocate(ptr);
@@ -128,6 +143,10 @@ namespace AZ::IO::ZipDir
 
         size_t GetCompressedSizeEstimate(size_t uncompressedSize, CompressionCodec::Codec codec);
 
+        // builds the flat lookup table over all the files of the (read-only) tree, used by FindFile instead of walking the tree
+        void BuildLookupTable();
+        FileEntry* FindFileInLookupTable(AZStd::string_view szPath) const;
+
     protected:
         friend class CacheFactory;
         friend class FileEntryTransactionAdd;
@@ -153,13 +172,30 @@ namespace AZ::IO::ZipDir
             // if this is set, the file is opened in read-only mode. no write operations are to be performed
             FLAGS_READ_ONLY = 1 << 2,
             // when this is set, compact operation is not performed
-            FLAGS_DONT_COMPACT = 1 << 3
+            FLAGS_DONT_COMPACT = 1 << 3,
+            // if this is set, the whole file is mapped into memory and the lookup table is used to find files
+            FLAGS_MEMORY_MAPPED = 1 << 4
         };
         uint32_t m_nFlags;
 
         // CDR buffer.
         AZStd::vector<uint8_t> m_CDR_buffer;
 
+        // The mapped archive, only set with FLAGS_MEMORY_MAPPED
+        AZStd::unique_ptr<MappedFile> m_mappedFile;
+
+        // Flat lookup table of all the files in the tree, sorted by hash and then by path.
+        // The paths are stored in m_lookupTablePaths, with the directories separated by '/'
+        struct LookupEntry
+        {
+            size_t m_hash;
+            uint32_t m_pathOffset;
+            uint32_t m_pathLength;
+            FileEntry* m_fileEntry;
+        };
+        AZStd::vector<LookupEntry> m_lookupTable;
+        AZStd::vector<char> m_lookupTablePaths;
+
         ZipFile::EHeaderEncryptionType m_encryptedHeaders;
         ZipFile::EHeaderSignatureType m_signedHeaders;
 
@@ -84,11 +84,22 @@ namespace AZ::IO::ZipDir
                 AZ_Warning("Archive", false, R"(ZD_ERROR_IO_FAILED: Could not open file "%s" in binary mode for reading)", szFileName);
                 return {};
             }
+
+            if ((m_nFlags & FLAGS_MEMORY_MAPPED) && !(m_nFlags & FLAGS_READ_INSIDE_PAK))
+            {
+                MapFile(*pCache, szFileName);
+            }
+
             if (!ReadCache(*pCache))
             {
                 AZ_Warning("Archive", false, R"(ZD_ERROR_IO_FAILED: Could not read the CDR of the pack file "%s".)", pCache->m_strFilePath.c_str());
                 return {};
             }
+
+            if (pCache->IsMemoryMapped())
+            {
+                pCache->BuildLookupTable();
+            }
         }
         else
         {
@@ -150,6 +161,25 @@ namespace AZ::IO::ZipDir
         return pCache;
     }
 
+    void CacheFactory::MapFile(Cache& rwCache, const char* szFileName)
+    {
+        auto mappedFile = AZStd::make_unique<MappedFile>();
+        if (!mappedFile->Open(szFileName))
+        {
+            AZ_TracePrintf("Archive", "Unable to memory map archive %s, it will be read through file reads instead\n", szFileName);
+            return;
+        }
+
+        // Let the CDR scan and the local header reads go through the mapping, the memory block doesn't own the mapping
+        AZStd::intrusive_ptr<AZ::IO::MemoryBlock> memoryBlock{ new AZ::IO::MemoryBlock };
+        memoryBlock->m_address = AZ::IO::MemoryBlock::AddressPtr{ mappedFile->GetData(), AZ::IO::MemoryBlock::AddressDeleter{ [](uint8_t*) {} } };
+        memoryBlock->m_size = mappedFile->GetSize();
+        m_fileExt.LoadToMemory(AZStd::move(memoryBlock));
+
+        rwCache.m_mappedFile = AZStd::move(mappedFile);
+        rwCache.m_nFlags |= Cache::FLAGS_MEMORY_MAPPED;
+    }
+
     bool CacheFactory::ReadCache(Cache& rwCache)
     {
         m_bBuildFileEntryTree = true;
@@ -32,6 +32,9 @@ namespace AZ::IO::ZipDir
             FLAGS_DONT_MEMORIZE_ZIP_PATH = 1 << 2,
             // if this is set, the archive will be created anew (the existing file will be overwritten)
             FLAGS_CREATE_NEW = 1 << 3,
+            // if this is set together with FLAGS_READ_ONLY, the whole archive is mapped into memory and a flat
+            // lookup table is built at mount time. Falls back to regular reads if the file can't be mapped
+            FLAGS_MEMORY_MAPPED = 1 << 4,
 
             // if this is set, zip path will be searched inside other zips
             FLAGS_READ_INSIDE_PAK = 1 << 7,
@@ -46,6 +49,9 @@ namespace AZ::IO::ZipDir
         CachePtr New(const char* szFileName);
 
     protected:
+        // maps the whole file into memory, the cache takes ownership of the mapping and the factory reads through it
+        void MapFile(Cache& rwCache, const char* szFileName);
+
         // reads the zip file into the file entry tree.
         bool ReadCache(Cache& rwCache);
 
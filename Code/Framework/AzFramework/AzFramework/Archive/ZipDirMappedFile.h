@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/SystemAllocator.h>
+
+namespace AZ::IO::ZipDir
+{
+    // Maps a whole archive file into the address space of the process.
+    // The mapping is private copy-on-write, so pages handed out to callers can be written to
+    // without ever touching the file on disk; only the pages that are actually written get copied.
+    // The mapping stays valid until Close() is called, independently of the file handle.
+    class MappedFile
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(MappedFile, AZ::SystemAllocator, 0);
+
+        MappedFile() = default;
+        ~MappedFile()
+        {
+            Close();
+        }
+
+        // maps the file at the given (already resolved) path, returns false if the platform doesn't support
+        // mapping this file, in which case the caller is expected to fall back to regular file reads
+        bool Open(const char* szFilePath);
+        void Close();
+
+        bool IsOpen() const
+        {
+            return m_data != nullptr;
+        }
+
+        uint8_t* GetData() const
+        {
+            return m_data;
+        }
+
+        size_t GetSize() const
+        {
+            return m_size;
+        }
+
+    private:
+        AZ_DISABLE_COPY_MOVE(MappedFile);
+
+        uint8_t* m_data = nullptr;
+        size_t m_size = 0;
+    };
+}
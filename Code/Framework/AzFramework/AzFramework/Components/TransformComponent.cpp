@@ -158,6 +158,11 @@ namespace AzFramework
 
     void TransformComponent::Deactivate()
     {
+        if (m_batchNodeId != TransformHierarchy::InvalidNodeId || m_isBatchNotificationPending)
+        {
+            ScopedTransformBatch::GetCurrent()->Release(*this);
+        }
+
         EBUS_EVENT_ID(m_parentId, AZ::TransformNotificationBus, OnChildRemoved, GetEntityId());
         auto parentTransform = AZ::TransformBus::FindFirstHandler(m_parentId);
         if (parentTransform)
@@ -540,6 +545,12 @@ namespace AzFramework
             return;
         }
 
+        // the new parent may have a pending batched move, and its world transform is needed below
+        if (ScopedTransformBatch* batch = ScopedTransformBatch::GetCurrent())
+        {
+            batch->Release(*this);
+        }
+
         AZ::EntityId oldParent = m_parentId;
         if (m_parentId.IsValid())
         {
@@ -605,12 +616,24 @@ namespace AzFramework
 
     void TransformComponent::SetLocalTMImpl(const AZ::Transform& tm)
     {
+        if (ScopedTransformBatch* batch = ScopedTransformBatch::GetCurrent();
+            batch && batch->RecordMove(*this, tm, false))
+        {
+            return;
+        }
+
         m_localTM = tm;
         ComputeWorldTM();  // We can user dirty flags and compute it later on demand
     }
 
     void TransformComponent::SetWorldTMImpl(const AZ::Transform& tm)
     {
+        if (ScopedTransformBatch* batch = ScopedTransformBatch::GetCurrent();
+            batch && batch->RecordMove(*this, tm, true))
+        {
+            return;
+        }
+
         m_worldTM = tm;
         ComputeLocalTM(); // We can user dirty flags and compute it later on demand
     }
@@ -622,6 +645,13 @@ namespace AzFramework
         if (m_parentTM)
         {
             m_worldTM = parentWorldTM * m_localTM;
+
+            // the batch flush in progress notifies this transform itself, once its own turn comes
+            if (m_isBatchNotificationPending)
+            {
+                return;
+            }
+
             EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
             m_transformChangedEvent.Signal(m_localTM, m_worldTM);
         }
@@ -13,6 +13,7 @@
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/EBus/Event.h>
+#include <AzFramework/Components/TransformHierarchy.h>
 
 namespace AzToolsFramework
 {
@@ -41,6 +42,7 @@ namespace AzFramework
         AZ_COMPONENT(TransformComponent, AZ::TransformComponentTypeId, AZ::TransformInterface);
 
         friend class AzToolsFramework::Components::TransformComponent;
+        friend class ScopedTransformBatch;
 
         using ParentActivationTransformMode = AZ::TransformConfig::ParentActivationTransformMode;
 
@@ -186,5 +188,7 @@ namespace AzFramework
         bool m_parentActive = false; ///< Keeps track of the state of the parent entity.
         bool m_onNewParentKeepWorldTM = true; ///< If set, recompute localTM instead of worldTM when parent becomes active.
         bool m_isStatic = false; ///< If true, the transform is static and doesn't move while entity is active.
+        bool m_isBatchNotificationPending = false; ///< If set, the ScopedTransformBatch flush in progress notifies the change of this transform.
+        TransformHierarchy::NodeId m_batchNodeId = TransformHierarchy::InvalidNodeId; ///< Node of this transform in the open ScopedTransformBatch, if it is part of it.
     };
 }   // namespace AZ
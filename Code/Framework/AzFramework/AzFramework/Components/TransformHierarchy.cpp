@@ -0,0 +1,510 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Components/TransformHierarchy.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Visibility/EntityBoundsUnionBus.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AzFramework
+{
+    namespace
+    {
+        thread_local ScopedTransformBatch* t_currentBatch = nullptr;
+    }
+
+    TransformHierarchy::NodeId TransformHierarchy::AddNode(AZ::EntityId entityId, const AZ::Transform& localTM, NodeId parentId)
+    {
+        const SlotIndex parentSlot = parentId != InvalidNodeId ? GetSlot(parentId) : InvalidSlot;
+
+        // appending keeps the order valid, the parent is always already stored in a lower slot
+        const SlotIndex slot = static_cast<SlotIndex>(m_nodeBySlot.size());
+        m_localTMs.push_back(localTM);
+        m_worldTMs.push_back(localTM);
+        m_parentSlots.push_back(parentSlot);
+        m_entityIds.push_back(entityId);
+        m_dirtyFlags.push_back(1);
+
+        NodeId nodeId;
+        if (!m_freeNodes.empty())
+        {
+            nodeId = m_freeNodes.back();
+            m_freeNodes.pop_back();
+            m_slotByNode[nodeId] = slot;
+        }
+        else
+        {
+            nodeId = static_cast<NodeId>(m_slotByNode.size());
+            m_slotByNode.push_back(slot);
+        }
+
+        m_nodeBySlot.push_back(nodeId);
+        ++m_nodeCount;
+        return nodeId;
+    }
+
+    void TransformHierarchy::RemoveNode(NodeId nodeId)
+    {
+        const SlotIndex slot = GetSlot(nodeId);
+        m_nodeBySlot[slot] = InvalidNodeId;
+        m_slotByNode[nodeId] = InvalidSlot;
+        m_pendingFreeNodes.push_back(nodeId);
+        --m_nodeCount;
+
+        // the slot is compacted, and the children detached, on the next update
+        m_isOrderDirty = true;
+    }
+
+    bool TransformHierarchy::SetParent(NodeId nodeId, NodeId parentId)
+    {
+        const SlotIndex slot = GetSlot(nodeId);
+        const SlotIndex parentSlot = parentId != InvalidNodeId ? GetSlot(parentId) : InvalidSlot;
+
+        for (SlotIndex ancestor = parentSlot; ancestor != InvalidSlot; ancestor = m_parentSlots[ancestor])
+        {
+            if (ancestor == slot)
+            {
+                AZ_Error("TransformHierarchy", false, "Trying to create a circular dependency of parenting. Aborting set parent call.");
+                return false;
+            }
+        }
+
+        m_parentSlots[slot] = parentSlot;
+        m_dirtyFlags[slot] = 1;
+
+        if (parentSlot != InvalidSlot && parentSlot > slot)
+        {
+            m_isOrderDirty = true;
+        }
+
+        return true;
+    }
+
+    void TransformHierarchy::SetLocalTM(NodeId nodeId, const AZ::Transform& localTM)
+    {
+        const SlotIndex slot = GetSlot(nodeId);
+        m_localTMs[slot] = localTM;
+        m_dirtyFlags[slot] = 1;
+    }
+
+    void TransformHierarchy::Update()
+    {
+        if (m_isOrderDirty)
+        {
+            SortByDepth();
+        }
+
+        m_changedNodes.clear();
+
+        const size_t slotCount = m_nodeBySlot.size();
+        const SlotIndex* parentSlots = m_parentSlots.data();
+        const AZ::Transform* localTMs = m_localTMs.data();
+        AZ::Transform* worldTMs = m_worldTMs.data();
+        AZ::u8* dirtyFlags = m_dirtyFlags.data();
+
+        // parents always precede their children, so by the time a node is visited, its parent is final
+        for (size_t slot = 0; slot < slotCount; ++slot)
+        {
+            const SlotIndex parentSlot = parentSlots[slot];
+            if (parentSlot != InvalidSlot)
+            {
+                dirtyFlags[slot] |= dirtyFlags[parentSlot];
+            }
+
+            if (dirtyFlags[slot])
+            {
+                worldTMs[slot] = parentSlot != InvalidSlot ? worldTMs[parentSlot] * localTMs[slot] : localTMs[slot];
+                m_changedNodes.push_back(m_nodeBySlot[slot]);
+            }
+        }
+
+        AZStd::fill(m_dirtyFlags.begin(), m_dirtyFlags.end(), AZ::u8(0));
+    }
+
+    void TransformHierarchy::NotifyChanged() const
+    {
+        for (NodeId nodeId : m_changedNodes)
+        {
+            if (!IsValid(nodeId))
+            {
+                continue;
+            }
+
+            const SlotIndex slot = m_slotByNode[nodeId];
+            if (m_entityIds[slot].IsValid())
+            {
+                AZ::TransformNotificationBus::Event(
+                    m_entityIds[slot], &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTMs[slot], m_worldTMs[slot]);
+            }
+        }
+    }
+
+    const AZStd::vector<TransformHierarchy::NodeId>& TransformHierarchy::GetChangedNodes() const
+    {
+        return m_changedNodes;
+    }
+
+    AZ::EntityId TransformHierarchy::GetEntityId(NodeId nodeId) const
+    {
+        return m_entityIds[GetSlot(nodeId)];
+    }
+
+    TransformHierarchy::NodeId TransformHierarchy::GetParent(NodeId nodeId) const
+    {
+        const SlotIndex parentSlot = m_parentSlots[GetSlot(nodeId)];
+        // a removed parent reports InvalidNodeId until its slot is compacted
+        return parentSlot != InvalidSlot ? m_nodeBySlot[parentSlot] : InvalidNodeId;
+    }
+
+    const AZ::Transform& TransformHierarchy::GetLocalTM(NodeId nodeId) const
+    {
+        return m_localTMs[GetSlot(nodeId)];
+    }
+
+    const AZ::Transform& TransformHierarchy::GetWorldTM(NodeId nodeId) const
+    {
+        return m_worldTMs[GetSlot(nodeId)];
+    }
+
+    size_t TransformHierarchy::GetNodeCount() const
+    {
+        return m_nodeCount;
+    }
+
+    bool TransformHierarchy::IsValid(NodeId nodeId) const
+    {
+        return nodeId < m_slotByNode.size() && m_slotByNode[nodeId] != InvalidSlot;
+    }
+
+    TransformHierarchy::SlotIndex TransformHierarchy::GetSlot(NodeId nodeId) const
+    {
+        AZ_Assert(IsValid(nodeId), "Invalid TransformHierarchy node %u", nodeId);
+        return m_slotByNode[nodeId];
+    }
+
+    void TransformHierarchy::SortByDepth()
+    {
+        constexpr AZ::u32 unknownDepth = AZStd::numeric_limits<AZ::u32>::max();
+        const SlotIndex slotCount = static_cast<SlotIndex>(m_nodeBySlot.size());
+
+        // detach the children of removed nodes, keeping their world transform as of the last update
+        for (SlotIndex slot = 0; slot < slotCount; ++slot)
+        {
+            const SlotIndex parentSlot = m_parentSlots[slot];
+            if (m_nodeBySlot[slot] != InvalidNodeId && parentSlot != InvalidSlot && m_nodeBySlot[parentSlot] == InvalidNodeId)
+            {
+                m_localTMs[slot] = m_worldTMs[parentSlot] * m_localTMs[slot];
+                m_parentSlots[slot] = InvalidSlot;
+            }
+        }
+
+        AZStd::vector<AZ::u32> depths(slotCount, unknownDepth);
+        AZStd::vector<SlotIndex> chain;
+        AZ::u32 maxDepth = 0;
+
+        for (SlotIndex slot = 0; slot < slotCount; ++slot)
+        {
+            if (m_nodeBySlot[slot] == InvalidNodeId || depths[slot] != unknownDepth)
+            {
+                continue;
+            }
+
+            SlotIndex current = slot;
+            while (current != InvalidSlot && depths[current] == unknownDepth)
+            {
+                chain.push_back(current);
+                current = m_parentSlots[current];
+            }
+
+            AZ::u32 depth = current != InvalidSlot ? depths[current] + 1 : 0;
+            while (!chain.empty())
+            {
+                depths[chain.back()] = depth++;
+                chain.pop_back();
+            }
+
+            maxDepth = AZStd::max(maxDepth, depth - 1);
+        }
+
+        // counting sort by depth, stable so siblings keep their relative order
+        AZStd::vector<SlotIndex> depthOffsets(maxDepth + 2, 0);
+        for (SlotIndex slot = 0; slot < slotCount; ++slot)
+        {
+            if (m_nodeBySlot[slot] != InvalidNodeId)
+            {
+                ++depthOffsets[depths[slot] + 1];
+            }
+        }
+
+        for (size_t depth = 1; depth < depthOffsets.size(); ++depth)
+        {
+            depthOffsets[depth] += depthOffsets[depth - 1];
+        }
+
+        AZStd::vector<SlotIndex> newSlots(slotCount, InvalidSlot);
+        for (SlotIndex slot = 0; slot < slotCount; ++slot)
+        {
+            if (m_nodeBySlot[slot] != InvalidNodeId)
+            {
+                newSlots[slot] = depthOffsets[depths[slot]]++;
+            }
+        }
+
+        AZStd::vector<AZ::Transform> localTMs(m_nodeCount);
+        AZStd::vector<AZ::Transform> worldTMs(m_nodeCount);
+        AZStd::vector<SlotIndex> parentSlots(m_nodeCount);
+        AZStd::vector<NodeId> nodeBySlot(m_nodeCount);
+        AZStd::vector<AZ::EntityId> entityIds(m_nodeCount);
+        AZStd::vector<AZ::u8> dirtyFlags(m_nodeCount);
+
+        for (SlotIndex slot = 0; slot < slotCount; ++slot)
+        {
+            const SlotIndex newSlot = newSlots[slot];
+            if (newSlot == InvalidSlot)
+            {
+                continue;
+            }
+
+            const SlotIndex parentSlot = m_parentSlots[slot];
+            localTMs[newSlot] = m_localTMs[slot];
+            worldTMs[newSlot] = m_worldTMs[slot];
+            parentSlots[newSlot] = parentSlot != InvalidSlot ? newSlots[parentSlot] : InvalidSlot;
+            nodeBySlot[newSlot] = m_nodeBySlot[slot];
+            entityIds[newSlot] = m_entityIds[slot];
+            dirtyFlags[newSlot] = m_dirtyFlags[slot];
+            m_slotByNode[m_nodeBySlot[slot]] = newSlot;
+        }
+
+        m_localTMs = AZStd::move(localTMs);
+        m_worldTMs = AZStd::move(worldTMs);
+        m_parentSlots = AZStd::move(parentSlots);
+        m_nodeBySlot = AZStd::move(nodeBySlot);
+        m_entityIds = AZStd::move(entityIds);
+        m_dirtyFlags = AZStd::move(dirtyFlags);
+
+        m_freeNodes.insert(m_freeNodes.end(), m_pendingFreeNodes.begin(), m_pendingFreeNodes.end());
+        m_pendingFreeNodes.clear();
+        m_isOrderDirty = false;
+    }
+
+    ScopedTransformBatch::ScopedTransformBatch()
+        : m_outer(t_currentBatch)
+    {
+        if (!m_outer)
+        {
+            t_currentBatch = this;
+        }
+    }
+
+    ScopedTransformBatch::~ScopedTransformBatch()
+    {
+        if (!m_outer)
+        {
+            Flush();
+            t_currentBatch = nullptr;
+        }
+    }
+
+    ScopedTransformBatch* ScopedTransformBatch::GetCurrent()
+    {
+        return t_currentBatch;
+    }
+
+    void ScopedTransformBatch::Flush()
+    {
+        if (m_outer)
+        {
+            m_outer->Flush();
+            return;
+        }
+
+        if (m_isFlushing || m_entries.empty())
+        {
+            return;
+        }
+
+        m_isFlushing = true;
+        m_hierarchy.Update();
+
+        // the ancestors of the moved nodes are only part of the hierarchy to provide parent transforms,
+        // only the moved nodes and their descendants changed
+        AZStd::vector<AZ::u8> isChanged(m_entries.size(), AZ::u8(0));
+        for (TransformHierarchy::NodeId nodeId : m_hierarchy.GetChangedNodes())
+        {
+            const TransformHierarchy::NodeId parentId = m_hierarchy.GetParent(nodeId);
+            isChanged[nodeId] = m_entries[nodeId].m_isMoved || (parentId != TransformHierarchy::InvalidNodeId && isChanged[parentId]);
+            if (isChanged[nodeId])
+            {
+                TransformComponent* component = m_entries[nodeId].m_component;
+                component->m_worldTM = m_hierarchy.GetWorldTM(nodeId);
+                component->m_isBatchNotificationPending = true;
+                m_pendingNotifications.push_back(component);
+            }
+        }
+
+        for (const Entry& entry : m_entries)
+        {
+            entry.m_component->m_batchNodeId = TransformHierarchy::InvalidNodeId;
+        }
+        m_entries.clear();
+        m_hierarchy = TransformHierarchy();
+
+        // handlers may move, re-parent or deactivate entities, which is applied immediately until the flush completes
+        IEntityBoundsUnion* boundsUnion = AZ::Interface<IEntityBoundsUnion>::Get();
+        for (size_t index = 0; index < m_pendingNotifications.size(); ++index)
+        {
+            TransformComponent* component = m_pendingNotifications[index];
+            if (!component)
+            {
+                continue;
+            }
+
+            component->m_isBatchNotificationPending = false;
+            EBUS_EVENT_PTR(component->m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, component->m_localTM, component->m_worldTM);
+            component->m_transformChangedEvent.Signal(component->m_localTM, component->m_worldTM);
+
+            if (boundsUnion != nullptr)
+            {
+                boundsUnion->OnTransformUpdated(component->GetEntity());
+            }
+        }
+
+        m_pendingNotifications.clear();
+        m_isFlushing = false;
+    }
+
+    bool ScopedTransformBatch::RecordMove(TransformComponent& component, const AZ::Transform& tm, bool isWorldTM)
+    {
+        // moves made by the handlers of the flush in progress, or while the entity (de)activates, are applied immediately
+        if (m_isFlushing || !component.GetEntity() || component.GetEntity()->GetState() != AZ::Entity::State::Active)
+        {
+            return false;
+        }
+
+        TransformHierarchy::NodeId nodeId = AddComponent(component);
+        if (nodeId == TransformHierarchy::InvalidNodeId)
+        {
+            return false;
+        }
+
+        if (isWorldTM)
+        {
+            if (HasMovedAncestor(nodeId))
+            {
+                // the world transform of the parent is stale until the pending moves are applied
+                Flush();
+                nodeId = AddComponent(component);
+            }
+
+            component.m_worldTM = tm;
+            component.m_localTM = component.m_parentTM ? component.m_parentTM->GetWorldTM().GetInverse() * tm : tm;
+        }
+        else
+        {
+            component.m_localTM = tm;
+            component.m_worldTM = component.m_parentTM ? component.m_parentTM->GetWorldTM() * tm : tm;
+        }
+
+        m_hierarchy.SetLocalTM(nodeId, component.m_localTM);
+        m_entries[nodeId].m_isMoved = true;
+        AddDescendants(nodeId);
+        return true;
+    }
+
+    void ScopedTransformBatch::Release(TransformComponent& component)
+    {
+        if (!m_isFlushing)
+        {
+            Flush();
+        }
+        else if (component.m_isBatchNotificationPending)
+        {
+            component.m_isBatchNotificationPending = false;
+            auto pendingIter = AZStd::find(m_pendingNotifications.begin(), m_pendingNotifications.end(), &component);
+            if (pendingIter != m_pendingNotifications.end())
+            {
+                *pendingIter = nullptr;
+            }
+        }
+    }
+
+    TransformHierarchy::NodeId ScopedTransformBatch::AddComponent(TransformComponent& component)
+    {
+        if (component.m_batchNodeId != TransformHierarchy::InvalidNodeId)
+        {
+            return component.m_batchNodeId;
+        }
+
+        TransformHierarchy::NodeId parentNodeId = TransformHierarchy::InvalidNodeId;
+        if (component.m_parentTM)
+        {
+            TransformComponent* parent = azrtti_cast<TransformComponent*>(component.m_parentTM);
+            parentNodeId = parent ? AddComponent(*parent) : TransformHierarchy::InvalidNodeId;
+            if (parentNodeId == TransformHierarchy::InvalidNodeId)
+            {
+                return TransformHierarchy::InvalidNodeId;
+            }
+        }
+        else if (component.m_parentActive)
+        {
+            // the parent is active, but not resolved yet, so the world transform can't be derived from it
+            return TransformHierarchy::InvalidNodeId;
+        }
+
+        const TransformHierarchy::NodeId nodeId = m_hierarchy.AddNode(component.GetEntityId(), component.m_localTM, parentNodeId);
+        AZ_Assert(nodeId == m_entries.size(), "The node ids of a batch are expected to be dense");
+        m_entries.emplace_back().m_component = &component;
+        component.m_batchNodeId = nodeId;
+        return nodeId;
+    }
+
+    void ScopedTransformBatch::AddDescendants(TransformHierarchy::NodeId nodeId)
+    {
+        if (m_entries[nodeId].m_hasDescendants)
+        {
+            return;
+        }
+
+        m_entries[nodeId].m_hasDescendants = true;
+        TransformComponent* component = m_entries[nodeId].m_component;
+
+        AZStd::vector<AZ::EntityId> children;
+        AZ::TransformHierarchyInformationBus::Event(component->GetEntityId(), &AZ::TransformHierarchyInformation::GatherChildren, children);
+
+        for (const AZ::EntityId& childId : children)
+        {
+            // other transform implementations are notified by their parent when the batch is flushed
+            TransformComponent* child = azrtti_cast<TransformComponent*>(AZ::TransformBus::FindFirstHandler(childId));
+            if (child && child->m_parentTM == component)
+            {
+                const TransformHierarchy::NodeId childNodeId = AddComponent(*child);
+                if (childNodeId != TransformHierarchy::InvalidNodeId)
+                {
+                    AddDescendants(childNodeId);
+                }
+            }
+        }
+    }
+
+    bool ScopedTransformBatch::HasMovedAncestor(TransformHierarchy::NodeId nodeId) const
+    {
+        for (TransformHierarchy::NodeId parentId = m_hierarchy.GetParent(nodeId); parentId != TransformHierarchy::InvalidNodeId;
+             parentId = m_hierarchy.GetParent(parentId))
+        {
+            if (m_entries[parentId].m_isMoved)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+} // namespace AzFramework
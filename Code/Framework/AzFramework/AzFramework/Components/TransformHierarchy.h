@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+
+namespace AzFramework
+{
+    class TransformComponent;
+
+    //! Optional data-oriented alternative to the per-entity transform propagation done by TransformComponent.
+    //! Local and world transforms are stored in contiguous arrays, sorted by depth so that every parent precedes its children.
+    //! Moves only flag nodes as dirty; Update() then propagates the flags and recomputes every affected world transform in a
+    //! single linear pass, however deep the hierarchy is. Each moved node is reported once per update, rather than once for
+    //! every move of each of its ancestors.
+    //! \note Not thread safe, the owner is expected to serialize access.
+    class TransformHierarchy
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TransformHierarchy, AZ::SystemAllocator, 0);
+
+        using NodeId = AZ::u32;
+        static constexpr NodeId InvalidNodeId = AZStd::numeric_limits<NodeId>::max();
+
+        //! Adds a node below parentId, or a root node if parentId is InvalidNodeId.
+        //! The world transform of the node is valid after the next Update().
+        NodeId AddNode(AZ::EntityId entityId, const AZ::Transform& localTM, NodeId parentId = InvalidNodeId);
+
+        //! Removes a node. Its children become root nodes that keep their world transform as of the last Update().
+        void RemoveNode(NodeId nodeId);
+
+        //! Changes the parent of a node, keeping its local transform.
+        //! Returns false, without changing anything, if this would create a cycle.
+        bool SetParent(NodeId nodeId, NodeId parentId);
+
+        //! Sets the local transform of a node, and flags it and all of its descendants for recomputation on the next Update().
+        void SetLocalTM(NodeId nodeId, const AZ::Transform& localTM);
+
+        //! Recomputes the world transforms of all flagged nodes and their descendants, and records them as changed.
+        void Update();
+
+        //! Signals AZ::TransformNotificationBus::OnTransformChanged once for each node changed by the last Update(), parents first.
+        void NotifyChanged() const;
+
+        //! Returns the nodes whose world transform was recomputed by the last Update(), parents first.
+        const AZStd::vector<NodeId>& GetChangedNodes() const;
+
+        AZ::EntityId GetEntityId(NodeId nodeId) const;
+        NodeId GetParent(NodeId nodeId) const;
+        const AZ::Transform& GetLocalTM(NodeId nodeId) const;
+        //! Returns the world transform as of the last Update().
+        const AZ::Transform& GetWorldTM(NodeId nodeId) const;
+
+        size_t GetNodeCount() const;
+        bool IsValid(NodeId nodeId) const;
+
+    private:
+        using SlotIndex = AZ::u32;
+        static constexpr SlotIndex InvalidSlot = AZStd::numeric_limits<SlotIndex>::max();
+
+        SlotIndex GetSlot(NodeId nodeId) const;
+
+        //! Restores the parents-first order after removals and re-parenting, and compacts removed slots.
+        void SortByDepth();
+
+        // indexed by NodeId, stable for the lifetime of the node
+        AZStd::vector<SlotIndex> m_slotByNode;
+        AZStd::vector<NodeId> m_freeNodes;
+        // NodeIds of removed nodes are only recycled after SortByDepth() has compacted their slots
+        AZStd::vector<NodeId> m_pendingFreeNodes;
+
+        // indexed by SlotIndex, ordered so that a parent slot is always lower than the slots of its children
+        AZStd::vector<AZ::Transform> m_localTMs;
+        AZStd::vector<AZ::Transform> m_worldTMs;
+        AZStd::vector<SlotIndex> m_parentSlots;
+        AZStd::vector<NodeId> m_nodeBySlot;
+        AZStd::vector<AZ::EntityId> m_entityIds;
+        AZStd::vector<AZ::u8> m_dirtyFlags;
+
+        AZStd::vector<NodeId> m_changedNodes;
+        size_t m_nodeCount = 0;
+        bool m_isOrderDirty = false;
+    };
+
+    //! Opt-in batching of the TransformComponent moves made on the current thread, through a TransformHierarchy.
+    //! While a batch is open, a move updates the transforms of the moved entity only. The world transforms of its descendants,
+    //! and all TransformNotificationBus and TransformChangedEvent notifications, are deferred until the batch is flushed or closed.
+    //! The flush recomputes every affected world transform in one pass and notifies each changed entity once, parents first.
+    //! \note Until the flush, GetWorldTM() of a descendant of a moved entity returns its value from before the move, and so does
+    //! GetWorldTM() of a moved entity whose ancestor also moved. SetWorldTM() on such an entity flushes first, to resolve its
+    //! local transform against the current parent. Re-parenting any entity, or deactivating one that is part of the batch,
+    //! also flushes it.
+    //! Nested batches join the outermost one, which flushes when it is closed.
+    class ScopedTransformBatch
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ScopedTransformBatch, AZ::SystemAllocator, 0);
+
+        ScopedTransformBatch();
+        ~ScopedTransformBatch();
+
+        ScopedTransformBatch(const ScopedTransformBatch&) = delete;
+        ScopedTransformBatch& operator=(const ScopedTransformBatch&) = delete;
+
+        //! Applies the moves recorded so far and sends their notifications. The batch stays open.
+        void Flush();
+
+        //! Returns the outermost batch open on the current thread, or nullptr if there is none.
+        static ScopedTransformBatch* GetCurrent();
+
+    private:
+        friend class TransformComponent;
+
+        struct Entry
+        {
+            TransformComponent* m_component = nullptr;
+            bool m_isMoved = false;
+            bool m_hasDescendants = false;
+        };
+
+        //! Records a new local or world transform for the component.
+        //! Returns false if the batch can't take the move, and the component has to apply it immediately.
+        bool RecordMove(TransformComponent& component, const AZ::Transform& tm, bool isWorldTM);
+
+        //! Called before a component is re-parented or deactivated. Flushes the pending moves, or, during a flush,
+        //! drops the pending notification of the component.
+        void Release(TransformComponent& component);
+
+        //! Adds the component, and all of its ancestors, to the hierarchy.
+        //! Returns InvalidNodeId if the component can't be batched, because it has a parent that is not a TransformComponent.
+        TransformHierarchy::NodeId AddComponent(TransformComponent& component);
+
+        //! Adds all descendants of the node, so that they are recomputed with it.
+        void AddDescendants(TransformHierarchy::NodeId nodeId);
+
+        bool HasMovedAncestor(TransformHierarchy::NodeId nodeId) const;
+
+        TransformHierarchy m_hierarchy;
+        // indexed by NodeId, nodes are never removed from the hierarchy of a batch, so the ids are dense
+        AZStd::vector<Entry> m_entries;
+        // the changed components still to be notified by the flush in progress, parents first
+        AZStd::vector<TransformComponent*> m_pendingNotifications;
+        ScopedTransformBatch* m_outer = nullptr;
+        bool m_isFlushing = false;
+    };
+} // namespace AzFramework
@@ -11,6 +11,7 @@
 #include <AzCore/Script/ScriptContext.h>
 #include <AzCore/Script/ScriptSystemBus.h>
 #include <AzCore/Script/ScriptProperty.h>
+#include <AzCore/Script/ScriptTimePoint.h>
 
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Asset/AssetManager.h>
@@ -23,6 +24,7 @@
 #include <AzCore/std/string/conversions.h>
 
 #include <AzFramework/Script/ScriptComponent.h>
+#include <AzFramework/Script/ScriptVMPoolInterface.h>
 
 #include <AzFramework/StringFunc/StringFunc.h>
 
@@ -507,6 +509,7 @@ namespace AzFramework
         , m_contextId(AZ::ScriptContextIds::DefaultScriptContextId)
         , m_script(AZ::Data::AssetLoadBehavior::PreLoad)
         , m_table(LUA_NOREF)
+        , m_isThreadSafe(false)
     {
         m_properties.m_name = "Properties";
     }
@@ -542,6 +545,16 @@ namespace AzFramework
         m_script = script;
     }
 
+    //=========================================================================
+    // SetThreadSafe
+    //=========================================================================
+    void ScriptComponent::SetThreadSafe(bool isThreadSafe)
+    {
+        AZ_Assert(m_entity == nullptr || m_entity->GetState() != AZ::Entity::State::Active, "You can't change whether the script is thread-safe while the entity is active");
+
+        m_isThreadSafe = isThreadSafe;
+    }
+
     AZ::ScriptProperty* ScriptComponent::GetScriptProperty(const char* propertyName)
     {
         return m_properties.GetProperty(propertyName);
@@ -560,6 +573,18 @@ namespace AzFramework
     //=========================================================================
     void ScriptComponent::Activate()
     {
+        // thread-safe scripts run in the context the pool assigns them to
+        if (m_isThreadSafe)
+        {
+            if (auto vmPool = ScriptVMPoolInterface::Get(); vmPool != nullptr)
+            {
+                if (AZ::ScriptContext* context = vmPool->AddScript(*this))
+                {
+                    m_context = context;
+                }
+            }
+        }
+
         // if we have valid asset listen for script asset events, like reload
         if (m_script.GetId().IsValid())
         {
@@ -577,6 +602,15 @@ namespace AzFramework
         AZ::Data::AssetBus::Handler::BusDisconnect(m_script.GetId());
 
         UnloadScript();
+
+        if (m_isThreadSafe)
+        {
+            if (auto vmPool = ScriptVMPoolInterface::Get(); vmPool != nullptr)
+            {
+                vmPool->RemoveScript(*this);
+            }
+            EBUS_EVENT_RESULT(m_context, AZ::ScriptSystemRequestBus, GetContext, m_contextId);
+        }
     }
 
     //=========================================================================
@@ -649,7 +683,7 @@ namespace AzFramework
 
         // Set the metamethods as we will use the script table as a metatable for entity tables
         bool success = false;
-        EBUS_EVENT_RESULT(success, AZ::ScriptSystemRequestBus, Load, m_script, AZ::k_scriptLoadBinaryOrText, m_contextId);
+        EBUS_EVENT_RESULT(success, AZ::ScriptSystemRequestBus, Load, m_script, AZ::k_scriptLoadBinaryOrText, m_context->GetId());
         if (!success)
         {
             return false;
@@ -873,6 +907,36 @@ namespace AzFramework
         }
     }
 
+    //=========================================================================
+    // ParallelTick
+    //=========================================================================
+    void ScriptComponent::ParallelTick(float deltaTime, const AZ::ScriptTimePoint& time)
+    {
+        if (m_table == LUA_NOREF)
+        {
+            return;
+        }
+
+        lua_State* lua = m_context->NativeContext();
+        LSV_BEGIN(lua, 0);
+
+        lua_rawgeti(lua, LUA_REGISTRYINDEX, m_table); // Stack: EntityTable
+        lua_pushliteral(lua, "OnParallelTick");
+        lua_gettable(lua, -2); // EntityTable[OnParallelTick], found through the script table which is the metatable
+        if (lua_isfunction(lua, -1))
+        {
+            lua_pushvalue(lua, -2); // push the entity table as self
+            lua_pushnumber(lua, deltaTime);
+            AZ::ScriptValue<AZ::ScriptTimePoint>::StackPush(lua, time);
+            AZ::Internal::LuaSafeCall(lua, 3, 0); // Call OnParallelTick
+        }
+        else
+        {
+            lua_pop(lua, 1); // remove the OnParallelTick result
+        }
+        lua_pop(lua, 1); // remove the entity table
+    }
+
     //=========================================================================
     // CreatePropertyGroup
     // [3/3/2014]
@@ -979,6 +1043,7 @@ namespace AzFramework
                     ->Field("ContextID", &ScriptComponent::m_contextId)
                     ->Field("Properties", &ScriptComponent::m_properties)
                     ->Field("Script", &ScriptComponent::m_script)
+                    ->Field("ThreadSafe", &ScriptComponent::m_isThreadSafe)
                     ;
 
                 serializeContext->Class<ScriptPropertyGroup>()
@@ -19,6 +19,7 @@
 namespace AZ
 {
     class ScriptProperty;
+    class ScriptTimePoint;
 }
 
 namespace AzToolsFramework
@@ -86,6 +87,7 @@ namespace AzFramework
         , private AZ::Data::AssetBus::Handler
     {
         friend class AzToolsFramework::Components::ScriptEditorComponent;        
+        friend class ScriptVMPoolComponent;
 
     public:
         static const char* DefaultFieldName;
@@ -104,6 +106,10 @@ namespace AzFramework
         const AZ::Data::Asset<AZ::ScriptAsset>& GetScript() const       { return m_script; }
         void                                    SetScript(const AZ::Data::Asset<AZ::ScriptAsset>& script);
 
+        /// Thread-safe scripts run in the contexts of the ScriptVMPoolInterface, which calls their OnParallelTick function.
+        bool                                    IsThreadSafe() const    { return m_isThreadSafe; }
+        void                                    SetThreadSafe(bool isThreadSafe);
+
         // Methods used for unit tests
         AZ::ScriptProperty* GetScriptProperty(const char* propertyName);
 
@@ -136,11 +142,15 @@ namespace AzFramework
 
         void CreatePropertyGroup(const ScriptPropertyGroup& group, int propertyGroupTableIndex, int parentIndex, int metatableIndex, bool isRoot);
 
+        /// Calls OnParallelTick of the script instance, if the script has one. Called by the ScriptVMPoolComponent.
+        void ParallelTick(float deltaTime, const AZ::ScriptTimePoint& time);
+
         AZ::ScriptContext*               m_context;              ///< Context in which the script will be running
         AZ::ScriptContextId                 m_contextId;            ///< Id of the script context.
         AZ::Data::Asset<AZ::ScriptAsset>    m_script;               ///< Reference to the script asset used for this component.
         int                                 m_table;                ///< Cached table index
         ScriptPropertyGroup                 m_properties;           ///< List with all properties that were tweaked in the editor and should override values in the m_sourceScriptName class inside m_script.
+        bool                                m_isThreadSafe;         ///< True if the script only touches its own context while ticking, so it can run in parallel with other scripts.
     };        
 }   // namespace AZ
 
@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if !defined(AZCORE_EXCLUDE_LUA)
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Script/ScriptSystemBus.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
+#include <AzFramework/Script/ScriptComponent.h>
+#include <AzFramework/Script/ScriptVMPoolComponent.h>
+
+extern "C" {
+#   include <Lua/lualib.h>
+#   include <Lua/lauxlib.h>
+}
+
+AZ_DECLARE_BUDGET(Script);
+
+namespace AzFramework
+{
+    void ScriptVMPoolComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<ScriptVMPoolComponent, AZ::Component>();
+        }
+    }
+
+    void ScriptVMPoolComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& services)
+    {
+        services.push_back(AZ_CRC_CE("ScriptVMPoolService"));
+    }
+
+    void ScriptVMPoolComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& services)
+    {
+        services.push_back(AZ_CRC_CE("ScriptVMPoolService"));
+    }
+
+    void ScriptVMPoolComponent::GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& services)
+    {
+        services.push_back(AZ_CRC_CE("ScriptService"));
+    }
+
+    void ScriptVMPoolComponent::Activate()
+    {
+        AZ::u64 contextCount = 0;
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+        {
+            settingsRegistry->Get(contextCount, ContextCountRegistryKey);
+        }
+        m_contextCount = aznumeric_cast<AZ::u32>(contextCount);
+
+        if (m_contextCount == 0)
+        {
+            AZ::ScriptContext* defaultContext = nullptr;
+            AZ::ScriptSystemRequestBus::BroadcastResult(
+                defaultContext, &AZ::ScriptSystemRequests::GetContext, AZ::ScriptContextIds::DefaultScriptContextId);
+            if (defaultContext == nullptr)
+            {
+                AZ_Warning("ScriptVMPool", false, "No default script context available, thread-safe scripts won't be ticked.");
+                return;
+            }
+            m_virtualMachines.resize(1);
+            m_virtualMachines[0].m_context = defaultContext;
+        }
+        else
+        {
+            m_virtualMachines.resize(m_contextCount);
+            for (AZ::u32 i = 0; i < m_contextCount; ++i)
+            {
+                AZ::ScriptSystemRequestBus::BroadcastResult(
+                    m_virtualMachines[i].m_context, &AZ::ScriptSystemRequests::AddContextWithId, FirstContextId + i);
+                if (m_virtualMachines[i].m_context == nullptr)
+                {
+                    AZ_Error("ScriptVMPool", false, "Failed to create script context %u, using %u script contexts instead of %u.",
+                        FirstContextId + i, i, m_contextCount);
+                    m_virtualMachines.resize(i);
+                    m_contextCount = i;
+                    break;
+                }
+            }
+        }
+
+        for (VirtualMachine& virtualMachine : m_virtualMachines)
+        {
+            lua_State* lua = virtualMachine.m_context->NativeContext();
+            lua_pushlightuserdata(lua, &virtualMachine);
+            lua_pushcclosure(lua, &ScriptVMPoolComponent::QueueOnMainThread, 1);
+            lua_setglobal(lua, "QueueOnMainThread");
+        }
+
+        m_taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void ScriptVMPoolComponent::Deactivate()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+
+        m_taskGraphActive = nullptr;
+
+        for (VirtualMachine& virtualMachine : m_virtualMachines)
+        {
+            AZ_Warning("ScriptVMPool", virtualMachine.m_scripts.empty(), "%zu thread-safe scripts are still active.", virtualMachine.m_scripts.size());
+
+            lua_State* lua = virtualMachine.m_context->NativeContext();
+            for (int reference : virtualMachine.m_mainThreadCalls)
+            {
+                luaL_unref(lua, LUA_REGISTRYINDEX, reference);
+            }
+            lua_pushnil(lua);
+            lua_setglobal(lua, "QueueOnMainThread");
+        }
+
+        for (AZ::u32 i = 0; i < m_contextCount; ++i)
+        {
+            AZ::ScriptSystemRequestBus::Broadcast(&AZ::ScriptSystemRequests::RemoveContextWithId, FirstContextId + i);
+        }
+        m_virtualMachines = {};
+        m_contextCount = 0;
+    }
+
+    AZ::ScriptContext* ScriptVMPoolComponent::AddScript(ScriptComponent& script)
+    {
+        if (m_virtualMachines.empty())
+        {
+            return nullptr;
+        }
+
+        VirtualMachine* virtualMachine = &m_virtualMachines[0];
+        for (VirtualMachine& candidate : m_virtualMachines)
+        {
+            if (candidate.m_scripts.size() < virtualMachine->m_scripts.size())
+            {
+                virtualMachine = &candidate;
+            }
+        }
+        virtualMachine->m_scripts.push_back(&script);
+        return virtualMachine->m_context;
+    }
+
+    void ScriptVMPoolComponent::RemoveScript(ScriptComponent& script)
+    {
+        for (VirtualMachine& virtualMachine : m_virtualMachines)
+        {
+            auto it = AZStd::find(virtualMachine.m_scripts.begin(), virtualMachine.m_scripts.end(), &script);
+            if (it != virtualMachine.m_scripts.end())
+            {
+                // The order in which the scripts of a context are ticked isn't defined, so swap with the last one.
+                *it = virtualMachine.m_scripts.back();
+                virtualMachine.m_scripts.pop_back();
+                return;
+            }
+        }
+    }
+
+    AZ::u32 ScriptVMPoolComponent::GetContextCount() const
+    {
+        return m_contextCount;
+    }
+
+    void ScriptVMPoolComponent::OnTick(float deltaTime, AZ::ScriptTimePoint time)
+    {
+        AZ_PROFILE_FUNCTION(Script);
+
+        if (m_virtualMachines.size() == 1)
+        {
+            TickVirtualMachine(m_virtualMachines[0], deltaTime, time);
+        }
+        else if (m_taskGraphActive && m_taskGraphActive->IsTaskGraphActive())
+        {
+            AZ::TaskGraph taskGraph;
+            AZ::TaskDescriptor tickDescriptor{ "ScriptVMTick", "Script" };
+            for (VirtualMachine& virtualMachine : m_virtualMachines)
+            {
+                if (!virtualMachine.m_scripts.empty())
+                {
+                    taskGraph.AddTask(
+                        tickDescriptor,
+                        [&virtualMachine, deltaTime, &time]()
+                        {
+                            TickVirtualMachine(virtualMachine, deltaTime, time);
+                        });
+                }
+            }
+
+            if (!taskGraph.IsEmpty())
+            {
+                AZ::TaskGraphEvent finishedEvent;
+                taskGraph.Submit(&finishedEvent);
+                finishedEvent.Wait();
+            }
+        }
+        else // use Job system
+        {
+            AZ::JobCompletion jobCompletion;
+            for (VirtualMachine& virtualMachine : m_virtualMachines)
+            {
+                if (!virtualMachine.m_scripts.empty())
+                {
+                    AZ::Job* tickJob = AZ::CreateJobFunction(
+                        [&virtualMachine, deltaTime, &time]()
+                        {
+                            TickVirtualMachine(virtualMachine, deltaTime, time);
+                        },
+                        true, nullptr);
+                    tickJob->SetDependent(&jobCompletion);
+                    tickJob->Start();
+                }
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+
+        // The contexts are idle again, run what the scripts want to do on the main thread.
+        for (VirtualMachine& virtualMachine : m_virtualMachines)
+        {
+            RunMainThreadCalls(virtualMachine);
+        }
+    }
+
+    void ScriptVMPoolComponent::TickVirtualMachine(VirtualMachine& virtualMachine, float deltaTime, const AZ::ScriptTimePoint& time)
+    {
+        AZ_PROFILE_SCOPE(Script, "ScriptVMPoolComponent: TickVirtualMachine");
+
+        // The other contexts may be ticked at the same time, so sending EBus events asserts until all scripts are ticked.
+        virtualMachine.m_context->DebugSetEBusEventsAllowed(false);
+        for (ScriptComponent* script : virtualMachine.m_scripts)
+        {
+            script->ParallelTick(deltaTime, time);
+        }
+        virtualMachine.m_context->DebugSetEBusEventsAllowed(true);
+    }
+
+    void ScriptVMPoolComponent::RunMainThreadCalls(VirtualMachine& virtualMachine)
+    {
+        if (virtualMachine.m_mainThreadCalls.empty())
+        {
+            return;
+        }
+
+        // The queued functions may queue more functions, those run after the next tick.
+        AZStd::vector<int> mainThreadCalls;
+        mainThreadCalls.swap(virtualMachine.m_mainThreadCalls);
+
+        lua_State* lua = virtualMachine.m_context->NativeContext();
+        for (int reference : mainThreadCalls)
+        {
+            lua_rawgeti(lua, LUA_REGISTRYINDEX, reference);
+            luaL_unref(lua, LUA_REGISTRYINDEX, reference);
+            AZ::Internal::LuaSafeCall(lua, 0, 0);
+        }
+    }
+
+    int ScriptVMPoolComponent::QueueOnMainThread(lua_State* lua)
+    {
+        luaL_checktype(lua, 1, LUA_TFUNCTION);
+        lua_settop(lua, 1);
+
+        auto virtualMachine = reinterpret_cast<VirtualMachine*>(lua_touserdata(lua, lua_upvalueindex(1)));
+        virtualMachine->m_mainThreadCalls.push_back(luaL_ref(lua, LUA_REGISTRYINDEX));
+        return 0;
+    }
+} // namespace AzFramework
+
+#endif // #if !defined(AZCORE_EXCLUDE_LUA)
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Script/ScriptContext.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Script/ScriptVMPoolInterface.h>
+
+namespace AZ
+{
+    class TaskGraphActiveInterface;
+}
+
+namespace AzFramework
+{
+    /**
+     * Ticks the scripts of ScriptComponents that are flagged as thread-safe.
+     * The number of isolated script contexts is read from ContextCountRegistryKey when the component activates. Each thread-safe
+     * script is loaded in the context with the fewest scripts, and every tick the contexts run the OnParallelTick(self, deltaTime, timePoint)
+     * functions of their scripts in parallel, one task per context. With no contexts configured, which is the default, the
+     * thread-safe scripts run in the default script context and are ticked on the main thread.
+     *
+     * A thread-safe script may only touch its own context during OnParallelTick, in particular it must not send EBus events, which
+     * asserts in non-release builds.
+     * Scripts can instead pass a function to QueueOnMainThread, the queued functions are called on the main thread once all contexts
+     * have been ticked.
+     */
+    class ScriptVMPoolComponent
+        : public AZ::Component
+        , public AZ::TickBus::Handler
+        , public ScriptVMPoolInterface::Registrar
+    {
+    public:
+        AZ_COMPONENT(ScriptVMPoolComponent, "{6B1E4F2C-9A8D-4E5B-B7C3-2F0D1A9E8C64}");
+
+        inline static constexpr const char* ContextCountRegistryKey = "/O3DE/AzFramework/ScriptVMPool/ContextCount";
+        //! Id of the first pooled script context, the other contexts use the ids that follow.
+        static constexpr AZ::ScriptContextId FirstContextId = AZ_CRC_CE("ScriptVMPool");
+
+        ScriptVMPoolComponent() = default;
+        ScriptVMPoolComponent(const ScriptVMPoolComponent&) = delete;
+        ScriptVMPoolComponent& operator=(const ScriptVMPoolComponent&) = delete;
+
+        static void Reflect(AZ::ReflectContext* context);
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& services);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& services);
+        static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& services);
+
+        //////////////////////////////////////////////////////////////////////////
+        // ScriptVMPoolRequests
+        AZ::ScriptContext* AddScript(ScriptComponent& script) override;
+        void RemoveScript(ScriptComponent& script) override;
+        AZ::u32 GetContextCount() const override;
+        //////////////////////////////////////////////////////////////////////////
+
+    protected:
+        //////////////////////////////////////////////////////////////////////////
+        // Component
+        void Activate() override;
+        void Deactivate() override;
+        //////////////////////////////////////////////////////////////////////////
+
+        //////////////////////////////////////////////////////////////////////////
+        // TickBus
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        //////////////////////////////////////////////////////////////////////////
+
+    private:
+        struct VirtualMachine
+        {
+            AZ::ScriptContext* m_context = nullptr;
+            AZStd::vector<ScriptComponent*> m_scripts;
+            //! Registry references to the functions passed to QueueOnMainThread.
+            AZStd::vector<int> m_mainThreadCalls;
+        };
+
+        static void TickVirtualMachine(VirtualMachine& virtualMachine, float deltaTime, const AZ::ScriptTimePoint& time);
+        static void RunMainThreadCalls(VirtualMachine& virtualMachine);
+        static int QueueOnMainThread(lua_State* lua);
+
+        //! Sized once on activation, the contexts keep a pointer to their entry.
+        AZStd::vector<VirtualMachine> m_virtualMachines;
+        AZ::u32 m_contextCount = 0;
+        AZ::TaskGraphActiveInterface* m_taskGraphActive = nullptr;
+    };
+} // namespace AzFramework
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/RTTI/RTTI.h>
+
+namespace AZ
+{
+    class ScriptContext;
+}
+
+namespace AzFramework
+{
+    class ScriptComponent;
+
+    //! Runs the OnParallelTick function of thread-safe scripts. The scripts are spread over a pool of isolated script
+    //! contexts which are ticked in parallel.
+    class ScriptVMPoolRequests
+    {
+    public:
+        AZ_RTTI(AzFramework::ScriptVMPoolRequests, "{3C0F6E9B-2B7A-4B43-9E0C-5D62D3C1A8F4}");
+
+        virtual ~ScriptVMPoolRequests() = default;
+
+        //! Assigns a thread-safe script to the context with the fewest scripts and returns that context.
+        //! The script has to be loaded in the returned context. Must be called from the main thread.
+        virtual AZ::ScriptContext* AddScript(ScriptComponent& script) = 0;
+
+        //! Removes a script that was added with AddScript. Must be called from the main thread.
+        virtual void RemoveScript(ScriptComponent& script) = 0;
+
+        //! Returns the number of isolated script contexts in the pool. With 0 the thread-safe scripts share the default
+        //! script context and are ticked on the main thread.
+        virtual AZ::u32 GetContextCount() const = 0;
+    };
+
+    using ScriptVMPoolInterface = AZ::Interface<ScriptVMPoolRequests>;
+} // namespace AzFramework
@@ -39,6 +39,7 @@ set(FILES
     Archive/ZipDirCacheFactory.h
     Archive/ZipDirFind.h
     Archive/ZipDirList.h
+    Archive/ZipDirMappedFile.h
     Archive/ZipDirStructures.h
     Archive/ZipDirTree.h
     Archive/ZipFileFormat.h
@@ -131,6 +132,8 @@ set(FILES
     Components/EditorEntityEvents.h
     Components/TransformComponent.cpp
     Components/TransformComponent.h
+    Components/TransformHierarchy.cpp
+    Components/TransformHierarchy.h
     Components/CameraBus.h
     Components/ConsoleBus.h
     Components/ConsoleBus.cpp
@@ -186,6 +189,9 @@ set(FILES
     Script/ScriptDebugMsgReflection.h
     Script/ScriptRemoteDebugging.cpp
     Script/ScriptRemoteDebugging.h
+    Script/ScriptVMPoolComponent.h
+    Script/ScriptVMPoolComponent.cpp
+    Script/ScriptVMPoolInterface.h
     Session/ISessionHandlingRequests.h
     Session/ISessionRequests.h
     Session/SessionRequests.cpp
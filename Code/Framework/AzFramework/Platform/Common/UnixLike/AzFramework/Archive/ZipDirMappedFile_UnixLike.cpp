@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Archive/ZipDirMappedFile.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace AZ::IO::ZipDir
+{
+    bool MappedFile::Open(const char* szFilePath)
+    {
+        Close();
+
+        int fileDescriptor = open(szFilePath, O_RDONLY);
+        if (fileDescriptor == -1)
+        {
+            return false;
+        }
+
+        struct stat fileStat;
+        if (fstat(fileDescriptor, &fileStat) != 0 || fileStat.st_size <= 0)
+        {
+            close(fileDescriptor);
+            return false;
+        }
+
+        const size_t fileSize = static_cast<size_t>(fileStat.st_size);
+        void* data = mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileDescriptor, 0);
+        // the mapping keeps its own reference to the file
+        close(fileDescriptor);
+        if (data == MAP_FAILED)
+        {
+            return false;
+        }
+
+        m_data = static_cast<uint8_t*>(data);
+        m_size = fileSize;
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_data)
+        {
+            munmap(m_data, m_size);
+            m_data = nullptr;
+            m_size = 0;
+        }
+    }
+}
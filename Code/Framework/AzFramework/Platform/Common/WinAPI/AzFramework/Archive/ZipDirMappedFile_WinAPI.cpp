@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/PlatformIncl.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzFramework/Archive/ZipDirMappedFile.h>
+
+namespace AZ::IO::ZipDir
+{
+    bool MappedFile::Open(const char* szFilePath)
+    {
+        Close();
+
+        AZStd::wstring filePathW;
+        AZStd::to_wstring(filePathW, szFilePath);
+        HANDLE fileHandle = CreateFileW(filePathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart <= 0)
+        {
+            CloseHandle(fileHandle);
+            return false;
+        }
+
+        HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        // the view keeps its own references to the file and the mapping object
+        CloseHandle(fileHandle);
+        if (!mappingHandle)
+        {
+            return false;
+        }
+
+        void* data = MapViewOfFile(mappingHandle, FILE_MAP_COPY, 0, 0, 0);
+        CloseHandle(mappingHandle);
+        if (!data)
+        {
+            return false;
+        }
+
+        m_data = static_cast<uint8_t*>(data);
+        m_size = static_cast<size_t>(fileSize.QuadPart);
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_data)
+        {
+            UnmapViewOfFile(m_data);
+            m_data = nullptr;
+            m_size = 0;
+        }
+    }
+}
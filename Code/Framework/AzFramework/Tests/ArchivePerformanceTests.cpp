@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Archive/ZipDirCache.h>
+#include <AzFramework/Archive/ZipDirCacheFactory.h>
+#include <AzFramework/IO/LocalFileIO.h>
+#include <AzTest/Utils.h>
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    class BM_Archive
+        : public benchmark::Fixture
+    {
+        void internalSetUp()
+        {
+            // Create the SystemAllocator if not available
+            if (!AZ::AllocatorInstance<AZ::SystemAllocator>::IsReady())
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+                m_ownsSystemAllocator = true;
+            }
+
+            if (!AZ::IO::FileIOBase::GetDirectInstance())
+            {
+                m_fileIO = new AZ::IO::LocalFileIO;
+                AZ::IO::FileIOBase::SetDirectInstance(m_fileIO);
+            }
+
+            m_tempDirectory = new AZ::Test::ScopedAutoTempDirectory;
+            m_pakPath = m_tempDirectory->Resolve("benchmark.pak");
+
+            // 16k files of a few KB in a directory structure like the one of a product cache,
+            // every other file is compressed
+            AZStd::vector<char> fileData(FileSize);
+            for (size_t index = 0; index < fileData.size(); ++index)
+            {
+                fileData[index] = static_cast<char>('a' + (index * 7 + index / 13) % 26);
+            }
+
+            {
+                AZ::IO::ZipDir::CacheFactory factory(AZ::IO::ZipDir::InitMethod::Default, AZ::IO::ZipDir::CacheFactory::FLAGS_CREATE_NEW);
+                AZ::IO::ZipDir::CachePtr cache = factory.New(m_pakPath.c_str());
+                for (uint32_t fileIndex = 0; fileIndex < FileCount; ++fileIndex)
+                {
+                    m_filePaths.push_back(AZStd::string::format("objects/group%u/subgroup%u/asset%u.azmodel", fileIndex % 32, fileIndex % 7, fileIndex));
+                    const uint32_t method = (fileIndex % 2) ? AZ::IO::ZipFile::METHOD_DEFLATE : AZ::IO::ZipFile::METHOD_STORE;
+                    cache->UpdateFile(m_filePaths.back(), fileData.data(), fileData.size(), method, 1);
+                }
+            }
+
+            m_readBuffer.resize(FileSize);
+        }
+
+        void internalTearDown()
+        {
+            m_mountedCache = {};
+            m_filePaths = {};
+            m_readBuffer = {};
+            m_pakPath = {};
+
+            delete m_tempDirectory;
+            m_tempDirectory = nullptr;
+
+            if (m_fileIO)
+            {
+                AZ::IO::FileIOBase::SetDirectInstance(nullptr);
+                delete m_fileIO;
+                m_fileIO = nullptr;
+            }
+
+            // Destroy system allocator only if it was created by this environment
+            if (m_ownsSystemAllocator)
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+            }
+        }
+
+    public:
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        AZ::IO::ZipDir::CachePtr Mount(bool memoryMapped)
+        {
+            uint32_t flags = AZ::IO::ZipDir::CacheFactory::FLAGS_READ_ONLY;
+            if (memoryMapped)
+            {
+                flags |= AZ::IO::ZipDir::CacheFactory::FLAGS_MEMORY_MAPPED;
+            }
+            AZ::IO::ZipDir::CacheFactory factory(AZ::IO::ZipDir::InitMethod::Default, flags);
+            return factory.New(m_pakPath.c_str());
+        }
+
+        static constexpr uint32_t FileCount = 16384;
+        static constexpr size_t FileSize = 4096;
+
+        bool m_ownsSystemAllocator = false;
+        AZ::IO::LocalFileIO* m_fileIO = nullptr;
+        AZ::Test::ScopedAutoTempDirectory* m_tempDirectory = nullptr;
+        AZStd::string m_pakPath;
+        AZStd::vector<AZStd::string> m_filePaths;
+        AZStd::vector<uint8_t> m_readBuffer;
+        AZ::IO::ZipDir::CachePtr m_mountedCache;
+    };
+
+    BENCHMARK_DEFINE_F(BM_Archive, Mount)(benchmark::State& state)
+    {
+        const bool memoryMapped = state.range(0) != 0;
+        for (auto _ : state)
+        {
+            AZ::IO::ZipDir::CachePtr cache = Mount(memoryMapped);
+            benchmark::DoNotOptimize(cache.get());
+        }
+    }
+    BENCHMARK_REGISTER_F(BM_Archive, Mount)->ArgName("MemoryMapped")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(BM_Archive, FindFile)(benchmark::State& state)
+    {
+        m_mountedCache = Mount(state.range(0) != 0);
+        for (auto _ : state)
+        {
+            for (const AZStd::string& filePath : m_filePaths)
+            {
+                benchmark::DoNotOptimize(m_mountedCache->FindFile(filePath));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * FileCount);
+    }
+    BENCHMARK_REGISTER_F(BM_Archive, FindFile)->ArgName("MemoryMapped")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(BM_Archive, ReadFile)(benchmark::State& state)
+    {
+        m_mountedCache = Mount(state.range(0) != 0);
+        AZStd::vector<AZ::IO::ZipDir::FileEntry*> fileEntries;
+        for (const AZStd::string& filePath : m_filePaths)
+        {
+            fileEntries.push_back(m_mountedCache->FindFile(filePath));
+        }
+
+        for (auto _ : state)
+        {
+            for (AZ::IO::ZipDir::FileEntry* fileEntry : fileEntries)
+            {
+                m_mountedCache->ReadFile(fileEntry, nullptr, m_readBuffer.data());
+            }
+            benchmark::DoNotOptimize(m_readBuffer.data());
+        }
+        state.SetBytesProcessed(state.iterations() * FileCount * FileSize);
+    }
+    BENCHMARK_REGISTER_F(BM_Archive, ReadFile)->ArgName("MemoryMapped")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+}
+
+#endif
@@ -23,6 +23,8 @@
 #include <AzFramework/Archive/Archive.h>
 #include <AzFramework/Archive/ArchiveVars.h>
 #include <AzFramework/Archive/INestedArchive.h>
+#include <AzFramework/Archive/NestedArchive.h>
+#include <AzFramework/Archive/ZipDirCache.h>
 
 namespace UnitTest
 {
@@ -280,6 +282,104 @@ namespace UnitTest
         TestFGetCachedFileData(fileInArchiveFile, dataString.size(), dataString.data());
     }
 
+    TEST_F(ArchiveTestFixture, MemoryMappedArchive_FindAndReadFiles_MatchesRegularArchive)
+    {
+        constexpr const char* storedFile = "levels/mylevel/stored.txt";
+        constexpr const char* compressedFile = "levels/mylevel/compressed.txt";
+        constexpr AZStd::string_view dataString = "HELLO WORLD HELLO WORLD HELLO WORLD";
+
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+
+        constexpr const char* testArchivePath = "@usercache@/memorymapped.pak";
+        fileIo->Remove(testArchivePath);
+
+        {
+            AZStd::intrusive_ptr<AZ::IO::INestedArchive> pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+            ASSERT_NE(nullptr, pArchive);
+            EXPECT_EQ(0, pArchive->UpdateFile(storedFile, dataString.data(), dataString.size(), AZ::IO::INestedArchive::METHOD_STORE));
+            EXPECT_EQ(0, pArchive->UpdateFile(compressedFile, dataString.data(), dataString.size(), AZ::IO::INestedArchive::METHOD_COMPRESS, AZ::IO::INestedArchive::LEVEL_FASTEST));
+        }
+
+        for (bool memoryMapped : { false, true })
+        {
+            uint32_t flags = AZ::IO::INestedArchive::FLAGS_OPTIMIZED_READ_ONLY;
+            if (memoryMapped)
+            {
+                flags |= AZ::IO::INestedArchive::FLAGS_MEMORY_MAPPED;
+            }
+
+            AZStd::intrusive_ptr<AZ::IO::INestedArchive> pArchive = archive->OpenArchive(testArchivePath, {}, flags);
+            ASSERT_NE(nullptr, pArchive);
+            EXPECT_EQ(memoryMapped, static_cast<AZ::IO::NestedArchive*>(pArchive.get())->GetCache()->IsMemoryMapped());
+
+            for (const char* filePath : { storedFile, compressedFile })
+            {
+                AZ::IO::INestedArchive::Handle fileHandle = pArchive->FindFile(filePath);
+                ASSERT_NE(nullptr, fileHandle);
+                ASSERT_EQ(dataString.size(), pArchive->GetFileSize(fileHandle));
+
+                AZStd::string readData(dataString.size(), '\0');
+                EXPECT_EQ(0, pArchive->ReadFile(fileHandle, readData.data()));
+                EXPECT_EQ(dataString, readData);
+            }
+
+            EXPECT_EQ(pArchive->FindFile(storedFile), pArchive->FindFile("levels//mylevel/stored.txt"));
+            EXPECT_EQ(nullptr, pArchive->FindFile("levels/mylevel/missing.txt"));
+            EXPECT_EQ(nullptr, pArchive->FindFile("levels/mylevel"));
+        }
+    }
+
+    TEST_F(ArchiveTestFixture, MemoryMappedArchive_ModifiedCachedFileData_DoesNotChangeArchiveData)
+    {
+        constexpr const char* storedFile = "levels/mappedlevel/stored.txt";
+        constexpr AZStd::string_view dataString = "HELLO WORLD";
+
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+
+        auto console = AZ::Interface<AZ::IConsole>::Get();
+        ASSERT_NE(nullptr, console);
+
+        constexpr const char* testArchivePath = "@usercache@/memorymappedwrite.pak";
+        archive->ClosePack(testArchivePath);
+        fileIo->Remove(testArchivePath);
+
+        {
+            AZStd::intrusive_ptr<AZ::IO::INestedArchive> pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+            ASSERT_NE(nullptr, pArchive);
+            EXPECT_EQ(0, pArchive->UpdateFile(storedFile, dataString.data(), dataString.size(), AZ::IO::INestedArchive::METHOD_STORE));
+        }
+
+        console->PerformCommand("sys_PakMemoryMapped", { "true" });
+        EXPECT_TRUE(archive->OpenPack("@products@", testArchivePath));
+        console->PerformCommand("sys_PakMemoryMapped", { "false" });
+
+        // the cached data of a stored file is a private copy, writing to it must not leak into the shared mapping
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            AZ::IO::HandleType fileHandle = archive->FOpen(storedFile, "rb");
+            ASSERT_NE(AZ::IO::InvalidHandle, fileHandle);
+
+            size_t fileSize = 0;
+            char* pFileBuffer = static_cast<char*>(archive->FGetCachedFileData(fileHandle, fileSize));
+            ASSERT_NE(nullptr, pFileBuffer);
+            ASSERT_EQ(dataString.size(), fileSize);
+            EXPECT_EQ(dataString, AZStd::string_view(pFileBuffer, fileSize));
+
+            memset(pFileBuffer, 'X', fileSize);
+            archive->FClose(fileHandle);
+        }
+
+        EXPECT_TRUE(archive->ClosePack(testArchivePath));
+    }
+
     TEST_F(ArchiveTestFixture, TestArchiveOpenPacks_FindsMultiplePaks_Works)
     {
         AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Components/TransformHierarchy.h>
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    class BM_TransformHierarchy
+        : public benchmark::Fixture
+    {
+        void internalSetUp()
+        {
+            // Create the SystemAllocator if not available
+            if (!AZ::AllocatorInstance<AZ::SystemAllocator>::IsReady())
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+                m_ownsSystemAllocator = true;
+            }
+
+            m_hierarchy = new AzFramework::TransformHierarchy;
+
+            // 100k entities, in 1000 chains that are 100 deep, like vehicles or characters with attachments
+            const AZ::Transform offset = AZ::Transform::CreateFromQuaternionAndTranslation(
+                AZ::Quaternion::CreateRotationZ(0.01f), AZ::Vector3(0.0f, 0.0f, 0.1f));
+            AZ::u64 entityId = 1;
+            for (uint32_t chain = 0; chain < ChainCount; ++chain)
+            {
+                AzFramework::TransformHierarchy::NodeId parent = m_hierarchy->AddNode(
+                    AZ::EntityId(entityId++), AZ::Transform::CreateTranslation(AZ::Vector3(static_cast<float>(chain), 0.0f, 0.0f)));
+                m_roots.push_back(parent);
+                m_leaves.push_back(parent);
+
+                for (uint32_t depth = 1; depth < ChainDepth; ++depth)
+                {
+                    parent = m_hierarchy->AddNode(AZ::EntityId(entityId++), offset, parent);
+                    m_leaves.back() = parent;
+                }
+            }
+            m_hierarchy->Update();
+        }
+
+        void internalTearDown()
+        {
+            delete m_hierarchy;
+            m_hierarchy = nullptr;
+
+            m_roots = {};
+            m_leaves = {};
+
+            // Destroy system allocator only if it was created by this environment
+            if (m_ownsSystemAllocator)
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+            }
+        }
+
+    public:
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        static constexpr uint32_t ChainCount = 1000;
+        static constexpr uint32_t ChainDepth = 100;
+
+        bool m_ownsSystemAllocator = false;
+        AzFramework::TransformHierarchy* m_hierarchy = nullptr;
+        AZStd::vector<AzFramework::TransformHierarchy::NodeId> m_roots;
+        AZStd::vector<AzFramework::TransformHierarchy::NodeId> m_leaves;
+    };
+
+    // every root moves, so every world transform is recomputed
+    BENCHMARK_F(BM_TransformHierarchy, MoveAllRoots100000)(benchmark::State& state)
+    {
+        float x = 0.0f;
+        for (auto _ : state)
+        {
+            x += 1.0f;
+            for (auto root : m_roots)
+            {
+                m_hierarchy->SetLocalTM(root, AZ::Transform::CreateTranslation(AZ::Vector3(x, 0.0f, 0.0f)));
+            }
+            m_hierarchy->Update();
+            benchmark::DoNotOptimize(m_hierarchy->GetChangedNodes().data());
+        }
+    }
+
+    // only the leaves move, so the cost is dominated by the traversal rather than the recomputation
+    BENCHMARK_F(BM_TransformHierarchy, MoveAllLeaves100000)(benchmark::State& state)
+    {
+        float z = 0.0f;
+        for (auto _ : state)
+        {
+            z += 1.0f;
+            for (auto leaf : m_leaves)
+            {
+                m_hierarchy->SetLocalTM(leaf, AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 0.0f, z)));
+            }
+            m_hierarchy->Update();
+            benchmark::DoNotOptimize(m_hierarchy->GetChangedNodes().data());
+        }
+    }
+
+    // a single root moves several times in a frame, its chain is only recomputed once
+    BENCHMARK_F(BM_TransformHierarchy, MoveOneRootRepeatedly100000)(benchmark::State& state)
+    {
+        float x = 0.0f;
+        for (auto _ : state)
+        {
+            for (int move = 0; move < 10; ++move)
+            {
+                x += 1.0f;
+                m_hierarchy->SetLocalTM(m_roots.front(), AZ::Transform::CreateTranslation(AZ::Vector3(x, 0.0f, 0.0f)));
+            }
+            m_hierarchy->Update();
+            benchmark::DoNotOptimize(m_hierarchy->GetChangedNodes().data());
+        }
+    }
+
+    // re-parenting every chain below another forces the depth sort
+    BENCHMARK_F(BM_TransformHierarchy, ReparentAndSort100000)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (uint32_t chain = 0; chain + 1 < ChainCount; ++chain)
+            {
+                m_hierarchy->SetParent(m_roots[chain], m_leaves[chain + 1]);
+            }
+            m_hierarchy->Update();
+
+            for (auto root : m_roots)
+            {
+                m_hierarchy->SetParent(root, AzFramework::TransformHierarchy::InvalidNodeId);
+            }
+            m_hierarchy->Update();
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AZTestShared/Math/MathTestHelpers.h>
+#include <AzFramework/Components/TransformHierarchy.h>
+
+using namespace AzFramework;
+
+namespace UnitTest
+{
+    class TransformHierarchyTests
+        : public AllocatorsFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            m_hierarchy = AZStd::make_unique<TransformHierarchy>();
+        }
+
+        void TearDown() override
+        {
+            m_hierarchy.reset();
+            AllocatorsFixture::TearDown();
+        }
+
+        static AZ::Transform Translation(float x, float y, float z)
+        {
+            return AZ::Transform::CreateTranslation(AZ::Vector3(x, y, z));
+        }
+
+        AZStd::unique_ptr<TransformHierarchy> m_hierarchy;
+    };
+
+    TEST_F(TransformHierarchyTests, Update_Chain_WorldTransformsAccumulate)
+    {
+        const auto root = m_hierarchy->AddNode(AZ::EntityId(1), Translation(1.0f, 0.0f, 0.0f));
+        const auto child = m_hierarchy->AddNode(AZ::EntityId(2), Translation(0.0f, 2.0f, 0.0f), root);
+        const auto grandChild = m_hierarchy->AddNode(AZ::EntityId(3), Translation(0.0f, 0.0f, 3.0f), child);
+        m_hierarchy->Update();
+
+        EXPECT_THAT(m_hierarchy->GetWorldTM(grandChild).GetTranslation(), IsClose(AZ::Vector3(1.0f, 2.0f, 3.0f)));
+        EXPECT_EQ(m_hierarchy->GetChangedNodes().size(), 3u);
+    }
+
+    TEST_F(TransformHierarchyTests, Update_MovedParent_ChildrenReportedOnceParentsFirst)
+    {
+        const auto root = m_hierarchy->AddNode(AZ::EntityId(1), Translation(0.0f, 0.0f, 0.0f));
+        const auto child = m_hierarchy->AddNode(AZ::EntityId(2), Translation(1.0f, 0.0f, 0.0f), root);
+        const auto unrelated = m_hierarchy->AddNode(AZ::EntityId(3), Translation(5.0f, 0.0f, 0.0f));
+        m_hierarchy->Update();
+
+        m_hierarchy->SetLocalTM(root, Translation(0.0f, 1.0f, 0.0f));
+        m_hierarchy->SetLocalTM(root, Translation(0.0f, 2.0f, 0.0f));
+        m_hierarchy->SetLocalTM(child, Translation(2.0f, 0.0f, 0.0f));
+        m_hierarchy->Update();
+
+        ASSERT_EQ(m_hierarchy->GetChangedNodes().size(), 2u);
+        EXPECT_EQ(m_hierarchy->GetChangedNodes()[0], root);
+        EXPECT_EQ(m_hierarchy->GetChangedNodes()[1], child);
+        EXPECT_THAT(m_hierarchy->GetWorldTM(child).GetTranslation(), IsClose(AZ::Vector3(2.0f, 2.0f, 0.0f)));
+        EXPECT_THAT(m_hierarchy->GetWorldTM(unrelated).GetTranslation(), IsClose(AZ::Vector3(5.0f, 0.0f, 0.0f)));
+
+        m_hierarchy->Update();
+        EXPECT_TRUE(m_hierarchy->GetChangedNodes().empty());
+    }
+
+    TEST_F(TransformHierarchyTests, SetParent_ToLaterNode_OrderIsRestored)
+    {
+        const auto child = m_hierarchy->AddNode(AZ::EntityId(1), Translation(1.0f, 0.0f, 0.0f));
+        const auto parent = m_hierarchy->AddNode(AZ::EntityId(2), Translation(0.0f, 1.0f, 0.0f));
+        EXPECT_TRUE(m_hierarchy->SetParent(child, parent));
+        m_hierarchy->Update();
+
+        EXPECT_EQ(m_hierarchy->GetParent(child), parent);
+        EXPECT_THAT(m_hierarchy->GetWorldTM(child).GetTranslation(), IsClose(AZ::Vector3(1.0f, 1.0f, 0.0f)));
+        ASSERT_EQ(m_hierarchy->GetChangedNodes().size(), 2u);
+        EXPECT_EQ(m_hierarchy->GetChangedNodes()[0], parent);
+    }
+
+    TEST_F(TransformHierarchyTests, SetParent_Cycle_IsRejected)
+    {
+        const auto root = m_hierarchy->AddNode(AZ::EntityId(1), Translation(0.0f, 0.0f, 0.0f));
+        const auto child = m_hierarchy->AddNode(AZ::EntityId(2), Translation(0.0f, 0.0f, 0.0f), root);
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(m_hierarchy->SetParent(root, child));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_EQ(m_hierarchy->GetParent(root), TransformHierarchy::InvalidNodeId);
+    }
+
+    TEST_F(TransformHierarchyTests, RemoveNode_ChildrenKeepWorldTransform)
+    {
+        const auto root = m_hierarchy->AddNode(AZ::EntityId(1), Translation(1.0f, 0.0f, 0.0f));
+        const auto child = m_hierarchy->AddNode(AZ::EntityId(2), Translation(0.0f, 1.0f, 0.0f), root);
+        m_hierarchy->Update();
+
+        m_hierarchy->RemoveNode(root);
+        EXPECT_EQ(m_hierarchy->GetParent(child), TransformHierarchy::InvalidNodeId);
+        m_hierarchy->Update();
+
+        EXPECT_FALSE(m_hierarchy->IsValid(root));
+        EXPECT_EQ(m_hierarchy->GetNodeCount(), 1u);
+        EXPECT_THAT(m_hierarchy->GetLocalTM(child).GetTranslation(), IsClose(AZ::Vector3(1.0f, 1.0f, 0.0f)));
+        EXPECT_THAT(m_hierarchy->GetWorldTM(child).GetTranslation(), IsClose(AZ::Vector3(1.0f, 1.0f, 0.0f)));
+
+        // the removed id is recycled once its slot has been compacted
+        const auto newNode = m_hierarchy->AddNode(AZ::EntityId(3), Translation(0.0f, 0.0f, 0.0f), child);
+        EXPECT_EQ(newNode, root);
+        m_hierarchy->Update();
+        EXPECT_THAT(m_hierarchy->GetWorldTM(newNode).GetTranslation(), IsClose(AZ::Vector3(1.0f, 1.0f, 0.0f)));
+    }
+}
@@ -12,6 +12,7 @@ set(FILES
     Spawnable/SpawnableEntitiesManagerTests.cpp
     Spawnable/SpawnableTests.cpp
     ArchiveCompressionTests.cpp
+    ArchivePerformanceTests.cpp
     ArchiveTests.cpp
     BehaviorEntityTests.cpp
     BinToTextEncode.cpp
@@ -24,6 +25,8 @@ set(FILES
     GenAppDescriptors.cpp
     OctreePerformanceTests.cpp
     OctreeTests.cpp
+    TransformHierarchyPerformanceTests.cpp
+    TransformHierarchyTests.cpp
     AssetCatalog.cpp
     AssetProcessorConnection.cpp
     NativeWindow.cpp
@@ -48,6 +48,10 @@ namespace AzNetworking
         //! Unique identifier of a given compressor.
         virtual CompressorType GetType() const = 0;
 
+        //! Whether packets must be decompressed in the order they were compressed, with none missing.
+        //! Such compressors keep state across packets and can only be used on TCP connections.
+        virtual bool RequiresOrderedDelivery() const { return false; }
+
         //! Returns max possible size of uncompressed data chunk needed to fit compressed data in maxCompSize bytes.
         virtual AZStd::size_t GetMaxChunkSize(AZStd::size_t maxCompSize) const = 0;
 
@@ -32,6 +32,8 @@ namespace AzNetworking
         uint64_t m_sendCompressedPacketsNoGain = 0;
         //! Returns the delta gain of bytes saved (+) or lost (-) due to compression.
         int64_t m_sendBytesCompressedDelta = 0;
+        //! Returns the total number of microseconds spent compressing packets sent on this network interface.
+        AZ::TimeUs m_sendCompressionTimeUs = AZ::Time::ZeroTimeUs;
         //! Returns the numbers of bytes added by encryption.
         uint64_t m_sendBytesEncryptionInflation = 0;
         //! Returns the total number of packets that had to be resent on this network interface due to packet loss.
@@ -44,6 +46,8 @@ namespace AzNetworking
         uint64_t m_recvBytes = 0;
         //! Returns the total number of bytes received on this socket before compression.
         uint64_t m_recvBytesUncompressed = 0;
+        //! Returns the total number of microseconds spent decompressing packets received on this network interface.
+        AZ::TimeUs m_recvDecompressionTimeUs = AZ::Time::ZeroTimeUs;
         //! Returns the total number of packets that were discarded due to timeslice budgets.
         uint64_t m_discardedPackets = 0;
     };
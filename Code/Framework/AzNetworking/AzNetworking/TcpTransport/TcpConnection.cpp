@@ -22,6 +22,13 @@ namespace AzNetworking
 {
     AZ_CVAR(AZ::CVarFixedString, net_TcpCompressor, "MultiplayerCompressor", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "TCP compressor to use."); // WARN: similar to encryption this needs to be set once and only once before creating the network interface
 
+    static AZStd::unique_ptr<ICompressor> CreateTcpCompressor()
+    {
+        const AZ::CVarFixedString compressor = static_cast<AZ::CVarFixedString>(net_TcpCompressor);
+        const AZ::Name compressorName = AZ::Name(compressor);
+        return AZ::Interface<INetworking>::Get()->CreateCompressor(compressorName);
+    }
+
     TcpConnection::TcpConnection
     (
         ConnectionId connectionId,
@@ -36,7 +43,8 @@ namespace AzNetworking
         , m_connectionRole(ConnectionRole::Acceptor)
         , m_registeredSocketFd(InvalidSocketFd)
     {
-        ;
+        // Both ends need a compressor, each direction of the connection is compressed by its sender
+        m_compressor = CreateTcpCompressor();
     }
 
     TcpConnection::TcpConnection
@@ -54,9 +62,7 @@ namespace AzNetworking
         , m_connectionRole(ConnectionRole::Connector)
         , m_registeredSocketFd(InvalidSocketFd)
     {
-        const AZ::CVarFixedString compressor = static_cast<AZ::CVarFixedString>(net_TcpCompressor);
-        const AZ::Name compressorName = AZ::Name(compressor);
-        m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(compressorName);
+        m_compressor = CreateTcpCompressor();
 
         if (useEncryption)
         {
@@ -106,11 +112,16 @@ namespace AzNetworking
             return;
         }
 
+        if (sentBytes <= 0)
+        {
+            // The socket would block, we get another write event once it has drained
+            return;
+        }
+
         m_sendRingbuffer.AdvanceReadBuffer(sentBytes);
-        m_networkInterface.GetMetrics().m_sendBytes += numSendBytes;
-        m_networkInterface.GetMetrics().m_sendBytesUncompressed += numSendBytes;
+        m_networkInterface.GetMetrics().m_sendBytes += sentBytes;
 
-        if (m_socket->IsEncrypted() && sentBytes > 0)
+        if (m_socket->IsEncrypted())
         {
             m_networkInterface.GetMetrics().m_sendBytesEncryptionInflation += (aznumeric_cast<uint32_t>(sentBytes) - numSendBytes);
             m_networkInterface.GetMetrics().m_sendPacketsEncrypted++;
@@ -122,7 +133,9 @@ namespace AzNetworking
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
         GetMetrics().LogPacketRecv(0, startTimeMs);
 
-        // Read new data off the input socket
+        // Read until the socket reports it would block, an edge triggered socket manager won't notify us again about data we leave on the socket.
+        // A short read doesn't mean the socket is drained, a TLS socket returns at most a few records per read.
+        while (m_state != ConnectionState::Disconnected)
         {
             uint8_t* srcData = m_recvRingbuffer.ReserveBlockForWrite(MaxPacketSize);
             if (srcData == nullptr)
@@ -135,8 +148,8 @@ namespace AzNetworking
             const int32_t receivedBytes = m_socket->Receive(srcData, MaxPacketSize);
             if (receivedBytes == 0)
             {
-                // No data on the socket, can happen if we're not in select or epoll mode
-                return true;
+                // No more data on the socket
+                break;
             }
 
             const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(receivedBytes);
@@ -147,38 +160,9 @@ namespace AzNetworking
             }
             m_recvRingbuffer.AdvanceWriteBuffer(receivedBytes);
             m_networkInterface.GetMetrics().m_recvBytes += receivedBytes;
-            m_networkInterface.GetMetrics().m_recvBytesUncompressed += receivedBytes;
-        }
-
-        // Process received packets
-        for (;;)
-        {
-            TcpPacketHeader header(PacketType(0), 0);
-            TcpPacketEncodingBuffer buffer;
-
-            if (!ReceivePacketInternal(header, buffer, startTimeMs))
-            {
-                break;
-            }
-
-            NetworkOutputSerializer serializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
-            if (m_state == ConnectionState::Connecting)
-            {
-                const ConnectResult connectResult = m_networkInterface.GetConnectionListener().ValidateConnect(GetRemoteAddress(), header, serializer);
-                if (connectResult == ConnectResult::Rejected)
-                {
-                    Disconnect(DisconnectReason::ConnectionRejected, TerminationEndpoint::Local);
-                }
-                else
-                {
-                    m_state = ConnectionState::Connected;
-                }
-            }
 
-            if (m_state == ConnectionState::Connected)
-            {
-                m_networkInterface.GetConnectionListener().OnPacketReceived(this, header, serializer);
-            }
+            // Dispatch what we have so far to free up ringbuffer space for the next read
+            DispatchReceivedPackets(startTimeMs);
         }
 
         m_networkInterface.GetMetrics().m_recvTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
@@ -258,10 +242,12 @@ namespace AzNetworking
         int32_t payloadSize = aznumeric_cast<int32_t>(payloadBuffer.GetSize());
         bool shouldCompress = m_compressor && packetType != aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket);
 
-        // Create and serialize header...
+        // Create and serialize header, the size it carries is the size of the payload as sent, after compression.
+        // The serialized header has the same size whatever the payload size, so it is written again once the payload is compressed.
         TcpPacketEncodingBuffer headerBuffer;
+        auto serializeHeader = [packetType, shouldCompress, &headerBuffer](int32_t packetSize)
         {
-            TcpPacketHeader header(packetType, aznumeric_cast<uint16_t>(payloadBuffer.GetSize()));
+            TcpPacketHeader header(packetType, aznumeric_cast<uint16_t>(packetSize));
             header.SetPacketFlag(PacketFlag::Compressed, shouldCompress);
             NetworkInputSerializer serializer(headerBuffer.GetBuffer(), static_cast<uint32_t>(headerBuffer.GetCapacity()));
             if (!header.Serialize(serializer))
@@ -269,12 +255,22 @@ namespace AzNetworking
                 return false;
             }
             headerBuffer.Resize(serializer.GetSize());
+            return true;
+        };
+        if (!serializeHeader(payloadSize))
+        {
+            return false;
         }
 
         const uint16_t headerSize = aznumeric_cast<uint16_t>(headerBuffer.GetSize());
         const uint8_t* srcData = reinterpret_cast<const uint8_t*>(payloadBuffer.GetBuffer());
-        uint8_t* dstData = reinterpret_cast<uint8_t*>(m_sendRingbuffer.ReserveBlockForWrite(headerSize + payloadSize));
 
+        // Reserve ringbuffer space for the whole packet before compressing, a streaming compressor must only advance for packets that go out.
+        // Nothing else touches the send ringbuffer until this packet is queued, so the reserved block stays valid across the direct send.
+        const uint32_t maxPayloadSize = shouldCompress
+            ? aznumeric_cast<uint32_t>(m_compressor->GetMaxCompressedBufferSize(payloadBuffer.GetSize()))
+            : aznumeric_cast<uint32_t>(payloadSize);
+        uint8_t* dstData = m_sendRingbuffer.ReserveBlockForWrite(headerSize + maxPayloadSize);
         if (dstData == nullptr)
         {
             AZLOG_ERROR("Send ringbuffer full, dropped packet");
@@ -283,11 +279,14 @@ namespace AzNetworking
 
         // Compress send data
         TcpPacketEncodingBuffer writeBuffer;
-        if (m_compressor && packetType != aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket))
+        if (shouldCompress)
         {
-            const AZStd::size_t maxSizeNeeded = m_compressor->GetMaxCompressedBufferSize(payloadBuffer.GetSize());
+            // Bounded by the write buffer, which also keeps the compressed size representable in the packet header
+            const AZStd::size_t maxSizeNeeded = AZStd::min(m_compressor->GetMaxCompressedBufferSize(payloadBuffer.GetSize()), writeBuffer.GetCapacity());
             AZStd::size_t compressionMemBytesUsed = 0;
+            const AZ::TimeUs compressStartTimeUs = AZ::GetElapsedTimeUs();
             CompressorError compErr = m_compressor->Compress(payloadBuffer.GetBuffer(), payloadBuffer.GetSize(), writeBuffer.GetBuffer(), maxSizeNeeded, compressionMemBytesUsed);
+            m_networkInterface.GetMetrics().m_sendCompressionTimeUs += AZ::GetElapsedTimeUs() - compressStartTimeUs;
 
             if (compErr != CompressorError::Ok)
             {
@@ -306,25 +305,102 @@ namespace AzNetworking
             writeBuffer.Resize(aznumeric_cast<int32_t>(compressionMemBytesUsed));
             payloadSize = static_cast<uint32_t>(writeBuffer.GetSize());
             srcData = writeBuffer.GetBuffer();
+
+            if (!serializeHeader(payloadSize))
+            {
+                return false;
+            }
         }
 
-        // Copy the header data to the ring buffer
+        const SocketSendBuffer sendBuffers[] =
+        {
+            { headerBuffer.GetBuffer(), headerSize },
+            { srcData, aznumeric_cast<uint32_t>(payloadSize) }
+        };
+        const uint32_t packetSize = aznumeric_cast<uint32_t>(headerSize + payloadSize);
+
+        // If nothing is queued ahead of this packet, write the header and payload straight to the socket with a single gathered send
+        // instead of copying them to the send ringbuffer first. TLS keeps using the ringbuffer, SSL_write needs the same buffer on retry.
+        const bool sendDirect = (m_sendRingbuffer.GetReadBufferSize() == 0) && !m_socket->IsEncrypted();
+        uint32_t sentBytes = 0;
+        if (sendDirect)
         {
-            memcpy(dstData, headerBuffer.GetBuffer(), headerSize);
+            const int32_t result = m_socket->SendGathered(sendBuffers, AZ_ARRAY_SIZE(sendBuffers));
+            const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(result);
+            if (disconnectReason != DisconnectReason::MAX)
+            {
+                Disconnect(disconnectReason, TerminationEndpoint::Remote);
+                return false;
+            }
+
+            sentBytes = (result > 0) ? aznumeric_cast<uint32_t>(result) : 0;
+            m_networkInterface.GetMetrics().m_sendBytes += sentBytes;
         }
 
-        // Write payload...
+        // Queue whatever the socket didn't accept, it goes out once the socket becomes writable again
+        if (sentBytes < packetSize)
         {
-            memcpy(dstData + headerSize, srcData, payloadSize);
+            uint32_t skipBytes = sentBytes;
+            for (const SocketSendBuffer& sendBuffer : sendBuffers)
+            {
+                const uint32_t skipped = AZStd::min(skipBytes, sendBuffer.m_size);
+                memcpy(dstData, sendBuffer.m_data + skipped, sendBuffer.m_size - skipped);
+                dstData += sendBuffer.m_size - skipped;
+                skipBytes -= skipped;
+            }
+
+            if (!m_sendRingbuffer.AdvanceWriteBuffer(packetSize - sentBytes))
+            {
+                // Part of the packet may already be on the wire, the peer can't resync the stream
+                AZLOG_ERROR("Send ringbuffer overflow, the stream is corrupt, dropped connection");
+                Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
+                return false;
+            }
         }
 
-        m_sendRingbuffer.AdvanceWriteBuffer(headerSize + payloadSize);
-        GetMetrics().LogPacketSent(headerSize + payloadSize, currentTimeMs);
+        GetMetrics().LogPacketSent(packetSize, currentTimeMs);
         m_networkInterface.GetMetrics().m_sendPackets++;
-        UpdateSend();
+        m_networkInterface.GetMetrics().m_sendBytesUncompressed += headerSize + payloadBuffer.GetSize();
+        if (!sendDirect)
+        {
+            UpdateSend();
+        }
         return true;
     }
 
+    void TcpConnection::DispatchReceivedPackets(AZ::TimeMs currentTimeMs)
+    {
+        for (;;)
+        {
+            TcpPacketHeader header(PacketType(0), 0);
+            TcpPacketEncodingBuffer buffer;
+
+            if (!ReceivePacketInternal(header, buffer, currentTimeMs))
+            {
+                break;
+            }
+
+            NetworkOutputSerializer serializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
+            if (m_state == ConnectionState::Connecting)
+            {
+                const ConnectResult connectResult = m_networkInterface.GetConnectionListener().ValidateConnect(GetRemoteAddress(), header, serializer);
+                if (connectResult == ConnectResult::Rejected)
+                {
+                    Disconnect(DisconnectReason::ConnectionRejected, TerminationEndpoint::Local);
+                }
+                else
+                {
+                    m_state = ConnectionState::Connected;
+                }
+            }
+
+            if (m_state == ConnectionState::Connected)
+            {
+                m_networkInterface.GetConnectionListener().OnPacketReceived(this, header, serializer);
+            }
+        }
+    }
+
     bool TcpConnection::ReceivePacketInternal(TcpPacketHeader& outHeader, TcpPacketEncodingBuffer& outBuffer, AZ::TimeMs currentTimeMs)
     {
         NetworkOutputSerializer serializer(m_recvRingbuffer.GetReadBufferData(), m_recvRingbuffer.GetReadBufferSize());
@@ -333,7 +409,8 @@ namespace AzNetworking
             return false;
         }
 
-        uint16_t packetSize = outHeader.GetPacketSize();
+        // The size of the payload on the wire, which is what the ringbuffer advances by, whether or not it is compressed
+        const uint16_t packetSize = outHeader.GetPacketSize();
         const uint32_t unreadSize = serializer.GetUnreadSize();
         if (packetSize > unreadSize)
         {
@@ -346,26 +423,31 @@ namespace AzNetworking
             // If we can't fit the packet, do not allow the copy to proceed as that would overwrite invalid memory
             return false;
         }
-        outBuffer.Resize(packetSize);
 
         const uint8_t* srcData = serializer.GetUnreadData();
-        if (m_compressor && outHeader.IsPacketFlagSet(PacketFlag::Compressed))
+        if (outHeader.IsPacketFlagSet(PacketFlag::Compressed))
         {
-            if (!DecompressPacket(srcData, packetSize, outBuffer))
+            const AZ::TimeUs decompressStartTimeUs = AZ::GetElapsedTimeUs();
+            const bool decompressed = DecompressPacket(srcData, packetSize, outBuffer);
+            m_networkInterface.GetMetrics().m_recvDecompressionTimeUs += AZ::GetElapsedTimeUs() - decompressStartTimeUs;
+            if (!decompressed)
             {
+                // The payload can't be read, and skipping it would desync a streaming compressor, the stream can't be recovered
                 AZLOG_WARN("Failed to decompress packet!");
+                Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
                 return false;
             }
-            srcData = outBuffer.GetBuffer();
-            packetSize = aznumeric_cast<uint16_t>(outBuffer.GetSize());
         }
-
-        uint8_t* dstData = outBuffer.GetBuffer();
-        memcpy(dstData, srcData, packetSize);
+        else
+        {
+            outBuffer.Resize(packetSize);
+            memcpy(outBuffer.GetBuffer(), srcData, packetSize);
+        }
 
         m_recvRingbuffer.AdvanceReadBuffer(serializer.GetReadSize() + packetSize);
         GetMetrics().LogPacketRecv(packetSize, currentTimeMs);
         m_networkInterface.GetMetrics().m_recvPackets++;
+        m_networkInterface.GetMetrics().m_recvBytesUncompressed += serializer.GetReadSize() + outBuffer.GetSize();
         return true;
     }
 
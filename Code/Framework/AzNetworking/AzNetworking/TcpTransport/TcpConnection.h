@@ -111,6 +111,10 @@ namespace AzNetworking
         //! @return boolean true if the packet was transmitted (NOT AN INDICATION OF DELIVERY)
         bool SendPacketInternal(PacketType packetType, TcpPacketEncodingBuffer& payloadBuffer, AZ::TimeMs currentTimeMs);
 
+        //! Dispatches every complete packet in the receive ringbuffer to the connection listener.
+        //! @param currentTimeMs current process time in milliseconds
+        void DispatchReceivedPackets(AZ::TimeMs currentTimeMs);
+
         //! Receives a packet from the connected connection.
         //! @param outHeader      header of the received packet
         //! @param outBuffer      encoded buffer of the received packet
@@ -124,7 +124,11 @@ namespace AzNetworking
             {
                 if (listenPort.m_listenSocket.GetSocketFd() == socketFd)
                 {
-                    HandleSocketAccept((void*)&newConnection, connectionLength, listenPort);
+                    // Accept until the backlog is empty, an edge triggered socket manager reports a burst of new connections only once
+                    while (HandleSocketAccept((void*)&newConnection, connectionLength, listenPort))
+                    {
+                        ;
+                    }
                 }
             };
             m_listenPorts.Visit(visitor);
@@ -174,6 +178,10 @@ namespace AzNetworking
         if (newSocketFd <= SocketFd{ 0 })
         {
             const int32_t error = GetLastNetworkError();
+            if (ErrorIsWouldBlock(error)) // No more pending connections
+            {
+                return false;
+            }
             AZLOG_WARN("Failed to accept incoming connection (%d:%s)", error, GetNetworkErrorDesc(error));
             return false;
         }
@@ -96,6 +96,17 @@ namespace AzNetworking
         return SendInternal(data, size);
     }
 
+    int32_t TcpSocket::SendGathered(const SocketSendBuffer* buffers, uint32_t bufferCount) const
+    {
+        AZ_Assert(bufferCount > 0, "Invalid buffer count for send");
+        AZ_Assert(buffers != nullptr, "NULL buffers pointer passed to send");
+        if (!IsOpen())
+        {
+            return SocketOpResultErrorNotOpen;
+        }
+        return SendGatheredInternal(buffers, bufferCount);
+    }
+
     int32_t TcpSocket::Receive(uint8_t* outData, uint32_t size) const
     {
         AZ_Assert(size > 0, "Invalid data size for receive");
@@ -124,6 +135,23 @@ namespace AzNetworking
         return sentBytes;
     }
 
+    int32_t TcpSocket::SendGatheredInternal(const SocketSendBuffer* buffers, uint32_t bufferCount) const
+    {
+        const int32_t sentBytes = AzNetworking::SendGathered(m_socketFd, buffers, bufferCount);
+
+        if (sentBytes < 0)
+        {
+            const int32_t error = GetLastNetworkError();
+            if (ErrorIsWouldBlock(error)) // Filter would block messages
+            {
+                return 0;
+            }
+            AZLOG_WARN("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+        }
+
+        return sentBytes;
+    }
+
     int32_t TcpSocket::ReceiveInternal(uint8_t* outData, uint32_t size) const
     {
         const int32_t receivedBytes = recv(aznumeric_cast<int32_t>(m_socketFd), (char*)outData, (int32_t)size, 0);
@@ -68,6 +68,12 @@ namespace AzNetworking
         //! @return number of bytes sent, <= 0 on error
         int32_t Send(const uint8_t* data, uint32_t size) const;
 
+        //! Sends several chunks of data to the connected endpoint in order, with a single gathered write where the socket supports it.
+        //! @param buffers     the chunks of data to send
+        //! @param bufferCount the number of chunks to send
+        //! @return number of bytes sent, which may be less than the total size of the chunks, <= 0 on error
+        int32_t SendGathered(const SocketSendBuffer* buffers, uint32_t bufferCount) const;
+
         //! Receives a payload from the TCP socket.
         //! @param outAddress on success, the address of the endpoint that sent the data
         //! @param outData    on success, address to write the received data to
@@ -78,6 +84,7 @@ namespace AzNetworking
     protected:
 
         virtual int32_t SendInternal(const uint8_t* data, uint32_t size) const;
+        virtual int32_t SendGatheredInternal(const SocketSendBuffer* buffers, uint32_t bufferCount) const;
         virtual int32_t ReceiveInternal(uint8_t* outData, uint32_t size) const;
 
         bool BindSocketForListenInternal(uint16_t port);
@@ -28,6 +28,11 @@ namespace AzNetworking
         }
     }
 
+    TcpSocketManager::~TcpSocketManager()
+    {
+        CloseSocket(m_epollFd);
+    }
+
     bool TcpSocketManager::AddSocket(SocketFd socketFd)
     {
         if (socketFd < SocketFd{ 0 })
@@ -36,7 +41,8 @@ namespace AzNetworking
         }
 
         struct epoll_event fdEvents;
-        fdEvents.events = EPOLLIN | EPOLLOUT | EPOLLET;
+        // Edge triggered, connections drain their socket on every read event and only wait for a write event once the socket is full
+        fdEvents.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
         fdEvents.data.fd = static_cast<int32_t>(socketFd);
 
         if (epoll_ctl(static_cast<int32_t>(m_epollFd), EPOLL_CTL_ADD, static_cast<int32_t>(socketFd), &fdEvents) < 0)
@@ -53,14 +59,28 @@ namespace AzNetworking
     bool TcpSocketManager::ClearSocket(SocketFd socketFd)
     {
         ClearSocketHelper(socketFd);
+
+        // Closing the socket would also remove it from the epoll set, but only once every duplicate of the descriptor has been closed
+        if (epoll_ctl(static_cast<int32_t>(m_epollFd), EPOLL_CTL_DEL, static_cast<int32_t>(socketFd), nullptr) < 0)
+        {
+            const int32_t error = GetLastNetworkError();
+            AZLOG_WARN("Call to epoll_ctl to unbind socket failed (%d:%s)", error, GetNetworkErrorDesc(error));
+            return false;
+        }
         return true;
     }
 
     void TcpSocketManager::ProcessEvents(AZ::TimeMs maxBlockMs, const SocketEventCallback& readCallback, const SocketEventCallback& writeCallback)
     {
+        if (m_socketFds.empty())
+        {
+            // There are no available sockets to process
+            return;
+        }
+
         struct epoll_event socketEvents[MaxEpollEvents];
-        const int32_t numEpollEvents = epoll_wait(static_cast<int32_t>(m_epollFd), socketEvents, MaxEpollEvents, -1);
-        if (numEpollEvents < 0)
+        const int32_t numEpollEvents = epoll_wait(static_cast<int32_t>(m_epollFd), socketEvents, MaxEpollEvents, static_cast<int32_t>(maxBlockMs));
+        if (numEpollEvents < 0 && GetLastNetworkError() != EINTR)
         {
             const int32_t error = GetLastNetworkError();
             AZLOG_ERROR("epoll_wait returned an error (%d:%s)", error, GetNetworkErrorDesc(error));
@@ -71,7 +91,8 @@ namespace AzNetworking
             for (int32_t event = 0; event < numEpollEvents; ++event)
             {
                 const SocketFd socketFd = static_cast<SocketFd>(socketEvents[event].data.fd);
-                if (socketEvents[event].events & EPOLLIN)
+                // Hangups and errors are reported as reads, the connection picks up the disconnect from the failed recv
+                if (socketEvents[event].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR))
                 {
                     readCallback(socketFd);
                 }
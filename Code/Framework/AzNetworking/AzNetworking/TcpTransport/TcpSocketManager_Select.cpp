@@ -20,6 +20,11 @@ namespace AzNetworking
         FD_ZERO(&m_writerFdSet);
     }
 
+    TcpSocketManager::~TcpSocketManager()
+    {
+        ;
+    }
+
     bool TcpSocketManager::AddSocket(SocketFd socketFd)
     {
         if (socketFd <= SocketFd{ 0 })
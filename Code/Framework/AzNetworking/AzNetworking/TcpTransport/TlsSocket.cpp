@@ -197,6 +197,26 @@ namespace AzNetworking
 #endif
     }
 
+    int32_t TlsSocket::SendGatheredInternal(const SocketSendBuffer* buffers, uint32_t bufferCount) const
+    {
+        // Records have to go through SSL_write, so write the chunks one after the other and stop at the first partial write
+        int32_t sentBytes = 0;
+        for (uint32_t i = 0; i < bufferCount; ++i)
+        {
+            const int32_t result = SendInternal(buffers[i].m_data, buffers[i].m_size);
+            if (result < 0)
+            {
+                return result;
+            }
+            sentBytes += result;
+            if (aznumeric_cast<uint32_t>(result) < buffers[i].m_size)
+            {
+                break;
+            }
+        }
+        return sentBytes;
+    }
+
     int32_t TlsSocket::ReceiveInternal([[maybe_unused]] uint8_t* outData, [[maybe_unused]] uint32_t size) const
     {
         if (m_sslSocket == nullptr)
@@ -221,6 +241,17 @@ namespace AzNetworking
             // Clean disconnect, force the endpoint to disconnect and cleanup
             return SocketOpResultDisconnected;
         }
+
+        // SSL_read returns a single record, pick up the records OpenSSL already buffered without going back to the socket
+        while ((aznumeric_cast<uint32_t>(receivedBytes) < size) && (SSL_pending(m_sslSocket) > 0))
+        {
+            const int32_t pendingBytes = SSL_read(m_sslSocket, outData + receivedBytes, size - aznumeric_cast<uint32_t>(receivedBytes));
+            if (pendingBytes <= 0)
+            {
+                break;
+            }
+            receivedBytes += pendingBytes;
+        }
         return receivedBytes;
 #else
         return 0;
@@ -53,6 +53,7 @@ namespace AzNetworking
     protected:
 
         int32_t SendInternal(const uint8_t* data, uint32_t size) const override;
+        int32_t SendGatheredInternal(const SocketSendBuffer* buffers, uint32_t bufferCount) const override;
         int32_t ReceiveInternal(uint8_t* outData, uint32_t size) const override;
 
         SSL_CTX* m_sslContext;
@@ -66,6 +66,12 @@ namespace AzNetworking
         const AZ::CVarFixedString compressor = static_cast<AZ::CVarFixedString>(net_UdpCompressor);
         const AZ::Name compressorName = AZ::Name(compressor);
         m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(compressorName);
+        if (m_compressor && m_compressor->RequiresOrderedDelivery())
+        {
+            // Udp packets can be lost or reordered, a compressor keeping history across packets would fail on the first one that is
+            AZLOG_ERROR("Compressor %s requires ordered delivery and can't be used over UDP, packets are sent uncompressed", compressor.c_str());
+            m_compressor.reset();
+        }
     }
 
     UdpNetworkInterface::~UdpNetworkInterface()
@@ -245,7 +251,10 @@ namespace AzNetworking
             if (m_compressor && header.IsPacketFlagSet(PacketFlag::Compressed))
             {
                 // Only the payload is compressed
-                if (!DecompressPacket(decodedPacketData, decodedPacketSize, m_decompressBuffer))
+                const AZ::TimeUs decompressStartTimeUs = AZ::GetElapsedTimeUs();
+                const bool decompressed = DecompressPacket(decodedPacketData, decodedPacketSize, m_decompressBuffer);
+                GetMetrics().m_recvDecompressionTimeUs += AZ::GetElapsedTimeUs() - decompressStartTimeUs;
+                if (!decompressed)
                 {
                     AZLOG_WARN("Failed to decompress packet!");
                     continue;
@@ -579,7 +588,9 @@ namespace AzNetworking
             uint8_t* payload = buffer.GetBuffer() + flagSize;
             const AZStd::size_t maxSizeNeeded = m_compressor->GetMaxCompressedBufferSize(payloadSize);
             AZStd::size_t compressionMemBytesUsed = 0;
+            const AZ::TimeUs compressStartTimeUs = AZ::GetElapsedTimeUs();
             CompressorError compErr = m_compressor->Compress(payload, payloadSize, writeBuffer.GetBuffer() + flagSize, maxSizeNeeded, compressionMemBytesUsed);
+            GetMetrics().m_sendCompressionTimeUs += AZ::GetElapsedTimeUs() - compressStartTimeUs;
 
             if (compErr != CompressorError::Ok)
             {
@@ -17,6 +17,7 @@ namespace AzNetworking
         bool SocketLayerInit();
         bool SocketLayerShutdown();
         bool SetSocketNonBlocking(SocketFd socketFd);
+        int32_t SendGathered(SocketFd socketFd, const SocketSendBuffer* buffers, uint32_t bufferCount);
         void CloseSocket(SocketFd socketFd);
         int32_t GetLastNetworkError();
         bool ErrorIsWouldBlock(int32_t errorCode);
@@ -90,6 +91,11 @@ namespace AzNetworking
         return true;
     }
 
+    int32_t SendGathered(SocketFd socketFd, const SocketSendBuffer* buffers, uint32_t bufferCount)
+    {
+        return Platform::SendGathered(socketFd, buffers, bufferCount);
+    }
+
     void CloseSocket(SocketFd socketFd)
     {
         if (int32_t(socketFd) <= 0)
@@ -36,6 +36,13 @@ namespace AzNetworking
     static const int32_t SocketOpResultErrorNotOpen = -3;
     static const int32_t SocketOpResultErrorNoSsl   = -4;
 
+    //! A contiguous block of memory to write to a socket as part of a gathered send.
+    struct SocketSendBuffer
+    {
+        const uint8_t* m_data = nullptr;
+        uint32_t       m_size = 0;
+    };
+
     //! Returns a valid disconnect reason if the provided socket result requires a disconnect.
     DisconnectReason GetDisconnectReasonForSocketResult(int32_t socketResult);
 
@@ -82,6 +89,13 @@ namespace AzNetworking
     //! @return boolean true on success
     bool SetSocketBufferSizes(SocketFd socketFd, int32_t sendSize, int32_t recvSize);
 
+    //! Writes multiple blocks of memory to a connected socket with a single gathered send (writev or WSASend), without copying them to a contiguous buffer first.
+    //! @param socketFd    identifier of the socket to write to
+    //! @param buffers     the blocks of memory to write, in order
+    //! @param bufferCount the number of blocks of memory to write
+    //! @return number of bytes written, which may be less than the total size of the buffers, < 0 on error
+    int32_t SendGathered(SocketFd socketFd, const SocketSendBuffer* buffers, uint32_t bufferCount);
+
     //! Closes the provided socket.
     //! @param socketFd identifier of socket to close
     void CloseSocket(SocketFd socketFd);
@@ -10,6 +10,7 @@
 #include <AzCore/Console/ILogger.h>
 
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <fcntl.h>
@@ -48,6 +49,21 @@ namespace AzNetworking
             return true;
         }
 
+        int32_t SendGathered(SocketFd socketFd, const SocketSendBuffer* buffers, uint32_t bufferCount)
+        {
+            static constexpr uint32_t MaxGatheredBuffers = 8;
+            AZ_Assert(bufferCount <= MaxGatheredBuffers, "Too many buffers for a single gathered send");
+
+            iovec ioBuffers[MaxGatheredBuffers];
+            bufferCount = AZStd::min(bufferCount, MaxGatheredBuffers);
+            for (uint32_t i = 0; i < bufferCount; ++i)
+            {
+                ioBuffers[i].iov_base = const_cast<uint8_t*>(buffers[i].m_data);
+                ioBuffers[i].iov_len = buffers[i].m_size;
+            }
+            return aznumeric_cast<int32_t>(writev(int32_t(socketFd), ioBuffers, aznumeric_cast<int>(bufferCount)));
+        }
+
         void CloseSocket(SocketFd socketFd)
         {
             close(int32_t(socketFd));
@@ -54,6 +54,27 @@ namespace AzNetworking
             return true;
         }
 
+        int32_t SendGathered(SocketFd socketFd, const SocketSendBuffer* buffers, uint32_t bufferCount)
+        {
+            static constexpr uint32_t MaxGatheredBuffers = 8;
+            AZ_Assert(bufferCount <= MaxGatheredBuffers, "Too many buffers for a single gathered send");
+
+            WSABUF wsaBuffers[MaxGatheredBuffers];
+            bufferCount = AZStd::min(bufferCount, MaxGatheredBuffers);
+            for (uint32_t i = 0; i < bufferCount; ++i)
+            {
+                wsaBuffers[i].buf = reinterpret_cast<CHAR*>(const_cast<uint8_t*>(buffers[i].m_data));
+                wsaBuffers[i].len = buffers[i].m_size;
+            }
+
+            DWORD sentBytes = 0;
+            if (WSASend(int32_t(socketFd), wsaBuffers, bufferCount, &sentBytes, 0, nullptr, nullptr) != SocketOpResultSuccess)
+            {
+                return SocketOpResultError;
+            }
+            return aznumeric_cast<int32_t>(sentBytes);
+        }
+
         void CloseSocket(SocketFd socketFd)
         {
             closesocket(int32_t(socketFd));
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <AzNetworking/TcpTransport/TcpNetworkInterface.h>
+#include <AzNetworking/Framework/NetworkingSystemComponent.h>
+#include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/Time/TimeSystem.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <benchmark/benchmark.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    //! Accepts every connection and counts the packets received over all of them
+    class BenchmarkTcpConnectionListener
+        : public IConnectionListener
+    {
+    public:
+        ConnectResult ValidateConnect([[maybe_unused]] const IpAddress& remoteAddress, [[maybe_unused]] const IPacketHeader& packetHeader, [[maybe_unused]] ISerializer& serializer) override
+        {
+            return ConnectResult::Accepted;
+        }
+
+        void OnConnect([[maybe_unused]] IConnection* connection) override
+        {
+            ;
+        }
+
+        PacketDispatchResult OnPacketReceived([[maybe_unused]] IConnection* connection, [[maybe_unused]] const IPacketHeader& packetHeader, [[maybe_unused]] ISerializer& serializer) override
+        {
+            ++m_receivedPackets;
+            return PacketDispatchResult::Success;
+        }
+
+        void OnPacketLost([[maybe_unused]] IConnection* connection, [[maybe_unused]] PacketId packetId) override
+        {
+            ;
+        }
+
+        void OnDisconnect([[maybe_unused]] IConnection* connection, [[maybe_unused]] DisconnectReason reason, [[maybe_unused]] TerminationEndpoint endpoint) override
+        {
+            ;
+        }
+
+        uint64_t m_receivedPackets = 0;
+    };
+
+    //! A server and a client network interface talking to each other over loopback, ticked the same way the game ticks them.
+    class TcpTransportBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        static constexpr AZ::TimeMs MaxWaitTimeMs = AZ::TimeMs{ 10000 };
+
+        void internalSetUp()
+        {
+            AZ::NameDictionary::Create();
+
+            m_loggerComponent = AZStd::make_unique<AZ::LoggerSystemComponent>();
+            m_timeSystem = AZStd::make_unique<AZ::TimeSystem>();
+            m_networkingSystemComponent = AZStd::make_unique<AzNetworking::NetworkingSystemComponent>();
+        }
+
+        void internalTearDown()
+        {
+            DestroyInterfaces();
+            m_networkingSystemComponent.reset();
+            m_timeSystem.reset();
+            m_loggerComponent.reset();
+
+            AZ::NameDictionary::Destroy();
+        }
+
+        //! Creates the server and client interfaces, each run listens on a new port so the sockets of the previous run lingering in
+        //! TIME_WAIT don't prevent the server from binding.
+        void CreateInterfaces()
+        {
+            INetworking* networking = AZ::Interface<INetworking>::Get();
+            m_serverInterface = networking->CreateNetworkInterface(m_serverName, ProtocolType::Tcp, TrustZone::InternalServerToServer, m_serverListener);
+            m_clientInterface = networking->CreateNetworkInterface(m_clientName, ProtocolType::Tcp, TrustZone::InternalServerToServer, m_clientListener);
+            m_port = (m_port >= 33000) ? uint16_t(32000) : static_cast<uint16_t>(m_port + 1);
+            m_serverInterface->Listen(m_port);
+            m_serverListener.m_receivedPackets = 0;
+        }
+
+        void DestroyInterfaces()
+        {
+            if (m_serverInterface != nullptr)
+            {
+                AZ::Interface<INetworking>::Get()->DestroyNetworkInterface(m_clientName);
+                AZ::Interface<INetworking>::Get()->DestroyNetworkInterface(m_serverName);
+                m_serverInterface = nullptr;
+                m_clientInterface = nullptr;
+            }
+        }
+
+        //! Opens connectionCount connections from the client to the server, returns false if they didn't all get accepted in time
+        bool Connect(uint32_t connectionCount)
+        {
+            for (uint32_t i = 0; i < connectionCount; ++i)
+            {
+                m_lastConnectionId = m_clientInterface->Connect(IpAddress(127, 0, 0, 1, m_port));
+                if (m_lastConnectionId == InvalidConnectionId)
+                {
+                    return false;
+                }
+            }
+            return TickUntil([this, connectionCount]()
+                {
+                    return m_serverInterface->GetConnectionSet().GetConnectionCount() == connectionCount;
+                });
+        }
+
+        template <typename PREDICATE>
+        bool TickUntil(const PREDICATE& predicate)
+        {
+            const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+            while (!predicate())
+            {
+                if (AZ::GetElapsedTimeMs() - startTimeMs > MaxWaitTimeMs)
+                {
+                    return false;
+                }
+                m_networkingSystemComponent->OnTick(0.0f, AZ::ScriptTimePoint());
+            }
+            return true;
+        }
+
+        AZStd::unique_ptr<AZ::LoggerSystemComponent> m_loggerComponent;
+        AZStd::unique_ptr<AZ::TimeSystem> m_timeSystem;
+        AZStd::unique_ptr<AzNetworking::NetworkingSystemComponent> m_networkingSystemComponent;
+
+        AZ::Name m_serverName = AZ::Name(AZStd::string_view("TcpBenchmarkServer"));
+        AZ::Name m_clientName = AZ::Name(AZStd::string_view("TcpBenchmarkClient"));
+        BenchmarkTcpConnectionListener m_serverListener;
+        BenchmarkTcpConnectionListener m_clientListener;
+        INetworkInterface* m_serverInterface = nullptr;
+        INetworkInterface* m_clientInterface = nullptr;
+        ConnectionId m_lastConnectionId = InvalidConnectionId;
+        uint16_t m_port = 32000;
+    };
+
+    // Streams batches of packets of state.range(0) payload bytes over a single loopback connection
+    BENCHMARK_DEFINE_F(TcpTransportBenchmark, LoopbackThroughput)(benchmark::State& state)
+    {
+        // Small enough for a batch of the largest packets to fit the connection send ringbuffer even if the socket doesn't take any of it
+        static constexpr uint32_t PacketsPerIteration = 64;
+
+        CreateInterfaces();
+        if (!Connect(1))
+        {
+            state.SkipWithError("Failed to establish the loopback connection");
+            return;
+        }
+
+        const ConnectionId connectionId = m_lastConnectionId;
+        CorePackets::InitiateConnectionPacket packet;
+        packet.ModifyHandshakeBuffer().Resize(aznumeric_cast<uint32_t>(state.range(0)));
+        memset(packet.ModifyHandshakeBuffer().GetBuffer(), 0xA5, packet.GetHandshakeBuffer().GetSize());
+
+        uint64_t expectedPackets = m_serverListener.m_receivedPackets;
+        for (auto _ : state)
+        {
+            for (uint32_t i = 0; i < PacketsPerIteration; ++i)
+            {
+                m_clientInterface->SendReliablePacket(connectionId, packet);
+            }
+            expectedPackets += PacketsPerIteration;
+
+            if (!TickUntil([this, expectedPackets]() { return m_serverListener.m_receivedPackets >= expectedPackets; }))
+            {
+                state.SkipWithError("Timed out waiting for the packets to arrive");
+                break;
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * PacketsPerIteration);
+        state.SetBytesProcessed(state.iterations() * PacketsPerIteration * state.range(0));
+        DestroyInterfaces();
+    }
+
+    // Opens state.range(0) loopback connections and waits for the server to have accepted all of them.
+    // Each connection uses two descriptors in this process, the larger runs need the open file limit raised above the default of 1024.
+    BENCHMARK_DEFINE_F(TcpTransportBenchmark, ConnectionCount)(benchmark::State& state)
+    {
+        const uint32_t connectionCount = aznumeric_cast<uint32_t>(state.range(0));
+        for (auto _ : state)
+        {
+            CreateInterfaces();
+            const bool connected = Connect(connectionCount);
+            state.PauseTiming();
+            DestroyInterfaces();
+            state.ResumeTiming();
+
+            if (!connected)
+            {
+                state.SkipWithError("Timed out waiting for the connections to be accepted");
+                break;
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * connectionCount);
+    }
+
+    BENCHMARK_REGISTER_F(TcpTransportBenchmark, LoopbackThroughput)
+        ->ArgName("PayloadBytes")
+        ->Arg(64)
+        ->Arg(1024)
+        ->Arg(8192)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(TcpTransportBenchmark, ConnectionCount)
+        ->ArgName("Connections")
+        ->Arg(64)
+        ->Arg(512)
+        ->Arg(2048)
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(4);
+} // namespace UnitTest
+#endif
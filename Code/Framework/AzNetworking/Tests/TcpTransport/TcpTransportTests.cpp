@@ -7,6 +7,7 @@
  */
 
 #include <AzNetworking/TcpTransport/TcpNetworkInterface.h>
+#include <AzNetworking/Framework/ICompressor.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
 #include <AzCore/Interface/Interface.h>
@@ -92,6 +93,137 @@ namespace UnitTest
         INetworkInterface* m_serverNetworkInterface;
     };
 
+    //! Run length encodes packets and scrambles each one with a key that changes every packet, so like a streaming compressor
+    //! a packet only decompresses if every packet before it on the connection was decompressed, in order.
+    class TestTcpCompressor
+        : public ICompressor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TestTcpCompressor, AZ::SystemAllocator, 0);
+
+        bool Init() override { return true; }
+        CompressorType GetType() const override { return CompressorType(0x7E57u); }
+        bool RequiresOrderedDelivery() const override { return true; }
+        AZStd::size_t GetMaxChunkSize(AZStd::size_t maxCompSize) const override { return maxCompSize / 2; }
+        AZStd::size_t GetMaxCompressedBufferSize(AZStd::size_t uncompSize) const override { return uncompSize * 2; }
+
+        CompressorError Compress(const void* uncompData, AZStd::size_t uncompSize, void* compData, AZStd::size_t compDataSize, AZStd::size_t& compSize) override
+        {
+            const uint8_t* src = static_cast<const uint8_t*>(uncompData);
+            uint8_t* dst = static_cast<uint8_t*>(compData);
+            compSize = 0;
+            for (AZStd::size_t i = 0; i < uncompSize;)
+            {
+                uint8_t runLength = 1;
+                while ((i + runLength < uncompSize) && (runLength < 255) && (src[i + runLength] == src[i]))
+                {
+                    ++runLength;
+                }
+                if (compSize + 2 > compDataSize)
+                {
+                    return CompressorError::InsufficientBuffer;
+                }
+                dst[compSize++] = runLength ^ m_compressKey;
+                dst[compSize++] = src[i] ^ m_compressKey;
+                i += runLength;
+            }
+            ++m_compressKey;
+            return CompressorError::Ok;
+        }
+
+        CompressorError Decompress(const void* compData, AZStd::size_t compDataSize, void* uncompData, AZStd::size_t uncompDataSize, AZStd::size_t& consumedSize, AZStd::size_t& uncompSize) override
+        {
+            const uint8_t* src = static_cast<const uint8_t*>(compData);
+            uint8_t* dst = static_cast<uint8_t*>(uncompData);
+            if (compDataSize % 2 != 0)
+            {
+                return CompressorError::CorruptData;
+            }
+            uncompSize = 0;
+            for (AZStd::size_t i = 0; i < compDataSize; i += 2)
+            {
+                const uint8_t runLength = src[i] ^ m_decompressKey;
+                if ((runLength == 0) || (uncompSize + runLength > uncompDataSize))
+                {
+                    return CompressorError::CorruptData;
+                }
+                memset(dst + uncompSize, src[i + 1] ^ m_decompressKey, runLength);
+                uncompSize += runLength;
+            }
+            consumedSize = compDataSize;
+            ++m_decompressKey;
+            return CompressorError::Ok;
+        }
+
+    private:
+        uint8_t m_compressKey = 0x5A;
+        uint8_t m_decompressKey = 0x5A;
+    };
+
+    class TestTcpCompressorFactory
+        : public ICompressorFactory
+    {
+    public:
+        AZStd::unique_ptr<ICompressor> Create() override
+        {
+            return AZStd::make_unique<TestTcpCompressor>();
+        }
+
+        //! The default value of net_TcpCompressor
+        AZ::Name GetFactoryName() const override
+        {
+            return AZ::Name(AZStd::string_view("MultiplayerCompressor"));
+        }
+    };
+
+    //! Records the payload of every ConnectionHandshakePacket received, and optionally sends it back
+    class PayloadRecordingConnectionListener
+        : public IConnectionListener
+    {
+    public:
+        ConnectResult ValidateConnect([[maybe_unused]] const IpAddress& remoteAddress, [[maybe_unused]] const IPacketHeader& packetHeader, [[maybe_unused]] ISerializer& serializer) override
+        {
+            return ConnectResult::Accepted;
+        }
+
+        void OnConnect([[maybe_unused]] IConnection* connection) override
+        {
+            ;
+        }
+
+        PacketDispatchResult OnPacketReceived(IConnection* connection, const IPacketHeader& packetHeader, ISerializer& serializer) override
+        {
+            if (packetHeader.GetPacketType() != static_cast<PacketType>(CorePackets::PacketType::ConnectionHandshakePacket))
+            {
+                return PacketDispatchResult::Success;
+            }
+
+            CorePackets::ConnectionHandshakePacket packet;
+            EXPECT_TRUE(packet.Serialize(serializer));
+            const UdpPacketEncodingBuffer& payload = packet.GetHandshakeBuffer();
+            m_receivedPayloads.emplace_back(payload.GetBuffer(), payload.GetBuffer() + payload.GetSize());
+            if (m_echo)
+            {
+                EXPECT_TRUE(connection->SendReliablePacket(packet));
+            }
+            return PacketDispatchResult::Success;
+        }
+
+        void OnPacketLost([[maybe_unused]] IConnection* connection, [[maybe_unused]] PacketId packetId) override
+        {
+            ;
+        }
+
+        void OnDisconnect([[maybe_unused]] IConnection* connection, [[maybe_unused]] DisconnectReason reason, [[maybe_unused]] TerminationEndpoint endpoint) override
+        {
+            ++m_disconnectCount;
+        }
+
+        AZStd::vector<AZStd::vector<uint8_t>> m_receivedPayloads;
+        uint32_t m_disconnectCount = 0;
+        bool m_echo = false;
+    };
+
     class TcpTransportTests
         : public AllocatorsFixture
     {
@@ -191,4 +323,112 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    //! A client and a server compressing every packet, the server sends every packet it receives back to the client.
+    class CompressedTcpTransportTests
+        : public TcpTransportTests
+    {
+    public:
+        //! Sends payloads back to back without ticking, so the receiving ends read several packets per socket read, then checks
+        //! that the server and then the client decompressed every one of them in order.
+        void SendAndVerifyEchoed(uint16_t port, const AZStd::vector<AZStd::vector<uint8_t>>& payloads)
+        {
+            // Both ends create their compressors from the factory registered under the name in net_TcpCompressor
+            m_networkingSystemComponent->RegisterCompressorFactory(new TestTcpCompressorFactory());
+
+            INetworking* networking = AZ::Interface<INetworking>::Get();
+            const AZ::Name serverName = AZ::Name(AZStd::string_view("CompressedTcpServer"));
+            const AZ::Name clientName = AZ::Name(AZStd::string_view("CompressedTcpClient"));
+            PayloadRecordingConnectionListener serverListener;
+            PayloadRecordingConnectionListener clientListener;
+            serverListener.m_echo = true;
+            INetworkInterface* serverInterface = networking->CreateNetworkInterface(serverName, ProtocolType::Tcp, TrustZone::ExternalClientToServer, serverListener);
+            INetworkInterface* clientInterface = networking->CreateNetworkInterface(clientName, ProtocolType::Tcp, TrustZone::ExternalClientToServer, clientListener);
+            EXPECT_TRUE(serverInterface->Listen(port));
+            const ConnectionId connectionId = clientInterface->Connect(IpAddress(127, 0, 0, 1, port));
+            EXPECT_NE(connectionId, InvalidConnectionId);
+
+            TickUntil([serverInterface]() { return serverInterface->GetConnectionSet().GetConnectionCount() == 1; });
+            EXPECT_EQ(serverInterface->GetConnectionSet().GetConnectionCount(), 1);
+
+            for (const AZStd::vector<uint8_t>& payload : payloads)
+            {
+                CorePackets::ConnectionHandshakePacket packet;
+                packet.ModifyHandshakeBuffer().CopyValues(payload.data(), payload.size());
+                EXPECT_TRUE(clientInterface->SendReliablePacket(connectionId, packet));
+            }
+
+            const size_t packetCount = payloads.size();
+            TickUntil([&clientListener, packetCount]() { return clientListener.m_receivedPayloads.size() >= packetCount; });
+
+            EXPECT_EQ(serverListener.m_receivedPayloads, payloads);
+            EXPECT_EQ(clientListener.m_receivedPayloads, payloads);
+            EXPECT_EQ(serverListener.m_disconnectCount, 0);
+            EXPECT_EQ(clientListener.m_disconnectCount, 0);
+
+            networking->DestroyNetworkInterface(clientName);
+            networking->DestroyNetworkInterface(serverName);
+        }
+
+        template <typename PREDICATE>
+        void TickUntil(const PREDICATE& predicate)
+        {
+            constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+            const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+            while (!predicate() && (AZ::GetElapsedTimeMs() - startTimeMs <= TotalIterationTimeMs))
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(5));
+                m_networkingSystemComponent->OnTick(0.0f, AZ::ScriptTimePoint());
+            }
+        }
+    };
+
+    #if AZ_TRAIT_DISABLE_FAILED_NETWORKING_TESTS
+    TEST_F(CompressedTcpTransportTests, DISABLED_TestCompressedPacketsBackToBack)
+    #else
+    TEST_F(CompressedTcpTransportTests, SUITE_sandbox_TestCompressedPacketsBackToBack)
+    #endif // AZ_TRAIT_DISABLE_FAILED_NETWORKING_TESTS
+    {
+        constexpr uint32_t PacketCount = 32;
+
+        // Payloads of different sizes made of runs of bytes, so every packet compresses to a size different from its own
+        AZStd::vector<AZStd::vector<uint8_t>> payloads(PacketCount);
+        for (uint32_t packetIndex = 0; packetIndex < PacketCount; ++packetIndex)
+        {
+            payloads[packetIndex].resize(500 + packetIndex * 97);
+            for (uint32_t i = 0; i < payloads[packetIndex].size(); ++i)
+            {
+                payloads[packetIndex][i] = aznumeric_cast<uint8_t>((i / 16 + packetIndex) & 0xFF);
+            }
+        }
+
+        SendAndVerifyEchoed(12346, payloads);
+    }
+
+    #if AZ_TRAIT_DISABLE_FAILED_NETWORKING_TESTS
+    TEST_F(CompressedTcpTransportTests, DISABLED_TestCompressedBurstDrainedFromSocket)
+    #else
+    TEST_F(CompressedTcpTransportTests, SUITE_sandbox_TestCompressedBurstDrainedFromSocket)
+    #endif // AZ_TRAIT_DISABLE_FAILED_NETWORKING_TESTS
+    {
+        constexpr uint32_t PacketCount = 128;
+        constexpr uint32_t PayloadSize = 1500;
+
+        // Payloads without runs grow to twice their size when compressed. The burst is many times the size of a single socket read,
+        // so with edge triggered epoll every packet only arrives if each readiness edge drains the socket. Whatever part of a packet
+        // the socket doesn't take in the gathered send is queued in the send ringbuffer, behind which the following packets wait.
+        AZStd::vector<AZStd::vector<uint8_t>> payloads(PacketCount);
+        uint32_t seed = 12345;
+        for (AZStd::vector<uint8_t>& payload : payloads)
+        {
+            payload.resize(PayloadSize);
+            for (uint8_t& value : payload)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                value = aznumeric_cast<uint8_t>(seed >> 24);
+            }
+        }
+
+        SendAndVerifyEchoed(12347, payloads);
+    }
 }
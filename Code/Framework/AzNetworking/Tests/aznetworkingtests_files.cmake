@@ -20,6 +20,7 @@ set(FILES
     Serialization/NetworkInputSerializerTests.cpp
     Serialization/NetworkOutputSerializerTests.cpp
     Serialization/TrackChangedSerializerTests.cpp
+    TcpTransport/TcpTransportBenchmarks.cpp
     TcpTransport/TcpTransportTests.cpp
     UdpTransport/UdpTransportTests.cpp
     Utilities/CidrAddressTests.cpp
@@ -1038,6 +1038,8 @@ namespace AzToolsFramework
                         ;
 
                     ec->Class<AzFramework::ScriptComponent>("Script Component", "Adding scripting functionality to the entity!")
+                        ->DataElement(AZ::Edit::UIHandlers::Default, &AzFramework::ScriptComponent::m_isThreadSafe, "Thread-safe",
+                            "The script's OnParallelTick only uses its own state and queues everything else with QueueOnMainThread, so it can run in parallel with other scripts")
                         ->DataElement(nullptr, &AzFramework::ScriptComponent::m_properties, "Properties", "Lua script properties")
                             ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
                         ->DataElement(nullptr, &AzFramework::ScriptComponent::m_script, "Asset", "")
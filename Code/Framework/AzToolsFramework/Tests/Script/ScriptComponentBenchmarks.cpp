@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/Asset/AssetManagerComponent.h>
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/IO/Streamer/StreamerComponent.h>
+#include <AzCore/Memory/MemoryComponent.h>
+#include <AzCore/Script/ScriptAsset.h>
+#include <AzCore/Script/ScriptSystemComponent.h>
+#include <AzCore/Script/ScriptTimePoint.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzFramework/Script/ScriptComponent.h>
+#include <AzFramework/Script/ScriptVMPoolComponent.h>
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Ticks 2000 entities whose thread-safe Lua script runs some simple movement logic in OnParallelTick.
+    //! The argument is the number of pooled script contexts, with 0 all scripts run in the default context on the main thread.
+    class ScriptVMPoolBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        static constexpr size_t EntityCount = 2000;
+
+        void internalSetUp(const benchmark::State& state)
+        {
+            AZ::ComponentApplication::Descriptor appDesc;
+            appDesc.m_memoryBlocksByteSize = 100 * 1024 * 1024;
+            m_app = AZStd::make_unique<AZ::ComponentApplication>();
+            AZ::Entity* systemEntity = m_app->Create(appDesc);
+
+            systemEntity->CreateComponent<AZ::MemoryComponent>();
+            systemEntity->CreateComponent("{CAE3A025-FAC9-4537-B39E-0A800A2326DF}"); // JobManager component
+            systemEntity->CreateComponent<AZ::StreamerComponent>();
+            systemEntity->CreateComponent<AZ::AssetManagerComponent>();
+            systemEntity->CreateComponent<AZ::ScriptSystemComponent>();
+
+            AzFramework::ScriptComponent::CreateDescriptor(); // descriptor is deleted by app
+            AzFramework::ScriptVMPoolComponent::CreateDescriptor(); // descriptor is deleted by app
+
+            AZ::SettingsRegistry::Get()->Set(AzFramework::ScriptVMPoolComponent::ContextCountRegistryKey, aznumeric_cast<AZ::u64>(state.range(0)));
+            systemEntity->CreateComponent<AzFramework::ScriptVMPoolComponent>();
+
+            systemEntity->Init();
+            systemEntity->Activate();
+
+            const AZStd::string script = "local mover = {}\
+                                          function mover:OnActivate()\
+                                            self.x = 0\
+                                            self.y = 0\
+                                            self.angle = 0\
+                                          end\
+                                          function mover:OnParallelTick(deltaTime, timePoint)\
+                                            self.angle = self.angle + deltaTime\
+                                            for i = 1, 16 do\
+                                              self.x = self.x + math.cos(self.angle + i) * deltaTime\
+                                              self.y = self.y + math.sin(self.angle + i) * deltaTime\
+                                            end\
+                                          end\
+                                          return mover;";
+            m_scriptAsset = AZ::Data::AssetManager::Instance().CreateAsset<AZ::ScriptAsset>(AZ::Uuid::CreateRandom());
+            m_scriptAsset.Get()->m_scriptBuffer.insert(m_scriptAsset.Get()->m_scriptBuffer.begin(), script.begin(), script.end());
+            AZ::Data::AssetManagerBus::Broadcast(&AZ::Data::AssetManagerBus::Events::OnAssetReady, m_scriptAsset);
+            m_app->Tick();
+            m_app->TickSystem();
+
+            m_entities.reserve(EntityCount);
+            for (size_t i = 0; i < EntityCount; ++i)
+            {
+                auto entity = AZStd::make_unique<AZ::Entity>();
+                auto* scriptComponent = entity->CreateComponent<AzFramework::ScriptComponent>();
+                scriptComponent->SetScript(m_scriptAsset);
+                scriptComponent->SetThreadSafe(true);
+                entity->Init();
+                entity->Activate();
+                m_entities.push_back(AZStd::move(entity));
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_entities = {};
+            m_scriptAsset = {};
+            m_app->Destroy();
+            m_app.reset();
+        }
+
+        AZStd::unique_ptr<AZ::ComponentApplication> m_app;
+        AZ::Data::Asset<AZ::ScriptAsset> m_scriptAsset;
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> m_entities;
+    };
+
+    BENCHMARK_DEFINE_F(ScriptVMPoolBenchmark, BM_TickThreadSafeScripts)(benchmark::State& state)
+    {
+        const AZ::ScriptTimePoint timePoint;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::TickBus::Broadcast(&AZ::TickEvents::OnTick, 1.0f / 60.0f, timePoint);
+        }
+        state.SetItemsProcessed(state.iterations() * EntityCount);
+    }
+    BENCHMARK_REGISTER_F(ScriptVMPoolBenchmark, BM_TickThreadSafeScripts)
+        ->Arg(0)
+        ->Arg(1)
+        ->Arg(2)
+        ->Arg(4)
+        ->Arg(8)
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+} // namespace Benchmark
+
+#endif // defined(HAVE_BENCHMARK)
@@ -11,7 +11,10 @@
 #include <AzCore/Script/ScriptAsset.h>
 #include <AzCore/Script/ScriptSystemComponent.h>
 #include <AzCore/Script/ScriptContext.h>
+#include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzFramework/Script/ScriptVMPoolComponent.h>
 #include <AzToolsFramework/ToolsComponents/ScriptEditorComponent.h>
 
 #include "EntityTestbed.h"
@@ -29,6 +32,7 @@ namespace UnitTest
     // Global Properties used for Testing
     int mySubValue = 0;
     int myReloadValue = 0;
+    int myParallelTickCount = 0;
 
     class ScriptComponentTest
         : public UnitTest::ScopedAllocatorSetupFixture
@@ -221,4 +225,110 @@ namespace UnitTest
 
         EXPECT_NE(scriptComponent->GetScriptProperty("myNum"), nullptr);
     }
+
+    class ScriptVMPoolTest
+        : public ScriptComponentTest
+    {
+    public:
+        static constexpr AZ::u64 ContextCount = 4;
+
+        void SetUp() override
+        {
+            ScriptComponentTest::SetUp();
+
+            AZ::SettingsRegistry::Get()->Set(ScriptVMPoolComponent::ContextCountRegistryKey, ContextCount);
+
+            ScriptVMPoolComponent::CreateDescriptor(); // descriptor is deleted by app
+            m_vmPoolEntity = AZStd::make_unique<Entity>();
+            m_vmPoolEntity->CreateComponent<ScriptVMPoolComponent>();
+            m_vmPoolEntity->Init();
+            m_vmPoolEntity->Activate();
+        }
+
+        void TearDown() override
+        {
+            m_vmPoolEntity.reset();
+
+            ScriptComponentTest::TearDown();
+        }
+
+        AZStd::unique_ptr<Entity> m_vmPoolEntity;
+    };
+
+    TEST_F(ScriptVMPoolTest, ThreadSafeScripts_AreSpreadOverContexts_AndQueueOnMainThread)
+    {
+        m_behaviorContext->Property("myParallelTickCount", BehaviorValueProperty(&myParallelTickCount));
+        myParallelTickCount = 0;
+
+        // The tick count is only written in the queued function, since the scripts in the other contexts run at the same time.
+        const AZStd::string script = "local parallelTest = {}\
+                                function parallelTest:OnActivate()\
+                                  self.ticks = 0\
+                                end\
+                                function parallelTest:OnParallelTick(deltaTime, timePoint)\
+                                  self.ticks = self.ticks + 1\
+                                  QueueOnMainThread(function() myParallelTickCount = myParallelTickCount + 1 end)\
+                                end\
+                                return parallelTest;";
+        Data::Asset<ScriptAsset> scriptAsset = CreateAndLoadScriptAsset(script);
+
+        constexpr int ThreadSafeEntityCount = 8;
+        AZStd::vector<AZStd::unique_ptr<Entity>> entities;
+        AZStd::unordered_set<ScriptContextId> contextIds;
+        for (int i = 0; i < ThreadSafeEntityCount + 1; ++i)
+        {
+            auto* scriptComponent = entities.emplace_back(AZStd::make_unique<Entity>())->CreateComponent<ScriptComponent>();
+            scriptComponent->SetScript(scriptAsset);
+            // the last script isn't thread-safe, so it's not ticked by the pool
+            scriptComponent->SetThreadSafe(i < ThreadSafeEntityCount);
+            entities.back()->Init();
+            entities.back()->Activate();
+
+            if (scriptComponent->IsThreadSafe())
+            {
+                contextIds.insert(scriptComponent->GetScriptContext()->GetId());
+            }
+            else
+            {
+                EXPECT_EQ(DefaultScriptContextId, scriptComponent->GetScriptContext()->GetId());
+            }
+        }
+        EXPECT_EQ(ContextCount, contextIds.size());
+        EXPECT_EQ(0u, contextIds.count(DefaultScriptContextId));
+
+        m_app.Tick();
+        m_app.Tick();
+        EXPECT_EQ(2 * ThreadSafeEntityCount, myParallelTickCount);
+    }
+
+    TEST_F(ScriptVMPoolTest, ThreadSafeScripts_SendingEBusEventFromParallelTick_AssertsAndSkipsEvent)
+    {
+        m_behaviorContext->Property("myParallelTickCount", BehaviorValueProperty(&myParallelTickCount));
+        myParallelTickCount = 0;
+
+        // The event sent from OnParallelTick is skipped, while the one sent from the queued function on the main thread is allowed.
+        const AZStd::string script = "local parallelTest = {}\
+                                function parallelTest:OnParallelTick(deltaTime, timePoint)\
+                                  local parallelDeltaTime = TickRequestBus.Broadcast.GetTickDeltaTime()\
+                                  QueueOnMainThread(function()\
+                                    if parallelDeltaTime == nil and TickRequestBus.Broadcast.GetTickDeltaTime() ~= nil then\
+                                      myParallelTickCount = myParallelTickCount + 1\
+                                    end\
+                                  end)\
+                                end\
+                                return parallelTest;";
+        Data::Asset<ScriptAsset> scriptAsset = CreateAndLoadScriptAsset(script);
+
+        Entity entity;
+        auto* scriptComponent = entity.CreateComponent<ScriptComponent>();
+        scriptComponent->SetScript(scriptAsset);
+        scriptComponent->SetThreadSafe(true);
+        entity.Init();
+        entity.Activate();
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_app.Tick();
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_EQ(1, myParallelTickCount);
+    }
 } // namespace UnitTest
@@ -724,6 +724,137 @@ namespace UnitTest
         EXPECT_TRUE(actualChildWorldPos == expectedChildLocalPos);
     }
 
+    // Counts the transform changes of a single entity.
+    class TransformChangedCounter
+        : public TransformNotificationBus::Handler
+    {
+    public:
+        explicit TransformChangedCounter(EntityId entityId)
+        {
+            TransformNotificationBus::Handler::BusConnect(entityId);
+        }
+
+        ~TransformChangedCounter() override
+        {
+            TransformNotificationBus::Handler::BusDisconnect();
+        }
+
+        void OnTransformChanged(const Transform& /*local*/, const Transform& world) override
+        {
+            m_lastWorldTM = world;
+            m_count++;
+        }
+
+        Transform m_lastWorldTM = Transform::CreateIdentity();
+        int m_count = 0;
+    };
+
+    TEST_F(TransformComponentHierarchy, ScopedTransformBatch_ParentMoved_ChildUpdatedWhenBatchCloses)
+    {
+        TransformBus::Event(m_childId, &TransformBus::Events::SetParent, m_parentId);
+        TransformBus::Event(m_childId, &TransformBus::Events::SetLocalTranslation, AZ::Vector3(1.0f, 2.0f, 3.0f));
+
+        TransformChangedCounter childCounter(m_childId);
+        {
+            ScopedTransformBatch batch;
+            TransformBus::Event(m_parentId, &TransformBus::Events::SetWorldTranslation, AZ::Vector3(10.0f, 20.0f, 30.0f));
+
+            // the moved entity is up to date, its descendants and all notifications wait for the batch
+            AZ::Vector3 parentWorldPos;
+            TransformBus::EventResult(parentWorldPos, m_parentId, &TransformBus::Events::GetWorldTranslation);
+            EXPECT_THAT(parentWorldPos, IsClose(AZ::Vector3(10.0f, 20.0f, 30.0f)));
+
+            AZ::Vector3 childWorldPos;
+            TransformBus::EventResult(childWorldPos, m_childId, &TransformBus::Events::GetWorldTranslation);
+            EXPECT_THAT(childWorldPos, IsClose(AZ::Vector3(1.0f, 2.0f, 3.0f)));
+            EXPECT_EQ(childCounter.m_count, 0);
+        }
+
+        AZ::Vector3 childWorldPos;
+        TransformBus::EventResult(childWorldPos, m_childId, &TransformBus::Events::GetWorldTranslation);
+        EXPECT_THAT(childWorldPos, IsClose(AZ::Vector3(11.0f, 22.0f, 33.0f)));
+        EXPECT_EQ(childCounter.m_count, 1);
+        EXPECT_THAT(childCounter.m_lastWorldTM.GetTranslation(), IsClose(AZ::Vector3(11.0f, 22.0f, 33.0f)));
+    }
+
+    TEST_F(TransformComponentHierarchy, ScopedTransformBatch_RepeatedMoves_EachEntityNotifiedOnce)
+    {
+        TransformBus::Event(m_childId, &TransformBus::Events::SetParent, m_parentId);
+
+        TransformChangedCounter parentCounter(m_parentId);
+        TransformChangedCounter childCounter(m_childId);
+        {
+            ScopedTransformBatch batch;
+            for (int i = 1; i <= 4; ++i)
+            {
+                const float offset = aznumeric_cast<float>(i);
+                TransformBus::Event(m_parentId, &TransformBus::Events::SetLocalTranslation, AZ::Vector3(offset, 0.0f, 0.0f));
+                TransformBus::Event(m_childId, &TransformBus::Events::SetLocalTranslation, AZ::Vector3(0.0f, offset, 0.0f));
+            }
+
+            // nested batches join the outer one
+            {
+                ScopedTransformBatch nestedBatch;
+                TransformBus::Event(m_parentId, &TransformBus::Events::SetLocalTranslation, AZ::Vector3(5.0f, 0.0f, 0.0f));
+            }
+            EXPECT_EQ(parentCounter.m_count, 0);
+            EXPECT_EQ(childCounter.m_count, 0);
+        }
+
+        EXPECT_EQ(parentCounter.m_count, 1);
+        EXPECT_EQ(childCounter.m_count, 1);
+        EXPECT_THAT(childCounter.m_lastWorldTM.GetTranslation(), IsClose(AZ::Vector3(5.0f, 4.0f, 0.0f)));
+    }
+
+    TEST_F(TransformComponentHierarchy, ScopedTransformBatch_SetWorldTMBelowMovedParent_MatchesUnbatchedMoves)
+    {
+        TransformBus::Event(m_childId, &TransformBus::Events::SetParent, m_parentId);
+
+        const AZ::Transform parentTM = AZ::Transform::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion::CreateRotationZ(0.5f), AZ::Vector3(4.0f, -2.0f, 7.0f));
+        const AZ::Transform childTM = AZ::Transform::CreateTranslation(AZ::Vector3(-3.0f, 6.0f, 1.0f));
+
+        TransformBus::Event(m_parentId, &TransformBus::Events::SetWorldTM, parentTM);
+        TransformBus::Event(m_childId, &TransformBus::Events::SetWorldTM, childTM);
+        AZ::Transform expectedChildLocalTM;
+        TransformBus::EventResult(expectedChildLocalTM, m_childId, &TransformBus::Events::GetLocalTM);
+
+        TransformBus::Event(m_parentId, &TransformBus::Events::SetWorldTM, AZ::Transform::CreateIdentity());
+        TransformBus::Event(m_childId, &TransformBus::Events::SetWorldTM, AZ::Transform::CreateIdentity());
+        {
+            ScopedTransformBatch batch;
+            TransformBus::Event(m_parentId, &TransformBus::Events::SetWorldTM, parentTM);
+            TransformBus::Event(m_childId, &TransformBus::Events::SetWorldTM, childTM);
+        }
+
+        AZ::Transform childWorldTM;
+        TransformBus::EventResult(childWorldTM, m_childId, &TransformBus::Events::GetWorldTM);
+        AZ::Transform childLocalTM;
+        TransformBus::EventResult(childLocalTM, m_childId, &TransformBus::Events::GetLocalTM);
+        EXPECT_THAT(childWorldTM, IsClose(childTM));
+        EXPECT_THAT(childLocalTM, IsClose(expectedChildLocalTM));
+    }
+
+    TEST_F(TransformComponentHierarchy, ScopedTransformBatch_ChildDeactivatedBeforeFlush_NotNotified)
+    {
+        TransformBus::Event(m_childId, &TransformBus::Events::SetParent, m_parentId);
+
+        TransformChangedCounter childCounter(m_childId);
+        {
+            ScopedTransformBatch batch;
+            TransformBus::Event(m_childId, &TransformBus::Events::SetLocalTranslation, AZ::Vector3(1.0f, 0.0f, 0.0f));
+
+            // deactivating a batched entity applies the pending moves first
+            m_childEntity->Deactivate();
+            EXPECT_EQ(childCounter.m_count, 1);
+
+            TransformBus::Event(m_parentId, &TransformBus::Events::SetLocalTranslation, AZ::Vector3(0.0f, 1.0f, 0.0f));
+        }
+
+        EXPECT_EQ(childCounter.m_count, 1);
+        m_childEntity->Activate();
+    }
+
     // Fixture provides TransformComponent that is static (or not static) on an entity that has been activated.
     template<bool IsStatic>
     class StaticOrMovableTransformComponent
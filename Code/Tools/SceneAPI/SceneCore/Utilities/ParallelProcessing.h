@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/Debug/Trace.h>
+#include <SceneAPI/SceneCore/Utilities/Reporting.h>
+
+namespace AZ
+{
+    namespace SceneAPI
+    {
+        namespace Utilities
+        {
+            // Calls function(index) for every index in [0, count) spread over the job system and returns once all calls have finished.
+            //      Use it for work on independent parts of the scene, like one call per mesh node or per mesh group. The function is
+            //      called concurrently so it may read the scene graph, but can only write to data owned by its index. Nodes have to be
+            //      added to the graph after the parallel part, usually in index order so the resulting graph doesn't depend on timing.
+            //      Falls back to calling function on the calling thread if there's no job system or only a single index.
+            template<typename Function>
+            void ParallelForEachIndex(size_t count, const Function& function)
+            {
+                if (count == 0)
+                {
+                    return;
+                }
+                if (count == 1 || AZ::JobContext::GetGlobalContext() == nullptr)
+                {
+                    for (size_t index = 0; index < count; ++index)
+                    {
+                        function(index);
+                    }
+                    return;
+                }
+
+                AZ::parallel_for(size_t(0), count, [&function](int index)
+                {
+                    function(static_cast<size_t>(index));
+                });
+            }
+
+            // Writes the time between construction and destruction to the log window, used to report the duration of the
+            //      phases of scene processing in the builder job log.
+            class ScopedPhaseTimer
+            {
+            public:
+                explicit ScopedPhaseTimer(const char* phaseName)
+                    : m_phaseName(phaseName)
+                    , m_start(AZStd::chrono::high_resolution_clock::now())
+                {
+                }
+
+                ~ScopedPhaseTimer()
+                {
+                    const AZStd::chrono::microseconds duration =
+                        AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::high_resolution_clock::now() - m_start);
+                    AZ_TracePrintf(LogWindow, "Phase '%s' took %.2f ms.\n", m_phaseName, static_cast<double>(duration.count()) / 1000.0);
+                }
+
+                ScopedPhaseTimer(const ScopedPhaseTimer&) = delete;
+                ScopedPhaseTimer& operator=(const ScopedPhaseTimer&) = delete;
+
+            private:
+                const char* m_phaseName;
+                AZStd::chrono::high_resolution_clock::time_point m_start;
+            };
+        } // Utilities
+    } // SceneAPI
+} // AZ
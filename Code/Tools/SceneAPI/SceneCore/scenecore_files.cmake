@@ -129,6 +129,7 @@ set(FILES
     Utilities/FileUtilities.h
     Utilities/FileUtilities.cpp
     Utilities/Reporting.h
+    Utilities/ParallelProcessing.h
     Utilities/PatternMatcher.h
     Utilities/PatternMatcher.cpp
     Utilities/HashHelper.h
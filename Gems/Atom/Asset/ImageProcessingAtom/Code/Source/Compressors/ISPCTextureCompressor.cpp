@@ -7,10 +7,12 @@
  */
 
 
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/function/function_template.h>
 
 #include <Atom/ImageProcessing/ImageObject.h>
 #include <Processing/ImageToProcess.h>
+#include <Processing/ParallelFor.h>
 #include <Processing/PixelFormatInfo.h>
 
 #include <Compressors/ISPCTextureCompressor.h>
@@ -182,68 +184,107 @@ namespace ImageProcessingAtom
             }
         }
 
+        // Get the settings of the destination format, they are shared by all the compression tasks
+        bc6h_enc_settings bc6Settings = {};
+        bc7_enc_settings bc7Settings = {};
+        switch (destinationFormat)
+        {
+        case ePixelFormat_BC3:
+            break;
+        case ePixelFormat_BC6UH:
+        {
+            const auto setProfile = compressionProfile->GetBC6();
+            setProfile(&bc6Settings);
+        }
+        break;
+        case ePixelFormat_BC7:
+        case ePixelFormat_BC7t:
+        {
+            const auto setProfile = compressionProfile->GetBC7(discardAlpha);
+            setProfile(&bc7Settings);
+        }
+        break;
+        default:
+        {
+            // No valid pixel format
+            AZ_Assert(false, "Unhandled pixel format %d", destinationFormat);
+            return nullptr;
+        }
+        break;
+        }
+
         // Allocate the destination image
         IImageObjectPtr destinationImage(sourceImage->AllocateImage(destinationFormat));
 
-        // Compress the images per mip
+        // Split the mips into bands of block rows. The bands of all the mips are compressed in parallel,
+        // so the small mips are compressed while the large ones are still in progress instead of waiting for them.
+        struct CompressionBand
+        {
+            uint32 m_mip;
+            uint32 m_firstBlockRow;
+            uint32 m_blockRowCount;
+        };
+        static constexpr uint32 BlockSize = 4;
+        static constexpr uint32 BlockRowsPerBand = 16;
+
+        AZStd::vector<CompressionBand> bands;
         const uint32 mipCount = destinationImage->GetMipCount();
         for (uint32_t mip = 0; mip < mipCount; mip++)
         {
-            // Create rgba_surface as input
-            uint32 sourcePitch = 0;
-            AZ::u8* sourceImageData = nullptr;
-            sourceImage->GetImagePointer(mip, sourceImageData, sourcePitch);
-            rgba_surface sourceSurface = {};
+            const uint32 blockRowCount = (sourceImage->GetHeight(mip) + BlockSize - 1) / BlockSize;
+            for (uint32 firstBlockRow = 0; firstBlockRow < blockRowCount; firstBlockRow += BlockRowsPerBand)
             {
-                sourceSurface.ptr = sourceImageData;
-                sourceSurface.width = sourceImage->GetWidth(mip);
-                sourceSurface.height = sourceImage->GetHeight(mip);
-                sourceSurface.stride = static_cast<int32_t>(sourcePitch);
+                bands.push_back({ mip, firstBlockRow, AZStd::min(BlockRowsPerBand, blockRowCount - firstBlockRow) });
             }
+        }
 
-            // Get the mip image destination pointer
-            uint32_t destinationPitch = 0;
-            AZ::u8* destinationImageData = nullptr;
-            destinationImage->GetImagePointer(mip, destinationImageData, destinationPitch);
-
-            // Compress with the correct function, depending on the destination format
-            switch (destinationFormat)
-            {
-            case ePixelFormat_BC3:
-                CompressBlocksBC3(&sourceSurface, destinationImageData);
-                break;
-            case ePixelFormat_BC6UH:
-            {
-                // Get the profile setter
-                bc6h_enc_settings settings = {};
-                const auto setProfile = compressionProfile->GetBC6();
-                setProfile(&settings);
-
-                // Compress with BC6 half precision
-                CompressBlocksBC6H(&sourceSurface, destinationImageData, &settings);
-            }
-            break;
-            case ePixelFormat_BC7:
-            case ePixelFormat_BC7t:
-            {
-                // Get the profile setter
-                bc7_enc_settings settings = {};
-                const auto setProfile = compressionProfile->GetBC7(discardAlpha);
-                setProfile(&settings);
-
-                // Compress with BC7
-                CompressBlocksBC7(&sourceSurface, destinationImageData, &settings);
-            }
-            break;
-            default:
+        ParallelForRanges(aznumeric_cast<uint32>(bands.size()), 1, [&](uint32 bandBegin, uint32 bandEnd)
+        {
+            for (uint32 bandIndex = bandBegin; bandIndex < bandEnd; ++bandIndex)
             {
-                // No valid pixel format
-                AZ_Assert(false, "Unhandled pixel format %d", destinationFormat);
-                return nullptr;
-            }
-            break;
+                const CompressionBand& band = bands[bandIndex];
+                const uint32 firstRow = band.m_firstBlockRow * BlockSize;
+                const uint32 mipHeight = sourceImage->GetHeight(band.m_mip);
+
+                // Create rgba_surface over the rows of the band as input
+                uint32 sourcePitch = 0;
+                AZ::u8* sourceImageData = nullptr;
+                sourceImage->GetImagePointer(band.m_mip, sourceImageData, sourcePitch);
+                rgba_surface sourceSurface = {};
+                {
+                    sourceSurface.ptr = sourceImageData + firstRow * sourcePitch;
+                    sourceSurface.width = sourceImage->GetWidth(band.m_mip);
+                    sourceSurface.height = AZStd::min(firstRow + band.m_blockRowCount * BlockSize, mipHeight) - firstRow;
+                    sourceSurface.stride = static_cast<int32_t>(sourcePitch);
+                }
+
+                // Get the destination pointer of the band, the pitch of compressed images is the size of a row of blocks
+                uint32_t destinationPitch = 0;
+                AZ::u8* destinationImageData = nullptr;
+                destinationImage->GetImagePointer(band.m_mip, destinationImageData, destinationPitch);
+                destinationImageData += band.m_firstBlockRow * destinationPitch;
+
+                // Compress with the correct function, depending on the destination format
+                switch (destinationFormat)
+                {
+                case ePixelFormat_BC3:
+                    CompressBlocksBC3(&sourceSurface, destinationImageData);
+                    break;
+                case ePixelFormat_BC6UH:
+                    // Compress with BC6 half precision
+                    CompressBlocksBC6H(&sourceSurface, destinationImageData, &bc6Settings);
+                    break;
+                case ePixelFormat_BC7:
+                case ePixelFormat_BC7t:
+                    // Compress with BC7
+                    CompressBlocksBC7(&sourceSurface, destinationImageData, &bc7Settings);
+                    break;
+                default:
+                    // Validated before compressing
+                    break;
+                }
             }
-        }
+        });
 
         return destinationImage;
     }
@@ -11,6 +11,7 @@
 #include <Processing/ImageFlags.h>
 #include <Processing/ImageObjectImpl.h>
 #include <Processing/ImageToProcess.h>
+#include <Processing/ParallelFor.h>
 #include <Processing/PixelFormatInfo.h>
 
 #include <Compressors/Compressor.h>
@@ -153,7 +154,6 @@ namespace ImageProcessingAtom
         uint32 dstPixelBytes = CPixelFormats::GetInstance().GetPixelFormatInfo(dstFmt)->bitsPerBlock / 8;
 
         const uint32 dwMips = dstImage->GetMipCount();
-        float r, g, b, a;
         for (uint32 dwMip = 0; dwMip < dwMips; ++dwMip)
         {
             uint8* srcPixelBuf;
@@ -165,11 +165,23 @@ namespace ImageProcessingAtom
 
             const uint32 pixelCount = srcImage->GetPixelCount(dwMip);
 
-            for (uint32 i = 0; i < pixelCount; ++i, srcPixelBuf += srcPixelBytes, dstPixelBuf += dstPixelBytes)
+            // the pixel operations are stateless, so the ranges can share them
+            ParallelForRanges(pixelCount, PixelsPerConversionTask, [&](uint32 begin, uint32 end)
             {
-                srcOp->GetRGBA(srcPixelBuf, r, g, b, a);
-                dstOp->SetRGBA(dstPixelBuf, r, g, b, a);
-            }
+                const uint8* srcRangeBuf = srcPixelBuf + begin * srcPixelBytes;
+                uint8* dstRangeBuf = dstPixelBuf + begin * dstPixelBytes;
+                if (ConvertPixelsSimd(srcFmt, srcRangeBuf, dstFmt, dstRangeBuf, end - begin))
+                {
+                    return;
+                }
+
+                float r, g, b, a;
+                for (uint32 i = begin; i < end; ++i, srcRangeBuf += srcPixelBytes, dstRangeBuf += dstPixelBytes)
+                {
+                    srcOp->GetRGBA(srcRangeBuf, r, g, b, a);
+                    dstOp->SetRGBA(dstRangeBuf, r, g, b, a);
+                }
+            });
         }
 
         m_img = dstImage;
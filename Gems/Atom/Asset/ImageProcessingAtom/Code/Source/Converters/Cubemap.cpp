@@ -12,6 +12,7 @@
 #include <Processing/PixelFormatInfo.h>
 #include <Processing/ImageConvert.h>
 #include <Processing/ImageFlags.h>
+#include <Processing/ParallelFor.h>
 
 #include <Compressors/Compressor.h>
 #include <Converters/PixelOperation.h>
@@ -550,10 +551,14 @@ namespace ImageProcessingAtom
         IImageObjectPtr mippedSourceImage(IImageObject::CreateImage(outWidth, outHeight, maxMipCount, srcPixelFormat));
         mippedSourceImage->CopyPropertiesFrom(m_image->Get());
 
-        for (int iSide = 0; iSide < 6; ++iSide)
+        //each face of each mip is written to its own rect, so they are all filtered in parallel
+        ParallelForRanges(6 * maxMipCount, 1, [&](AZ::u32 faceMipBegin, AZ::u32 faceMipEnd)
         {
-            for (int iMip = 0; iMip < (int)maxMipCount; iMip++)
+            for (AZ::u32 faceMip = faceMipBegin; faceMip < faceMipEnd; ++faceMip)
             {
+                const int iSide = faceMip / maxMipCount;
+                const int iMip = faceMip % maxMipCount;
+
                 QRect srcRect;
                 QRect dstRect;
 
@@ -572,7 +577,7 @@ namespace ImageProcessingAtom
                 MipGenType mipGenType = (iMip == 0 ? MipGenType::point : MipGenType::box);
                 FilterImage(mipGenType, MipGenEvalType::sum, 0, 0, m_image->Get(), 0, mippedSourceImage, iMip, &srcRect, &dstRect);
             }
-        }
+        });
 
         //replace the source cubemap with the mipped version
         delete srcCubemap;
@@ -584,25 +589,28 @@ namespace ImageProcessingAtom
         CubemapLayout* dstCubemap = CubemapLayout::CreateCubemapLayout(outImage);
         AZ::u32 dstMipCount = outImage->GetMipCount();
 
-        //filter mip 0 from source to destination
-        for (int iSide = 0; iSide < 6; ++iSide)
+        //filter mip 0 from source to destination, one face per task
+        ParallelForRanges(6, 1, [&](AZ::u32 sideBegin, AZ::u32 sideEnd)
         {
-            QRect srcRect;
-            QRect dstRect;
+            for (AZ::u32 iSide = sideBegin; iSide < sideEnd; ++iSide)
+            {
+                QRect srcRect;
+                QRect dstRect;
 
-            srcRect.setLeft(0);
-            srcRect.setRight(srcFaceSize);
-            srcRect.setTop(iSide * srcFaceSize);
-            srcRect.setBottom((iSide + 1) * srcFaceSize);
+                srcRect.setLeft(0);
+                srcRect.setRight(srcFaceSize);
+                srcRect.setTop(iSide * srcFaceSize);
+                srcRect.setBottom((iSide + 1) * srcFaceSize);
 
-            dstRect.setLeft(0);
-            dstRect.setRight(outFaceSize);
-            dstRect.setTop(iSide * outFaceSize);
-            dstRect.setBottom((iSide + 1) * outFaceSize);
+                dstRect.setLeft(0);
+                dstRect.setRight(outFaceSize);
+                dstRect.setTop(iSide * outFaceSize);
+                dstRect.setBottom((iSide + 1) * outFaceSize);
 
-            FilterImage(m_input->m_textureSetting.m_mipGenType, m_input->m_textureSetting.m_mipGenEval, 0, 0, m_image->Get(), 0,
-                outImage, 0, &srcRect, &dstRect);
-        }
+                FilterImage(m_input->m_textureSetting.m_mipGenType, m_input->m_textureSetting.m_mipGenEval, 0, 0, m_image->Get(), 0,
+                    outImage, 0, &srcRect, &dstRect);
+            }
+        });
 
         CCubeMapProcessor  atiCubemanGen;
         //ATI's cubemap generator to filter the image edges to avoid seam problem
@@ -8,6 +8,7 @@
 
 #include <Atom/ImageProcessing/ImageObject.h>
 #include <Processing/ImageToProcess.h>
+#include <Processing/ParallelFor.h>
 #include <Processing/PixelFormatInfo.h>
 #include <Processing/ImageFlags.h>
 #include <Atom/ImageProcessing/PixelFormats.h>
@@ -25,6 +26,7 @@ namespace ImageProcessingAtom
     // then the original function is called.
     // Otherwise, a value from the table (linearly interpolated)
     // is returned.
+    // The table is filled on construction so compute() can be called from multiple threads.
     template <int TABLE_SIZE>
     class FunctionLookupTable
     {
@@ -34,11 +36,11 @@ namespace ImageProcessingAtom
             , m_xMin(xMin)
             , m_fMaxDiff(maxAllowedDifference)
         {
+            Initialize();
         }
 
-        void Initialize() const
+        void Initialize()
         {
-            m_initialized = true;
             AZ_Assert(m_xMin >= 0.0f, "wrong initial data for m_xMin");
             for (int i = 0; i <= TABLE_SIZE; ++i)
             {
@@ -59,11 +61,6 @@ namespace ImageProcessingAtom
 
             const int i = int(f);
 
-            if (!m_initialized)
-            {
-                Initialize();
-            }
-
             if (i >= TABLE_SIZE)
             {
                 return m_table[TABLE_SIZE];
@@ -113,8 +110,7 @@ namespace ImageProcessingAtom
     private:
         float(* m_fn)(float x);
         float m_xMin;
-        mutable float m_table[TABLE_SIZE + 1];
-        mutable bool m_initialized = false;
+        float m_table[TABLE_SIZE + 1];
         float m_fMaxDiff = 0.0f;
     };
 
@@ -132,6 +128,18 @@ namespace ImageProcessingAtom
     static FunctionLookupTable<1024> s_lutGammaToLinear(GammaToLinear, 0.04045f, 0.00001f);
     static FunctionLookupTable<1024> s_lutLinearToGamma(LinearToGamma, 0.05f, 0.00001f);
 
+    // Applies the function to the red, green and blue channels of R32G32B32A32F pixels, alpha is left untouched
+    template <int TABLE_SIZE>
+    static void ApplyToRGB(const FunctionLookupTable<TABLE_SIZE>& lut, float* pixels, uint32 pixelCount)
+    {
+        for (uint32 i = 0; i < pixelCount; ++i, pixels += 4)
+        {
+            pixels[0] = lut.compute(pixels[0]);
+            pixels[1] = lut.compute(pixels[1]);
+            pixels[2] = lut.compute(pixels[2]);
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////
 
     ///////////////////////////////////////////////////////////////////////////////////
@@ -164,7 +172,6 @@ namespace ImageProcessingAtom
         uint32 dstPixelBytes = CPixelFormats::GetInstance().GetPixelFormatInfo(dstFmt)->bitsPerBlock / 8;
 
         const uint32 dwMips = dstImage->GetMipCount();
-        float r, g, b, a;
         for (uint32 dwMip = 0; dwMip < dwMips; ++dwMip)
         {
             uint8* srcPixelBuf;
@@ -176,18 +183,28 @@ namespace ImageProcessingAtom
 
             const uint32 pixelCount = srcImage->GetPixelCount(dwMip);
 
-            for (uint32 i = 0; i < pixelCount; ++i, srcPixelBuf += srcPixelBytes, dstPixelBuf += dstPixelBytes)
+            ParallelForRanges(pixelCount, PixelsPerConversionTask, [&](uint32 begin, uint32 end)
             {
-                srcOp->GetRGBA(srcPixelBuf, r, g, b, a);
-                if (bDeGamma)
+                const uint8* srcRangeBuf = srcPixelBuf + begin * srcPixelBytes;
+                uint8* dstRangeBuf = dstPixelBuf + begin * dstPixelBytes;
+                const uint32 rangePixelCount = end - begin;
+
+                // convert to float first, then de-gamma the float pixels in place
+                if (!ConvertPixelsSimd(srcFmt, srcRangeBuf, dstFmt, dstRangeBuf, rangePixelCount))
                 {
-                    r = s_lutGammaToLinear.compute(r);
-                    g = s_lutGammaToLinear.compute(g);
-                    b = s_lutGammaToLinear.compute(b);
+                    float r, g, b, a;
+                    for (uint32 i = 0; i < rangePixelCount; ++i, srcRangeBuf += srcPixelBytes)
+                    {
+                        srcOp->GetRGBA(srcRangeBuf, r, g, b, a);
+                        dstOp->SetRGBA(dstRangeBuf + i * dstPixelBytes, r, g, b, a);
+                    }
                 }
 
-                dstOp->SetRGBA(dstPixelBuf, r, g, b, a);
-            }
+                if (bDeGamma)
+                {
+                    ApplyToRGB(s_lutGammaToLinear, reinterpret_cast<float*>(dstRangeBuf), rangePixelCount);
+                }
+            });
         }
 
         m_img = dstImage;
@@ -225,7 +242,6 @@ namespace ImageProcessingAtom
         uint32 pixelBytes = CPixelFormats::GetInstance().GetPixelFormatInfo(srcFmt)->bitsPerBlock / 8;
 
         const uint32 dwMips = srcImage->GetMipCount();
-        float r, g, b, a;
         for (uint32 dwMip = 0; dwMip < dwMips; ++dwMip)
         {
             uint8* srcPixelBuf;
@@ -237,14 +253,29 @@ namespace ImageProcessingAtom
 
             const uint32 pixelCount = srcImage->GetPixelCount(dwMip);
 
-            for (uint32 i = 0; i < pixelCount; ++i, srcPixelBuf += pixelBytes, dstPixelBuf += pixelBytes)
+            ParallelForRanges(pixelCount, PixelsPerConversionTask, [&](uint32 begin, uint32 end)
             {
-                pixelOp->GetRGBA(srcPixelBuf, r, g, b, a);
-                r = s_lutLinearToGamma.compute(r);
-                g = s_lutLinearToGamma.compute(g);
-                b = s_lutLinearToGamma.compute(b);
-                pixelOp->SetRGBA(dstPixelBuf, r, g, b, a);
-            }
+                const uint8* srcRangeBuf = srcPixelBuf + begin * pixelBytes;
+                uint8* dstRangeBuf = dstPixelBuf + begin * pixelBytes;
+
+                // float pixels are processed in place without going through the pixel operation
+                if (srcFmt == ePixelFormat_R32G32B32A32F)
+                {
+                    memcpy(dstRangeBuf, srcRangeBuf, (end - begin) * pixelBytes);
+                    ApplyToRGB(s_lutLinearToGamma, reinterpret_cast<float*>(dstRangeBuf), end - begin);
+                    return;
+                }
+
+                float r, g, b, a;
+                for (uint32 i = begin; i < end; ++i, srcRangeBuf += pixelBytes, dstRangeBuf += pixelBytes)
+                {
+                    pixelOp->GetRGBA(srcRangeBuf, r, g, b, a);
+                    r = s_lutLinearToGamma.compute(r);
+                    g = s_lutLinearToGamma.compute(g);
+                    b = s_lutLinearToGamma.compute(b);
+                    pixelOp->SetRGBA(dstRangeBuf, r, g, b, a);
+                }
+            });
         }
 
         m_img = dstImage;
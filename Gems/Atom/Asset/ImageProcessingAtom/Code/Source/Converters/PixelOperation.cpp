@@ -7,6 +7,7 @@
  */
 
 
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 #include <Processing/ImageObjectImpl.h>
@@ -543,4 +544,62 @@ namespace ImageProcessingAtom
         }
         return nullptr;
     }
+
+    namespace
+    {
+        using AZ::Simd::Vec4;
+
+        // Same result as U8ToF32 for each channel
+        void ConvertR8G8B8A8ToR32G32B32A32F(const uint8* srcBuf, float* dstBuf, uint32 pixelCount, bool opaque)
+        {
+            const Vec4::FloatType maxValue = Vec4::Splat(255.0f);
+            for (uint32 i = 0; i < pixelCount; ++i, srcBuf += 4, dstBuf += 4)
+            {
+                const Vec4::Int32Type channels = Vec4::LoadImmediate(
+                    static_cast<int32_t>(srcBuf[0]), static_cast<int32_t>(srcBuf[1]), static_cast<int32_t>(srcBuf[2]),
+                    opaque ? 255 : static_cast<int32_t>(srcBuf[3]));
+                Vec4::StoreUnaligned(dstBuf, Vec4::Div(Vec4::ConvertToFloat(channels), maxValue));
+            }
+        }
+
+        // Same result as F32ToU8 for each channel. round() rounds halfway cases away from zero, which differs from the
+        // rounding of the SIMD conversions, so the fraction of the clamped value is compared to 0.5 explicitly instead.
+        void ConvertR32G32B32A32FToR8G8B8A8(const float* srcBuf, uint8* dstBuf, uint32 pixelCount, bool opaque)
+        {
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType half = Vec4::Splat(0.5f);
+            const Vec4::FloatType maxValue = Vec4::Splat(255.0f);
+            alignas(16) int32_t channels[4];
+            for (uint32 i = 0; i < pixelCount; ++i, srcBuf += 4, dstBuf += 4)
+            {
+                const Vec4::FloatType scaled = Vec4::Mul(Vec4::Clamp(Vec4::LoadUnaligned(srcBuf), zero, one), maxValue);
+                const Vec4::FloatType floored = Vec4::Floor(scaled);
+                const Vec4::FloatType roundUp = Vec4::And(Vec4::CmpGtEq(Vec4::Sub(scaled, floored), half), one);
+                Vec4::StoreAligned(channels, Vec4::ConvertToInt(Vec4::Add(floored, roundUp)));
+                dstBuf[0] = static_cast<uint8>(channels[0]);
+                dstBuf[1] = static_cast<uint8>(channels[1]);
+                dstBuf[2] = static_cast<uint8>(channels[2]);
+                dstBuf[3] = opaque ? 0xff : static_cast<uint8>(channels[3]);
+            }
+        }
+    }
+
+    bool ConvertPixelsSimd(EPixelFormat srcFmt, const uint8* srcBuf, EPixelFormat dstFmt, uint8* dstBuf, uint32 pixelCount)
+    {
+        const bool isSrc8Bit = srcFmt == ePixelFormat_R8G8B8A8 || srcFmt == ePixelFormat_R8G8B8X8;
+        const bool isDst8Bit = dstFmt == ePixelFormat_R8G8B8A8 || dstFmt == ePixelFormat_R8G8B8X8;
+
+        if (isSrc8Bit && dstFmt == ePixelFormat_R32G32B32A32F)
+        {
+            ConvertR8G8B8A8ToR32G32B32A32F(srcBuf, reinterpret_cast<float*>(dstBuf), pixelCount, srcFmt == ePixelFormat_R8G8B8X8);
+            return true;
+        }
+        if (srcFmt == ePixelFormat_R32G32B32A32F && isDst8Bit)
+        {
+            ConvertR32G32B32A32FToR8G8B8A8(reinterpret_cast<const float*>(srcBuf), dstBuf, pixelCount, dstFmt == ePixelFormat_R8G8B8X8);
+            return true;
+        }
+        return false;
+    }
 } // namespace ImageProcessingAtom
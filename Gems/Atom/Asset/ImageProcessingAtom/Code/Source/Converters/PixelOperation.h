@@ -24,4 +24,9 @@ namespace ImageProcessingAtom
 
     typedef AZStd::shared_ptr<IPixelOperation> IPixelOperationPtr;
     IPixelOperationPtr CreatePixelOperation(EPixelFormat pixelFmt);
+
+    //! Converts pixelCount pixels between 8 bit RGBA and 32 bit float RGBA formats four channels at a time.
+    //! Returns false without touching the destination if there is no SIMD kernel for this pair of formats,
+    //! in which case the pixels need to be converted with the IPixelOperations of the formats.
+    bool ConvertPixelsSimd(EPixelFormat srcFmt, const uint8* srcBuf, EPixelFormat dstFmt, uint8* dstBuf, uint32 pixelCount);
 }// namespace ImageProcessingAtom
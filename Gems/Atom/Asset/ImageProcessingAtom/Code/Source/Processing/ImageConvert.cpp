@@ -11,6 +11,7 @@
 #include <Processing/ImageConvert.h>
 #include <Processing/ImageAssetProducer.h>
 #include <Processing/ImageFlags.h>
+#include <Processing/ParallelFor.h>
 #include <Processing/Utils.h>
 #include <Converters/FIR-Weights.h>
 #include <Converters/Cubemap.h>
@@ -460,6 +461,23 @@ namespace ImageProcessingAtom
         return m_image->GammaToLinearRGBA32F(m_input->m_presetSetting.m_srcColorSpace == ColorSpace::sRGB);
     }
 
+    void FilterMipChain(MipGenType genType, MipGenEvalType evalType, const IImageObjectPtr srcImg, IImageObjectPtr dstImg)
+    {
+        // filter setting for mip map generation
+        const float blurH = 0;
+        const float blurV = 0;
+
+        // every mip is filtered from the top mip of the source image and written to its own buffer,
+        // so the mips don't depend on each other and can be filtered at the same time
+        ParallelForRanges(dstImg->GetMipCount(), 1, [&](uint32 mipBegin, uint32 mipEnd)
+        {
+            for (uint32 mip = mipBegin; mip < mipEnd; mip++)
+            {
+                FilterImage(genType, evalType, blurH, blurV, srcImg, 0, dstImg, mip, nullptr, nullptr);
+            }
+        });
+    }
+
     // mipmap generation
     bool ImageConvertProcess::FillMipmaps()
     {
@@ -495,15 +513,8 @@ namespace ImageProcessingAtom
         // create new new output image with proper side
         IImageObjectPtr outImage(IImageObject::CreateImage(outWidth, outHeight, mipCount, ePixelFormat_R32G32B32A32F));
 
-        // filter setting for mip map generation
-        float blurH = 0;
-        float blurV = 0;
-
         // fill mipmap data for uncompressed output image
-        for (uint32 mip = 0; mip < outImage->GetMipCount(); mip++)
-        {
-            FilterImage(m_input->m_textureSetting.m_mipGenType, m_input->m_textureSetting.m_mipGenEval, blurH, blurV, m_image->Get(), 0, outImage, mip, nullptr, nullptr);
-        }
+        FilterMipChain(m_input->m_textureSetting.m_mipGenType, m_input->m_textureSetting.m_mipGenEval, m_image->Get(), outImage);
 
         // transfer alpha coverage
         if (m_input->m_textureSetting.m_maintainAlphaCoverage)
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/std/algorithm.h>
+
+namespace ImageProcessingAtom
+{
+    //! Amount of pixels converted by each task of the per pixel conversions (pixel format, gamma).
+    //! Large enough for the job overhead to be negligible, small enough to split the mips of an 8K texture over all cores.
+    static constexpr AZ::u32 PixelsPerConversionTask = 64 * 1024;
+
+    //! Splits [0, count) into ranges of grainSize items and calls rangeFunction(begin, end) for each of them, spreading the ranges
+    //! over the job system with AZ::parallel_for. Returns once all the ranges were processed.
+    //! Everything runs on the calling thread when there is a single range, or when there is no job context to run the ranges on.
+    //! rangeFunction is called concurrently, it may only write to data that belongs to its own range.
+    template<class RangeFunction>
+    void ParallelForRanges(AZ::u32 count, AZ::u32 grainSize, const RangeFunction& rangeFunction)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        grainSize = AZStd::max(grainSize, 1u);
+        const AZ::u32 rangeCount = (count + grainSize - 1) / grainSize;
+        if (rangeCount == 1 || AZ::JobContext::GetGlobalContext() == nullptr)
+        {
+            rangeFunction(0u, count);
+            return;
+        }
+
+        AZ::parallel_for(0u, rangeCount, [count, grainSize, &rangeFunction](int range)
+        {
+            const AZ::u32 begin = static_cast<AZ::u32>(range) * grainSize;
+            rangeFunction(begin, AZStd::min(begin + grainSize, count));
+        });
+    }
+} // namespace ImageProcessingAtom
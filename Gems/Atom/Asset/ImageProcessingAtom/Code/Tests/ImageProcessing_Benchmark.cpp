@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <Atom/ImageProcessing/ImageObject.h>
+#include <Processing/ImageConvert.h>
+#include <Processing/ImageFlags.h>
+#include <Processing/ImageToProcess.h>
+
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
+#include <benchmark/benchmark.h>
+
+namespace ImageProcessingAtom
+{
+    //! Runs the steps of the image builder that dominate the processing time (de-gamma, mip generation, gamma and pixel format
+    //! conversion, block compression) over a synthetic texture corpus, with the job system set up the same way as in the asset builders.
+    class ImageProcessingBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        //! Content of the synthetic textures, each one stresses the filters and the compressors differently
+        enum class Pattern : int64_t
+        {
+            Gradient,
+            Noise,
+            Checker
+        };
+
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void internalSetUp(const benchmark::State& state)
+        {
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            AZ::JobManagerDesc jobManagerDesc;
+            for (unsigned int i = 0; i < AZStd::thread::hardware_concurrency(); ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+
+            m_sourceImage = CreateSyntheticImage(aznumeric_cast<AZ::u32>(state.range(0)), static_cast<Pattern>(state.range(1)));
+        }
+
+        void internalTearDown()
+        {
+            m_sourceImage = nullptr;
+
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext.reset();
+            m_jobManager.reset();
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        }
+
+        // Square sRGB R8G8B8A8 image with a single mip, filled with a deterministic pattern
+        static IImageObjectPtr CreateSyntheticImage(AZ::u32 size, Pattern pattern)
+        {
+            IImageObjectPtr image(IImageObject::CreateImage(size, size, 1, ePixelFormat_R8G8B8A8));
+            image->AddImageFlags(EIF_SRGBRead);
+
+            AZ::u8* pixels;
+            AZ::u32 pitch;
+            image->GetImagePointer(0, pixels, pitch);
+
+            AZ::u32 seed = 12345;
+            for (AZ::u32 y = 0; y < size; ++y)
+            {
+                AZ::u8* row = pixels + y * pitch;
+                for (AZ::u32 x = 0; x < size; ++x, row += 4)
+                {
+                    switch (pattern)
+                    {
+                    case Pattern::Gradient:
+                        row[0] = static_cast<AZ::u8>(x * 255 / size);
+                        row[1] = static_cast<AZ::u8>(y * 255 / size);
+                        row[2] = static_cast<AZ::u8>((x + y) * 255 / (2 * size));
+                        row[3] = 255;
+                        break;
+                    case Pattern::Noise:
+                        seed = seed * 1664525u + 1013904223u;
+                        row[0] = static_cast<AZ::u8>(seed >> 24);
+                        row[1] = static_cast<AZ::u8>(seed >> 16);
+                        row[2] = static_cast<AZ::u8>(seed >> 8);
+                        row[3] = static_cast<AZ::u8>(seed);
+                        break;
+                    case Pattern::Checker:
+                    {
+                        const AZ::u8 value = ((x / 8 + y / 8) % 2) ? 255 : 0;
+                        row[0] = value;
+                        row[1] = value;
+                        row[2] = value;
+                        row[3] = 255 - value;
+                    }
+                    break;
+                    }
+                }
+            }
+            return image;
+        }
+
+        static void GenerateMips(ImageToProcess& imageToProcess)
+        {
+            IImageObjectPtr mippedImage(IImageObject::CreateImage(
+                imageToProcess.Get()->GetWidth(0), imageToProcess.Get()->GetHeight(0), UINT32_MAX, ePixelFormat_R32G32B32A32F));
+            FilterMipChain(MipGenType::blackmanHarris, MipGenEvalType::sum, imageToProcess.Get(), mippedImage);
+            imageToProcess.Set(mippedImage);
+        }
+
+        void SetBytesProcessed(benchmark::State& state) const
+        {
+            state.SetBytesProcessed(state.iterations() * m_sourceImage->GetMipBufSize(0));
+        }
+
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+        IImageObjectPtr m_sourceImage;
+    };
+
+    BENCHMARK_DEFINE_F(ImageProcessingBenchmark, GammaToLinear)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            ImageToProcess imageToProcess(m_sourceImage);
+            imageToProcess.GammaToLinearRGBA32F(true);
+            benchmark::DoNotOptimize(imageToProcess.Get());
+        }
+        SetBytesProcessed(state);
+    }
+
+    BENCHMARK_DEFINE_F(ImageProcessingBenchmark, GenerateMips)(benchmark::State& state)
+    {
+        ImageToProcess linearImage(m_sourceImage);
+        linearImage.GammaToLinearRGBA32F(true);
+
+        for (auto _ : state)
+        {
+            ImageToProcess imageToProcess(linearImage.Get());
+            GenerateMips(imageToProcess);
+            benchmark::DoNotOptimize(imageToProcess.Get());
+        }
+        SetBytesProcessed(state);
+    }
+
+    BENCHMARK_DEFINE_F(ImageProcessingBenchmark, LinearToGammaRGBA8)(benchmark::State& state)
+    {
+        ImageToProcess linearImage(m_sourceImage);
+        linearImage.GammaToLinearRGBA32F(true);
+        GenerateMips(linearImage);
+
+        for (auto _ : state)
+        {
+            ImageToProcess imageToProcess(linearImage.Get());
+            imageToProcess.LinearToGamma();
+            imageToProcess.ConvertFormatUncompressed(ePixelFormat_R8G8B8A8);
+            benchmark::DoNotOptimize(imageToProcess.Get());
+        }
+        SetBytesProcessed(state);
+    }
+
+    BENCHMARK_DEFINE_F(ImageProcessingBenchmark, CompressBC7)(benchmark::State& state)
+    {
+        ImageToProcess uncompressedImage(m_sourceImage);
+        uncompressedImage.GammaToLinearRGBA32F(true);
+        GenerateMips(uncompressedImage);
+        uncompressedImage.LinearToGamma();
+        uncompressedImage.ConvertFormatUncompressed(ePixelFormat_R8G8B8A8);
+
+        for (auto _ : state)
+        {
+            ImageToProcess imageToProcess(uncompressedImage.Get());
+            imageToProcess.GetCompressOption().compressQuality = ICompressor::eQuality_Fast;
+            imageToProcess.ConvertFormat(ePixelFormat_BC7);
+            benchmark::DoNotOptimize(imageToProcess.Get());
+        }
+        SetBytesProcessed(state);
+    }
+
+    // All the steps above, in the order the image builder runs them
+    BENCHMARK_DEFINE_F(ImageProcessingBenchmark, FullPipeline)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            ImageToProcess imageToProcess(m_sourceImage);
+            imageToProcess.GammaToLinearRGBA32F(true);
+            GenerateMips(imageToProcess);
+            imageToProcess.LinearToGamma();
+            imageToProcess.ConvertFormatUncompressed(ePixelFormat_R8G8B8A8);
+            imageToProcess.GetCompressOption().compressQuality = ICompressor::eQuality_Fast;
+            imageToProcess.ConvertFormat(ePixelFormat_BC7);
+            benchmark::DoNotOptimize(imageToProcess.Get());
+        }
+        SetBytesProcessed(state);
+    }
+
+    // The corpus: every pattern at a small, a typical and a large texture size
+    static void SyntheticCorpus(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->ArgNames({ "Size", "Pattern" });
+        for (int64_t size : { 512, 2048, 4096 })
+        {
+            for (int64_t pattern = 0; pattern <= static_cast<int64_t>(ImageProcessingBenchmark::Pattern::Checker); ++pattern)
+            {
+                benchmark->Args({ size, pattern });
+            }
+        }
+        benchmark->Unit(benchmark::kMillisecond);
+    }
+
+    BENCHMARK_REGISTER_F(ImageProcessingBenchmark, GammaToLinear)->Apply(SyntheticCorpus);
+    BENCHMARK_REGISTER_F(ImageProcessingBenchmark, GenerateMips)->Apply(SyntheticCorpus);
+    BENCHMARK_REGISTER_F(ImageProcessingBenchmark, LinearToGammaRGBA8)->Apply(SyntheticCorpus);
+    BENCHMARK_REGISTER_F(ImageProcessingBenchmark, CompressBC7)->Apply(SyntheticCorpus);
+    BENCHMARK_REGISTER_F(ImageProcessingBenchmark, FullPipeline)->Apply(SyntheticCorpus);
+} // namespace ImageProcessingAtom
+#endif
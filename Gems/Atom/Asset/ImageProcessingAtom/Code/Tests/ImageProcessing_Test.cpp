@@ -42,6 +42,7 @@
 #include <Compressors/Compressor.h>
 
 #include <Converters/Cubemap.h>
+#include <Converters/PixelOperation.h>
 
 #include <BuilderSettings/BuilderSettingManager.h>
 #include <BuilderSettings/CubemapSettings.h>
@@ -60,6 +61,7 @@
 #include <QIODevice>
 
 #include <array>
+#include <cmath>
 #include <utility>
 
 //Enable generate image files for result of some tests.
@@ -732,6 +734,60 @@ namespace UnitTest
         ASSERT_TRUE(dstImage3->CompareImage(dstImage1));
     }
 
+    TEST_F(ImageProcessingTest, ConvertPixelsSimd_EightBitAndFloatRGBA_MatchesPixelOperations)
+    {
+        // every 8 bit value, and float values around the rounding boundaries and outside of [0, 1]
+        AZStd::vector<uint8> bytes;
+        for (uint32 value = 0; value < 256; ++value)
+        {
+            bytes.push_back(static_cast<uint8>(value));
+        }
+        AZStd::vector<float> floats = { -1.0f, -0.0f, 0.0f, 0.5f / 255.0f, 0.49999997f / 255.0f, 0.5f, 1.0f, 1.5f, 1000.0f };
+        for (uint32 value = 0; value < 255; ++value)
+        {
+            floats.push_back((value + 0.5f) / 255.0f);
+            floats.push_back(std::nextafter((value + 0.5f) / 255.0f, 0.0f));
+        }
+        floats.resize((floats.size() + 3) / 4 * 4, 0.25f);
+
+        for (EPixelFormat format : { ePixelFormat_R8G8B8A8, ePixelFormat_R8G8B8X8 })
+        {
+            IPixelOperationPtr byteOp = CreatePixelOperation(format);
+            IPixelOperationPtr floatOp = CreatePixelOperation(ePixelFormat_R32G32B32A32F);
+
+            // 8 bit to float
+            const uint32 bytePixelCount = aznumeric_cast<uint32>(bytes.size() / 4);
+            AZStd::vector<float> simdFloats(bytes.size());
+            AZStd::vector<float> expectedFloats(bytes.size());
+            ASSERT_TRUE(ConvertPixelsSimd(format, bytes.data(), ePixelFormat_R32G32B32A32F,
+                reinterpret_cast<uint8*>(simdFloats.data()), bytePixelCount));
+            float r, g, b, a;
+            for (uint32 pixel = 0; pixel < bytePixelCount; ++pixel)
+            {
+                byteOp->GetRGBA(&bytes[pixel * 4], r, g, b, a);
+                floatOp->SetRGBA(reinterpret_cast<uint8*>(&expectedFloats[pixel * 4]), r, g, b, a);
+            }
+            EXPECT_EQ(simdFloats, expectedFloats);
+
+            // float to 8 bit
+            const uint32 floatPixelCount = aznumeric_cast<uint32>(floats.size() / 4);
+            AZStd::vector<uint8> simdBytes(floats.size());
+            AZStd::vector<uint8> expectedBytes(floats.size());
+            ASSERT_TRUE(ConvertPixelsSimd(ePixelFormat_R32G32B32A32F, reinterpret_cast<const uint8*>(floats.data()), format,
+                simdBytes.data(), floatPixelCount));
+            for (uint32 pixel = 0; pixel < floatPixelCount; ++pixel)
+            {
+                floatOp->GetRGBA(reinterpret_cast<const uint8*>(&floats[pixel * 4]), r, g, b, a);
+                byteOp->SetRGBA(&expectedBytes[pixel * 4], r, g, b, a);
+            }
+            EXPECT_EQ(simdBytes, expectedBytes);
+        }
+
+        // no kernel for other formats
+        uint8 pixel[16] = {};
+        EXPECT_FALSE(ConvertPixelsSimd(ePixelFormat_R16G16B16A16, pixel, ePixelFormat_R32G32B32A32F, pixel, 1));
+    }
+
     TEST_F(ImageProcessingTest, TestConvertFormatCompressed)
     {
         IImageObjectPtr srcImage;
@@ -7,5 +7,6 @@
 #
 
 set(FILES
+    Tests/ImageProcessing_Benchmark.cpp
     Tests/ImageProcessing_Test.cpp
 )
@@ -15,6 +15,7 @@
 #include <Atom/Feature/Material/MaterialAssignment.h>
 #include <Atom/Feature/TransformService/TransformServiceFeatureProcessor.h>
 #include <Atom/Feature/Mesh/ModelReloaderSystemInterface.h>
+#include <Atom/Feature/Utils/ConcurrentDirtyList.h>
 #include <RayTracing/RayTracingFeatureProcessor.h>
 #include <AzCore/Asset/AssetCommon.h>
 #include <AtomCore/std/parallel/concurrency_checker.h>
@@ -29,6 +30,7 @@ namespace AZ
     {
         class TransformServiceFeatureProcessor;
         class RayTracingFeatureProcessor;
+        class MeshFeatureProcessor;
 
         class ModelDataInstance
         {
@@ -86,6 +88,9 @@ namespace AZ
             void UpdateObjectSrg();
             bool MaterialRequiresForwardPassIblSpecular(Data::Instance<RPI::Material> material) const;
             void SetVisible(bool isVisible);
+            void ConnectMaterialCompiledHandlers();
+            //! Queues this instance to be updated in the next MeshFeatureProcessor::Simulate(). Safe to call from any thread.
+            void QueueForUpdate();
 
             using DrawPacketList = AZStd::vector<RPI::MeshDrawPacket>;
 
@@ -103,8 +108,14 @@ namespace AZ
             AZStd::vector<Data::Instance<RPI::ShaderResourceGroup>> m_objectSrgList;
             AZStd::unique_ptr<MeshLoader> m_meshLoader;
             RPI::Scene* m_scene = nullptr;
+            MeshFeatureProcessor* m_featureProcessor = nullptr;
             RHI::DrawItemSortKey m_sortKey;
 
+            //! Queue this instance for an update whenever one of its materials is compiled with new changes.
+            AZStd::vector<RPI::Material::CompiledEvent::Handler> m_materialCompiledHandlers;
+            //! Link in the MeshFeatureProcessor's list of instances to update in the next Simulate().
+            ConcurrentDirtyListNode<ModelDataInstance> m_updateListNode;
+
             TransformServiceFeatureProcessorInterface::ObjectId m_objectId;
 
             Aabb m_aabb = Aabb::CreateNull();
@@ -121,6 +132,8 @@ namespace AZ
         class MeshFeatureProcessor final
             : public MeshFeatureProcessorInterface
         {
+            friend class ModelDataInstance;
+
         public:
 
             AZ_RTTI(AZ::Render::MeshFeatureProcessor, "{6E3DFA1D-22C7-4738-A3AE-1E10AB88B29B}", MeshFeatureProcessorInterface);
@@ -194,9 +207,21 @@ namespace AZ
             // RPI::SceneNotificationBus::Handler overrides...
             void OnRenderPipelineAdded(RPI::RenderPipelinePtr pipeline) override;
             void OnRenderPipelineRemoved(RPI::RenderPipeline* pipeline) override;
-                        
+
+            //! Updates the object SRG, draw packets, cullable and cull bounds of a mesh, as needed.
+            void UpdateModelData(ModelDataInstance& modelData);
+            //! Erases released meshes that were still referenced by m_updateList.
+            void ErasePendingReleases();
+
             AZStd::concurrency_checker m_meshDataChecker;
             StableDynamicArray<ModelDataInstance> m_modelData;
+            //! Meshes changed since the last Simulate(). Transform, material, LOD and visibility changes add to it from any thread,
+            //! so Simulate() only visits those instead of checking every mesh, which matters in scenes of mostly static meshes.
+            ConcurrentDirtyList<ModelDataInstance, &ModelDataInstance::m_updateListNode> m_updateList;
+            //! The meshes taken from m_updateList in the current Simulate(), kept to reuse the memory.
+            AZStd::vector<ModelDataInstance*> m_meshesToUpdate;
+            //! Released meshes that can't be erased from m_modelData until m_updateList is emptied.
+            AZStd::vector<MeshHandle> m_pendingReleases;
             TransformServiceFeatureProcessor* m_transformService;
             RayTracingFeatureProcessor* m_rayTracingFeatureProcessor = nullptr;
             AZ::RPI::ShaderSystemInterface::GlobalShaderOptionUpdatedEvent::Handler m_handleGlobalShaderOptionUpdate;
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace AZ::Render
+{
+    //! The link an element needs to embed to be added to a ConcurrentDirtyList.
+    //! Copying or moving an element gives the new one an unqueued node, the list only ever links the original.
+    template<typename T>
+    struct ConcurrentDirtyListNode
+    {
+        ConcurrentDirtyListNode() = default;
+        ConcurrentDirtyListNode(const ConcurrentDirtyListNode&) {}
+        ConcurrentDirtyListNode& operator=(const ConcurrentDirtyListNode&) { return *this; }
+
+        T* m_next = nullptr;
+        AZStd::atomic_bool m_isQueued{ false };
+    };
+
+    //! ConcurrentDirtyList collects the elements that changed since they were last processed, so a feature processor with
+    //! many mostly static elements only has to visit the changed ones each frame instead of scanning all of them for dirty flags.
+    //!
+    //! The list is intrusive: each element embeds a ConcurrentDirtyListNode, and must stay at the same address while it's
+    //! queued, like the elements of a StableDynamicArray. Queue() is lock-free and can be called from any thread, adding an
+    //! element at most once until it's taken out again. TakeAll() must only be called by one thread at a time.
+    template<typename T, ConcurrentDirtyListNode<T> T::* NodeMember>
+    class ConcurrentDirtyList
+    {
+    public:
+        ConcurrentDirtyList() = default;
+        ConcurrentDirtyList(const ConcurrentDirtyList&) = delete;
+        ConcurrentDirtyList& operator=(const ConcurrentDirtyList&) = delete;
+
+        //! Adds an element to the list, unless it's already queued.
+        //! @return true if the element was added, false if it was already in the list.
+        bool Queue(T& element);
+
+        //! Returns whether the element is currently in the list.
+        bool IsQueued(const T& element) const;
+
+        //! Returns whether the list is empty. Only a hint if other threads are queueing elements.
+        bool IsEmpty() const;
+
+        //! Moves every queued element to the end of elementsOut and empties the list.
+        //! The elements are marked as not queued, so changes made while they are processed queue them again.
+        //! @return the number of elements taken.
+        size_t TakeAll(AZStd::vector<T*>& elementsOut);
+
+    private:
+        AZStd::atomic<T*> m_head{ nullptr };
+    };
+
+    template<typename T, ConcurrentDirtyListNode<T> T::* NodeMember>
+    bool ConcurrentDirtyList<T, NodeMember>::Queue(T& element)
+    {
+        ConcurrentDirtyListNode<T>& node = element.*NodeMember;
+        if (node.m_isQueued.exchange(true, AZStd::memory_order_acq_rel))
+        {
+            return false;
+        }
+
+        T* head = m_head.load(AZStd::memory_order_relaxed);
+        do
+        {
+            node.m_next = head;
+        } while (!m_head.compare_exchange_weak(head, &element, AZStd::memory_order_release, AZStd::memory_order_relaxed));
+        return true;
+    }
+
+    template<typename T, ConcurrentDirtyListNode<T> T::* NodeMember>
+    bool ConcurrentDirtyList<T, NodeMember>::IsQueued(const T& element) const
+    {
+        return (element.*NodeMember).m_isQueued.load(AZStd::memory_order_acquire);
+    }
+
+    template<typename T, ConcurrentDirtyListNode<T> T::* NodeMember>
+    bool ConcurrentDirtyList<T, NodeMember>::IsEmpty() const
+    {
+        return m_head.load(AZStd::memory_order_acquire) == nullptr;
+    }
+
+    template<typename T, ConcurrentDirtyListNode<T> T::* NodeMember>
+    size_t ConcurrentDirtyList<T, NodeMember>::TakeAll(AZStd::vector<T*>& elementsOut)
+    {
+        // Detaching the whole chain at once means elements are never popped one by one, which avoids the ABA problem.
+        T* element = m_head.exchange(nullptr, AZStd::memory_order_acquire);
+        size_t count = 0;
+        while (element)
+        {
+            ConcurrentDirtyListNode<T>& node = element->*NodeMember;
+            T* next = node.m_next;
+            node.m_next = nullptr;
+            // Clear the flag last, the element can be queued again by another thread right after, which overwrites m_next.
+            node.m_isQueued.store(false, AZStd::memory_order_release);
+            elementsOut.push_back(element);
+            element = next;
+            ++count;
+        }
+        return count;
+    }
+} // namespace AZ::Render
@@ -32,28 +32,44 @@ namespace AZ
             {
                 return color.GetA8() == 0xFF;
             }
+
+            //! Returns whether two opaque primitives can be drawn with the same draw item.
+            bool HasSameDrawState(const PrimitiveBufferEntry& lhs, const PrimitiveBufferEntry& rhs)
+            {
+                return lhs.m_primitiveType == rhs.m_primitiveType &&
+                    lhs.m_depthReadType == rhs.m_depthReadType &&
+                    lhs.m_depthWriteType == rhs.m_depthWriteType &&
+                    lhs.m_faceCullMode == rhs.m_faceCullMode &&
+                    lhs.m_width == rhs.m_width &&
+                    lhs.m_viewProjOverrideIndex == rhs.m_viewProjOverrideIndex;
+            }
+
+            AZStd::atomic<uint64_t> s_nextQueueId{ 1 };
         }
 
         const uint32_t VerticesPerPoint = 1;
         const uint32_t VerticesPerLine = 2;
         const uint32_t VerticesPerTriangle = 3;
 
+        AuxGeomDrawQueue::AuxGeomDrawQueue()
+            : m_queueId(s_nextQueueId.fetch_add(1))
+        {
+        }
+
         int32_t AuxGeomDrawQueue::AddViewProjOverride(const AZ::Matrix4x4& viewProj)
         {
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
-            AuxGeomBufferData& buffer = m_buffers[m_currentBufferIndex];
+            AZStd::lock_guard<AZStd::mutex> lock(m_viewProjOverridesLock);
 
             //the override matrix is pushed an array that persists until the frame is over, so that the matrix can be looked up later
-            buffer.m_viewProjOverrides.push_back(viewProj);
-            return aznumeric_cast<int32_t>(buffer.m_viewProjOverrides.size()) - 1;
+            m_viewProjOverrides.push_back(viewProj);
+            return aznumeric_cast<int32_t>(m_viewProjOverrides.size()) - 1;
         }
 
         int32_t AuxGeomDrawQueue::GetOrAdd2DViewProjOverride()
         {
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
-            AuxGeomBufferData& buffer = m_buffers[m_currentBufferIndex];
+            AZStd::lock_guard<AZStd::mutex> lock(m_viewProjOverridesLock);
 
-            if (buffer.m_2DViewProjOverrideIndex == -1)
+            if (m_2DViewProjOverrideIndex == -1)
             {
                 // matrix to convert 2d normalized screen coordinates (0.0-1.0 window lower-left based coordinates) to post projection space.
                 static float s_Matrix4x4Floats[16] = {
@@ -63,9 +79,10 @@ namespace AZ
                     0.0f,  0.0f, 0.0f, 1.0f};
                 static Matrix4x4 s_proj2D = Matrix4x4::CreateFromRowMajorFloat16(s_Matrix4x4Floats);
 
-                buffer.m_2DViewProjOverrideIndex = AddViewProjOverride(s_proj2D);
+                m_viewProjOverrides.push_back(s_proj2D);
+                m_2DViewProjOverrideIndex = aznumeric_cast<int32_t>(m_viewProjOverrides.size()) - 1;
             }
-            return buffer.m_2DViewProjOverrideIndex;
+            return m_2DViewProjOverrideIndex;
         }
 
         void AuxGeomDrawQueue::SetPointSize(float pointSize)
@@ -587,29 +604,181 @@ namespace AZ
         AuxGeomBufferData* AuxGeomDrawQueue::Commit()
         {
             AZ_PROFILE_SCOPE(AzRender, "AuxGeomDrawQueue: Commit");
-            // get a mutually exclusive lock and then switch to the next buffer, returning a pointer to the current buffer (before the switch)
 
-            // grab the lock
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
+            ClearBufferData(m_committedBufferData);
+
+            int filledBufferIndex = 0;
+            {
+                // Switch the view projection overrides together with the buffers so the override indices of a draw refer to the
+                // overrides of the frame the draw ends up in.
+                AZStd::lock_guard<AZStd::mutex> lock(m_viewProjOverridesLock);
+
+                // switch every thread to its other buffer, draws made from now on go to the next frame
+                filledBufferIndex = m_currentBufferIndex.load();
+                m_currentBufferIndex.store((filledBufferIndex + 1) % NumBuffers);
+
+                m_committedBufferData.m_viewProjOverrides.swap(m_viewProjOverrides);
+                m_committedBufferData.m_2DViewProjOverrideIndex = m_2DViewProjOverrideIndex;
+                m_2DViewProjOverrideIndex = -1;
+            }
+
+            MergeThreadBuffers(filledBufferIndex);
+
+            return &m_committedBufferData;
+        }
+
+        void AuxGeomDrawQueue::MergeThreadBuffers(int bufferIndex)
+        {
+            AZ_PROFILE_SCOPE(AzRender, "AuxGeomDrawQueue: MergeThreadBuffers");
+            AZStd::lock_guard<AZStd::mutex> lock(m_threadBuffersLock);
+
+            // A draw that read the buffer index before the switch may still be writing to the filled buffer, wait for it to finish.
+            // Draws don't block, so this is at most the time of the draws in progress.
+            for (const AZStd::unique_ptr<ThreadBuffer>& threadBuffer : m_threadBuffers)
+            {
+                while (threadBuffer->m_activeWrites.load() != 0)
+                {
+                    AZStd::this_thread::yield();
+                }
+            }
+
+            MergeDynamicPrimitives(bufferIndex);
+
+            for (int drawStyle = 0; drawStyle < DrawStyle_Count; ++drawStyle)
+            {
+                for (const AZStd::unique_ptr<ThreadBuffer>& threadBuffer : m_threadBuffers)
+                {
+                    const AuxGeomBufferData& data = threadBuffer->m_buffers[bufferIndex];
+                    m_committedBufferData.m_opaqueShapes[drawStyle].insert(
+                        m_committedBufferData.m_opaqueShapes[drawStyle].end(), data.m_opaqueShapes[drawStyle].begin(), data.m_opaqueShapes[drawStyle].end());
+                    m_committedBufferData.m_translucentShapes[drawStyle].insert(
+                        m_committedBufferData.m_translucentShapes[drawStyle].end(), data.m_translucentShapes[drawStyle].begin(), data.m_translucentShapes[drawStyle].end());
+                    m_committedBufferData.m_opaqueBoxes[drawStyle].insert(
+                        m_committedBufferData.m_opaqueBoxes[drawStyle].end(), data.m_opaqueBoxes[drawStyle].begin(), data.m_opaqueBoxes[drawStyle].end());
+                    m_committedBufferData.m_translucentBoxes[drawStyle].insert(
+                        m_committedBufferData.m_translucentBoxes[drawStyle].end(), data.m_translucentBoxes[drawStyle].begin(), data.m_translucentBoxes[drawStyle].end());
+                }
+            }
+
+            FreeIdleThreadBuffers(bufferIndex);
+
+            // The filled buffers are empty again by the time the threads switch back to them on the next commit
+            for (const AZStd::unique_ptr<ThreadBuffer>& threadBuffer : m_threadBuffers)
+            {
+                ClearBufferData(threadBuffer->m_buffers[bufferIndex]);
+            }
+        }
 
-            // get a pointer to the buffer we have been filling
-            AuxGeomBufferData* filledBufferData = &m_buffers[m_currentBufferIndex];
+        size_t AuxGeomDrawQueue::GetThreadBufferCount()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_threadBuffersLock);
+            return AZStd::count_if(m_threadBuffers.begin(), m_threadBuffers.end(),
+                [](const AZStd::unique_ptr<ThreadBuffer>& threadBuffer) { return !threadBuffer->m_isFree; });
+        }
 
-            // switch the buffer for future requests to the other buffer
-            m_currentBufferIndex = (m_currentBufferIndex + 1) % NumBuffers;
+        void AuxGeomDrawQueue::MergeDynamicPrimitives(int bufferIndex)
+        {
+            DynamicPrimitiveData& mergedPrimitives = m_committedBufferData.m_primitiveData;
 
-            // Clear the buffers that new requests will get added to
-            ClearCurrentBufferData();
+            size_t vertexCount = 0;
+            size_t indexCount = 0;
+            size_t primitiveCount = 0;
+            for (const AZStd::unique_ptr<ThreadBuffer>& threadBuffer : m_threadBuffers)
+            {
+                const DynamicPrimitiveData& primitives = threadBuffer->m_buffers[bufferIndex].m_primitiveData;
+                vertexCount += primitives.m_vertexBuffer.size();
+                indexCount += primitives.m_indexBuffer.size();
+                primitiveCount += primitives.m_primitiveBuffer.size();
+            }
+            mergedPrimitives.m_vertexBuffer.reserve(AZStd::min(vertexCount, MaxDynamicVertexCount));
+            mergedPrimitives.m_indexBuffer.reserve(indexCount);
+            mergedPrimitives.m_primitiveBuffer.reserve(primitiveCount);
 
-            return filledBufferData;
+            for (const AZStd::unique_ptr<ThreadBuffer>& threadBuffer : m_threadBuffers)
+            {
+                const DynamicPrimitiveData& primitives = threadBuffer->m_buffers[bufferIndex].m_primitiveData;
+                if (mergedPrimitives.m_vertexBuffer.size() + primitives.m_vertexBuffer.size() > MaxDynamicVertexCount)
+                {
+                    AZ_WarningOnce("AuxGeom", false, "Draws of some threads ignored, would exceed maximum allowed index of %d", MaxDynamicVertexCount);
+                    break;
+                }
+
+                const AuxGeomIndex vertexOffset = aznumeric_cast<AuxGeomIndex>(mergedPrimitives.m_vertexBuffer.size());
+                mergedPrimitives.m_vertexBuffer.insert(mergedPrimitives.m_vertexBuffer.end(), primitives.m_vertexBuffer.begin(), primitives.m_vertexBuffer.end());
+
+                for (const PrimitiveBufferEntry& primitive : primitives.m_primitiveBuffer)
+                {
+                    const AuxGeomIndex destinationOffset = aznumeric_cast<AuxGeomIndex>(mergedPrimitives.m_indexBuffer.size());
+                    const AuxGeomIndex* sourceIndices = primitives.m_indexBuffer.data() + primitive.m_indexOffset;
+                    for (AuxGeomIndex index = 0; index < primitive.m_indexCount; ++index)
+                    {
+                        mergedPrimitives.m_indexBuffer.push_back(sourceIndices[index] + vertexOffset);
+                    }
+
+                    // Only join with the entry drawn right before, so primitives drawn without depth test still overlap in draw order.
+                    // The indices of the previous entry always end where the ones of this primitive start.
+                    const bool isOpaque = primitive.m_blendMode == BlendMode_Off;
+                    if (isOpaque && !mergedPrimitives.m_primitiveBuffer.empty())
+                    {
+                        PrimitiveBufferEntry& previous = mergedPrimitives.m_primitiveBuffer.back();
+                        if (previous.m_blendMode == BlendMode_Off && HasSameDrawState(previous, primitive))
+                        {
+                            previous.m_indexCount += primitive.m_indexCount;
+                            continue;
+                        }
+                    }
+
+                    PrimitiveBufferEntry& entry = mergedPrimitives.m_primitiveBuffer.emplace_back(primitive);
+                    entry.m_indexOffset = destinationOffset;
+                    if (isOpaque)
+                    {
+                        // opaque draws aren't depth sorted, so the center isn't used
+                        entry.m_center = AZ::Vector3::CreateZero();
+                    }
+                }
+            }
         }
 
-        void AuxGeomDrawQueue::ClearCurrentBufferData()
+        void AuxGeomDrawQueue::FreeIdleThreadBuffers(int bufferIndex)
         {
-            AZ_PROFILE_SCOPE(AzRender, "AuxGeomDrawQueue: ClearCurrentBufferData");
-            // no need for mutex here, this function is only called from a function holding a lock
-            AuxGeomBufferData& data = m_buffers[m_currentBufferIndex];
+            const int currentBufferIndex = (bufferIndex + 1) % NumBuffers;
+            for (const AZStd::unique_ptr<ThreadBuffer>& threadBuffer : m_threadBuffers)
+            {
+                if (threadBuffer->m_isFree)
+                {
+                    continue;
+                }
+                if (!IsBufferDataEmpty(threadBuffer->m_buffers[bufferIndex]))
+                {
+                    threadBuffer->m_idleCommitCount = 0;
+                    continue;
+                }
+                if (++threadBuffer->m_idleCommitCount < MaxIdleCommits)
+                {
+                    continue;
+                }
+                threadBuffer->m_idleCommitCount = 0;
+
+                // Invalidate the pointer cached by the owning thread before checking for draws in progress. A draw counts itself before
+                // it checks the generation, so either it sees the new generation and looks up its buffers again, or it is seen here.
+                threadBuffer->m_generation.fetch_add(1);
+                if (threadBuffer->m_activeWrites.load() != 0 || !IsBufferDataEmpty(threadBuffer->m_buffers[currentBufferIndex]))
+                {
+                    // The thread drew again, it keeps its buffers and refreshes its cache on its next draw
+                    continue;
+                }
+
+                for (AuxGeomBufferData& data : threadBuffer->m_buffers)
+                {
+                    data = AuxGeomBufferData();
+                }
+                threadBuffer->m_threadId = AZStd::thread_id();
+                threadBuffer->m_isFree = true;
+            }
+        }
 
+        void AuxGeomDrawQueue::ClearBufferData(AuxGeomBufferData& data)
+        {
             DynamicPrimitiveData& primitives = data.m_primitiveData;
             primitives.m_primitiveBuffer.clear();
             primitives.m_vertexBuffer.clear();
@@ -628,6 +797,116 @@ namespace AZ
             data.m_2DViewProjOverrideIndex = -1;
         }
 
+        bool AuxGeomDrawQueue::IsBufferDataEmpty(const AuxGeomBufferData& data)
+        {
+            if (!data.m_primitiveData.m_primitiveBuffer.empty())
+            {
+                return false;
+            }
+            for (int drawStyle = 0; drawStyle < DrawStyle_Count; ++drawStyle)
+            {
+                if (!data.m_opaqueShapes[drawStyle].empty() || !data.m_translucentShapes[drawStyle].empty() ||
+                    !data.m_opaqueBoxes[drawStyle].empty() || !data.m_translucentBoxes[drawStyle].empty())
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        AuxGeomDrawQueue::ThreadBuffer& AuxGeomDrawQueue::GetThreadBuffer(uint32_t& generation, bool skipCache)
+        {
+            // Threads usually draw to only a few queues, so the last ones used are cached per thread to find the buffer without the lock.
+            struct CacheEntry
+            {
+                uint64_t m_queueId = 0;
+                ThreadBuffer* m_threadBuffer = nullptr;
+                uint32_t m_generation = 0;
+            };
+            static constexpr size_t CacheSize = 8;
+            thread_local CacheEntry s_cache[CacheSize];
+            thread_local size_t s_nextCacheEntry = 0;
+
+            CacheEntry* cachedEntry = nullptr;
+            for (CacheEntry& entry : s_cache)
+            {
+                if (entry.m_queueId == m_queueId)
+                {
+                    cachedEntry = &entry;
+                    break;
+                }
+            }
+            if (cachedEntry && !skipCache)
+            {
+                generation = cachedEntry->m_generation;
+                return *cachedEntry->m_threadBuffer;
+            }
+
+            ThreadBuffer* threadBuffer = nullptr;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_threadBuffersLock);
+                const AZStd::thread_id threadId = AZStd::this_thread::get_id();
+                ThreadBuffer* freeBuffer = nullptr;
+                for (const AZStd::unique_ptr<ThreadBuffer>& existingBuffer : m_threadBuffers)
+                {
+                    if (existingBuffer->m_isFree)
+                    {
+                        freeBuffer = freeBuffer ? freeBuffer : existingBuffer.get();
+                    }
+                    else if (existingBuffer->m_threadId == threadId)
+                    {
+                        threadBuffer = existingBuffer.get();
+                        break;
+                    }
+                }
+                if (!threadBuffer)
+                {
+                    // Reuse the buffers released by a thread that stopped drawing, if any
+                    threadBuffer = freeBuffer ? freeBuffer : m_threadBuffers.emplace_back(AZStd::make_unique<ThreadBuffer>()).get();
+                    threadBuffer->m_threadId = threadId;
+                    threadBuffer->m_idleCommitCount = 0;
+                    threadBuffer->m_isFree = false;
+                }
+                generation = threadBuffer->m_generation.load();
+            }
+
+            if (!cachedEntry)
+            {
+                cachedEntry = &s_cache[s_nextCacheEntry];
+                s_nextCacheEntry = (s_nextCacheEntry + 1) % CacheSize;
+                cachedEntry->m_queueId = m_queueId;
+            }
+            cachedEntry->m_threadBuffer = threadBuffer;
+            cachedEntry->m_generation = generation;
+            return *threadBuffer;
+        }
+
+        AuxGeomDrawQueue::ThreadBufferWriteScope::ThreadBufferWriteScope(AuxGeomDrawQueue& queue)
+        {
+            // Count the draw before checking the generation and reading the buffer index. Commit() changes both before it checks for
+            // draws in progress, so either this draw sees the change or Commit() waits for it.
+            bool skipCache = false;
+            for (;;)
+            {
+                uint32_t generation = 0;
+                m_threadBuffer = &queue.GetThreadBuffer(generation, skipCache);
+                m_threadBuffer->m_activeWrites.fetch_add(1);
+                if (m_threadBuffer->m_generation.load() == generation)
+                {
+                    break;
+                }
+                // The buffers were released, or are about to be, look them up again under the lock
+                m_threadBuffer->m_activeWrites.fetch_sub(1, AZStd::memory_order_release);
+                skipCache = true;
+            }
+            m_bufferData = &m_threadBuffer->m_buffers[queue.m_currentBufferIndex.load()];
+        }
+
+        AuxGeomDrawQueue::ThreadBufferWriteScope::~ThreadBufferWriteScope()
+        {
+            m_threadBuffer->m_activeWrites.fetch_sub(1, AZStd::memory_order_release);
+        }
+
         bool AuxGeomDrawQueue::ShouldBatchDraw(
             DynamicPrimitiveData& primBuffer, 
             AuxGeomPrimitiveType primType, 
@@ -670,10 +949,9 @@ namespace AZ
             AZ::u8 width,
             int32_t viewProjOverrideIndex)
         {
-            // grab a mutex lock for the rest of this function so that a commit cannot happen during it and
-            // other threads can't add geometry during it
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
-            AuxGeomBufferData& buffer = m_buffers[m_currentBufferIndex];
+            // the buffer belongs to this thread so no lock is needed, the scope only keeps a commit from merging it during this draw
+            ThreadBufferWriteScope writeScope(*this);
+            AuxGeomBufferData& buffer = writeScope.GetBufferData();
 
             // We have a separate PrimitiveBufferEntry for each AuxGeomDraw call
             DynamicPrimitiveData& primBuffer = buffer.m_primitiveData;
@@ -744,10 +1022,9 @@ namespace AZ
                 "Index count must be at least %d and must be a multiple of %d",
                 verticesPerPrimitiveType, verticesPerPrimitiveType);
 
-            // grab a mutex lock for the rest of this function so that a commit cannot happen during it and
-            // other threads can't add geometry during it
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
-            AuxGeomBufferData& buffer = m_buffers[m_currentBufferIndex];
+            // the buffer belongs to this thread so no lock is needed, the scope only keeps a commit from merging it during this draw
+            ThreadBufferWriteScope writeScope(*this);
+            AuxGeomBufferData& buffer = writeScope.GetBufferData();
 
             // We have a separate PrimitiveBufferEntry for each AuxGeomDraw call
             DynamicPrimitiveData& primBuffer = buffer.m_primitiveData;
@@ -807,10 +1084,9 @@ namespace AZ
         {
             AuxGeomDrawStyle drawStyle = ConvertRPIDrawStyle(style);
 
-            // grab a mutex lock for the rest of this function so that a commit cannot happen during it and
-            // other threads can't add geometry during it
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
-            AuxGeomBufferData& buffer = m_buffers[m_currentBufferIndex];
+            // the buffer belongs to this thread so no lock is needed, the scope only keeps a commit from merging it during this draw
+            ThreadBufferWriteScope writeScope(*this);
+            AuxGeomBufferData& buffer = writeScope.GetBufferData();
 
             if (IsOpaque(shape.m_color))
             {
@@ -826,10 +1102,9 @@ namespace AZ
         {
             AuxGeomDrawStyle drawStyle = ConvertRPIDrawStyle(style);
 
-            // grab a mutex lock for the rest of this function so that a commit cannot happen during it and
-            // other threads can't add geometry during it
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
-            AuxGeomBufferData& buffer = m_buffers[m_currentBufferIndex];
+            // the buffer belongs to this thread so no lock is needed, the scope only keeps a commit from merging it during this draw
+            ThreadBufferWriteScope writeScope(*this);
+            AuxGeomBufferData& buffer = writeScope.GetBufferData();
 
             if (IsOpaque(box.m_color))
             {
@@ -10,6 +10,10 @@
 
 #include <Atom/RPI.Public/AuxGeom/AuxGeomDraw.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Math/Transform.h>
 
@@ -31,6 +35,11 @@ namespace AZ
         /**
          * Class that stores up AuxGeom draw requests for one RPI scene.
          * This acts somewhat like a render proxy in that it stores data that is consumed by the feature processor.
+         *
+         * Every thread that draws gets its own buffers, so draws from different threads never contend on a lock.
+         * Commit() merges the buffers of all threads once per frame, joining adjacent opaque dynamic primitives that share
+         * the same draw state so the DynamicPrimitiveProcessor builds fewer draw items without changing the draw order.
+         * The buffers of threads that stop drawing are released after a while and reused by the next thread that draws.
          */
         class AuxGeomDrawQueue final
             : public RPI::AuxGeomDraw
@@ -39,7 +48,7 @@ namespace AZ
 
             AZ_CLASS_ALLOCATOR(AuxGeomDrawQueue, AZ::SystemAllocator, 0);
 
-            AuxGeomDrawQueue() = default;
+            AuxGeomDrawQueue();
             ~AuxGeomDrawQueue() override = default;
 
             // RPI::AuxGeomDraw
@@ -71,16 +80,80 @@ namespace AZ
             void DrawObb(const AZ::Obb& obb, const AZ::Vector3& position, const AZ::Color& color, DrawStyle style, DepthTest depthTest, DepthWrite depthWrite, FaceCullMode faceCull, int32_t viewProjOverrideIndex) override;
             void DrawObb(const AZ::Obb& obb, const AZ::Matrix3x4& transform, const AZ::Color& color, DrawStyle style, DepthTest depthTest, DepthWrite depthWrite, FaceCullMode faceCull, int32_t viewProjOverrideIndex) override;
 
-            //! Switch clients of AuxGeom to using a different buffer and return the filled buffer for processing
+            //! Switch clients of AuxGeom to using a different buffer and return the draws of all threads merged into one buffer for processing.
+            //! The returned buffer stays valid until the next call to Commit().
             AuxGeomBufferData* Commit();
 
+            //! Returns the number of threads that currently have draw buffers in this queue.
+            size_t GetThreadBufferCount();
+
+        private: // types
+
+            // We just toggle back and forth between two buffers per thread, one being filled while the other is being merged
+            // by Commit().
+            static const int NumBuffers = 2;
+
+            // Number of commits in a row without draws from a thread after which its buffers are released.
+            static const uint32_t MaxIdleCommits = 120;
+
+            //! The draws recorded by one thread. Only the primitive data, shapes and boxes are used, the view projection overrides
+            //! are shared by all threads so their indices stay valid across threads.
+            struct ThreadBuffer
+            {
+                AZStd::thread_id m_threadId;
+                AuxGeomBufferData m_buffers[NumBuffers];
+
+                //! Number of draws of the owning thread currently in progress, Commit() waits for it to drop to zero after switching buffers.
+                AZStd::atomic<uint32_t> m_activeWrites{ 0 };
+
+                //! Changed by Commit() before it releases the buffer, so the owning thread notices its cached pointer is stale.
+                AZStd::atomic<uint32_t> m_generation{ 0 };
+
+                //! Guarded by m_threadBuffersLock.
+                uint32_t m_idleCommitCount = 0;
+                bool m_isFree = false;
+            };
+
+            //! Gives access to the calling thread's buffer for the current frame for the duration of one draw.
+            class ThreadBufferWriteScope
+            {
+            public:
+                explicit ThreadBufferWriteScope(AuxGeomDrawQueue& queue);
+                ~ThreadBufferWriteScope();
+
+                ThreadBufferWriteScope(const ThreadBufferWriteScope&) = delete;
+                ThreadBufferWriteScope& operator=(const ThreadBufferWriteScope&) = delete;
+
+                AuxGeomBufferData& GetBufferData() { return *m_bufferData; }
+
+            private:
+                ThreadBuffer* m_threadBuffer = nullptr;
+                AuxGeomBufferData* m_bufferData = nullptr;
+            };
+
         private: // functions
 
+            //! Returns the buffers of the calling thread and their generation, assigning buffers to the thread the first time it draws
+            //! to this queue. The result is cached per thread unless skipCache is set.
+            ThreadBuffer& GetThreadBuffer(uint32_t& generation, bool skipCache);
+
+            //! Merges the draws of every thread in the buffer with the given index into m_committedBufferData and clears them.
+            void MergeThreadBuffers(int bufferIndex);
+
+            //! Appends the dynamic primitives of every thread to the committed buffer in draw order. An opaque primitive is joined
+            //! with the previous entry if both have the same draw state, translucent ones keep their own entries since they are depth sorted.
+            void MergeDynamicPrimitives(int bufferIndex);
+
+            //! Releases the buffers of threads that haven't drawn for MaxIdleCommits commits. Called with m_threadBuffersLock held.
+            void FreeIdleThreadBuffers(int bufferIndex);
+
             void DrawCylinderCommon(const AZ::Vector3& center, const AZ::Vector3& direction, float radius, float height, const AZ::Color& color, DrawStyle style, DepthTest depthTest, DepthWrite depthWrite, FaceCullMode faceCull, int32_t viewProjOverrideIndex, bool drawEnds);
             void DrawSphereCommon(const AZ::Vector3& center, const AZ::Vector3& direction, float radius, const AZ::Color& color, DrawStyle style, DepthTest depthTest, DepthWrite depthWrite, FaceCullMode faceCull, int32_t viewProjOverrideIndex, bool isHemisphere);
 
-            //! Clear the current buffers
-            void ClearCurrentBufferData();
+            //! Clear the draws recorded in a buffer, keeping the allocated memory for the next frames
+            static void ClearBufferData(AuxGeomBufferData& data);
+
+            static bool IsBufferDataEmpty(const AuxGeomBufferData& data);
 
             bool ShouldBatchDraw(
                 DynamicPrimitiveData& primBuffer, 
@@ -126,14 +199,24 @@ namespace AZ
 
         private: // data
 
-            // We just toggle back and forth between two buffers, one being filled while the other is being processed
-            // by the FeatureProcessor.
-            static const int NumBuffers = 2;
-            AuxGeomBufferData m_buffers[NumBuffers];
-            int m_currentBufferIndex = 0;
+            //! Unique per queue, unlike its address, so the per-thread lookup cache never matches a queue that was destroyed.
+            const uint64_t m_queueId;
+
+            //! The buffer of each ThreadBuffer that draws currently go to.
+            AZStd::atomic_int m_currentBufferIndex{ 0 };
             float m_pointSize = 3.0f;
 
-            AZStd::recursive_mutex m_buffersWriteLock;
+            //! Guards m_threadBuffers. It's only taken when a thread gets its buffers and by Commit().
+            AZStd::mutex m_threadBuffersLock;
+            AZStd::vector<AZStd::unique_ptr<ThreadBuffer>> m_threadBuffers;
+
+            //! Guards the view projection overrides, which are added rarely compared to draws.
+            AZStd::mutex m_viewProjOverridesLock;
+            AZStd::vector<AZ::Matrix4x4> m_viewProjOverrides;
+            int32_t m_2DViewProjOverrideIndex = -1;
+
+            //! The merged draws returned by Commit().
+            AuxGeomBufferData m_committedBufferData;
         };
 
     } // namespace Render
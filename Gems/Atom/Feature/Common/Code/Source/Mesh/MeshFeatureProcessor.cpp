@@ -26,7 +26,9 @@
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Jobs/Algorithms.h>
 #include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/RTTI/TypeInfo.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -69,6 +71,11 @@ namespace AZ
             AZ_Warning("MeshFeatureProcessor", m_modelData.size() == 0,
                 "Deactivaing the MeshFeatureProcessor, but there are still outstanding mesh handles.\n"
             );
+            m_meshesToUpdate.clear();
+            m_updateList.TakeAll(m_meshesToUpdate);
+            m_meshesToUpdate.clear();
+            ErasePendingReleases();
+
             m_transformService = nullptr;
             m_forceRebuildDrawPackets = false;
         }
@@ -80,59 +87,84 @@ namespace AZ
             AZ::Job* parentJob = packet.m_parentJob;
             AZStd::concurrency_check_scope scopeCheck(m_meshDataChecker);
 
-            const auto iteratorRanges = m_modelData.GetParallelRanges();
+            // Meshes are marked as not queued when taken, so changes made from here on are picked up next frame.
+            m_meshesToUpdate.clear();
+            m_updateList.TakeAll(m_meshesToUpdate);
+
             AZ::JobCompletion jobCompletion;
-            for (const auto& iteratorRange : iteratorRanges)
+            decltype(m_modelData.GetParallelRanges()) iteratorRanges; // outlives the jobs iterating the ranges
+            bool startedJobs = false;
+            const auto startJob = [&](const auto& jobLambda)
             {
-                const auto jobLambda = [&]() -> void
+                Job* executeGroupJob = aznew JobFunction<AZStd::decay_t<decltype(jobLambda)>>(jobLambda, true, nullptr); // Auto-deletes
+                if (parentJob)
+                {
+                    parentJob->StartAsChild(executeGroupJob);
+                }
+                else
                 {
-                    AZ_PROFILE_SCOPE(AzRender, "MeshFeatureProcessor: Simulate: Job");
+                    executeGroupJob->SetDependent(&jobCompletion);
+                    executeGroupJob->Start();
+                }
+                startedJobs = true;
+            };
 
-                    for (auto meshDataIter = iteratorRange.first; meshDataIter != iteratorRange.second; ++meshDataIter)
+            if (m_forceRebuildDrawPackets)
+            {
+                // Every draw packet has to be rebuilt, so go through all the meshes.
+                iteratorRanges = m_modelData.GetParallelRanges();
+                for (const auto& iteratorRange : iteratorRanges)
+                {
+                    startJob([this, &iteratorRange]() -> void
                     {
-                        if (!meshDataIter->m_model)
-                        {
-                            continue;   // model not loaded yet
-                        }
-
-                        if (!meshDataIter->m_visible)
-                        {
-                            continue;
-                        }
+                        AZ_PROFILE_SCOPE(AzRender, "MeshFeatureProcessor: Simulate: Job");
 
-                        if (meshDataIter->m_objectSrgNeedsUpdate)
+                        for (auto meshDataIter = iteratorRange.first; meshDataIter != iteratorRange.second; ++meshDataIter)
                         {
-                            meshDataIter->UpdateObjectSrg();
+                            UpdateModelData(*meshDataIter);
                         }
-
-                        // [GFX TODO] [ATOM-1357] Currently all of the draw packets have to be checked for material ID changes because
-                        // material properties can impact which actual shader is used, which impacts the SRG in the draw packet.
-                        // This is scheduled to be optimized so the work is only done on draw packets that need it instead of having
-                        // to check every one.
-                        meshDataIter->UpdateDrawPackets(m_forceRebuildDrawPackets);
-
-                        if (meshDataIter->m_cullableNeedsRebuild)
-                        {
-                            meshDataIter->BuildCullable();
-                        }
-
-                        if (meshDataIter->m_cullBoundsNeedsUpdate)
-                        {
-                            meshDataIter->UpdateCullBounds(m_transformService);
-                        }
-                    }
-                };
-                Job* executeGroupJob = aznew JobFunction<decltype(jobLambda)>(jobLambda, true, nullptr); // Auto-deletes
-                if (parentJob)
+                    });
+                }
+            }
+            else if (!m_meshesToUpdate.empty())
+            {
+                // Split the changed meshes in as many jobs as there are worker threads, but don't go below a minimum amount of work
+                // per job so frames where only a few meshes moved don't pay for the job overhead.
+                constexpr size_t MinMeshesPerJob = 128;
+                const size_t meshCount = m_meshesToUpdate.size();
+                const size_t workerCount = AZ::JobContext::GetGlobalContext()
+                    ? AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads()
+                    : 1;
+                const size_t jobCount = AZStd::clamp<size_t>(meshCount / MinMeshesPerJob, 1, AZStd::max<size_t>(workerCount, 1));
+
+                if (jobCount == 1)
                 {
-                    parentJob->StartAsChild(executeGroupJob);
+                    AZ_PROFILE_SCOPE(AzRender, "MeshFeatureProcessor: Simulate: Update");
+                    for (ModelDataInstance* modelData : m_meshesToUpdate)
+                    {
+                        UpdateModelData(*modelData);
+                    }
                 }
                 else
                 {
-                    executeGroupJob->SetDependent(&jobCompletion);
-                    executeGroupJob->Start();
+                    const size_t meshesPerJob = (meshCount + jobCount - 1) / jobCount;
+                    for (size_t jobStart = 0; jobStart < meshCount; jobStart += meshesPerJob)
+                    {
+                        const size_t jobEnd = AZStd::min(jobStart + meshesPerJob, meshCount);
+                        startJob([this, jobStart, jobEnd]() -> void
+                        {
+                            AZ_PROFILE_SCOPE(AzRender, "MeshFeatureProcessor: Simulate: Job");
+
+                            for (size_t meshIndex = jobStart; meshIndex < jobEnd; ++meshIndex)
+                            {
+                                UpdateModelData(*m_meshesToUpdate[meshIndex]);
+                            }
+                        });
+                    }
                 }
             }
+
+            if (startedJobs)
             {
                 AZ_PROFILE_SCOPE(AzRender, "MeshFeatureProcessor: Simulate: WaitForChildren");
                 if (parentJob)
@@ -145,9 +177,52 @@ namespace AZ
                 }
             }
 
+            ErasePendingReleases();
             m_forceRebuildDrawPackets = false;
         }
 
+        void MeshFeatureProcessor::UpdateModelData(ModelDataInstance& modelData)
+        {
+            if (!modelData.m_model)
+            {
+                return; // model not loaded yet, Init() queues the mesh again once it is
+            }
+
+            if (!modelData.m_visible)
+            {
+                return; // SetVisible() queues the mesh again when it's shown
+            }
+
+            if (modelData.m_objectSrgNeedsUpdate)
+            {
+                modelData.UpdateObjectSrg();
+            }
+
+            // Draw packets only need to be checked for material ID changes when one of the mesh's materials was compiled since
+            // the last update (which queues the mesh), because material properties can impact which actual shader is used,
+            // which impacts the SRG in the draw packet.
+            modelData.UpdateDrawPackets(m_forceRebuildDrawPackets);
+
+            if (modelData.m_cullableNeedsRebuild)
+            {
+                modelData.BuildCullable();
+            }
+
+            if (modelData.m_cullBoundsNeedsUpdate)
+            {
+                modelData.UpdateCullBounds(m_transformService);
+            }
+        }
+
+        void MeshFeatureProcessor::ErasePendingReleases()
+        {
+            for (MeshHandle& meshHandle : m_pendingReleases)
+            {
+                m_modelData.erase(meshHandle);
+            }
+            m_pendingReleases.clear();
+        }
+
         void MeshFeatureProcessor::OnBeginPrepareRender()
         {
             m_meshDataChecker.soft_lock();
@@ -169,6 +244,7 @@ namespace AZ
 
             meshDataHandle->m_descriptor = descriptor;
             meshDataHandle->m_scene = GetParentScene();
+            meshDataHandle->m_featureProcessor = this;
             meshDataHandle->m_materialAssignments = materials;
             meshDataHandle->m_objectId = m_transformService->ReserveObjectId();
             meshDataHandle->m_originalModelAsset = descriptor.m_modelAsset;
@@ -197,7 +273,15 @@ namespace AZ
                 m_transformService->ReleaseObjectId(meshHandle->m_objectId);
 
                 AZStd::concurrency_check_scope scopeCheck(m_meshDataChecker);
-                m_modelData.erase(meshHandle);
+                if (m_updateList.IsQueued(*meshHandle))
+                {
+                    // The update list still points to the mesh, it's erased once the next Simulate() has emptied the list.
+                    m_pendingReleases.emplace_back(AZStd::move(meshHandle));
+                }
+                else
+                {
+                    m_modelData.erase(meshHandle);
+                }
 
                 return true;
             }
@@ -240,6 +324,7 @@ namespace AZ
             if (meshHandle.IsValid())
             {
                 meshHandle->m_objectSrgNeedsUpdate = true;
+                meshHandle->QueueForUpdate();
             }
         }
 
@@ -269,6 +354,7 @@ namespace AZ
                 }
 
                 meshHandle->m_objectSrgNeedsUpdate = true;
+                meshHandle->QueueForUpdate();
             }
         }
 
@@ -292,6 +378,7 @@ namespace AZ
                 ModelDataInstance& modelData = *meshHandle;
                 modelData.m_cullBoundsNeedsUpdate = true;
                 modelData.m_objectSrgNeedsUpdate = true;
+                modelData.QueueForUpdate();
 
                 m_transformService->SetTransformForId(meshHandle->m_objectId, transform, nonUniformScale);
 
@@ -311,6 +398,7 @@ namespace AZ
                 modelData.m_aabb = localAabb;
                 modelData.m_cullBoundsNeedsUpdate = true;
                 modelData.m_objectSrgNeedsUpdate = true;
+                modelData.QueueForUpdate();
             }
         };
 
@@ -458,7 +546,10 @@ namespace AZ
                     {
                         meshHandle->BuildDrawPacketList(modelLodIndex);
                     }
+                    meshHandle->ConnectMaterialCompiledHandlers();
                 }
+
+                meshHandle->QueueForUpdate();
             }
         }
 
@@ -485,6 +576,7 @@ namespace AZ
                 if (meshInstance.m_descriptor.m_useForwardPassIblSpecular)
                 {
                     meshInstance.m_objectSrgNeedsUpdate = true;
+                    meshInstance.QueueForUpdate();
                 }
             }
         }
@@ -622,6 +714,7 @@ namespace AZ
 
             RemoveRayTracingData();
 
+            m_materialCompiledHandlers.clear();
             m_drawPacketListsByLod.clear();
             m_materialAssignments.clear();
             m_objectSrgList = {};
@@ -653,9 +746,12 @@ namespace AZ
 
             m_aabb = model->GetModelAsset()->GetAabb();
 
+            ConnectMaterialCompiledHandlers();
+
             m_cullableNeedsRebuild = true;
             m_cullBoundsNeedsUpdate = true;
             m_objectSrgNeedsUpdate = true;
+            QueueForUpdate();
         }
 
         void ModelDataInstance::BuildDrawPacketList(size_t modelLodIndex)
@@ -1262,6 +1358,45 @@ namespace AZ
         {
             m_visible = isVisible;
             m_cullable.m_isHidden = !isVisible;
+
+            if (isVisible)
+            {
+                // Changes made while hidden were skipped by the update
+                QueueForUpdate();
+            }
+        }
+
+        void ModelDataInstance::ConnectMaterialCompiledHandlers()
+        {
+            m_materialCompiledHandlers.clear();
+
+            AZStd::vector<RPI::Material*> materials;
+            for (DrawPacketList& drawPacketList : m_drawPacketListsByLod)
+            {
+                for (RPI::MeshDrawPacket& drawPacket : drawPacketList)
+                {
+                    RPI::Material* material = drawPacket.GetMaterial().get();
+                    if (material && AZStd::find(materials.begin(), materials.end(), material) == materials.end())
+                    {
+                        materials.push_back(material);
+                    }
+                }
+            }
+
+            m_materialCompiledHandlers.reserve(materials.size());
+            for (RPI::Material* material : materials)
+            {
+                RPI::Material::CompiledEvent::Handler& handler = m_materialCompiledHandlers.emplace_back([this]() { QueueForUpdate(); });
+                material->ConnectCompiledEventHandler(handler);
+            }
+        }
+
+        void ModelDataInstance::QueueForUpdate()
+        {
+            if (m_featureProcessor)
+            {
+                m_featureProcessor->m_updateList.Queue(*this);
+            }
         }
     } // namespace Render
 } // namespace AZ
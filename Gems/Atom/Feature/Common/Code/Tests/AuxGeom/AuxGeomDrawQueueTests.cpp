@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AuxGeom/AuxGeomDrawQueue.h>
+#include <gtest/gtest.h>
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+#endif
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    namespace
+    {
+        void DrawTestLine(AuxGeomDrawQueue& queue, float offset, const AZ::Color& color, RPI::AuxGeomDraw::DepthTest depthTest)
+        {
+            const AZ::Vector3 points[] = { AZ::Vector3(offset, 0.0f, 0.0f), AZ::Vector3(offset, 1.0f, 0.0f) };
+            RPI::AuxGeomDraw::AuxGeomDynamicDrawArguments args;
+            args.m_verts = points;
+            args.m_vertCount = 2;
+            args.m_colors = &color;
+            args.m_colorCount = 1;
+            args.m_depthTest = depthTest;
+            queue.DrawLines(args);
+        }
+
+        uint32_t CountIndices(const AuxGeomBufferData& data)
+        {
+            uint32_t indexCount = 0;
+            for (const PrimitiveBufferEntry& primitive : data.m_primitiveData.m_primitiveBuffer)
+            {
+                indexCount += primitive.m_indexCount;
+            }
+            return indexCount;
+        }
+    }
+
+    class AuxGeomDrawQueueTests
+        : public UnitTest::AllocatorsTestFixture
+    {
+    };
+
+    TEST_F(AuxGeomDrawQueueTests, TestCommitSwitchesFrames)
+    {
+        AuxGeomDrawQueue queue;
+        DrawTestLine(queue, 0.0f, AZ::Colors::White, RPI::AuxGeomDraw::DepthTest::On);
+        static_cast<RPI::AuxGeomDraw&>(queue).DrawSphere(AZ::Vector3::CreateZero(), 1.0f, AZ::Colors::White);
+
+        AuxGeomBufferData* data = queue.Commit();
+        ASSERT_EQ(data->m_primitiveData.m_primitiveBuffer.size(), 1);
+        EXPECT_EQ(data->m_primitiveData.m_vertexBuffer.size(), 2);
+        EXPECT_EQ(CountIndices(*data), 2);
+        EXPECT_EQ(data->m_opaqueShapes[DrawStyle_Shaded].size(), 1);
+
+        // Nothing was drawn since the last commit
+        data = queue.Commit();
+        EXPECT_TRUE(data->m_primitiveData.m_primitiveBuffer.empty());
+        EXPECT_TRUE(data->m_primitiveData.m_vertexBuffer.empty());
+        EXPECT_TRUE(data->m_opaqueShapes[DrawStyle_Shaded].empty());
+    }
+
+    TEST_F(AuxGeomDrawQueueTests, TestOnlyAdjacentOpaquePrimitivesJoined)
+    {
+        AuxGeomDrawQueue queue;
+        const AZ::Color translucent(1.0f, 1.0f, 1.0f, 0.5f);
+
+        DrawTestLine(queue, 0.0f, AZ::Colors::White, RPI::AuxGeomDraw::DepthTest::On);
+        AZStd::thread([&queue]()
+        {
+            DrawTestLine(queue, 1.0f, AZ::Colors::White, RPI::AuxGeomDraw::DepthTest::On);
+            DrawTestLine(queue, 2.0f, AZ::Colors::White, RPI::AuxGeomDraw::DepthTest::Off);
+            DrawTestLine(queue, 3.0f, AZ::Colors::White, RPI::AuxGeomDraw::DepthTest::On);
+            DrawTestLine(queue, 4.0f, translucent, RPI::AuxGeomDraw::DepthTest::On);
+            DrawTestLine(queue, 5.0f, translucent, RPI::AuxGeomDraw::DepthTest::On);
+            DrawTestLine(queue, 6.0f, AZ::Colors::White, RPI::AuxGeomDraw::DepthTest::On);
+        }).join();
+
+        AuxGeomBufferData* data = queue.Commit();
+        const PrimitiveBuffer& primitives = data->m_primitiveData.m_primitiveBuffer;
+
+        // The first line of each thread is joined, but draws with different states stay in draw order so overlays without depth
+        // test still overlap what was drawn before them. Translucent draws keep their own entries since they are depth sorted.
+        ASSERT_EQ(primitives.size(), 6);
+        const AuxGeomDepthReadType expectedDepthRead[] = { DepthRead_On, DepthRead_Off, DepthRead_On, DepthRead_On, DepthRead_On, DepthRead_On };
+        const AuxGeomBlendMode expectedBlendMode[] = { BlendMode_Off, BlendMode_Off, BlendMode_Off, BlendMode_Alpha, BlendMode_Alpha, BlendMode_Off };
+        const uint32_t expectedIndexCount[] = { 4, 2, 2, 2, 2, 2 };
+        for (size_t i = 0; i < primitives.size(); ++i)
+        {
+            EXPECT_EQ(primitives[i].m_depthReadType, expectedDepthRead[i]);
+            EXPECT_EQ(primitives[i].m_blendMode, expectedBlendMode[i]);
+            EXPECT_EQ(primitives[i].m_indexCount, expectedIndexCount[i]);
+        }
+
+        // Every index range is contiguous and the vertices are referenced in draw order
+        EXPECT_EQ(CountIndices(*data), data->m_primitiveData.m_indexBuffer.size());
+        const AZStd::vector<AuxGeomIndex>& indices = data->m_primitiveData.m_indexBuffer;
+        for (size_t i = 0; i < indices.size(); ++i)
+        {
+            EXPECT_EQ(indices[i], i);
+        }
+    }
+
+    TEST_F(AuxGeomDrawQueueTests, TestIdleThreadBuffersReleasedAndReused)
+    {
+        constexpr int MaxCommits = 1000;
+
+        AuxGeomDrawQueue queue;
+        DrawTestLine(queue, 0.0f, AZ::Colors::White, RPI::AuxGeomDraw::DepthTest::On);
+        AZStd::thread([&queue]()
+        {
+            DrawTestLine(queue, 1.0f, AZ::Colors::White, RPI::AuxGeomDraw::DepthTest::On);
+        }).join();
+        EXPECT_EQ(queue.GetThreadBufferCount(), 2);
+        EXPECT_EQ(queue.Commit()->m_primitiveData.m_vertexBuffer.size(), 4);
+
+        // Neither thread draws anymore, so both release their buffers after a while
+        for (int i = 0; i < MaxCommits && queue.GetThreadBufferCount() != 0; ++i)
+        {
+            queue.Commit();
+        }
+        EXPECT_EQ(queue.GetThreadBufferCount(), 0);
+
+        // This thread still has the released buffers cached, it gets buffers again and none of its draws are lost
+        DrawTestLine(queue, 2.0f, AZ::Colors::White, RPI::AuxGeomDraw::DepthTest::On);
+        EXPECT_EQ(queue.GetThreadBufferCount(), 1);
+        AuxGeomBufferData* data = queue.Commit();
+        ASSERT_EQ(data->m_primitiveData.m_primitiveBuffer.size(), 1);
+        EXPECT_EQ(data->m_primitiveData.m_vertexBuffer.size(), 2);
+        EXPECT_EQ(data->m_primitiveData.m_vertexBuffer[0].m_position.m_x, 2.0f);
+    }
+
+    TEST_F(AuxGeomDrawQueueTests, TestDrawsFromMultipleThreadsMerged)
+    {
+        constexpr size_t ThreadCount = 8;
+        constexpr size_t DrawsPerThread = 500;
+
+        AuxGeomDrawQueue queue;
+        const int32_t overrideIndex = queue.GetOrAdd2DViewProjOverride();
+
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads.emplace_back([&queue, threadIndex, overrideIndex]()
+            {
+                for (size_t i = 0; i < DrawsPerThread; ++i)
+                {
+                    DrawTestLine(queue, static_cast<float>(threadIndex), AZ::Colors::White, RPI::AuxGeomDraw::DepthTest::On);
+                    queue.DrawAabb(AZ::Aabb::CreateCenterRadius(AZ::Vector3::CreateZero(), 1.0f), AZ::Colors::White,
+                        RPI::AuxGeomDraw::DrawStyle::Line, RPI::AuxGeomDraw::DepthTest::On, RPI::AuxGeomDraw::DepthWrite::On,
+                        RPI::AuxGeomDraw::FaceCullMode::Back, overrideIndex);
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        AuxGeomBufferData* data = queue.Commit();
+        ASSERT_EQ(data->m_primitiveData.m_primitiveBuffer.size(), 1);
+        EXPECT_EQ(data->m_primitiveData.m_vertexBuffer.size(), ThreadCount * DrawsPerThread * 2);
+        EXPECT_EQ(CountIndices(*data), ThreadCount * DrawsPerThread * 2);
+        EXPECT_EQ(data->m_opaqueBoxes[DrawStyle_Line].size(), ThreadCount * DrawsPerThread);
+        EXPECT_EQ(data->m_viewProjOverrides.size(), 1);
+        EXPECT_EQ(data->m_2DViewProjOverrideIndex, overrideIndex);
+    }
+
+    TEST_F(AuxGeomDrawQueueTests, TestCommitWhileDrawing)
+    {
+        constexpr size_t ThreadCount = 4;
+        constexpr size_t DrawsPerThread = 20000;
+
+        AuxGeomDrawQueue queue;
+        AZStd::atomic_bool drawing{ true };
+
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads.emplace_back([&queue]()
+            {
+                for (size_t i = 0; i < DrawsPerThread; ++i)
+                {
+                    DrawTestLine(queue, 0.0f, AZ::Colors::White, RPI::AuxGeomDraw::DepthTest::On);
+                }
+            });
+        }
+
+        // Every draw ends up in exactly one committed frame, whole
+        size_t vertexCount = 0;
+        AZStd::thread committer([&queue, &drawing, &vertexCount]()
+        {
+            while (drawing)
+            {
+                AuxGeomBufferData* data = queue.Commit();
+                EXPECT_EQ(CountIndices(*data), data->m_primitiveData.m_vertexBuffer.size());
+                vertexCount += data->m_primitiveData.m_vertexBuffer.size();
+            }
+        });
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        drawing = false;
+        committer.join();
+
+        vertexCount += queue.Commit()->m_primitiveData.m_vertexBuffer.size();
+        EXPECT_EQ(vertexCount, ThreadCount * DrawsPerThread * 2);
+    }
+
+#ifdef HAVE_BENCHMARK
+    //! Measures recording debug lines from several threads at once, like the physics and animation debug draws do, followed by the
+    //! commit of the frame. The argument is the number of threads drawing.
+    class AuxGeomDrawQueueBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    protected:
+        static constexpr size_t DrawsPerFrame = 40000;
+    };
+
+    BENCHMARK_DEFINE_F(AuxGeomDrawQueueBenchmark, BM_MultiThreadedDrawLines)(benchmark::State& state)
+    {
+        const size_t threadCount = aznumeric_cast<size_t>(state.range(0));
+        const size_t drawsPerThread = DrawsPerFrame / threadCount;
+        AuxGeomDrawQueue queue;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZStd::vector<AZStd::thread> threads;
+            threads.reserve(threadCount);
+            for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+            {
+                threads.emplace_back([&queue, threadIndex, drawsPerThread]()
+                {
+                    for (size_t i = 0; i < drawsPerThread; ++i)
+                    {
+                        const AZ::Color color = (i % 2) ? AZ::Colors::White : AZ::Colors::Red;
+                        DrawTestLine(queue, static_cast<float>(threadIndex), color, RPI::AuxGeomDraw::DepthTest::On);
+                    }
+                });
+            }
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+
+            benchmark::DoNotOptimize(queue.Commit());
+        }
+        state.SetItemsProcessed(state.iterations() * drawsPerThread * threadCount);
+    }
+
+    BENCHMARK_REGISTER_F(AuxGeomDrawQueueBenchmark, BM_MultiThreadedDrawLines)
+        ->Arg(1)
+        ->Arg(2)
+        ->Arg(4)
+        ->Arg(8)
+        ->Unit(benchmark::kMicrosecond)
+        ->UseRealTime();
+#endif
+} // namespace UnitTest
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/parallel/thread.h>
+#include <Atom/Feature/Utils/ConcurrentDirtyList.h>
+#include <gtest/gtest.h>
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+#endif
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    struct DirtyListTestElement
+    {
+        uint32_t m_value = 0;
+        bool m_isDirty = false;
+        ConcurrentDirtyListNode<DirtyListTestElement> m_node;
+    };
+
+    using TestDirtyList = ConcurrentDirtyList<DirtyListTestElement, &DirtyListTestElement::m_node>;
+
+    class ConcurrentDirtyListTests
+        : public UnitTest::AllocatorsTestFixture
+    {
+    };
+
+    TEST_F(ConcurrentDirtyListTests, TestBasics)
+    {
+        TestDirtyList list;
+        AZStd::vector<DirtyListTestElement*> taken;
+
+        EXPECT_TRUE(list.IsEmpty());
+        EXPECT_EQ(list.TakeAll(taken), 0);
+        EXPECT_TRUE(taken.empty());
+
+        DirtyListTestElement elements[3];
+        EXPECT_TRUE(list.Queue(elements[0]));
+        EXPECT_TRUE(list.Queue(elements[2]));
+        EXPECT_FALSE(list.IsEmpty());
+        EXPECT_TRUE(list.IsQueued(elements[0]));
+        EXPECT_FALSE(list.IsQueued(elements[1]));
+        EXPECT_TRUE(list.IsQueued(elements[2]));
+
+        EXPECT_EQ(list.TakeAll(taken), 2);
+        EXPECT_TRUE(list.IsEmpty());
+        EXPECT_FALSE(list.IsQueued(elements[0]));
+        EXPECT_FALSE(list.IsQueued(elements[2]));
+        ASSERT_EQ(taken.size(), 2);
+        EXPECT_NE(AZStd::find(taken.begin(), taken.end(), &elements[0]), taken.end());
+        EXPECT_NE(AZStd::find(taken.begin(), taken.end(), &elements[2]), taken.end());
+    }
+
+    TEST_F(ConcurrentDirtyListTests, TestQueueTwice)
+    {
+        TestDirtyList list;
+        DirtyListTestElement element;
+
+        EXPECT_TRUE(list.Queue(element));
+        EXPECT_FALSE(list.Queue(element));
+
+        AZStd::vector<DirtyListTestElement*> taken;
+        EXPECT_EQ(list.TakeAll(taken), 1);
+
+        // Once taken, the element can be queued again
+        EXPECT_TRUE(list.Queue(element));
+        taken.clear();
+        EXPECT_EQ(list.TakeAll(taken), 1);
+        EXPECT_EQ(taken[0], &element);
+    }
+
+    TEST_F(ConcurrentDirtyListTests, TestTakeAllAppends)
+    {
+        TestDirtyList list;
+        DirtyListTestElement first;
+        DirtyListTestElement second;
+
+        AZStd::vector<DirtyListTestElement*> taken;
+        list.Queue(first);
+        list.TakeAll(taken);
+        list.Queue(second);
+        list.TakeAll(taken);
+
+        ASSERT_EQ(taken.size(), 2);
+        EXPECT_EQ(taken[0], &first);
+        EXPECT_EQ(taken[1], &second);
+    }
+
+    TEST_F(ConcurrentDirtyListTests, TestQueueFromMultipleThreads)
+    {
+        constexpr size_t ThreadCount = 8;
+        constexpr size_t ElementCount = 4096;
+
+        TestDirtyList list;
+        AZStd::vector<DirtyListTestElement> elements(ElementCount);
+
+        // Every thread queues every element, each one must still be in the list only once
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads.emplace_back([&list, &elements, threadIndex]()
+            {
+                for (size_t i = 0; i < elements.size(); ++i)
+                {
+                    list.Queue(elements[(i + threadIndex * 512) % elements.size()]);
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        AZStd::vector<DirtyListTestElement*> taken;
+        EXPECT_EQ(list.TakeAll(taken), ElementCount);
+        AZStd::sort(taken.begin(), taken.end());
+        EXPECT_EQ(AZStd::unique(taken.begin(), taken.end()), taken.end());
+        EXPECT_EQ(taken.front(), &elements.front());
+        EXPECT_EQ(taken.back(), &elements.back());
+    }
+
+#ifdef HAVE_BENCHMARK
+    //! Compares finding the few changed elements of a large container by scanning dirty flags, like MeshFeatureProcessor::Simulate
+    //! used to do for every mesh, with taking them from a ConcurrentDirtyList. The first argument is the number of elements, the
+    //! second one the number of elements changed each frame.
+    class ConcurrentDirtyListBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    protected:
+        static void ChangeElements(AZStd::deque<DirtyListTestElement>& elements, TestDirtyList* list, size_t changeCount, size_t frame)
+        {
+            if (changeCount == 0)
+            {
+                return;
+            }
+
+            const size_t stride = elements.size() / changeCount;
+            for (size_t i = 0; i < changeCount; ++i)
+            {
+                DirtyListTestElement& element = elements[(i * stride + frame) % elements.size()];
+                element.m_isDirty = true;
+                if (list)
+                {
+                    list->Queue(element);
+                }
+            }
+        }
+
+        static void UpdateElement(DirtyListTestElement& element)
+        {
+            element.m_isDirty = false;
+            ++element.m_value;
+        }
+    };
+
+    BENCHMARK_DEFINE_F(ConcurrentDirtyListBenchmark, BM_ScanDirtyFlags)(benchmark::State& state)
+    {
+        AZStd::deque<DirtyListTestElement> elements(aznumeric_cast<size_t>(state.range(0)));
+        size_t frame = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            ChangeElements(elements, nullptr, aznumeric_cast<size_t>(state.range(1)), frame++);
+            state.ResumeTiming();
+
+            for (DirtyListTestElement& element : elements)
+            {
+                if (element.m_isDirty)
+                {
+                    UpdateElement(element);
+                }
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(1));
+    }
+
+    BENCHMARK_DEFINE_F(ConcurrentDirtyListBenchmark, BM_TakeDirtyList)(benchmark::State& state)
+    {
+        AZStd::deque<DirtyListTestElement> elements(aznumeric_cast<size_t>(state.range(0)));
+        TestDirtyList list;
+        AZStd::vector<DirtyListTestElement*> dirtyElements;
+        size_t frame = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            ChangeElements(elements, &list, aznumeric_cast<size_t>(state.range(1)), frame++);
+            state.ResumeTiming();
+
+            dirtyElements.clear();
+            list.TakeAll(dirtyElements);
+            for (DirtyListTestElement* element : dirtyElements)
+            {
+                UpdateElement(*element);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(1));
+    }
+
+    BENCHMARK_REGISTER_F(ConcurrentDirtyListBenchmark, BM_ScanDirtyFlags)
+        ->Args({ 200000, 2000 })
+        ->Args({ 200000, 0 })
+        ->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(ConcurrentDirtyListBenchmark, BM_TakeDirtyList)
+        ->Args({ 200000, 2000 })
+        ->Args({ 200000, 0 })
+        ->Unit(benchmark::kMicrosecond);
+#endif
+} // namespace UnitTest
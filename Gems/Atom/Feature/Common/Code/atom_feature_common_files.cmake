@@ -38,6 +38,7 @@ set(FILES
     Include/Atom/Feature/SphericalHarmonics/SphericalHarmonicsUtility.h
     Include/Atom/Feature/SphericalHarmonics/SphericalHarmonicsUtility.inl
     Include/Atom/Feature/TransformService/TransformServiceFeatureProcessor.h
+    Include/Atom/Feature/Utils/ConcurrentDirtyList.h
     Include/Atom/Feature/Utils/FrameCaptureBus.h
     Include/Atom/Feature/Utils/GpuBufferHandler.h
     Include/Atom/Feature/Utils/IndexedDataVector.h
@@ -8,7 +8,9 @@
 
 set(FILES
     Mocks/MockMeshFeatureProcessor.h
+    Tests/AuxGeom/AuxGeomDrawQueueTests.cpp
     Tests/CommonTest.cpp
+    Tests/ConcurrentDirtyListTests.cpp
     Tests/CoreLights/ShadowmapAtlasTest.cpp
     Tests/IndexedDataVectorTests.cpp
     Tests/MultiIndexedDataVectorTests.cpp
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI.Reflect/Base.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        struct FrameGraphCompileStatistics
+        {
+            /// The number of frame graphs compiled since statistics gathering was enabled.
+            uint32_t m_compileCount = 0;
+
+            /// The number of those compilations that replayed the cached results of a previous
+            /// frame with the same frame graph topology.
+            uint32_t m_cacheHitCount = 0;
+
+            /// Whether the previous frame replayed cached compile results.
+            bool m_lastCompileWasCacheHit = false;
+
+            /// CPU time spent compiling the previous frame graph, in milliseconds.
+            double m_lastCompileTimeInMs = 0.0;
+
+            /// Total CPU time spent compiling frame graphs since statistics gathering was enabled, in milliseconds.
+            double m_totalCompileTimeInMs = 0.0;
+
+            /// Returns the ratio of compilations that hit the cache, in the range [0, 1].
+            float GetCacheHitRate() const
+            {
+                return m_compileCount ? static_cast<float>(m_cacheHitCount) / static_cast<float>(m_compileCount) : 0.0f;
+            }
+
+            /// Returns the average CPU time spent compiling a frame graph, in milliseconds.
+            double GetAverageCompileTimeInMs() const
+            {
+                return m_compileCount ? m_totalCompileTimeInMs / m_compileCount : 0.0;
+            }
+        };
+    }
+}
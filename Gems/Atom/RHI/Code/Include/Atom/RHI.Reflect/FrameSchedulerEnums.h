@@ -51,7 +51,10 @@ namespace AZ
             DisableAttachmentAliasing = AZ_BIT(2),
 
             /// Disables aliasing of transient attachment memory during async queue regions.
-            DisableAttachmentAliasingAsyncQueue = AZ_BIT(3)
+            DisableAttachmentAliasingAsyncQueue = AZ_BIT(3),
+
+            /// Disables reusing the compile results of previous frames with the same frame graph topology.
+            DisableCompileCache = AZ_BIT(4)
         };
         AZ_DEFINE_ENUM_BITWISE_OPERATORS(AZ::RHI::FrameSchedulerCompileFlags)
 
@@ -70,7 +73,10 @@ namespace AZ
             GatherTransientAttachmentStatistics = AZ_BIT(2),
 
             //! Enables gathering of memory statistics across pools.
-            GatherMemoryStatistics = AZ_BIT(3)
+            GatherMemoryStatistics = AZ_BIT(3),
+
+            //! Enables gathering of frame graph compile time and compile cache hit rate.
+            GatherFrameGraphCompileStatistics = AZ_BIT(4)
         };
 
         AZ_DEFINE_ENUM_BITWISE_OPERATORS(AZ::RHI::FrameSchedulerStatisticsFlags)
@@ -7,11 +7,16 @@
  */
 #pragma once
 
+#include <Atom/RHI.Reflect/FrameGraphCompileStatistics.h>
 #include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
+#include <Atom/RHI.Reflect/TransientAttachmentStatistics.h>
 #include <Atom/RHI/Object.h>
 #include <Atom/RHI/ObjectCache.h>
 #include <Atom/RHI/ImageView.h>
 #include <Atom/RHI/BufferView.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/Utils/TypeHash.h>
 
 namespace AZ
 {
@@ -99,6 +104,15 @@ namespace AZ
          * kept inside the compiler. The cache is big enough to avoid having to re-create views every frame, but
          * bounded in order to release entries old views.
          *
+         *      == Compile Cache ==
+         *
+         * The topology of the frame graph rarely changes from one frame to the next. The compiler hashes the scopes,
+         * their graph edges and attachment usages, and the transient attachment descriptors, and keeps the results of
+         * the queue-centric graph and transient attachment lifetime phases for the last few distinct hashes. When a
+         * frame graph matches a cached hash, those results are replayed onto the new graph instead of being rebuilt,
+         * and the transient attachment pool skips the pass that measures the memory needed by the frame. Resources,
+         * views and the platform-specific phases are still compiled every frame.
+         *
          *      == Platform-Specific Compilation ==
          *
          * Finally, the compiler calls into the platform-specific compile method, which hands control over to the
@@ -125,6 +139,9 @@ namespace AZ
              */
             MessageOutcome Compile(const FrameGraphCompileRequest& request);
 
+            /// Returns the compile statistics, gathered while FrameSchedulerStatisticsFlags::GatherFrameGraphCompileStatistics is set.
+            const FrameGraphCompileStatistics& GetStatistics() const;
+
         protected:
             FrameGraphCompiler() = default;
 
@@ -144,21 +161,74 @@ namespace AZ
 
             //////////////////////////////////////////////////////////////////////////
 
+            /// Platform-independent compile results of a frame graph, stored by scope and attachment
+            /// index so they can be replayed onto later frame graphs with the same topology.
+            struct CompileCacheEntry
+            {
+                HashValue64 m_hash = HashValue64{ 0 };
+
+                /// The compile index of the last frame graph that used this entry, to evict the least recently used one.
+                uint64_t m_lastUsedCompileIndex = 0;
+
+                /// The indices of the producer / consumer scopes of each scope on each hardware queue, or InvalidScopeIndex.
+                AZStd::vector<AZStd::array<uint32_t, HardwareQueueClassCount>> m_producersByQueue;
+                AZStd::vector<AZStd::array<uint32_t, HardwareQueueClassCount>> m_consumersByQueue;
+
+                /// The first and last scope indices of each transient attachment after async queue lifetime extension.
+                AZStd::vector<AZStd::pair<uint32_t, uint32_t>> m_transientBufferLifetimes;
+                AZStd::vector<AZStd::pair<uint32_t, uint32_t>> m_transientImageLifetimes;
+
+                /// The sorted transient attachment activation / deactivation commands.
+                AZStd::vector<uint32_t> m_transientCommands;
+
+                /// The memory the transient attachment pool reserved for the frame, used as the heap allocation hint.
+                AZStd::optional<TransientAttachmentStatistics::MemoryUsage> m_transientMemoryHint;
+
+                /// The hash of the descriptor of the pool the memory hint was measured with.
+                HashValue64 m_transientMemoryHintPoolHash = HashValue64{ 0 };
+            };
+
+            static const uint32_t InvalidScopeIndex = static_cast<uint32_t>(-1);
+            static const size_t CompileCacheCapacity = 4;
+
             MessageOutcome ValidateCompileRequest(const FrameGraphCompileRequest& request) const;
 
+            /// Hashes everything the cached compile phases depend on.
+            HashValue64 HashFrameGraphTopology(const FrameGraphCompileRequest& request) const;
+
+            /// Returns the cache entry matching the hash, or nullptr if there's none.
+            CompileCacheEntry* FindCompileCacheEntry(HashValue64 hash);
+
+            /// Returns whether the results stored in the cache entry have the scope and attachment counts of the frame graph.
+            bool IsCompileCacheEntryCompatible(const FrameGraph& frameGraph, const CompileCacheEntry& cacheEntry) const;
+
+            /// Adds an empty cache entry for the hash, replacing the least recently used one when the cache is full.
+            CompileCacheEntry& AddCompileCacheEntry(HashValue64 hash);
+
             void CompileQueueCentricScopeGraph(
                 FrameGraph& frameGraph,
                 FrameSchedulerCompileFlags compileFlags);
 
+            void StoreQueueCentricScopeGraph(const FrameGraph& frameGraph, CompileCacheEntry& cacheEntry) const;
+
+            void ReplayQueueCentricScopeGraph(
+                FrameGraph& frameGraph,
+                FrameSchedulerCompileFlags compileFlags,
+                const CompileCacheEntry& cacheEntry) const;
+
             void ExtendTransientAttachmentAsyncQueueLifetimes(
                 FrameGraph& frameGraph,
                 FrameSchedulerCompileFlags compileFlags);
 
+            /// Compiles the transient attachments, or replays their lifetimes from the cache entry if isCacheHit is true.
+            /// The results are stored in the cache entry otherwise, if there is one.
             void CompileTransientAttachments(
                 FrameGraph& frameGraph,
                 TransientAttachmentPool& transientAttachmentPool,
                 FrameSchedulerCompileFlags compileFlags,
-                FrameSchedulerStatisticsFlags statisticsFlags);
+                FrameSchedulerStatisticsFlags statisticsFlags,
+                CompileCacheEntry* cacheEntry,
+                bool isCacheHit);
 
             void CompileResourceViews(const FrameGraphAttachmentDatabase& attachmentDatabase);
 
@@ -171,6 +241,12 @@ namespace AZ
             ObjectCache<ImageView> m_imageViewCache;
             ObjectCache<BufferView> m_bufferViewCache;
 
+            // Compile results of the most recent distinct frame graph topologies.
+            AZStd::vector<CompileCacheEntry> m_compileCache;
+            uint64_t m_compileIndex = 0;
+
+            FrameGraphCompileStatistics m_statistics;
+
         };
     }
 }
@@ -173,6 +173,9 @@ namespace AZ
             /// Returns memory statistics for the previous frame.
             const MemoryStatistics* GetMemoryStatistics() const;
 
+            /// Returns the frame graph compile time and compile cache statistics.
+            const FrameGraphCompileStatistics* GetFrameGraphCompileStatistics() const;
+
             /// Returns the implicit root scope id.
             ScopeId GetRootScopeId() const;
 
@@ -11,6 +11,7 @@
 #include <AzCore/Debug/Budget.h>
 #include <AzCore/Name/Name.h>
 #include <AzCore/EBus/EBus.h>
+#include <Atom/RHI.Reflect/FrameGraphCompileStatistics.h>
 #include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
 #include <Atom/RHI.Reflect/MemoryStatistics.h>
 #include <Atom/RHI/DrawListTagRegistry.h>
@@ -60,6 +61,8 @@ namespace AZ
 
             virtual const RHI::MemoryStatistics* GetMemoryStatistics() const = 0;
 
+            virtual const RHI::FrameGraphCompileStatistics* GetFrameGraphCompileStatistics() const = 0;
+
             virtual const RHI::TransientAttachmentPoolDescriptor* GetTransientAttachmentPoolDescriptor() const = 0;
 
             virtual ConstPtr<PlatformLimitsDescriptor> GetPlatformLimitsDescriptor() const = 0;
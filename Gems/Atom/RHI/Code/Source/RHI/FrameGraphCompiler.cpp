@@ -20,11 +20,33 @@
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/optional.h>
+#include <AzCore/std/time.h>
 
 namespace AZ
 {
     namespace RHI
     {
+        namespace
+        {
+            // Hashes the settings of a transient attachment pool that the memory it reserves for a frame depends on.
+            HashValue64 HashTransientAttachmentPoolDescriptor(const TransientAttachmentPoolDescriptor& descriptor)
+            {
+                HashValue64 hash = TypeHash64(descriptor.m_bufferBudgetInBytes);
+                hash = TypeHash64(descriptor.m_imageBudgetInBytes, hash);
+                hash = TypeHash64(descriptor.m_renderTargetBudgetInBytes, hash);
+                hash = TypeHash64(descriptor.m_heapParameters.m_type, hash);
+                if (descriptor.m_heapParameters.m_type == HeapAllocationStrategy::MemoryHint)
+                {
+                    const HeapMemoryHintParameters& hintParameters = descriptor.m_heapParameters.m_usageHintParameters;
+                    hash = TypeHash64(hintParameters.m_minHeapSizeInBytes, hash);
+                    hash = TypeHash64(hintParameters.m_collectLatency, hash);
+                    hash = TypeHash64(hintParameters.m_heapSizeScaleFactor, hash);
+                    hash = TypeHash64(hintParameters.m_maxHeapWastedPercentage, hash);
+                }
+                return hash;
+            }
+        }
+
         ResultCode FrameGraphCompiler::Init(Device& device)
         {
             if (Validation::IsEnabled())
@@ -60,6 +82,8 @@ namespace AZ
             {
                 m_imageViewCache.Clear();
                 m_bufferViewCache.Clear();
+                m_compileCache.clear();
+                m_statistics = {};
 
                 ShutdownInternal();
                 DeviceObject::Shutdown();
@@ -116,11 +140,16 @@ namespace AZ
          *
          *          The final phase is to compile the platform specific scopes and hand-off compilation to the platform-specific
          *          implementation, which may introduce more phases specific to the platform API.
+         *
+         * Phases 1 and 2 only depend on the topology of the frame graph, so their results are cached and replayed when
+         * the topology hashes the same as a previous frame.
          */
         MessageOutcome FrameGraphCompiler::Compile(const FrameGraphCompileRequest& request)
         {
             AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: Compile");
 
+            const AZStd::sys_time_t compileStartTime = AZStd::GetTimeNowTicks();
+
             MessageOutcome outcome = ValidateCompileRequest(request);
             if (!outcome)
             {
@@ -129,15 +158,50 @@ namespace AZ
 
             FrameGraph& frameGraph = *request.m_frameGraph;
 
+            ++m_compileIndex;
+            CompileCacheEntry* cacheEntry = nullptr;
+            bool isCacheHit = false;
+            if (!CheckBitsAny(request.m_compileFlags, FrameSchedulerCompileFlags::DisableCompileCache))
+            {
+                const HashValue64 topologyHash = HashFrameGraphTopology(request);
+                cacheEntry = FindCompileCacheEntry(topologyHash);
+                isCacheHit = cacheEntry != nullptr;
+                if (isCacheHit && !IsCompileCacheEntryCompatible(frameGraph, *cacheEntry))
+                {
+                    // A hash collision between graphs of different sizes, the entry is rebuilt for this graph.
+                    *cacheEntry = {};
+                    cacheEntry->m_hash = topologyHash;
+                    isCacheHit = false;
+                }
+                else if (!isCacheHit)
+                {
+                    cacheEntry = &AddCompileCacheEntry(topologyHash);
+                }
+                cacheEntry->m_lastUsedCompileIndex = m_compileIndex;
+            }
+
             /// [Phase 1] Compiles the cross-queue scope graph.
-            CompileQueueCentricScopeGraph(frameGraph, request.m_compileFlags);
+            if (isCacheHit)
+            {
+                ReplayQueueCentricScopeGraph(frameGraph, request.m_compileFlags, *cacheEntry);
+            }
+            else
+            {
+                CompileQueueCentricScopeGraph(frameGraph, request.m_compileFlags);
+                if (cacheEntry)
+                {
+                    StoreQueueCentricScopeGraph(frameGraph, *cacheEntry);
+                }
+            }
 
             /// [Phase 2] Compile transient attachments across all scopes.
             CompileTransientAttachments(
                 frameGraph,
                 *request.m_transientAttachmentPool,
                 request.m_compileFlags,
-                request.m_statisticsFlags);
+                request.m_statisticsFlags,
+                cacheEntry,
+                isCacheHit);
 
             /// [Phase 3] Compiles buffer / image views and assigns them to scope attachments.
             CompileResourceViews(frameGraph.GetAttachmentDatabase());
@@ -153,7 +217,144 @@ namespace AZ
             }
 
             /// Perform platform-specific compilation.
-            return CompileInternal(request);
+            outcome = CompileInternal(request);
+
+            if (CheckBitsAny(request.m_statisticsFlags, FrameSchedulerStatisticsFlags::GatherFrameGraphCompileStatistics))
+            {
+                const double compileTimeInMs =
+                    static_cast<double>(AZStd::GetTimeNowTicks() - compileStartTime) * 1000.0 / static_cast<double>(AZStd::GetTimeTicksPerSecond());
+
+                ++m_statistics.m_compileCount;
+                m_statistics.m_cacheHitCount += isCacheHit ? 1 : 0;
+                m_statistics.m_lastCompileWasCacheHit = isCacheHit;
+                m_statistics.m_lastCompileTimeInMs = compileTimeInMs;
+                m_statistics.m_totalCompileTimeInMs += compileTimeInMs;
+            }
+            else
+            {
+                m_statistics = {};
+            }
+
+            return outcome;
+        }
+
+        const FrameGraphCompileStatistics& FrameGraphCompiler::GetStatistics() const
+        {
+            return m_statistics;
+        }
+
+        HashValue64 FrameGraphCompiler::HashFrameGraphTopology(const FrameGraphCompileRequest& request) const
+        {
+            AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: HashFrameGraphTopology");
+
+            const FrameGraph& frameGraph = *request.m_frameGraph;
+            const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+
+            HashValue64 hash = TypeHash64(request.m_compileFlags);
+
+            /// The scopes in sorted order, with their queue, producer -> consumer edges and attachment usages.
+            hash = TypeHash64(frameGraph.GetScopes().size(), hash);
+            for (const Scope* scope : frameGraph.GetScopes())
+            {
+                hash = TypeHash64(scope->GetId().GetHash(), hash);
+                hash = TypeHash64(scope->GetHardwareQueueClass(), hash);
+
+                const auto& consumers = frameGraph.GetConsumers(*scope);
+                hash = TypeHash64(consumers.size(), hash);
+                for (const Scope* consumer : consumers)
+                {
+                    hash = TypeHash64(consumer->GetIndex(), hash);
+                }
+
+                hash = TypeHash64(scope->GetAttachments().size(), hash);
+                for (const ScopeAttachment* scopeAttachment : scope->GetAttachments())
+                {
+                    const FrameAttachment& frameAttachment = scopeAttachment->GetFrameAttachment();
+                    hash = TypeHash64(frameAttachment.GetId().GetHash(), hash);
+                    hash = TypeHash64(frameAttachment.GetLifetimeType(), hash);
+                    for (const ScopeAttachmentUsageAndAccess& usageAndAccess : scopeAttachment->GetUsageAndAccess())
+                    {
+                        hash = TypeHash64(usageAndAccess.m_usage, hash);
+                        hash = TypeHash64(usageAndAccess.m_access, hash);
+                    }
+                }
+            }
+
+            /// The transient attachments in the order they are compiled, with what drives their placement in the pool.
+            const auto hashTransientAttachment = [&hash](const FrameAttachment& frameAttachment)
+            {
+                hash = TypeHash64(frameAttachment.GetId().GetHash(), hash);
+                hash = TypeHash64(frameAttachment.GetSupportedQueueMask(), hash);
+                hash = TypeHash64(frameAttachment.GetFirstScope()->GetIndex(), hash);
+                hash = TypeHash64(frameAttachment.GetLastScope()->GetIndex(), hash);
+            };
+
+            hash = TypeHash64(attachmentDatabase.GetTransientBufferAttachments().size(), hash);
+            for (const BufferFrameAttachment* transientBuffer : attachmentDatabase.GetTransientBufferAttachments())
+            {
+                hashTransientAttachment(*transientBuffer);
+                hash = transientBuffer->GetBufferDescriptor().GetHash(hash);
+            }
+
+            hash = TypeHash64(attachmentDatabase.GetTransientImageAttachments().size(), hash);
+            for (const ImageFrameAttachment* transientImage : attachmentDatabase.GetTransientImageAttachments())
+            {
+                hashTransientAttachment(*transientImage);
+                hash = transientImage->GetImageDescriptor().GetHash(hash);
+            }
+
+            return hash;
+        }
+
+        FrameGraphCompiler::CompileCacheEntry* FrameGraphCompiler::FindCompileCacheEntry(HashValue64 hash)
+        {
+            for (CompileCacheEntry& cacheEntry : m_compileCache)
+            {
+                if (cacheEntry.m_hash == hash)
+                {
+                    return &cacheEntry;
+                }
+            }
+            return nullptr;
+        }
+
+        bool FrameGraphCompiler::IsCompileCacheEntryCompatible(const FrameGraph& frameGraph, const CompileCacheEntry& cacheEntry) const
+        {
+            const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+            const size_t transientBufferCount = attachmentDatabase.GetTransientBufferAttachments().size();
+            const size_t transientImageCount = attachmentDatabase.GetTransientImageAttachments().size();
+
+            // The lifetimes and commands are only stored when the graph has transient attachments.
+            const bool hasTransientAttachments = transientBufferCount > 0 || transientImageCount > 0;
+            return cacheEntry.m_producersByQueue.size() == frameGraph.GetScopes().size() &&
+                cacheEntry.m_consumersByQueue.size() == frameGraph.GetScopes().size() &&
+                cacheEntry.m_transientBufferLifetimes.size() == (hasTransientAttachments ? transientBufferCount : 0) &&
+                cacheEntry.m_transientImageLifetimes.size() == (hasTransientAttachments ? transientImageCount : 0) &&
+                cacheEntry.m_transientCommands.size() == (hasTransientAttachments ? (transientBufferCount + transientImageCount) * 2 : 0);
+        }
+
+        FrameGraphCompiler::CompileCacheEntry& FrameGraphCompiler::AddCompileCacheEntry(HashValue64 hash)
+        {
+            CompileCacheEntry* cacheEntry = nullptr;
+            if (m_compileCache.size() < CompileCacheCapacity)
+            {
+                cacheEntry = &m_compileCache.emplace_back();
+            }
+            else
+            {
+                cacheEntry = &m_compileCache.front();
+                for (CompileCacheEntry& otherEntry : m_compileCache)
+                {
+                    if (otherEntry.m_lastUsedCompileIndex < cacheEntry->m_lastUsedCompileIndex)
+                    {
+                        cacheEntry = &otherEntry;
+                    }
+                }
+                *cacheEntry = {};
+            }
+
+            cacheEntry->m_hash = hash;
+            return *cacheEntry;
         }
 
         void FrameGraphCompiler::CompileQueueCentricScopeGraph(
@@ -277,6 +478,57 @@ namespace AZ
             }
         }
 
+        void FrameGraphCompiler::StoreQueueCentricScopeGraph(const FrameGraph& frameGraph, CompileCacheEntry& cacheEntry) const
+        {
+            const auto getScopeIndex = [](const Scope* scope)
+            {
+                return scope ? scope->GetIndex() : InvalidScopeIndex;
+            };
+
+            const auto& scopes = frameGraph.GetScopes();
+            cacheEntry.m_producersByQueue.resize(scopes.size());
+            cacheEntry.m_consumersByQueue.resize(scopes.size());
+            for (size_t scopeIdx = 0; scopeIdx < scopes.size(); ++scopeIdx)
+            {
+                const Scope* scope = scopes[scopeIdx];
+                for (uint32_t hardwareQueueClassIdx = 0; hardwareQueueClassIdx < HardwareQueueClassCount; ++hardwareQueueClassIdx)
+                {
+                    cacheEntry.m_producersByQueue[scopeIdx][hardwareQueueClassIdx] = getScopeIndex(scope->m_producersByQueue[hardwareQueueClassIdx]);
+                    cacheEntry.m_consumersByQueue[scopeIdx][hardwareQueueClassIdx] = getScopeIndex(scope->m_consumersByQueue[hardwareQueueClassIdx]);
+                }
+            }
+        }
+
+        void FrameGraphCompiler::ReplayQueueCentricScopeGraph(
+            FrameGraph& frameGraph,
+            FrameSchedulerCompileFlags compileFlags,
+            const CompileCacheEntry& cacheEntry) const
+        {
+            AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: ReplayQueueCentricScopeGraph");
+
+            const auto& scopes = frameGraph.GetScopes();
+            const auto getScope = [&scopes](uint32_t scopeIndex)
+            {
+                return scopeIndex != InvalidScopeIndex ? scopes[scopeIndex] : nullptr;
+            };
+
+            const bool disableAsyncQueues = CheckBitsAll(compileFlags, FrameSchedulerCompileFlags::DisableAsyncQueues);
+            for (size_t scopeIdx = 0; scopeIdx < scopes.size(); ++scopeIdx)
+            {
+                Scope* scope = scopes[scopeIdx];
+                if (disableAsyncQueues)
+                {
+                    scope->m_hardwareQueueClass = HardwareQueueClass::Graphics;
+                }
+
+                for (uint32_t hardwareQueueClassIdx = 0; hardwareQueueClassIdx < HardwareQueueClassCount; ++hardwareQueueClassIdx)
+                {
+                    scope->m_producersByQueue[hardwareQueueClassIdx] = getScope(cacheEntry.m_producersByQueue[scopeIdx][hardwareQueueClassIdx]);
+                    scope->m_consumersByQueue[hardwareQueueClassIdx] = getScope(cacheEntry.m_consumersByQueue[scopeIdx][hardwareQueueClassIdx]);
+                }
+            }
+        }
+
         void FrameGraphCompiler::ExtendTransientAttachmentAsyncQueueLifetimes(
             FrameGraph& frameGraph,
             FrameSchedulerCompileFlags compileFlags)
@@ -470,7 +722,9 @@ namespace AZ
             FrameGraph& frameGraph,
             TransientAttachmentPool& transientAttachmentPool,
             FrameSchedulerCompileFlags compileFlags,
-            FrameSchedulerStatisticsFlags statisticsFlags)
+            FrameSchedulerStatisticsFlags statisticsFlags,
+            CompileCacheEntry* cacheEntry,
+            bool isCacheHit)
         {
             const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
             if (attachmentDatabase.GetTransientBufferAttachments().empty() && attachmentDatabase.GetTransientImageAttachments().empty())
@@ -480,7 +734,45 @@ namespace AZ
 
             AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: CompileTransientAttachments");
 
-            ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
+            const auto& scopes = frameGraph.GetScopes();
+            const auto& transientBufferGraphAttachments = attachmentDatabase.GetTransientBufferAttachments();
+            const auto& transientImageGraphAttachments = attachmentDatabase.GetTransientImageAttachments();
+
+            if (isCacheHit)
+            {
+                for (size_t attachmentIndex = 0; attachmentIndex < transientBufferGraphAttachments.size(); ++attachmentIndex)
+                {
+                    const AZStd::pair<uint32_t, uint32_t>& lifetime = cacheEntry->m_transientBufferLifetimes[attachmentIndex];
+                    transientBufferGraphAttachments[attachmentIndex]->m_firstScope = scopes[lifetime.first];
+                    transientBufferGraphAttachments[attachmentIndex]->m_lastScope = scopes[lifetime.second];
+                }
+
+                for (size_t attachmentIndex = 0; attachmentIndex < transientImageGraphAttachments.size(); ++attachmentIndex)
+                {
+                    const AZStd::pair<uint32_t, uint32_t>& lifetime = cacheEntry->m_transientImageLifetimes[attachmentIndex];
+                    transientImageGraphAttachments[attachmentIndex]->m_firstScope = scopes[lifetime.first];
+                    transientImageGraphAttachments[attachmentIndex]->m_lastScope = scopes[lifetime.second];
+                }
+            }
+            else
+            {
+                ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
+
+                if (cacheEntry)
+                {
+                    cacheEntry->m_transientBufferLifetimes.reserve(transientBufferGraphAttachments.size());
+                    for (const BufferFrameAttachment* transientBuffer : transientBufferGraphAttachments)
+                    {
+                        cacheEntry->m_transientBufferLifetimes.emplace_back(transientBuffer->GetFirstScope()->GetIndex(), transientBuffer->GetLastScope()->GetIndex());
+                    }
+
+                    cacheEntry->m_transientImageLifetimes.reserve(transientImageGraphAttachments.size());
+                    for (const ImageFrameAttachment* transientImage : transientImageGraphAttachments)
+                    {
+                        cacheEntry->m_transientImageLifetimes.emplace_back(transientImage->GetFirstScope()->GetIndex(), transientImage->GetLastScope()->GetIndex());
+                    }
+                }
+            }
 
             /**
              * Builds a sortable key. It iterates each scope and performs deactivations
@@ -506,6 +798,11 @@ namespace AZ
                     m_bits.m_attachmentIndex = attachmentIndex;
                 }
 
+                explicit Command(uint32_t command)
+                    : m_command(command)
+                {
+                }
+
                 bool operator < (Command rhs) const
                 {
                     return m_command < rhs.m_command;
@@ -531,10 +828,6 @@ namespace AZ
                 };
             };
 
-            const auto& scopes = frameGraph.GetScopes();
-            const auto& transientBufferGraphAttachments = attachmentDatabase.GetTransientBufferAttachments();
-            const auto& transientImageGraphAttachments = attachmentDatabase.GetTransientImageAttachments();
-
             AZ_Assert(scopes.size() < AZ_BIT(SCOPE_BIT_COUNT),
                 "Exceeded maximum number of allowed scopes");
 
@@ -546,7 +839,14 @@ namespace AZ
             AZStd::vector<Command> commands;
             commands.reserve((transientBufferGraphAttachments.size() + transientImageGraphAttachments.size()) * 2);
 
-            if (CheckBitsAny(compileFlags, FrameSchedulerCompileFlags::DisableAttachmentAliasing))
+            if (isCacheHit)
+            {
+                for (uint32_t command : cacheEntry->m_transientCommands)
+                {
+                    commands.emplace_back(command);
+                }
+            }
+            else if (CheckBitsAny(compileFlags, FrameSchedulerCompileFlags::DisableAttachmentAliasing))
             {
                 const uint32_t ScopeIndexFirst = 0;
                 const uint32_t ScopeIndexLast = static_cast<uint32_t>(scopes.size() - 1);
@@ -588,7 +888,19 @@ namespace AZ
                 }
             }
 
-            AZStd::sort(commands.begin(), commands.end());
+            if (!isCacheHit)
+            {
+                AZStd::sort(commands.begin(), commands.end());
+
+                if (cacheEntry)
+                {
+                    cacheEntry->m_transientCommands.reserve(commands.size());
+                    for (Command command : commands)
+                    {
+                        cacheEntry->m_transientCommands.push_back(command.m_command);
+                    }
+                }
+            }
 
             auto processCommands = [&](TransientAttachmentPoolCompileFlags compileFlags, TransientAttachmentStatistics::MemoryUsage* memoryHint = nullptr)
             {
@@ -699,9 +1011,23 @@ namespace AZ
             // Check if we need to do two passes (one for calculating the size and the second one for allocating the resources)
             if (transientAttachmentPool.GetDescriptor().m_heapParameters.m_type == HeapAllocationStrategy::MemoryHint)
             {
-                // First pass to calculate size needed.
-                processCommands(TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
-                memoryUsage = transientAttachmentPool.GetStatistics().m_reservedMemory;
+                const HashValue64 poolDescriptorHash = HashTransientAttachmentPoolDescriptor(transientAttachmentPool.GetDescriptor());
+                if (isCacheHit && cacheEntry->m_transientMemoryHint && cacheEntry->m_transientMemoryHintPoolHash == poolDescriptorHash)
+                {
+                    // Same attachments with the same lifetimes, in a pool with the same settings, as when the size was calculated.
+                    memoryUsage = cacheEntry->m_transientMemoryHint;
+                }
+                else
+                {
+                    // First pass to calculate size needed.
+                    processCommands(TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
+                    memoryUsage = transientAttachmentPool.GetStatistics().m_reservedMemory;
+                    if (cacheEntry)
+                    {
+                        cacheEntry->m_transientMemoryHint = memoryUsage;
+                        cacheEntry->m_transientMemoryHintPoolHash = poolDescriptorHash;
+                    }
+                }
             }
 
             // Second pass uses the information about memory usage
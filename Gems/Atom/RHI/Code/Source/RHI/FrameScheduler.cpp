@@ -602,6 +602,14 @@ namespace AZ
                 : nullptr;
         }
 
+        const FrameGraphCompileStatistics* FrameScheduler::GetFrameGraphCompileStatistics() const
+        {
+            return
+                CheckBitsAny(m_compileRequest.m_statisticsFlags, FrameSchedulerStatisticsFlags::GatherFrameGraphCompileStatistics)
+                ? &m_frameGraphCompiler->GetStatistics()
+                : nullptr;
+        }
+
         double FrameScheduler::GetCpuFrameTime() const
         {
             if (auto statsProfiler = AZ::Interface<AZ::Statistics::StatisticalProfilerProxy>::Get(); statsProfiler)
@@ -265,6 +265,11 @@ namespace AZ
             return m_frameScheduler.GetMemoryStatistics();
         }
 
+        const RHI::FrameGraphCompileStatistics* RHISystem::GetFrameGraphCompileStatistics() const
+        {
+            return m_frameScheduler.GetFrameGraphCompileStatistics();
+        }
+
         const AZ::RHI::TransientAttachmentPoolDescriptor* RHISystem::GetTransientAttachmentPoolDescriptor() const
         {
             return m_frameScheduler.GetTransientAttachmentPoolDescriptor();
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <Tests/Device.h>
+#include <Tests/Factory.h>
+#include <Tests/ShaderResourceGroup.h>
+#include <Atom/RHI/FrameScheduler.h>
+#include <Atom/RHI.Reflect/ShaderResourceGroupLayout.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <benchmark/benchmark.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    //! Runs frames on the test RHI in which a large number of per-object ShaderResourceGroups are updated, to measure the
+    //! cost of FrameScheduler::CompileShaderResourceGroups. The groups are spread evenly over the pools.
+    //! The argument is the number of pools.
+    class FrameSchedulerBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        static constexpr uint32_t GroupsPerFrame = 50000;
+
+        struct ObjectConstants
+        {
+            AZ::Matrix3x4 m_world;
+            AZ::Vector4 m_color;
+        };
+
+        void internalSetUp(const benchmark::State& state)
+        {
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+            AZ::NameDictionary::Create();
+
+            AZ::JobManagerDesc jobManagerDesc;
+            for (unsigned int i = 0; i < AZStd::thread::hardware_concurrency(); ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+
+            m_factory = AZStd::make_unique<Factory>();
+            m_device = MakeTestDevice();
+
+            RHI::FrameSchedulerDescriptor frameSchedulerDescriptor;
+            m_frameScheduler = AZStd::make_unique<RHI::FrameScheduler>();
+            m_frameScheduler->Init(*m_device, frameSchedulerDescriptor);
+
+            RHI::Ptr<RHI::ShaderResourceGroupLayout> layout = RHI::ShaderResourceGroupLayout::Create();
+            layout->SetBindingSlot(0);
+            layout->AddShaderInput(RHI::ShaderInputConstantDescriptor{
+                Name("m_world"), offsetof(ObjectConstants, m_world), sizeof(ObjectConstants::m_world), 0 });
+            layout->AddShaderInput(RHI::ShaderInputConstantDescriptor{
+                Name("m_color"), offsetof(ObjectConstants, m_color), sizeof(ObjectConstants::m_color), 0 });
+            layout->Finalize();
+
+            const uint32_t poolCount = aznumeric_cast<uint32_t>(state.range(0));
+            for (uint32_t poolIndex = 0; poolIndex < poolCount; ++poolIndex)
+            {
+                RHI::Ptr<ShaderResourceGroupPool> pool = aznew ShaderResourceGroupPool;
+
+                RHI::ShaderResourceGroupPoolDescriptor descriptor;
+                descriptor.m_layout = layout;
+                pool->Init(*m_device, descriptor);
+                m_pools.push_back(pool);
+            }
+
+            m_groups.reserve(GroupsPerFrame);
+            m_groupData.reserve(GroupsPerFrame);
+            for (uint32_t groupIndex = 0; groupIndex < GroupsPerFrame; ++groupIndex)
+            {
+                RHI::Ptr<RHI::ShaderResourceGroup> group = RHI::Factory::Get().CreateShaderResourceGroup();
+                m_pools[groupIndex % poolCount]->InitGroup(*group);
+                m_groupData.emplace_back(*group);
+                m_groups.push_back(AZStd::move(group));
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_groupData = {};
+            m_groups = {};
+            m_pools = {};
+
+            m_frameScheduler->Shutdown();
+            m_frameScheduler = nullptr;
+            m_device = nullptr;
+            m_factory = nullptr;
+
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext = nullptr;
+            m_jobManager = nullptr;
+
+            // Flushing the tick bus queue since AZ::RHI::Factory:Register queues a function
+            AZ::SystemTickBus::ClearQueuedEvents();
+            AZ::NameDictionary::Destroy();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        }
+
+        void RunFrames(benchmark::State& state, RHI::JobPolicy jobPolicy)
+        {
+            RHI::FrameSchedulerCompileRequest compileRequest;
+            compileRequest.m_jobPolicy = jobPolicy;
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                m_frameScheduler->BeginFrame();
+                for (uint32_t groupIndex = 0; groupIndex < GroupsPerFrame; ++groupIndex)
+                {
+                    m_groups[groupIndex]->Compile(m_groupData[groupIndex]);
+                }
+                m_frameScheduler->Compile(compileRequest);
+                m_frameScheduler->Execute(RHI::JobPolicy::Serial);
+                m_frameScheduler->EndFrame();
+            }
+            state.SetItemsProcessed(state.iterations() * GroupsPerFrame);
+        }
+
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+        AZStd::unique_ptr<Factory> m_factory;
+        RHI::Ptr<RHI::Device> m_device;
+        AZStd::unique_ptr<RHI::FrameScheduler> m_frameScheduler;
+        AZStd::vector<RHI::Ptr<ShaderResourceGroupPool>> m_pools;
+        AZStd::vector<RHI::Ptr<RHI::ShaderResourceGroup>> m_groups;
+        AZStd::vector<RHI::ShaderResourceGroupData> m_groupData;
+    };
+
+    BENCHMARK_DEFINE_F(FrameSchedulerBenchmark, BM_CompileShaderResourceGroupsSerial)(benchmark::State& state)
+    {
+        RunFrames(state, RHI::JobPolicy::Serial);
+    }
+    BENCHMARK_REGISTER_F(FrameSchedulerBenchmark, BM_CompileShaderResourceGroupsSerial)
+        ->Arg(1)
+        ->Arg(8)
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(FrameSchedulerBenchmark, BM_CompileShaderResourceGroupsParallel)(benchmark::State& state)
+    {
+        RunFrames(state, RHI::JobPolicy::Parallel);
+    }
+    BENCHMARK_REGISTER_F(FrameSchedulerBenchmark, BM_CompileShaderResourceGroupsParallel)
+        ->Arg(1)
+        ->Arg(8)
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+} // namespace UnitTest
+#endif
@@ -9,6 +9,10 @@
 #include "RHITestFixture.h"
 #include <Tests/Factory.h>
 #include <Tests/Device.h>
+#include <Tests/TransientAttachmentPool.h>
+#include <Atom/RHI/FrameAttachment.h>
+#include <Atom/RHI/Scope.h>
+#include <Atom/RHI/ScopeAttachment.h>
 #include <Atom/RHI/ScopeProducer.h>
 #include <Atom/RHI/FrameScheduler.h>
 #include <AzCore/Math/Random.h>
@@ -225,7 +229,7 @@ namespace UnitTest
             RHITestFixture::TearDown();
         }
 
-        void Test()
+        void Test(RHI::FrameSchedulerCompileFlags compileFlags = RHI::FrameSchedulerCompileFlags::None)
         {
             RHI::FrameScheduler frameScheduler;
 
@@ -374,8 +378,13 @@ namespace UnitTest
                 }
             }
 
+            // The first frame is compiled from scratch, the compile results of every later frame must match it.
+            CompileResults firstFrameResults;
             for (uint32_t frameIdx = 0; frameIdx < FrameIterationCount; ++frameIdx)
             {
+                CompileResults frameResults;
+                TransientAttachmentPool::s_commandLog = &frameResults.m_transientCommands;
+
                 frameScheduler.BeginFrame();
 
                 for (AZStd::unique_ptr<ScopeProducer>& producer : m_state->m_producers)
@@ -385,17 +394,82 @@ namespace UnitTest
 
                 RHI::FrameSchedulerCompileRequest compileRequest;
                 compileRequest.m_jobPolicy = RHI::JobPolicy::Serial;
+                compileRequest.m_compileFlags = compileFlags;
+                compileRequest.m_statisticsFlags = RHI::FrameSchedulerStatisticsFlags::GatherFrameGraphCompileStatistics;
                 frameScheduler.Compile(compileRequest);
 
+                TransientAttachmentPool::s_commandLog = nullptr;
+                GatherCompileResults(frameResults);
+                if (frameIdx == 0)
+                {
+                    EXPECT_FALSE(frameResults.m_transientCommands.empty());
+                    firstFrameResults = AZStd::move(frameResults);
+                }
+                else
+                {
+                    EXPECT_EQ(frameResults.m_scopeLinks, firstFrameResults.m_scopeLinks);
+                    EXPECT_EQ(frameResults.m_transientLifetimes, firstFrameResults.m_transientLifetimes);
+                    EXPECT_TRUE(frameResults.m_transientCommands == firstFrameResults.m_transientCommands);
+                }
+
                 frameScheduler.Execute(RHI::JobPolicy::Serial);
 
                 frameScheduler.EndFrame();
             }
 
+            // The graph is the same every frame, so only the first compile should miss the cache.
+            const RHI::FrameGraphCompileStatistics* compileStatistics = frameScheduler.GetFrameGraphCompileStatistics();
+            ASSERT_NE(compileStatistics, nullptr);
+            EXPECT_EQ(compileStatistics->m_compileCount, FrameIterationCount);
+            if (RHI::CheckBitsAny(compileFlags, RHI::FrameSchedulerCompileFlags::DisableCompileCache))
+            {
+                EXPECT_EQ(compileStatistics->m_cacheHitCount, 0);
+            }
+            else
+            {
+                EXPECT_EQ(compileStatistics->m_cacheHitCount, FrameIterationCount - 1);
+                EXPECT_TRUE(compileStatistics->m_lastCompileWasCacheHit);
+            }
+
             frameScheduler.Shutdown();
         }
 
     private:
+        struct CompileResults
+        {
+            // the producer and consumer scope index of each scope on each hardware queue
+            AZStd::vector<uint32_t> m_scopeLinks;
+            // the first and last scope index of each transient attachment of each scope
+            AZStd::vector<uint32_t> m_transientLifetimes;
+            AZStd::vector<TransientAttachmentPool::Command> m_transientCommands;
+        };
+
+        void GatherCompileResults(CompileResults& results) const
+        {
+            const auto getScopeIndex = [](const RHI::Scope* scope)
+            {
+                return scope ? scope->GetIndex() : static_cast<uint32_t>(-1);
+            };
+
+            for (const AZStd::unique_ptr<ScopeProducer>& producer : m_state->m_producers)
+            {
+                const RHI::Scope* scope = producer->GetScope();
+                for (uint32_t hardwareQueueClassIdx = 0; hardwareQueueClassIdx < RHI::HardwareQueueClassCount; ++hardwareQueueClassIdx)
+                {
+                    const RHI::HardwareQueueClass hardwareQueueClass = static_cast<RHI::HardwareQueueClass>(hardwareQueueClassIdx);
+                    results.m_scopeLinks.push_back(getScopeIndex(scope->GetProducerByQueue(hardwareQueueClass)));
+                    results.m_scopeLinks.push_back(getScopeIndex(scope->GetConsumerByQueue(hardwareQueueClass)));
+                }
+
+                for (const RHI::ScopeAttachment* scopeAttachment : scope->GetTransientAttachments())
+                {
+                    const RHI::FrameAttachment& frameAttachment = scopeAttachment->GetFrameAttachment();
+                    results.m_transientLifetimes.push_back(getScopeIndex(frameAttachment.GetFirstScope()));
+                    results.m_transientLifetimes.push_back(getScopeIndex(frameAttachment.GetLastScope()));
+                }
+            }
+        }
+
         static const uint32_t FrameIterationCount = 128;
         static const uint32_t ImportedImageCount = 16;
         static const uint32_t ImportedBufferCount = 16;
@@ -426,4 +500,14 @@ namespace UnitTest
     {
         Test();
     }
+
+    TEST_F(FrameSchedulerTests, TestCompileCacheDisabled)
+    {
+        Test(RHI::FrameSchedulerCompileFlags::DisableCompileCache);
+    }
+
+    TEST_F(FrameSchedulerTests, TestCompileCacheWithoutAttachmentAliasing)
+    {
+        Test(RHI::FrameSchedulerCompileFlags::DisableAttachmentAliasing);
+    }
 }
@@ -11,11 +11,14 @@
 #include <Atom/RHI/BufferPool.h>
 #include <Atom/RHI/ImagePool.h>
 #include <Atom/RHI/Buffer.h>
+#include <Atom/RHI/Scope.h>
 
 namespace UnitTest
 {
     using namespace AZ;
 
+    AZStd::vector<TransientAttachmentPool::Command>* TransientAttachmentPool::s_commandLog = nullptr;
+
     RHI::ResultCode TransientAttachmentPool::InitInternal(RHI::Device& device, const RHI::TransientAttachmentPoolDescriptor&)
     {
         {
@@ -52,6 +55,7 @@ namespace UnitTest
         const RHI::TransientImageDescriptor& descriptor)
     {
         using namespace AZ;
+        LogCommand(true, descriptor.m_attachmentId);
         auto findIt = m_attachments.find(descriptor.m_attachmentId);
         if (findIt != m_attachments.end())
         {
@@ -75,6 +79,7 @@ namespace UnitTest
         const RHI::TransientBufferDescriptor& descriptor)
     {
         using namespace AZ;
+        LogCommand(true, descriptor.m_attachmentId);
         auto findIt = m_attachments.find(descriptor.m_attachmentId);
         if (findIt != m_attachments.end())
         {
@@ -96,12 +101,14 @@ namespace UnitTest
 
     void TransientAttachmentPool::DeactivateBuffer(const RHI::AttachmentId& attachmentId)
     {
+        LogCommand(false, attachmentId);
         AZ_Assert(m_activeSet.find(attachmentId) != m_activeSet.end(), "buffer not in the active set.");
         m_activeSet.erase(attachmentId);
     }
 
     void TransientAttachmentPool::DeactivateImage(const RHI::AttachmentId& attachmentId)
     {
+        LogCommand(false, attachmentId);
         AZ_Assert(m_activeSet.find(attachmentId) != m_activeSet.end(), "image not in the active set.");
         m_activeSet.erase(attachmentId);
     }
@@ -112,4 +119,12 @@ namespace UnitTest
         AZ_Assert(m_activeSet.empty(), "active set is not empty.");
         m_attachments.clear();
     }
+
+    void TransientAttachmentPool::LogCommand(bool isActivation, const RHI::AttachmentId& attachmentId) const
+    {
+        if (s_commandLog)
+        {
+            s_commandLog->push_back(Command{ m_currentScope->GetIndex(), isActivation, attachmentId });
+        }
+    }
 }
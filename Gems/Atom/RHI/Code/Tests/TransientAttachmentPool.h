@@ -14,6 +14,7 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace UnitTest
 {
@@ -25,6 +26,22 @@ namespace UnitTest
 
         TransientAttachmentPool() = default;
 
+        //! An activation or deactivation of a transient attachment, with the index of the scope it was made in.
+        struct Command
+        {
+            uint32_t m_scopeIndex = 0;
+            bool m_isActivation = false;
+            AZ::RHI::AttachmentId m_attachmentId;
+
+            bool operator==(const Command& rhs) const
+            {
+                return m_scopeIndex == rhs.m_scopeIndex && m_isActivation == rhs.m_isActivation && m_attachmentId == rhs.m_attachmentId;
+            }
+        };
+
+        //! When set, the commands of every pool are appended to it.
+        static AZStd::vector<Command>* s_commandLog;
+
     private:
         AZ::RHI::ResultCode InitInternal(AZ::RHI::Device&, const AZ::RHI::TransientAttachmentPoolDescriptor& descriptor) override;
 
@@ -42,6 +59,8 @@ namespace UnitTest
 
         void EndInternal() override;
 
+        void LogCommand(bool isActivation, const AZ::RHI::AttachmentId& attachmentId) const;
+
         AZ::RHI::Ptr<AZ::RHI::ImagePool> m_imagePool;
         AZ::RHI::Ptr<AZ::RHI::BufferPool> m_bufferPool;
         AZStd::unordered_map<AZ::RHI::AttachmentId, AZ::RHI::Ptr<AZ::RHI::Resource>> m_attachments;
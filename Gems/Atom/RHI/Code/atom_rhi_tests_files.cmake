@@ -13,6 +13,7 @@ set(FILES
     Tests/DrawPacketTests.cpp
     Tests/FrameGraphTests.cpp
     Tests/FrameSchedulerTests.cpp
+    Tests/FrameSchedulerBenchmarks.cpp
     Tests/HashingTests.cpp
     Tests/ImageTests.cpp
     Tests/IndirectBufferTests.cpp
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/EBus/Event.h>
 
 // These classes are not directly referenced in this header only because the Set/GetPropertyValue()
 // functions are templatized. But the API is still specific to these data types so we include them here.
@@ -106,6 +107,11 @@ namespace AZ
             //! This gets incremented every time a change is made, like by calling SetPropertyValue().
             ChangeId GetCurrentChangeId() const;
 
+            //! Signaled at the end of Compile(), on the thread that compiled the material, once changes have been applied.
+            //! Lets client code that tracks GetCurrentChangeId() react to changes instead of checking the material every frame.
+            using CompiledEvent = AZ::Event<>;
+            void ConnectCompiledEventHandler(CompiledEvent::Handler& handler);
+
             //! Return the set of shaders to be run by this material.
             const ShaderCollection& GetShaderCollection() const;
 
@@ -202,6 +208,8 @@ namespace AZ
             //! Records the m_currentChangeId when the material was last compiled.
             ChangeId m_compiledChangeId = DEFAULT_CHANGE_ID;
 
+            CompiledEvent m_compiledEvent;
+
             bool m_isInitializing = false;
                 
             MaterialPropertyPsoHandling m_psoHandling = MaterialPropertyPsoHandling::Warning;
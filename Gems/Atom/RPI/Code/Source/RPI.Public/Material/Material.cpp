@@ -374,6 +374,8 @@ namespace AZ
 
                 m_compiledChangeId = m_currentChangeId;
 
+                m_compiledEvent.Signal();
+
                 return true;
             }
 
@@ -385,6 +387,11 @@ namespace AZ
             return m_currentChangeId;
         }
 
+        void Material::ConnectCompiledEventHandler(CompiledEvent::Handler& handler)
+        {
+            handler.Connect(m_compiledEvent);
+        }
+
         MaterialPropertyIndex Material::FindPropertyIndex(const Name& propertyId, bool* wasRenamed, Name* newName) const
         {
             if (wasRenamed)
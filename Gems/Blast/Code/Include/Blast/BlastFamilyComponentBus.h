@@ -107,6 +107,10 @@ namespace Blast
         //! Fill debug render buffer with debug visualization data based on debug mode.
         virtual void FillDebugRenderBuffer(DebugRenderBuffer& debugRenderBuffer, DebugRenderMode debugRenderMode) = 0;
 
+        //! Apply damage queued since the last call onto the actors in the family.
+        //! Should only be invoked by BlastSystemComponent.
+        virtual void ApplyDamage() = 0;
+
         //! Apply accumulated stress damage onto the actors in the family.
         //! Should only be invoked by BlastSystemComponent.
         virtual void ApplyStressDamage() = 0;
@@ -493,6 +493,16 @@ namespace Blast
         }
     }
 
+    void BlastFamilyComponent::ApplyDamage()
+    {
+        AZ_PROFILE_FUNCTION(Physics);
+
+        if (m_damageManager)
+        {
+            m_damageManager->ProcessDamage();
+        }
+    }
+
     void BlastFamilyComponent::ApplyStressDamage()
     {
         AZ_PROFILE_FUNCTION(Physics);
@@ -85,6 +85,7 @@ namespace Blast
         AZStd::vector<BlastActorData> GetActorsData() override;
 
         void FillDebugRenderBuffer(DebugRenderBuffer& debugRenderBuffer, DebugRenderMode debugRenderMode) override;
+        void ApplyDamage() override;
         void ApplyStressDamage() override;
         void SyncMeshes() override;
 
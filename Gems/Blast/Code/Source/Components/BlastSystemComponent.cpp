@@ -196,14 +196,16 @@ namespace Blast
         BlastFamilyComponentRequestBus::EnumerateHandlers(
             [&jobCompletion](BlastFamilyComponentRequests* handler)
             {
-                auto stressDamageJob = AZ::CreateJobFunction(
+                // Each family has its own Blast group, so the damage of different families can be evaluated in parallel.
+                auto damageJob = AZ::CreateJobFunction(
                     [handler]() -> void
                     {
+                        handler->ApplyDamage();
                         handler->ApplyStressDamage();
                     },
                     true);
-                stressDamageJob->SetDependent(&jobCompletion);
-                stressDamageJob->Start();
+                damageJob->SetDependent(&jobCompletion);
+                damageJob->Start();
 
                 return true;
             });
@@ -8,6 +8,7 @@
 
 #include <Family/DamageManager.h>
 
+#include <AzCore/Debug/Profiler.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 
 #include <Blast/BlastActor.h>
@@ -17,104 +18,172 @@
 
 namespace Blast
 {
-    template<typename T>
-    using DamagePair = DamageManager::DamagePair<T>;
-
-    DamagePair<NvBlastExtRadialDamageDesc> DamageManager::RadialDamageInternal(
-        BlastActor& actor, float damage, const AZ::Vector3& localPosition, float minRadius, float maxRadius)
+    void DamageManager::QueueDamage(const DamageEvent& damageEvent)
     {
-        auto desc = AZStd::make_unique<NvBlastExtRadialDamageDesc>(NvBlastExtRadialDamageDesc{
-            damage,
-            {localPosition.GetX(), localPosition.GetY(), localPosition.GetZ()},
-            minRadius,
-            maxRadius,
-        });
-        auto programParams = AZStd::make_unique<NvBlastExtProgramParams>(NvBlastExtProgramParams{
-            desc.get(), m_blastMaterial.GetNativePointer(), actor.GetFamily().GetPxAsset().getAccelerator()});
-
-        const NvBlastDamageProgram program{NvBlastExtFalloffGraphShader, NvBlastExtFalloffSubgraphShader};
-        actor.Damage(program, programParams.get());
-
-        return AZStd::make_pair(AZStd::move(desc), AZStd::move(programParams));
+        AZStd::lock_guard<AZStd::mutex> lock(m_pendingMutex);
+        m_pendingEvents.push_back(damageEvent);
     }
 
-    DamagePair<NvBlastExtShearDamageDesc> DamageManager::ShearDamageInternal(
-        BlastActor& actor, float damage, const AZ::Vector3& localPosition, float minRadius, float maxRadius,
-        const AZ::Vector3& normal)
+    bool DamageManager::HasPendingDamage() const
     {
-        auto desc = AZStd::make_unique<NvBlastExtShearDamageDesc>(NvBlastExtShearDamageDesc{
-            damage,
-            {normal.GetX(), normal.GetY(), normal.GetZ()},
-            {localPosition.GetX(), localPosition.GetY(), localPosition.GetZ()},
-            minRadius,
-            maxRadius,
-        });
-        auto programParams = AZStd::make_unique<NvBlastExtProgramParams>(NvBlastExtProgramParams{
-            desc.get(), m_blastMaterial.GetNativePointer(), actor.GetFamily().GetPxAsset().getAccelerator()});
-
-        const NvBlastDamageProgram program{NvBlastExtShearGraphShader, NvBlastExtShearSubgraphShader};
-        actor.Damage(program, programParams.get());
-
-        return AZStd::make_pair(AZStd::move(desc), AZStd::move(programParams));
+        AZStd::lock_guard<AZStd::mutex> lock(m_pendingMutex);
+        return !m_pendingEvents.empty();
     }
 
-    DamagePair<NvBlastExtImpactSpreadDamageDesc> DamageManager::ImpactSpreadDamageInternal(
-        BlastActor& actor, float damage, const AZ::Vector3& localPosition, float minRadius, float maxRadius)
+    void DamageManager::ProcessDamage()
     {
-        auto desc = AZStd::make_unique<NvBlastExtImpactSpreadDamageDesc>(NvBlastExtImpactSpreadDamageDesc{
-            damage,
-            {localPosition.GetX(), localPosition.GetY(), localPosition.GetZ()},
-            minRadius,
-            maxRadius,
-        });
-        auto programParams = AZStd::make_unique<NvBlastExtProgramParams>(NvBlastExtProgramParams{
-            desc.get(), m_blastMaterial.GetNativePointer(), actor.GetFamily().GetPxAsset().getAccelerator()});
-
-        const NvBlastDamageProgram program{NvBlastExtImpactSpreadGraphShader, NvBlastExtImpactSpreadSubgraphShader};
-        actor.Damage(program, programParams.get());
-
-        return AZStd::make_pair(AZStd::move(desc), AZStd::move(programParams));
+        AZ_PROFILE_FUNCTION(Physics);
+
+        // The previous batch has been run by the Blast group by now, so its descriptions can be released.
+        m_commands.clear();
+        m_programParams.clear();
+        m_processingEvents.clear();
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_pendingMutex);
+            m_processingEvents.swap(m_pendingEvents);
+        }
+
+        for (const DamageEvent& damageEvent : m_processingEvents)
+        {
+            AddDamageCommands(damageEvent);
+        }
+
+        if (m_commands.empty())
+        {
+            return;
+        }
+
+        // All actors of the family share the same asset and with that the same damage accelerator.
+        NvBlastExtDamageAccelerator* accelerator = m_commands.front().m_actor->GetFamily().GetPxAsset().getAccelerator();
+
+        // All commands are added before taking pointers to their descriptions, so growing the vector can't invalidate them.
+        m_programParams.reserve(m_commands.size());
+        for (DamageCommand& command : m_commands)
+        {
+            const void* desc = AZStd::visit(
+                [](const auto& damageDesc) -> const void*
+                {
+                    return &damageDesc;
+                },
+                command.m_desc);
+            NvBlastExtProgramParams& programParams = m_programParams.emplace_back(
+                NvBlastExtProgramParams{desc, m_blastMaterial.GetNativePointer(), accelerator});
+
+            command.m_actor->Damage(GetDamageProgram(command.m_desc), &programParams);
+        }
     }
 
-    DamagePair<NvBlastExtCapsuleRadialDamageDesc> DamageManager::CapsuleDamageInternal(
-        BlastActor& actor, float damage, const AZ::Vector3& localPosition0, const AZ::Vector3& localPosition1,
-        float minRadius, float maxRadius)
+    void DamageManager::AddDamageCommands(const DamageEvent& damageEvent)
     {
-        auto desc = AZStd::make_unique<NvBlastExtCapsuleRadialDamageDesc>(NvBlastExtCapsuleRadialDamageDesc{
-            damage,
-            {localPosition0.GetX(), localPosition0.GetY(), localPosition0.GetZ()},
-            {localPosition1.GetX(), localPosition1.GetY(), localPosition1.GetZ()},
-            minRadius,
-            maxRadius,
-        });
-        auto programParams = AZStd::make_unique<NvBlastExtProgramParams>(NvBlastExtProgramParams{
-            desc.get(), m_blastMaterial.GetNativePointer(), actor.GetFamily().GetPxAsset().getAccelerator()});
-
-        const NvBlastDamageProgram program{NvBlastExtCapsuleFalloffGraphShader, NvBlastExtCapsuleFalloffSubgraphShader};
-        actor.Damage(program, programParams.get());
-
-        return AZStd::make_pair(AZStd::move(desc), AZStd::move(programParams));
+        if (damageEvent.m_actor)
+        {
+            // The actor might have been destroyed since the damage was queued.
+            if (m_actorTracker.GetActors().find(damageEvent.m_actor) != m_actorTracker.GetActors().end())
+            {
+                m_commands.push_back({damageEvent.m_actor, CalculateDamageDesc(damageEvent, *damageEvent.m_actor)});
+            }
+            return;
+        }
+
+        AZStd::vector<BlastActor*> actors;
+        switch (damageEvent.m_type)
+        {
+        case DamageType::Radial:
+        case DamageType::Shear:
+        case DamageType::ImpactSpread:
+            actors = OverlapSphere(
+                m_actorTracker, damageEvent.m_maxRadius, AZ::Transform::CreateTranslation(damageEvent.m_position0));
+            break;
+        case DamageType::Capsule:
+            actors = OverlapCapsule(m_actorTracker, damageEvent.m_position0, damageEvent.m_position1, damageEvent.m_maxRadius);
+            break;
+        case DamageType::Triangle:
+            AZStd::copy(
+                m_actorTracker.GetActors().begin(), m_actorTracker.GetActors().end(), AZStd::back_inserter(actors));
+            break;
+        }
+
+        for (BlastActor* actor : actors)
+        {
+            m_commands.push_back({actor, CalculateDamageDesc(damageEvent, *actor)});
+        }
     }
 
-    DamagePair<NvBlastExtTriangleIntersectionDamageDesc> DamageManager::TriangleDamageInternal(
-        BlastActor& actor, float damage, const AZ::Vector3& localPosition0, const AZ::Vector3& localPosition1,
-        const AZ::Vector3& localPosition2)
+    DamageManager::DamageDesc DamageManager::CalculateDamageDesc(const DamageEvent& damageEvent, BlastActor& actor)
     {
-        auto desc =
-            AZStd::make_unique<NvBlastExtTriangleIntersectionDamageDesc>(NvBlastExtTriangleIntersectionDamageDesc{
-                damage,
+        const AZ::Vector3 localPosition0 = TransformToLocal(actor, damageEvent.m_position0);
+        switch (damageEvent.m_type)
+        {
+        case DamageType::Shear:
+            {
+                const AZ::Vector3 normal = TransformToLocal(actor, damageEvent.m_normal);
+                return NvBlastExtShearDamageDesc{
+                    damageEvent.m_damage,
+                    {normal.GetX(), normal.GetY(), normal.GetZ()},
+                    {localPosition0.GetX(), localPosition0.GetY(), localPosition0.GetZ()},
+                    damageEvent.m_minRadius,
+                    damageEvent.m_maxRadius,
+                };
+            }
+        case DamageType::ImpactSpread:
+            return NvBlastExtImpactSpreadDamageDesc{
+                damageEvent.m_damage,
                 {localPosition0.GetX(), localPosition0.GetY(), localPosition0.GetZ()},
-                {localPosition1.GetX(), localPosition1.GetY(), localPosition1.GetZ()},
-                {localPosition2.GetX(), localPosition2.GetY(), localPosition2.GetZ()},
-            });
-        auto programParams = AZStd::make_unique<NvBlastExtProgramParams>(NvBlastExtProgramParams{
-            desc.get(), m_blastMaterial.GetNativePointer(), actor.GetFamily().GetPxAsset().getAccelerator()});
-
-        const NvBlastDamageProgram program
-            {NvBlastExtTriangleIntersectionGraphShader, NvBlastExtTriangleIntersectionSubgraphShader};
-        actor.Damage(program, programParams.get());
+                damageEvent.m_minRadius,
+                damageEvent.m_maxRadius,
+            };
+        case DamageType::Capsule:
+            {
+                const AZ::Vector3 localPosition1 = TransformToLocal(actor, damageEvent.m_position1);
+                return NvBlastExtCapsuleRadialDamageDesc{
+                    damageEvent.m_damage,
+                    {localPosition0.GetX(), localPosition0.GetY(), localPosition0.GetZ()},
+                    {localPosition1.GetX(), localPosition1.GetY(), localPosition1.GetZ()},
+                    damageEvent.m_minRadius,
+                    damageEvent.m_maxRadius,
+                };
+            }
+        case DamageType::Triangle:
+            {
+                const AZ::Vector3 localPosition1 = TransformToLocal(actor, damageEvent.m_position1);
+                const AZ::Vector3 localPosition2 = TransformToLocal(actor, damageEvent.m_position2);
+                return NvBlastExtTriangleIntersectionDamageDesc{
+                    damageEvent.m_damage,
+                    {localPosition0.GetX(), localPosition0.GetY(), localPosition0.GetZ()},
+                    {localPosition1.GetX(), localPosition1.GetY(), localPosition1.GetZ()},
+                    {localPosition2.GetX(), localPosition2.GetY(), localPosition2.GetZ()},
+                };
+            }
+        case DamageType::Radial:
+        default:
+            return NvBlastExtRadialDamageDesc{
+                damageEvent.m_damage,
+                {localPosition0.GetX(), localPosition0.GetY(), localPosition0.GetZ()},
+                damageEvent.m_minRadius,
+                damageEvent.m_maxRadius,
+            };
+        }
+    }
 
-        return AZStd::make_pair(AZStd::move(desc), AZStd::move(programParams));
+    NvBlastDamageProgram DamageManager::GetDamageProgram(const DamageDesc& desc)
+    {
+        if (AZStd::holds_alternative<NvBlastExtCapsuleRadialDamageDesc>(desc))
+        {
+            return {NvBlastExtCapsuleFalloffGraphShader, NvBlastExtCapsuleFalloffSubgraphShader};
+        }
+        if (AZStd::holds_alternative<NvBlastExtShearDamageDesc>(desc))
+        {
+            return {NvBlastExtShearGraphShader, NvBlastExtShearSubgraphShader};
+        }
+        if (AZStd::holds_alternative<NvBlastExtTriangleIntersectionDamageDesc>(desc))
+        {
+            return {NvBlastExtTriangleIntersectionGraphShader, NvBlastExtTriangleIntersectionSubgraphShader};
+        }
+        if (AZStd::holds_alternative<NvBlastExtImpactSpreadDamageDesc>(desc))
+        {
+            return {NvBlastExtImpactSpreadGraphShader, NvBlastExtImpactSpreadSubgraphShader};
+        }
+        return {NvBlastExtFalloffGraphShader, NvBlastExtFalloffSubgraphShader};
     }
 
     AZ::Vector3 DamageManager::TransformToLocal(BlastActor& actor, const AZ::Vector3& globalPosition)
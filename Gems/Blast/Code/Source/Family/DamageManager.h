@@ -13,12 +13,18 @@
 #include <Family/ActorTracker.h>
 #include <Blast/BlastSystemBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/variant.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
 
 namespace Blast
 {
     class BlastActor;
 
     // Class responsible to handling damage and how it applies in the Blast family.
+    // Damage is not applied right away, it's accumulated until ProcessDamage is called once per frame by the family.
+    // This way all damage a family receives in a frame, e.g. from many explosions going off at once, is evaluated in
+    // one pass that can run in parallel with the other families.
     class DamageManager
     {
     public:
@@ -38,42 +44,73 @@ namespace Blast
         {
         };
 
-        template<typename T>
-        using DamagePair = AZStd::pair<AZStd::unique_ptr<T>, AZStd::unique_ptr<NvBlastExtProgramParams>>;
-
         DamageManager(const BlastMaterial& blastMaterial, ActorTracker& actorTracker)
             : m_blastMaterial(blastMaterial)
             , m_actorTracker(actorTracker)
         {
         }
 
+        //! Queues damage for all actors of the family that are within the damage's area.
         template<class T, class... Args>
         void Damage(T damageType, float damage, const Args&... args);
 
+        //! Queues damage for a single actor of the family.
         template<class T, class... Args>
         void Damage(T damageType, BlastActor& actor, float damage, const Args&... args);
 
+        //! Applies all damage queued since the last call to the actors of the family.
+        //! The damage descriptions are kept alive until the next call, since the Blast group reads them when it runs the
+        //! damage programs. Can run in parallel with ProcessDamage of other families. Damage queued while this runs is
+        //! applied by the next call.
+        void ProcessDamage();
+
+        //! Returns whether there's damage waiting to be processed.
+        bool HasPendingDamage() const;
+
     private:
+        enum class DamageType : uint8_t
+        {
+            Radial,
+            Capsule,
+            Shear,
+            Triangle,
+            ImpactSpread
+        };
+
+        //! A damage request as it was received, in world space.
+        struct DamageEvent
+        {
+            DamageType m_type;
+            //! The only actor that's damaged, or null to damage all actors in the area.
+            BlastActor* m_actor = nullptr;
+            float m_damage = 0.0f;
+            float m_minRadius = 0.0f;
+            float m_maxRadius = 0.0f;
+            AZ::Vector3 m_position0 = AZ::Vector3::CreateZero();
+            AZ::Vector3 m_position1 = AZ::Vector3::CreateZero();
+            AZ::Vector3 m_position2 = AZ::Vector3::CreateZero();
+            AZ::Vector3 m_normal = AZ::Vector3::CreateZero();
+        };
+
+        using DamageDesc = AZStd::variant<
+            NvBlastExtRadialDamageDesc, NvBlastExtCapsuleRadialDamageDesc, NvBlastExtShearDamageDesc,
+            NvBlastExtTriangleIntersectionDamageDesc, NvBlastExtImpactSpreadDamageDesc>;
+
+        //! The damage of a single event on a single actor, in the actor's local space.
+        struct DamageCommand
+        {
+            BlastActor* m_actor;
+            DamageDesc m_desc;
+        };
+
         template<class T, class... Args>
-        auto CalculateDamage(T damageType, BlastActor& actor, float damage, const Args&... args);
-
-        template<typename T>
-        static void DelegateToSystem(
-            AZStd::unique_ptr<T> desc, AZStd::unique_ptr<NvBlastExtProgramParams> programParams);
-
-        [[nodiscard]] DamagePair<NvBlastExtRadialDamageDesc> RadialDamageInternal(
-            BlastActor& actor, float damage, const AZ::Vector3& localPosition, float minRadius, float maxRadius);
-        [[nodiscard]] DamagePair<NvBlastExtShearDamageDesc> ShearDamageInternal(
-            BlastActor& actor, float damage, const AZ::Vector3& localPosition, float minRadius, float maxRadius,
-            const AZ::Vector3& normal);
-        [[nodiscard]] DamagePair<NvBlastExtImpactSpreadDamageDesc> ImpactSpreadDamageInternal(
-            BlastActor& actor, float damage, const AZ::Vector3& localPosition, float minRadius, float maxRadius);
-        [[nodiscard]] DamagePair<NvBlastExtCapsuleRadialDamageDesc> CapsuleDamageInternal(
-            BlastActor& actor, float damage, const AZ::Vector3& localPosition0, const AZ::Vector3& localPosition1,
-            float minRadius, float maxRadius);
-        [[nodiscard]] DamagePair<NvBlastExtTriangleIntersectionDamageDesc> TriangleDamageInternal(
-            BlastActor& actor, float damage, const AZ::Vector3& localPosition0, const AZ::Vector3& localPosition1,
-            const AZ::Vector3& localPosition2);
+        DamageEvent CreateDamageEvent(T damageType, float damage, const Args&... args);
+
+        void QueueDamage(const DamageEvent& damageEvent);
+        void AddDamageCommands(const DamageEvent& damageEvent);
+
+        static DamageDesc CalculateDamageDesc(const DamageEvent& damageEvent, BlastActor& actor);
+        static NvBlastDamageProgram GetDamageProgram(const DamageDesc& desc);
 
         static AZStd::vector<BlastActor*> OverlapSphere(
             ActorTracker& actorTracker, float radius, const AZ::Transform& pose);
@@ -84,6 +121,14 @@ namespace Blast
 
         BlastMaterial m_blastMaterial;
         ActorTracker& m_actorTracker;
+
+        mutable AZStd::mutex m_pendingMutex;
+        AZStd::vector<DamageEvent> m_pendingEvents;
+
+        // Storage for the last processed batch, reused between frames. The program params point into the commands.
+        AZStd::vector<DamageEvent> m_processingEvents;
+        AZStd::vector<DamageCommand> m_commands;
+        AZStd::vector<NvBlastExtProgramParams> m_programParams;
     };
 
     template<class T, class... Args>
@@ -95,32 +140,7 @@ namespace Blast
             return;
         }
 
-        std::tuple<const Args&...> tuple(args...);
-
-        AZStd::vector<BlastActor*> actors;
-
-        if constexpr (
-            std::is_same<T, struct RadialDamage>::value || std::is_same<T, struct ImpactSpreadDamage>::value ||
-            std::is_same<T, struct ShearDamage>::value)
-        {
-            actors =
-                OverlapSphere(m_actorTracker, std::get<2>(tuple), AZ::Transform::CreateTranslation(std::get<0>(tuple)));
-        }
-        else if constexpr (std::is_same<T, struct CapsuleDamage>::value)
-        {
-            actors = OverlapCapsule(m_actorTracker, std::get<0>(tuple), std::get<1>(tuple), std::get<3>(tuple));
-        }
-        else if constexpr (std::is_same<T, struct TriangleDamage>::value)
-        {
-            AZStd::copy(
-                m_actorTracker.GetActors().begin(), m_actorTracker.GetActors().end(), AZStd::back_inserter(actors));
-        }
-
-        for (auto* actor : actors)
-        {
-            auto [desc, programParams] = CalculateDamage(damageType, *actor, normalizedDamage, args...);
-            DelegateToSystem(AZStd::move(desc), AZStd::move(programParams));
-        }
+        QueueDamage(CreateDamageEvent(damageType, normalizedDamage, args...));
     }
 
     template<class T, class... Args>
@@ -132,53 +152,55 @@ namespace Blast
             return;
         }
 
-        auto [desc, programParams] = CalculateDamage(damageType, actor, normalizedDamage, args...);
-        DelegateToSystem(AZStd::move(desc), AZStd::move(programParams));
+        DamageEvent damageEvent = CreateDamageEvent(damageType, normalizedDamage, args...);
+        damageEvent.m_actor = &actor;
+        QueueDamage(damageEvent);
     }
 
     template<class T, class... Args>
-    auto DamageManager::CalculateDamage([[maybe_unused]] T damageType, BlastActor& actor, float damage, const Args&... args)
+    DamageManager::DamageEvent DamageManager::CreateDamageEvent([[maybe_unused]] T damageType, float damage, const Args&... args)
     {
+        std::tuple<const Args&...> tuple(args...);
+
+        DamageEvent damageEvent;
+        damageEvent.m_damage = damage;
         if constexpr (std::is_same<T, struct RadialDamage>::value)
         {
-            std::tuple<const Args&...> tuple(args...);
-            return RadialDamageInternal(
-                actor, damage, TransformToLocal(actor, std::get<0>(tuple)), std::get<1>(tuple), std::get<2>(tuple));
+            damageEvent.m_type = DamageType::Radial;
+            damageEvent.m_position0 = std::get<0>(tuple);
+            damageEvent.m_minRadius = std::get<1>(tuple);
+            damageEvent.m_maxRadius = std::get<2>(tuple);
         }
         else if constexpr (std::is_same<T, struct ShearDamage>::value)
         {
-            std::tuple<const Args&...> tuple(args...);
-            AZ::Vector3 position = TransformToLocal(actor, std::get<0>(tuple));
-            AZ::Vector3 normal = TransformToLocal(actor, std::get<3>(tuple));
-            return ShearDamageInternal(actor, damage, position, std::get<1>(tuple), std::get<2>(tuple), normal);
+            damageEvent.m_type = DamageType::Shear;
+            damageEvent.m_position0 = std::get<0>(tuple);
+            damageEvent.m_minRadius = std::get<1>(tuple);
+            damageEvent.m_maxRadius = std::get<2>(tuple);
+            damageEvent.m_normal = std::get<3>(tuple);
         }
         else if constexpr (std::is_same<T, struct ImpactSpreadDamage>::value)
         {
-            std::tuple<const Args&...> tuple(args...);
-            return ImpactSpreadDamageInternal(
-                actor, damage, TransformToLocal(actor, std::get<0>(tuple)), std::get<1>(tuple), std::get<2>(tuple));
+            damageEvent.m_type = DamageType::ImpactSpread;
+            damageEvent.m_position0 = std::get<0>(tuple);
+            damageEvent.m_minRadius = std::get<1>(tuple);
+            damageEvent.m_maxRadius = std::get<2>(tuple);
         }
         else if constexpr (std::is_same<T, struct CapsuleDamage>::value)
         {
-            std::tuple<const Args&...> tuple(args...);
-            return CapsuleDamageInternal(
-                actor, damage, TransformToLocal(actor, std::get<0>(tuple)), TransformToLocal(actor, std::get<1>(tuple)),
-                std::get<2>(tuple), std::get<3>(tuple));
+            damageEvent.m_type = DamageType::Capsule;
+            damageEvent.m_position0 = std::get<0>(tuple);
+            damageEvent.m_position1 = std::get<1>(tuple);
+            damageEvent.m_minRadius = std::get<2>(tuple);
+            damageEvent.m_maxRadius = std::get<3>(tuple);
         }
         else if constexpr (std::is_same<T, struct TriangleDamage>::value)
         {
-            std::tuple<const Args&...> tuple(args...);
-            return TriangleDamageInternal(
-                actor, damage, TransformToLocal(actor, std::get<0>(tuple)), TransformToLocal(actor, std::get<1>(tuple)),
-                TransformToLocal(actor, std::get<2>(tuple)));
+            damageEvent.m_type = DamageType::Triangle;
+            damageEvent.m_position0 = std::get<0>(tuple);
+            damageEvent.m_position1 = std::get<1>(tuple);
+            damageEvent.m_position2 = std::get<2>(tuple);
         }
-    }
-
-    template<typename T>
-    void DamageManager::DelegateToSystem(
-        AZStd::unique_ptr<T> desc, AZStd::unique_ptr<NvBlastExtProgramParams> programParams)
-    {
-        AZ::Interface<Blast::BlastSystemRequests>::Get()->AddDamageDesc(AZStd::move(desc));
-        AZ::Interface<Blast::BlastSystemRequests>::Get()->AddProgramParams(AZStd::move(programParams));
+        return damageEvent;
     }
 } // namespace Blast
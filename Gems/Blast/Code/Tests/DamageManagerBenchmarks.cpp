@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <Family/DamageManager.h>
+#include <Mocks/BlastMocks.h>
+
+#include <benchmark/benchmark.h>
+
+namespace Blast
+{
+    //! Actor that counts the damage it receives instead of handing it to the Blast toolkit, so the benchmark measures the
+    //! damage evaluation only.
+    class BenchmarkBlastActor : public FakeBlastActor
+    {
+    public:
+        BenchmarkBlastActor(const BlastFamily& family, const AZ::Transform& transform)
+            : FakeBlastActor(false, aznew FakeRigidBody(AZ::EntityId(0), transform), new MockTkActor())
+            , m_family(family)
+        {
+        }
+
+        void Damage([[maybe_unused]] const NvBlastDamageProgram& program, [[maybe_unused]] NvBlastExtProgramParams* programParams) override
+        {
+            ++m_damageCount;
+        }
+
+        const BlastFamily& GetFamily() const override
+        {
+            return m_family;
+        }
+
+        const BlastFamily& m_family;
+        size_t m_damageCount = 0;
+    };
+
+    //! Headless stress test of many explosions going off in the same frame, each damaging every actor of a family.
+    //! The first argument is the number of families, the second one the number of explosions per family.
+    class DamageManagerBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        static constexpr size_t ActorsPerFamily = 32;
+
+        struct BenchmarkFamily
+        {
+            FakeBlastFamily m_family;
+            ActorTracker m_actorTracker;
+            AZStd::vector<AZStd::unique_ptr<BenchmarkBlastActor>> m_actors;
+            AZStd::unique_ptr<DamageManager> m_damageManager;
+        };
+
+        void internalSetUp(const benchmark::State& state)
+        {
+            AZ::JobManagerDesc jobManagerDesc;
+            for (unsigned int i = 0; i < AZStd::thread::hardware_concurrency(); ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+
+            m_families.resize(aznumeric_cast<size_t>(state.range(0)));
+            for (size_t familyIndex = 0; familyIndex < m_families.size(); ++familyIndex)
+            {
+                auto family = AZStd::make_unique<BenchmarkFamily>();
+                EXPECT_CALL(family->m_family.m_pxAsset, getAccelerator()).WillRepeatedly(testing::Return(nullptr));
+                for (size_t actorIndex = 0; actorIndex < ActorsPerFamily; ++actorIndex)
+                {
+                    const AZ::Transform transform = AZ::Transform::CreateTranslation(
+                        AZ::Vector3(aznumeric_cast<float>(familyIndex) * 10.0f, aznumeric_cast<float>(actorIndex), 0.0f));
+                    family->m_actors.push_back(AZStd::make_unique<BenchmarkBlastActor>(family->m_family, transform));
+                    family->m_actorTracker.AddActor(family->m_actors.back().get());
+                }
+                family->m_damageManager =
+                    AZStd::make_unique<DamageManager>(BlastMaterial(BlastMaterialConfiguration()), family->m_actorTracker);
+                m_families[familyIndex] = AZStd::move(family);
+            }
+            m_explosionsPerFamily = aznumeric_cast<size_t>(state.range(1));
+        }
+
+        void internalTearDown()
+        {
+            for (auto& family : m_families)
+            {
+                for (auto& actor : family->m_actors)
+                {
+                    family->m_actorTracker.RemoveActor(actor.get());
+                }
+            }
+            m_families = {};
+            m_jobContext = nullptr;
+            m_jobManager = nullptr;
+        }
+
+        void QueueExplosions()
+        {
+            for (auto& family : m_families)
+            {
+                for (size_t explosion = 0; explosion < m_explosionsPerFamily; ++explosion)
+                {
+                    const AZ::Vector3 position(aznumeric_cast<float>(explosion % 8), aznumeric_cast<float>(explosion % 5), 0.0f);
+                    for (auto& actor : family->m_actors)
+                    {
+                        family->m_damageManager->Damage(DamageManager::RadialDamage{}, *actor, 1.0f, position, 1.0f, 5.0f);
+                    }
+                }
+            }
+        }
+
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+        AZStd::vector<AZStd::unique_ptr<BenchmarkFamily>> m_families;
+        size_t m_explosionsPerFamily = 0;
+    };
+
+    BENCHMARK_DEFINE_F(DamageManagerBenchmark, BM_ProcessDamageSerial)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            QueueExplosions();
+            for (auto& family : m_families)
+            {
+                family->m_damageManager->ProcessDamage();
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1) * ActorsPerFamily);
+    }
+    BENCHMARK_REGISTER_F(DamageManagerBenchmark, BM_ProcessDamageSerial)
+        ->Args({ 16, 4 })
+        ->Args({ 64, 16 })
+        ->Args({ 256, 16 })
+        ->Unit(benchmark::kMicrosecond);
+
+    // One job per family, the same way the BlastSystemComponent applies the damage of its families.
+    BENCHMARK_DEFINE_F(DamageManagerBenchmark, BM_ProcessDamageParallel)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            QueueExplosions();
+            AZ::JobCompletion jobCompletion(m_jobContext.get());
+            for (auto& family : m_families)
+            {
+                AZ::Job* job = AZ::CreateJobFunction(
+                    [damageManager = family->m_damageManager.get()]()
+                    {
+                        damageManager->ProcessDamage();
+                    },
+                    true, m_jobContext.get());
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1) * ActorsPerFamily);
+    }
+    BENCHMARK_REGISTER_F(DamageManagerBenchmark, BM_ProcessDamageParallel)
+        ->Args({ 16, 4 })
+        ->Args({ 64, 16 })
+        ->Args({ 256, 16 })
+        ->Unit(benchmark::kMicrosecond)
+        ->UseRealTime();
+} // namespace Blast
+#endif
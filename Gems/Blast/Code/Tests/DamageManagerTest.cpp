@@ -45,10 +45,18 @@ namespace Blast
             m_systemHandler = AZStd::make_shared<MockBlastSystemBusHandler>();
             m_damageManager =
                 AZStd::make_unique<DamageManager>(BlastMaterial(BlastMaterialConfiguration()), m_actorTracker);
+            for (FakeBlastActor* actor : m_actorFactory->m_mockActors)
+            {
+                m_actorTracker.AddActor(actor);
+            }
         }
 
         void TearDown() override
         {
+            for (FakeBlastActor* actor : m_actorFactory->m_mockActors)
+            {
+                m_actorTracker.RemoveActor(actor);
+            }
             m_mockFamily = nullptr;
             m_actorFactory = nullptr;
             m_systemHandler = nullptr;
@@ -70,13 +78,11 @@ namespace Blast
             EXPECT_CALL(*m_actorFactory->m_mockActors[0], GetFamily()).Times(1).WillOnce(ReturnRef(*m_mockFamily));
             EXPECT_CALL(m_mockFamily->m_pxAsset, getAccelerator()).Times(1).WillOnce(Return(nullptr));
             EXPECT_CALL(*m_actorFactory->m_mockActors[0], Damage(_, _)).Times(1);
-            EXPECT_CALL(*m_systemHandler, AddDamageDesc(testing::An<AZStd::unique_ptr<NvBlastExtRadialDamageDesc>>()))
-                .Times(1);
-            EXPECT_CALL(*m_systemHandler, AddProgramParams(_)).Times(1);
         }
 
         m_damageManager->Damage(
             DamageManager::RadialDamage{}, *m_actorFactory->m_mockActors[0], Constants::DamageAmount, AZ::Vector3{0, 0, 0}, Constants::MinRadius, Constants::MaxRadius);
+        m_damageManager->ProcessDamage();
     }
 
     TEST_F(DamageManagerTest, CapsuleDamage_SUITE_sandbox)
@@ -87,15 +93,12 @@ namespace Blast
             EXPECT_CALL(*m_actorFactory->m_mockActors[0], GetFamily()).Times(1).WillOnce(ReturnRef(*m_mockFamily));
             EXPECT_CALL(m_mockFamily->m_pxAsset, getAccelerator()).Times(1).WillOnce(Return(nullptr));
             EXPECT_CALL(*m_actorFactory->m_mockActors[0], Damage(_, _)).Times(1);
-            EXPECT_CALL(
-                *m_systemHandler, AddDamageDesc(testing::An<AZStd::unique_ptr<NvBlastExtCapsuleRadialDamageDesc>>()))
-                .Times(1);
-            EXPECT_CALL(*m_systemHandler, AddProgramParams(_)).Times(1);
         }
 
         m_damageManager->Damage(
             DamageManager::CapsuleDamage{}, *m_actorFactory->m_mockActors[0], Constants::DamageAmount,
             AZ::Vector3{0, 0, 0}, AZ::Vector3{1, 0, 0}, Constants::MinRadius, Constants::MaxRadius);
+        m_damageManager->ProcessDamage();
     }
 
     TEST_F(DamageManagerTest, ShearDamage_SUITE_sandbox)
@@ -106,14 +109,12 @@ namespace Blast
             EXPECT_CALL(*m_actorFactory->m_mockActors[0], GetFamily()).Times(1).WillOnce(ReturnRef(*m_mockFamily));
             EXPECT_CALL(m_mockFamily->m_pxAsset, getAccelerator()).Times(1).WillOnce(Return(nullptr));
             EXPECT_CALL(*m_actorFactory->m_mockActors[0], Damage(_, _)).Times(1);
-            EXPECT_CALL(*m_systemHandler, AddDamageDesc(testing::An<AZStd::unique_ptr<NvBlastExtShearDamageDesc>>()))
-                .Times(1);
-            EXPECT_CALL(*m_systemHandler, AddProgramParams(_)).Times(1);
         }
 
         m_damageManager->Damage(
             DamageManager::ShearDamage{}, *m_actorFactory->m_mockActors[0], Constants::DamageAmount,
             AZ::Vector3{0, 0, 0}, Constants::MinRadius, Constants::MaxRadius, AZ ::Vector3{1, 0, 0});
+        m_damageManager->ProcessDamage();
     }
 
     TEST_F(DamageManagerTest, TriangleDamage_SUITE_sandbox)
@@ -124,16 +125,12 @@ namespace Blast
             EXPECT_CALL(*m_actorFactory->m_mockActors[0], GetFamily()).Times(1).WillOnce(ReturnRef(*m_mockFamily));
             EXPECT_CALL(m_mockFamily->m_pxAsset, getAccelerator()).Times(1).WillOnce(Return(nullptr));
             EXPECT_CALL(*m_actorFactory->m_mockActors[0], Damage(_, _)).Times(1);
-            EXPECT_CALL(
-                *m_systemHandler,
-                AddDamageDesc(testing::An<AZStd::unique_ptr<NvBlastExtTriangleIntersectionDamageDesc>>()))
-                .Times(1);
-            EXPECT_CALL(*m_systemHandler, AddProgramParams(_)).Times(1);
         }
 
         m_damageManager->Damage(
             DamageManager::TriangleDamage{}, *m_actorFactory->m_mockActors[0], Constants::DamageAmount,
             AZ::Vector3{0, 0, 0}, AZ::Vector3{1, 0, 0}, AZ::Vector3{0, 1, 0});
+        m_damageManager->ProcessDamage();
     }
 
     TEST_F(DamageManagerTest, ImpactSpreadDamage_SUITE_sandbox)
@@ -144,14 +141,65 @@ namespace Blast
             EXPECT_CALL(*m_actorFactory->m_mockActors[0], GetFamily()).Times(1).WillOnce(ReturnRef(*m_mockFamily));
             EXPECT_CALL(m_mockFamily->m_pxAsset, getAccelerator()).Times(1).WillOnce(Return(nullptr));
             EXPECT_CALL(*m_actorFactory->m_mockActors[0], Damage(_, _)).Times(1);
-            EXPECT_CALL(
-                *m_systemHandler, AddDamageDesc(testing::An<AZStd::unique_ptr<NvBlastExtImpactSpreadDamageDesc>>()))
-                .Times(1);
-            EXPECT_CALL(*m_systemHandler, AddProgramParams(_)).Times(1);
         }
 
         m_damageManager->Damage(
             DamageManager::ImpactSpreadDamage{}, *m_actorFactory->m_mockActors[0], Constants::DamageAmount,
             AZ::Vector3{0, 0, 0}, Constants::MinRadius, Constants::MaxRadius);
+        m_damageManager->ProcessDamage();
+    }
+
+    TEST_F(DamageManagerTest, Damage_NotAppliedUntilProcessed_SUITE_sandbox)
+    {
+        EXPECT_CALL(*m_actorFactory->m_mockActors[0], GetFamily()).WillRepeatedly(ReturnRef(*m_mockFamily));
+        EXPECT_CALL(m_mockFamily->m_pxAsset, getAccelerator()).WillRepeatedly(Return(nullptr));
+
+        EXPECT_CALL(*m_actorFactory->m_mockActors[0], Damage(_, _)).Times(0);
+        m_damageManager->Damage(
+            DamageManager::RadialDamage{}, *m_actorFactory->m_mockActors[0], Constants::DamageAmount, AZ::Vector3{0, 0, 0},
+            Constants::MinRadius, Constants::MaxRadius);
+        EXPECT_TRUE(m_damageManager->HasPendingDamage());
+        testing::Mock::VerifyAndClearExpectations(m_actorFactory->m_mockActors[0]);
+
+        EXPECT_CALL(*m_actorFactory->m_mockActors[0], GetFamily()).WillRepeatedly(ReturnRef(*m_mockFamily));
+        EXPECT_CALL(*m_actorFactory->m_mockActors[0], Damage(_, _)).Times(1);
+        m_damageManager->ProcessDamage();
+        EXPECT_FALSE(m_damageManager->HasPendingDamage());
+    }
+
+    TEST_F(DamageManagerTest, Damage_MultipleEventsAppliedInOneBatch_SUITE_sandbox)
+    {
+        EXPECT_CALL(m_mockFamily->m_pxAsset, getAccelerator()).WillRepeatedly(Return(nullptr));
+        for (FakeBlastActor* actor : m_actorFactory->m_mockActors)
+        {
+            EXPECT_CALL(*actor, GetFamily()).WillRepeatedly(ReturnRef(*m_mockFamily));
+            EXPECT_CALL(*actor, Damage(_, _)).Times(2);
+        }
+
+        for (FakeBlastActor* actor : m_actorFactory->m_mockActors)
+        {
+            m_damageManager->Damage(
+                DamageManager::RadialDamage{}, *actor, Constants::DamageAmount, AZ::Vector3{0, 0, 0}, Constants::MinRadius,
+                Constants::MaxRadius);
+            m_damageManager->Damage(
+                DamageManager::CapsuleDamage{}, *actor, Constants::DamageAmount, AZ::Vector3{0, 0, 0}, AZ::Vector3{1, 0, 0},
+                Constants::MinRadius, Constants::MaxRadius);
+        }
+        m_damageManager->ProcessDamage();
+
+        // Nothing is left to apply on the next frame.
+        m_damageManager->ProcessDamage();
+    }
+
+    TEST_F(DamageManagerTest, Damage_ActorRemovedBeforeProcessing_NotDamaged_SUITE_sandbox)
+    {
+        EXPECT_CALL(*m_actorFactory->m_mockActors[0], Damage(_, _)).Times(0);
+
+        m_damageManager->Damage(
+            DamageManager::RadialDamage{}, *m_actorFactory->m_mockActors[0], Constants::DamageAmount, AZ::Vector3{0, 0, 0},
+            Constants::MinRadius, Constants::MaxRadius);
+        m_actorTracker.RemoveActor(m_actorFactory->m_mockActors[0]);
+        m_damageManager->ProcessDamage();
+        m_actorTracker.AddActor(m_actorFactory->m_mockActors[0]);
     }
 } // namespace Blast
@@ -9,6 +9,7 @@
 set(FILES
     Tests/BlastTest.cpp
     Tests/DamageManagerTest.cpp
+    Tests/DamageManagerBenchmarks.cpp
     Tests/Mocks/BlastMocks.h
     Tests/ActorRenderManagerTest.cpp
     Tests/BlastFamilyTest.cpp
@@ -339,6 +339,11 @@ public: // member functions
     //! cleared and rebuilt on the next render.
     virtual void MarkRenderGraphDirty() = 0;
 
+    //! Mark the render graph as out of date for the given element only. This is used when an element's primitives
+    //! have changed but their number, size and render state have not, in which case the graph patches the element's
+    //! primitives in place on the next render instead of being rebuilt. Otherwise it is the same as MarkRenderGraphDirty.
+    virtual void MarkRenderGraphElementDirty(AZ::EntityId elementId) = 0;
+
 public: // static member data
 
     //! Only one component on an entity can implement the events
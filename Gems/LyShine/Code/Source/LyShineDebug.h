@@ -61,6 +61,8 @@ public: // static member functions
         bool m_wasBuiltThisFrame;
         AZ::u64 m_timeGraphLastBuiltMs;
         bool m_isReusingRenderTargets;
+        AZ::u64 m_numRebuilds;          //!< Number of times the render graph was rebuilt from scratch
+        AZ::u64 m_numElementPatches;    //!< Number of times an element's primitives were patched in place instead
     };
 
     struct DebugInfoTextureUsage
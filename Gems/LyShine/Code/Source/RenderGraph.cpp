@@ -148,15 +148,8 @@ namespace LyShine
 
         drawSrg->Compile();
 
-        // Add the indexed primitives to the dynamic draw context for drawing
-        //
-        // [LYSHINE_ATOM_TODO][ATOM-15073] Combine into a single DrawIndexed call to take advantage of the draw call
-        // optimization done by this RenderGraph. This option will be added to DynamicDrawContext. For
-        // now we could combine the vertices ourselves
-        for (const LyShine::UiPrimitive& primitive : m_primitives)
-        {
-            dynamicDraw->DrawIndexed(primitive.m_vertices, primitive.m_numVertices, primitive.m_indices, primitive.m_numIndices, AZ::RHI::IndexFormat::Uint16, drawSrg);
-        }
+        // Draw all the primitives with a single draw call using the batched vertices and indices
+        dynamicDraw->DrawIndexed(m_vertices.data(), m_totalNumVertices, m_indices.data(), m_totalNumIndices, AZ::RHI::IndexFormat::Uint16, drawSrg);
 
         uiRenderer->SetBaseState(prevBaseState);
     }
@@ -168,10 +161,30 @@ namespace LyShine
         primitive->m_next = nullptr;
         m_primitives.push_back(*primitive);
 
+        m_vertices.insert(m_vertices.end(), primitive->m_vertices, primitive->m_vertices + primitive->m_numVertices);
+        m_indices.resize_no_construct(m_totalNumIndices + primitive->m_numIndices);
+        for (int i = 0; i < primitive->m_numIndices; ++i)
+        {
+            m_indices[m_totalNumIndices + i] = static_cast<uint16>(primitive->m_indices[i] + m_totalNumVertices);
+        }
+
         m_totalNumVertices += primitive->m_numVertices;
         m_totalNumIndices += primitive->m_numIndices;
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void PrimitiveListRenderNode::UpdatePrimitive(const LyShine::UiPrimitive* primitive, int vertexOffset, int indexOffset)
+    {
+        AZ_Assert(vertexOffset + primitive->m_numVertices <= m_totalNumVertices && indexOffset + primitive->m_numIndices <= m_totalNumIndices,
+            "Primitive does not fit in the range it was added with");
+
+        memcpy(m_vertices.data() + vertexOffset, primitive->m_vertices, sizeof(LyShine::UiPrimitiveVertex) * primitive->m_numVertices);
+        for (int i = 0; i < primitive->m_numIndices; ++i)
+        {
+            m_indices[indexOffset + i] = static_cast<uint16>(primitive->m_indices[i] + vertexOffset);
+        }
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     LyShine::UiPrimitiveList& PrimitiveListRenderNode::GetPrimitives() const
     {
@@ -612,6 +625,12 @@ namespace LyShine
         }
         m_renderNodeListStack.push(&m_renderNodes);
 
+        // the recorded primitives point into the deleted render nodes
+        m_recordedElements.clear();
+        m_recordedPrimitives.clear();
+        m_dirtyElements.clear();
+        m_currentElement = nullptr;
+
         m_isDirty = true;
         m_renderToRenderTargetCount = 0;
 
@@ -624,6 +643,11 @@ namespace LyShine
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::BeginMask(bool isMaskingEnabled, bool useAlphaTest, bool drawBehind, bool drawInFront)
     {
+        if (!CheckGraphChangeAllowed())
+        {
+            return;
+        }
+
         // this uses pool allocator
         MaskRenderNode* maskRenderNode = new MaskRenderNode(m_currentMask, isMaskingEnabled, useAlphaTest, drawBehind, drawInFront);
 
@@ -634,6 +658,11 @@ namespace LyShine
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::StartChildrenForMask()
     {
+        if (!CheckGraphChangeAllowed())
+        {
+            return;
+        }
+
         AZ_Assert(m_currentMask, "Calling StartChildrenForMask while not defining a mask");
         m_renderNodeListStack.pop();
         m_renderNodeListStack.push(&m_currentMask->GetContentRenderNodeList());
@@ -642,6 +671,11 @@ namespace LyShine
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::EndMask()
     {
+        if (!CheckGraphChangeAllowed())
+        {
+            return;
+        }
+
         AZ_Assert(m_currentMask, "Calling EndMask while not defining a mask");
         if (m_currentMask)
         {
@@ -668,6 +702,11 @@ namespace LyShine
     void RenderGraph::BeginRenderToTexture(AZ::Data::Instance<AZ::RPI::AttachmentImage> attachmentImage,
         const AZ::Vector2& viewportTopLeft, const AZ::Vector2& viewportSize, const AZ::Color& clearColor)
     {
+        if (!CheckGraphChangeAllowed())
+        {
+            return;
+        }
+
         // this uses pool allocator
         RenderTargetRenderNode* renderTargetRenderNode = new RenderTargetRenderNode(
             m_currentRenderTarget, attachmentImage,
@@ -681,6 +720,11 @@ namespace LyShine
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::EndRenderToTexture()
     {
+        if (!CheckGraphChangeAllowed())
+        {
+            return;
+        }
+
         AZ_Assert(m_currentRenderTarget, "Calling EndRenderToTexture while not defining a render target node");
         if (m_currentRenderTarget)
         {
@@ -715,7 +759,20 @@ namespace LyShine
             AZ::RHI::TargetBlendState blendModeState = GetBlendModeState(blendMode, isShaderOutputPremultAlpha);
 
             PrimitiveListRenderNode* renderNodeToAddTo = nullptr;
-            if (!renderNodeList->empty())
+            const RecordedPrimitive* primitiveToPatch = nullptr;
+            if (m_patchElement)
+            {
+                // When patching, the primitive must replace the recorded one in the same render node
+                primitiveToPatch = GetPrimitiveToPatch(primitive, isTextureSRGB, blendModeState, isPreMultiplyAlpha, AlphaMaskType::None);
+                texUnit = primitiveToPatch ? primitiveToPatch->m_renderNode->FindTexture(texture, isClampTextureMode) : -1;
+                if (texUnit == -1)
+                {
+                    m_patchFailed = true;
+                    return;
+                }
+                renderNodeToAddTo = primitiveToPatch->m_renderNode;
+            }
+            else if (!renderNodeList->empty())
             {
                 RenderNode* lastRenderNode = renderNodeList->back();
 
@@ -764,8 +821,16 @@ namespace LyShine
                 }
             }
 
-            // add this primitive to the render node
-            renderNodeToAddTo->AddPrimitive(primitive);
+            if (primitiveToPatch)
+            {
+                renderNodeToAddTo->UpdatePrimitive(primitive, primitiveToPatch->m_vertexOffset, primitiveToPatch->m_indexOffset);
+            }
+            else
+            {
+                // add this primitive to the render node
+                RecordPrimitive(primitive, renderNodeToAddTo);
+                renderNodeToAddTo->AddPrimitive(primitive);
+            }
         }
     }
 
@@ -795,7 +860,24 @@ namespace LyShine
             AlphaMaskType alphaMaskType = isShaderOutputPremultAlpha ? AlphaMaskType::ModulateAlphaAndColor : AlphaMaskType::ModulateAlpha;
 
             PrimitiveListRenderNode* renderNodeToAddTo = nullptr;
-            if (!renderNodeList->empty())
+            const RecordedPrimitive* primitiveToPatch = nullptr;
+            if (m_patchElement)
+            {
+                // When patching, the primitive must replace the recorded one in the same render node
+                primitiveToPatch = GetPrimitiveToPatch(primitive, isTextureSRGB, blendModeState, isPreMultiplyAlpha, alphaMaskType);
+                if (primitiveToPatch)
+                {
+                    texUnit0 = primitiveToPatch->m_renderNode->FindTexture(contentAttachmentImage, true);
+                    texUnit1 = primitiveToPatch->m_renderNode->FindTexture(maskAttachmentImage, true);
+                }
+                if (texUnit0 == -1 || texUnit1 == -1)
+                {
+                    m_patchFailed = true;
+                    return;
+                }
+                renderNodeToAddTo = primitiveToPatch->m_renderNode;
+            }
+            else if (!renderNodeList->empty())
             {
                 RenderNode* lastRenderNode = renderNodeList->back();
 
@@ -848,8 +930,16 @@ namespace LyShine
                 }
             }
 
-            // add this primitive to the render node
-            renderNodeToAddTo->AddPrimitive(primitive);
+            if (primitiveToPatch)
+            {
+                renderNodeToAddTo->UpdatePrimitive(primitive, primitiveToPatch->m_vertexOffset, primitiveToPatch->m_indexOffset);
+            }
+            else
+            {
+                // add this primitive to the render node
+                RecordPrimitive(primitive, renderNodeToAddTo);
+                renderNodeToAddTo->AddPrimitive(primitive);
+            }
         }
     }
 
@@ -864,6 +954,9 @@ namespace LyShine
 
         static uint16 indices[numIndicesInQuad] = { 0, 1, 2, 2, 3, 0 };
 
+        // Dynamic quads are recreated each time an element renders, so they can't be patched
+        CheckGraphChangeAllowed();
+
         DynamicQuad* quad = new DynamicQuad;
         for (int i = 0; i < numVertsInQuad; ++i)
         {
@@ -1003,6 +1096,10 @@ namespace LyShine
         // sort the render targets so that more deeply nested ones are rendered first
         std::sort(m_renderTargetRenderNodes.begin(), m_renderTargetRenderNodes.end(),
             RenderTargetRenderNode::CompareNestLevelForSort);
+
+#ifndef _RELEASE
+        ++m_numRebuilds;
+#endif
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1036,6 +1133,113 @@ namespace LyShine
         }
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::BeginElement(AZ::EntityId elementId)
+    {
+        auto insertResult = m_recordedElements.try_emplace(elementId);
+        RecordedElement& element = insertResult.first->second;
+        if (insertResult.second)
+        {
+            element.m_alphaFade = GetAlphaFade();
+            element.m_isRenderingToMask = m_isRenderingToMask;
+            element.m_firstPrimitive = static_cast<int>(m_recordedPrimitives.size());
+
+            // Render targets are only rendered to for a few frames after the graph is built, so changes to the
+            // primitives inside of them would not be visible
+            element.m_isPatchable = m_renderTargetNestLevel == 0;
+        }
+        else
+        {
+            // The element is rendered more than once (e.g. as a mask), its primitives are not contiguous
+            element.m_isPatchable = false;
+        }
+
+        m_currentElement = &element;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::EndElement()
+    {
+        m_currentElement = nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RenderGraph::MarkElementDirty(AZ::EntityId elementId)
+    {
+        if (m_isDirty)
+        {
+            // the whole graph is going to be rebuilt anyway
+            return;
+        }
+
+        auto elementIter = m_recordedElements.find(elementId);
+        if (elementIter == m_recordedElements.end() || !elementIter->second.m_isPatchable)
+        {
+            SetDirtyFlag(true);
+            return;
+        }
+
+        if (!elementIter->second.m_isDirty)
+        {
+            elementIter->second.m_isDirty = true;
+            m_dirtyElements.push_back(elementId);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool RenderGraph::HasDirtyElements() const
+    {
+        return !m_dirtyElements.empty();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool RenderGraph::PatchDirtyElements(const AZStd::function<void(AZ::EntityId elementId)>& renderElement)
+    {
+        const bool priorIsRenderingToMask = m_isRenderingToMask;
+        m_patchFailed = false;
+
+        for (const AZ::EntityId& elementId : m_dirtyElements)
+        {
+            RecordedElement& element = m_recordedElements.find(elementId)->second;
+            element.m_isDirty = false;
+
+            // render the element again in the same state that it was rendered in when the graph was built
+            m_patchElement = &element;
+            m_patchPrimitiveIndex = element.m_firstPrimitive;
+            m_isRenderingToMask = element.m_isRenderingToMask;
+            PushOverrideAlphaFade(element.m_alphaFade);
+
+            renderElement(elementId);
+
+            PopAlphaFade();
+
+            // every recorded primitive must have been replaced
+            if (m_patchFailed || m_patchPrimitiveIndex != element.m_firstPrimitive + element.m_numPrimitives)
+            {
+                m_patchFailed = true;
+                break;
+            }
+
+#ifndef _RELEASE
+            ++m_numElementPatches;
+#endif
+        }
+
+        m_patchElement = nullptr;
+        m_isRenderingToMask = priorIsRenderingToMask;
+
+        if (m_patchFailed)
+        {
+            // some primitives may already be patched but the rest of the graph is out of date, start over
+            m_patchFailed = false;
+            SetDirtyFlag(true);
+            return false;
+        }
+
+        m_dirtyElements.clear();
+        return true;
+    }
+
 #ifndef _RELEASE
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::ValidateGraph()
@@ -1064,6 +1268,8 @@ namespace LyShine
         info.m_wasBuiltThisFrame = m_wasBuiltThisFrame;
         info.m_timeGraphLastBuiltMs = m_timeGraphLastBuiltMs;
         info.m_isReusingRenderTargets = m_renderToRenderTargetCount >= 2 && !m_renderTargetRenderNodes.empty();
+        info.m_numRebuilds = m_numRebuilds;
+        info.m_numElementPatches = m_numElementPatches;
 
         m_wasBuiltThisFrame = false;
 
@@ -1481,6 +1687,66 @@ namespace LyShine
         return blendState;
     }
 
+    void RenderGraph::RecordPrimitive(LyShine::UiPrimitive* primitive, PrimitiveListRenderNode* renderNode)
+    {
+        if (m_currentElement && m_currentElement->m_isPatchable)
+        {
+            RecordedPrimitive recordedPrimitive;
+            recordedPrimitive.m_primitive = primitive;
+            recordedPrimitive.m_renderNode = renderNode;
+            recordedPrimitive.m_vertexOffset = renderNode->GetNumVertices();
+            recordedPrimitive.m_indexOffset = renderNode->GetNumIndices();
+            recordedPrimitive.m_numVertices = primitive->m_numVertices;
+            recordedPrimitive.m_numIndices = primitive->m_numIndices;
+            m_recordedPrimitives.push_back(recordedPrimitive);
+
+            ++m_currentElement->m_numPrimitives;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    const RenderGraph::RecordedPrimitive* RenderGraph::GetPrimitiveToPatch(LyShine::UiPrimitive* primitive, bool isTextureSRGB,
+        const AZ::RHI::TargetBlendState& blendModeState, bool isPreMultiplyAlpha, AlphaMaskType alphaMaskType)
+    {
+        if (m_patchFailed || m_patchPrimitiveIndex >= m_patchElement->m_firstPrimitive + m_patchElement->m_numPrimitives)
+        {
+            return nullptr;
+        }
+
+        const RecordedPrimitive& recordedPrimitive = m_recordedPrimitives[m_patchPrimitiveIndex++];
+        const PrimitiveListRenderNode* renderNode = recordedPrimitive.m_renderNode;
+
+        // the primitive must be the same size and need the same render state, only the contents of the vertices and indices may change
+        if (recordedPrimitive.m_primitive == primitive &&
+            recordedPrimitive.m_numVertices == primitive->m_numVertices &&
+            recordedPrimitive.m_numIndices == primitive->m_numIndices &&
+            renderNode->GetIsTextureSRGB() == isTextureSRGB &&
+            renderNode->GetBlendModeState() == blendModeState &&
+            renderNode->GetIsPremultiplyAlpha() == isPreMultiplyAlpha &&
+            renderNode->GetAlphaMaskType() == alphaMaskType)
+        {
+            return &recordedPrimitive;
+        }
+        return nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool RenderGraph::CheckGraphChangeAllowed()
+    {
+        if (m_patchElement)
+        {
+            m_patchFailed = true;
+            return false;
+        }
+
+        if (m_currentElement)
+        {
+            m_currentElement->m_isPatchable = false;
+        }
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::SetRttPassesEnabled(UiRenderer* uiRenderer, bool enabled)
     {
         // Enable or disable the rtt render passes
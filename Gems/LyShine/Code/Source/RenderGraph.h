@@ -13,6 +13,10 @@
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/containers/stack.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/Component/EntityId.h>
 #include <AzCore/Math/Color.h>
 
 #include <Atom/RPI.Public/Image/AttachmentImage.h>
@@ -79,9 +83,19 @@ namespace LyShine
             , const AZ::Matrix4x4& modelViewProjMat
             , AZ::RHI::Ptr<AZ::RPI::DynamicDrawContext> dynamicDraw) override;
 
+        //! Add the primitive to the list and append its vertices and indices to the batched buffers of the node
         void AddPrimitive(LyShine::UiPrimitive* primitive);
         LyShine::UiPrimitiveList& GetPrimitives() const;
 
+        //! Overwrite the batched vertices and indices of a primitive previously added with AddPrimitive.
+        //! The primitive must still have the same number of vertices and indices.
+        void UpdatePrimitive(const LyShine::UiPrimitive* primitive, int vertexOffset, int indexOffset);
+
+        int GetNumVertices() const { return m_totalNumVertices; }
+        int GetNumIndices() const { return m_totalNumIndices; }
+        const LyShine::UiPrimitiveVertex* GetVertices() const { return m_vertices.data(); }
+        const uint16* GetIndices() const { return m_indices.data(); }
+
         int GetOrAddTexture(const AZ::Data::Instance<AZ::RPI::Image>& texture, bool isClampTextureMode);
         int GetNumTextures() const { return m_numTextures; }
         const AZ::Data::Instance<AZ::RPI::Image> GetTexture(int texIndex) const { return m_textures[texIndex].m_texture; }
@@ -123,6 +137,11 @@ namespace LyShine
         int             m_totalNumIndices;
 
         LyShine::UiPrimitiveList   m_primitives;
+
+        // Copies of the vertices and indices of all the primitives, with the indices rebased so that the whole
+        // node is drawn with a single draw call. They are kept for as long as the render graph is not rebuilt.
+        AZStd::vector<LyShine::UiPrimitiveVertex> m_vertices;
+        AZStd::vector<uint16> m_indices;
     };
 
     // A mask render node handles using one set of render nodes to mask another set of render nodes
@@ -308,6 +327,23 @@ namespace LyShine
 
         void GetRenderTargetsAndDependencies(LyShine::AttachmentImagesAndDependencies& attachmentImagesAndDependencies);
 
+        //! Called while building the graph, around the rendering of the components on an element. The primitives added in
+        //! between are recorded so that they can be patched in place if only this element changes.
+        void BeginElement(AZ::EntityId elementId);
+        void EndElement();
+
+        //! Called when only the geometry of an element changed. If the element's primitives were recorded when the graph was
+        //! built they get patched on the next render, otherwise this is the same as setting the dirty flag.
+        void MarkElementDirty(AZ::EntityId elementId);
+
+        //! Test whether there are elements waiting to be patched
+        bool HasDirtyElements() const;
+
+        //! Call renderElement for each dirty element, which must render the element's components to this graph again.
+        //! The new primitives overwrite the recorded ones in place. If an element no longer adds the same primitives with the
+        //! same render state, vertex and index counts then patching is abandoned, the dirty flag is set and false is returned.
+        bool PatchDirtyElements(const AZStd::function<void(AZ::EntityId elementId)>& renderElement);
+
 #ifndef _RELEASE
         // A debug-only function useful for debugging, not called but calls can be added during debugging
         void ValidateGraph();
@@ -331,6 +367,28 @@ namespace LyShine
             LyShine::UiPrimitive   m_primitive;
         };
 
+        //! Where a primitive added by an element ended up in the graph
+        struct RecordedPrimitive
+        {
+            LyShine::UiPrimitive*       m_primitive;
+            PrimitiveListRenderNode*    m_renderNode;
+            int                         m_vertexOffset;
+            int                         m_indexOffset;
+            int                         m_numVertices;
+            int                         m_numIndices;
+        };
+
+        //! The state an element was rendered with, restored when the element is rendered again to patch its primitives
+        struct RecordedElement
+        {
+            float   m_alphaFade = 1.0f;
+            bool    m_isRenderingToMask = false;
+            bool    m_isPatchable = true;
+            bool    m_isDirty = false;
+            int     m_firstPrimitive = 0;
+            int     m_numPrimitives = 0;
+        };
+
     protected: // member functions
 
         //! Given a blend mode and whether the shader will be outputing premultiplied alpha, return state flags
@@ -338,6 +396,16 @@ namespace LyShine
 
         void SetRttPassesEnabled(UiRenderer* uiRenderer, bool enabled);
 
+        //! Record a primitive added while building the graph for the element being rendered, if any
+        void RecordPrimitive(LyShine::UiPrimitive* primitive, PrimitiveListRenderNode* renderNode);
+
+        //! While patching, return the recorded primitive that the given primitive replaces if the render state is unchanged
+        const RecordedPrimitive* GetPrimitiveToPatch(LyShine::UiPrimitive* primitive, bool isTextureSRGB,
+            const AZ::RHI::TargetBlendState& blendModeState, bool isPreMultiplyAlpha, AlphaMaskType alphaMaskType);
+
+        //! Called by the functions that change the structure of the graph, which is never possible when patching
+        bool CheckGraphChangeAllowed();
+
     protected:  // data
 
         AZStd::vector<RenderNode*>  m_renderNodes;
@@ -357,10 +425,22 @@ namespace LyShine
         AZStd::vector<RenderTargetRenderNode*>  m_renderTargetRenderNodes;
         int                         m_renderTargetNestLevel = 0;
 
+        // Per element records of the primitives added when the graph was last built, used to patch elements in place
+        AZStd::unordered_map<AZ::EntityId, RecordedElement> m_recordedElements;
+        AZStd::vector<RecordedPrimitive> m_recordedPrimitives;
+        AZStd::vector<AZ::EntityId> m_dirtyElements;
+        RecordedElement*            m_currentElement = nullptr;     //!< The element being rendered while building the graph
+        RecordedElement*            m_patchElement = nullptr;       //!< The element being rendered while patching
+        int                         m_patchPrimitiveIndex = 0;
+        bool                        m_patchFailed = false;
+
 #ifndef _RELEASE
         // A debug-only variable used to track whether the rendergraph was rebuilt this frame
         mutable bool                m_wasBuiltThisFrame = false;
         AZ::u64                     m_timeGraphLastBuiltMs = 0;
+        // Debug-only counts of how many times the graph was rebuilt and how many elements were patched in place
+        AZ::u64                     m_numRebuilds = 0;
+        AZ::u64                     m_numElementPatches = 0;
 #endif
     };
 }
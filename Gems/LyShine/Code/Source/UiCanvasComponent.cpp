@@ -1840,6 +1840,16 @@ void UiCanvasComponent::MarkRenderGraphDirty()
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiCanvasComponent::MarkRenderGraphElementDirty(AZ::EntityId elementId)
+{
+    // Same as MarkRenderGraphDirty, never change the graph while rendering
+    if (!m_isRendering)
+    {
+        m_renderGraph.MarkElementDirty(elementId);
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 AZ::RHI::AttachmentId UiCanvasComponent::UseRenderTarget(const AZ::Name& renderTargetName, AZ::RHI::Size size)
 {
@@ -1936,6 +1946,20 @@ void UiCanvasComponent::RenderCanvas(bool isInGame, AZ::Vector2 viewportSize, Ui
 
     m_isRendering = true;
 
+    if (!m_renderGraph.GetDirtyFlag() && m_renderGraph.HasDirtyElements())
+    {
+        // Only some elements changed, have them render again to patch their primitives in place. This sets the
+        // dirty flag if any of them can't be patched.
+        m_renderGraph.PatchDirtyElements([this](AZ::EntityId elementId)
+            {
+                UiRenderInterface* renderInterface = UiRenderBus::FindFirstHandler(elementId);
+                if (renderInterface)
+                {
+                    renderInterface->Render(&m_renderGraph);
+                }
+            });
+    }
+
     if (m_renderGraph.GetDirtyFlag())
     {
         m_renderGraph.ResetGraph();
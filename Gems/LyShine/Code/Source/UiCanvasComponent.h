@@ -233,6 +233,7 @@ public: // member functions
 
     // UiCanvasComponentImplementationInterface
     void MarkRenderGraphDirty() override;
+    void MarkRenderGraphElementDirty(AZ::EntityId elementId) override;
     // ~UiCanvasComponentImplementationInterface
 
     // RenderToTextureRequests
@@ -268,6 +269,9 @@ public: // member functions
 
     bool IsRenderGraphDirty() { return m_renderGraph.GetDirtyFlag(); }
 
+    //! Get the render graph that this canvas renders to
+    LyShine::RenderGraph* GetRenderGraph() { return &m_renderGraph; }
+
     void GetRenderTargets(LyShine::AttachmentImagesAndDependencies& attachmentImagesAndDependencies);
 
 #ifndef _RELEASE
@@ -1186,8 +1186,9 @@ void UiCanvasManager::DebugDisplayDrawCallData() const
 
     char buffer[200];
 
-    sprintf_s(buffer, "NN: %20s %5s   %5s %5s %5s %5s %5s   %5s %5s %5s %5s %5s %5s",
-        "Canvas name", "nDraw",   "nPrim", "nTris", "nMask", "nRTs", "nUTex",   "XMask", "XRT", "XBlnd", "XSrgb", "XMaxV", "XTex");
+    sprintf_s(buffer, "NN: %20s %5s   %5s %5s %5s %5s %5s   %5s %5s %5s %5s %5s %5s   %7s %7s",
+        "Canvas name", "nDraw",   "nPrim", "nTris", "nMask", "nRTs", "nUTex",   "XMask", "XRT", "XBlnd", "XSrgb", "XMaxV", "XTex",
+        "nBuild", "nPatch");
     WriteLine(buffer, blue);
 
     int totalRenderNodes = 0;
@@ -1226,14 +1227,15 @@ void UiCanvasManager::DebugDisplayDrawCallData() const
         LyShineDebug::DebugInfoRenderGraph info;
         canvas->GetDebugInfoRenderGraph(info);
 
-        sprintf_s(buffer, "%2d: %20s %5d   %5d %5d %5d %5d %5d   %5d %5d %5d %5d %5d %5d",
+        sprintf_s(buffer, "%2d: %20s %5d   %5d %5d %5d %5d %5d   %5d %5d %5d %5d %5d %5d   %7llu %7llu",
             i, leafName.c_str(),
             info.m_numRenderNodes,
             info.m_numPrimitives, info.m_numTriangles,
             info.m_numMasks, info.m_numRTs, info.m_numUniqueTextures,
             info.m_numNodesDueToMask, info.m_numNodesDueToRT,
             info.m_numNodesDueToBlendMode, info.m_numNodesDueToSrgb,
-            info.m_numNodesDueToMaxVerts, info.m_numNodesDueToTextures);
+            info.m_numNodesDueToMaxVerts, info.m_numNodesDueToTextures,
+            static_cast<unsigned long long>(info.m_numRebuilds), static_cast<unsigned long long>(info.m_numElementPatches));
 
         AZ::u64 timeSinceBuiltMs = AZStd::GetTimeUTCMilliSecond() - info.m_timeGraphLastBuiltMs;
         if (timeSinceBuiltMs > 1000)
@@ -1392,11 +1394,14 @@ void UiCanvasManager::DebugReportDrawCalls(const AZStd::string& name) const
                 renderGraphInfo.m_numUniqueTextures, renderGraphInfo.m_numMasks, renderGraphInfo.m_numRTs);
             AZ::IO::LocalFileIO::GetInstance()->Write(logHandle, logLine.c_str(), logLine.size());
             logLine = AZStd::string::format(
-                "Extra draw calls caused by... Masks: %d, RenderTargets: %d, BlendModes: %d, Srgb: %d, MaxVerts: %d, MaxTextures: %d\r\n\r\n",
+                "Extra draw calls caused by... Masks: %d, RenderTargets: %d, BlendModes: %d, Srgb: %d, MaxVerts: %d, MaxTextures: %d\r\n",
                 renderGraphInfo.m_numNodesDueToMask, renderGraphInfo.m_numNodesDueToRT,
                 renderGraphInfo.m_numNodesDueToBlendMode,
                 renderGraphInfo.m_numNodesDueToSrgb, renderGraphInfo.m_numNodesDueToMaxVerts, renderGraphInfo.m_numNodesDueToTextures);
             AZ::IO::LocalFileIO::GetInstance()->Write(logHandle, logLine.c_str(), logLine.size());
+            logLine = AZStd::string::format("The render graph was rebuilt %llu times and elements were patched in place %llu times\r\n\r\n",
+                static_cast<unsigned long long>(renderGraphInfo.m_numRebuilds), static_cast<unsigned long long>(renderGraphInfo.m_numElementPatches));
+            AZ::IO::LocalFileIO::GetInstance()->Write(logHandle, logLine.c_str(), logLine.size());
         }
 
         // output the details on each draw call and gather info for all canvases
@@ -151,7 +151,19 @@ void UiElementComponent::RenderElement(LyShine::IRenderGraph* renderGraph, bool
         // render any component on this element connected to the UiRenderBus
         if (m_renderInterface)
         {
-            m_renderInterface->Render(renderGraph);
+            // When building the canvas's render graph, let it record the primitives of this element so that they can
+            // be patched in place if only this element changes
+            LyShine::RenderGraph* canvasRenderGraph = m_canvas ? m_canvas->GetRenderGraph() : nullptr;
+            if (canvasRenderGraph == renderGraph)
+            {
+                canvasRenderGraph->BeginElement(GetEntityId());
+                m_renderInterface->Render(renderGraph);
+                canvasRenderGraph->EndElement();
+            }
+            else
+            {
+                m_renderInterface->Render(renderGraph);
+            }
         }
 
         // now render child elements
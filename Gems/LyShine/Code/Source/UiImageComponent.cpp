@@ -2325,10 +2325,12 @@ void UiImageComponent::MarkRenderCacheDirty()
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiImageComponent::MarkRenderGraphDirty()
 {
-    // tell the canvas to invalidate the render graph (never want to do this while rendering)
+    // tell the canvas to invalidate the render graph (never want to do this while rendering).
+    // The image always renders a single primitive that it owns, so if the new vertices still fit in the graph
+    // the graph only patches this element rather than being rebuilt.
     AZ::EntityId canvasEntityId;
     EBUS_EVENT_ID_RESULT(canvasEntityId, GetEntityId(), UiElementBus, GetCanvasEntityId);
-    EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkRenderGraphDirty);
+    EBUS_EVENT_ID(canvasEntityId, UiCanvasComponentImplementationBus, MarkRenderGraphElementDirty, GetEntityId());
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include "RenderGraphTest.h"
+
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <benchmark/benchmark.h>
+
+namespace UnitTest
+{
+    //! A canvas of 5000 image-like elements of which 1% change every frame, comparing rebuilding the whole render graph
+    //! with patching the changed elements in place.
+    class RenderGraphBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        static constexpr size_t NumElements = 5000;
+        static constexpr size_t NumAnimatedElements = NumElements / 100;
+
+        void internalSetUp()
+        {
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+
+            m_renderGraph = AZStd::make_unique<TestRenderGraph>();
+            m_elements.resize(NumElements);
+            for (size_t i = 0; i < NumElements; ++i)
+            {
+                m_elements[i].Init(i + 1, static_cast<float>(i % 100), static_cast<float>(i / 100));
+            }
+            m_renderGraph->Build(m_elements);
+            m_frame = 0;
+        }
+
+        void internalTearDown()
+        {
+            m_renderGraph.reset();
+            m_elements = {};
+
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        }
+
+        //! Change the color of a different 1% of the elements each frame, the same way an animated image component would
+        template<class MarkDirtyFunction>
+        void AnimateElements(const MarkDirtyFunction& markDirty)
+        {
+            ++m_frame;
+            for (size_t i = 0; i < NumAnimatedElements; ++i)
+            {
+                RenderGraphTestElement& element = m_elements[(m_frame * NumAnimatedElements + i * 100) % NumElements];
+                element.SetColor(0xff000000 | static_cast<uint32>(m_frame));
+                markDirty(element.m_entityId);
+            }
+        }
+
+        AZStd::unique_ptr<TestRenderGraph> m_renderGraph;
+        AZStd::vector<RenderGraphTestElement> m_elements;
+        size_t m_frame = 0;
+    };
+
+    BENCHMARK_F(RenderGraphBenchmark, FullRebuild)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AnimateElements([this](AZ::EntityId)
+                {
+                    m_renderGraph->SetDirtyFlag(true);
+                });
+            m_renderGraph->Build(m_elements);
+            benchmark::DoNotOptimize(m_renderGraph->GetRenderNodes().data());
+        }
+        state.SetItemsProcessed(state.iterations() * NumAnimatedElements);
+    }
+
+    BENCHMARK_F(RenderGraphBenchmark, PatchDirtyElements)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AnimateElements([this](AZ::EntityId elementId)
+                {
+                    m_renderGraph->MarkElementDirty(elementId);
+                });
+            if (!m_renderGraph->Patch(m_elements))
+            {
+                state.SkipWithError("Patching the render graph failed");
+                return;
+            }
+            benchmark::DoNotOptimize(m_renderGraph->GetRenderNodes().data());
+        }
+        state.SetItemsProcessed(state.iterations() * NumAnimatedElements);
+    }
+} // namespace UnitTest
+#endif
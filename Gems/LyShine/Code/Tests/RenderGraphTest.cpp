@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "RenderGraphTest.h"
+
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+
+namespace UnitTest
+{
+    class RenderGraphTest
+        : public AllocatorsFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+
+            m_renderGraph = AZStd::make_unique<TestRenderGraph>();
+            m_elements.resize(3);
+            for (size_t i = 0; i < m_elements.size(); ++i)
+            {
+                m_elements[i].Init(i + 1, static_cast<float>(i), 0.0f);
+            }
+            m_renderGraph->Build(m_elements);
+        }
+
+        void TearDown() override
+        {
+            m_renderGraph.reset();
+            m_elements = {};
+
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            AllocatorsFixture::TearDown();
+        }
+
+        const LyShine::PrimitiveListRenderNode* GetOnlyRenderNode() const
+        {
+            const AZStd::vector<LyShine::RenderNode*>& renderNodes = m_renderGraph->GetRenderNodes();
+            EXPECT_EQ(renderNodes.size(), 1u);
+            EXPECT_EQ(renderNodes[0]->GetType(), LyShine::RenderNodeType::PrimitiveList);
+            return static_cast<const LyShine::PrimitiveListRenderNode*>(renderNodes[0]);
+        }
+
+        AZStd::unique_ptr<TestRenderGraph> m_renderGraph;
+        AZStd::vector<RenderGraphTestElement> m_elements;
+    };
+
+    TEST_F(RenderGraphTest, AddPrimitive_SameRenderState_BatchesPrimitivesWithRebasedIndices)
+    {
+        const LyShine::PrimitiveListRenderNode* renderNode = GetOnlyRenderNode();
+        ASSERT_EQ(renderNode->GetNumVertices(), 12);
+        ASSERT_EQ(renderNode->GetNumIndices(), 18);
+
+        for (int element = 0; element < 3; ++element)
+        {
+            for (int i = 0; i < 6; ++i)
+            {
+                EXPECT_EQ(renderNode->GetIndices()[element * 6 + i], m_elements[element].m_indices[i] + element * 4);
+            }
+            EXPECT_EQ(renderNode->GetVertices()[element * 4].xy.x, static_cast<float>(element));
+        }
+    }
+
+    TEST_F(RenderGraphTest, PatchDirtyElements_SamePrimitiveSize_UpdatesVerticesInPlace)
+    {
+        m_elements[1].SetPosition(10.0f, 20.0f);
+        m_elements[1].SetColor(0xff00ff00);
+        m_renderGraph->MarkElementDirty(m_elements[1].m_entityId);
+        EXPECT_FALSE(m_renderGraph->GetDirtyFlag());
+        EXPECT_TRUE(m_renderGraph->HasDirtyElements());
+
+        EXPECT_TRUE(m_renderGraph->Patch(m_elements));
+        EXPECT_FALSE(m_renderGraph->GetDirtyFlag());
+        EXPECT_FALSE(m_renderGraph->HasDirtyElements());
+
+        const LyShine::PrimitiveListRenderNode* renderNode = GetOnlyRenderNode();
+        EXPECT_EQ(renderNode->GetVertices()[4].xy.x, 10.0f);
+        EXPECT_EQ(renderNode->GetVertices()[6].xy.y, 21.0f);
+        EXPECT_EQ(renderNode->GetVertices()[5].color.dcolor, 0xff00ff00);
+        EXPECT_EQ(renderNode->GetVertices()[3].color.dcolor, 0xffffffff);
+        EXPECT_EQ(renderNode->GetVertices()[8].color.dcolor, 0xffffffff);
+        EXPECT_EQ(renderNode->GetIndices()[6], 4);
+    }
+
+    TEST_F(RenderGraphTest, PatchDirtyElements_PrimitiveSizeChanged_SetsDirtyFlag)
+    {
+        m_elements[2].m_primitive.m_numIndices = 3;
+        m_renderGraph->MarkElementDirty(m_elements[2].m_entityId);
+
+        EXPECT_FALSE(m_renderGraph->Patch(m_elements));
+        EXPECT_TRUE(m_renderGraph->GetDirtyFlag());
+        EXPECT_FALSE(m_renderGraph->HasDirtyElements());
+    }
+
+    TEST_F(RenderGraphTest, PatchDirtyElements_ElementAddsNoPrimitive_SetsDirtyFlag)
+    {
+        m_renderGraph->MarkElementDirty(m_elements[0].m_entityId);
+
+        EXPECT_FALSE(m_renderGraph->PatchDirtyElements([](AZ::EntityId) {}));
+        EXPECT_TRUE(m_renderGraph->GetDirtyFlag());
+    }
+
+    TEST_F(RenderGraphTest, MarkElementDirty_ElementNotInGraph_SetsDirtyFlag)
+    {
+        m_renderGraph->MarkElementDirty(AZ::EntityId(100));
+
+        EXPECT_TRUE(m_renderGraph->GetDirtyFlag());
+        EXPECT_FALSE(m_renderGraph->HasDirtyElements());
+    }
+} // namespace UnitTest
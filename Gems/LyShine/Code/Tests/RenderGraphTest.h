@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <RenderGraph.h>
+
+namespace UnitTest
+{
+    //! A quad owned by a fake UI element, the same way UiImageComponent owns its cached primitive
+    struct RenderGraphTestElement
+    {
+        void Init(AZ::u64 id, float x, float y)
+        {
+            static const uint16 quadIndices[6] = { 0, 1, 2, 2, 3, 0 };
+
+            m_entityId = AZ::EntityId(id);
+            SetPosition(x, y);
+            SetColor(0xffffffff);
+            memcpy(m_indices, quadIndices, sizeof(quadIndices));
+
+            m_primitive.m_vertices = m_vertices;
+            m_primitive.m_numVertices = 4;
+            m_primitive.m_indices = m_indices;
+            m_primitive.m_numIndices = 6;
+        }
+
+        void SetPosition(float x, float y)
+        {
+            m_vertices[0].xy = Vec2(x, y);
+            m_vertices[1].xy = Vec2(x + 1.0f, y);
+            m_vertices[2].xy = Vec2(x + 1.0f, y + 1.0f);
+            m_vertices[3].xy = Vec2(x, y + 1.0f);
+        }
+
+        void SetColor(uint32 packedColor)
+        {
+            for (LyShine::UiPrimitiveVertex& vertex : m_vertices)
+            {
+                vertex.color.dcolor = packedColor;
+            }
+        }
+
+        void Render(LyShine::RenderGraph& renderGraph)
+        {
+            renderGraph.AddPrimitive(&m_primitive, AZ::Data::Instance<AZ::RPI::Image>(), true, false, false, LyShine::BlendMode::Normal);
+        }
+
+        AZ::EntityId m_entityId;
+        LyShine::UiPrimitiveVertex m_vertices[4] = {};
+        uint16 m_indices[6] = {};
+        LyShine::UiPrimitive m_primitive;
+    };
+
+    //! Exposes the render nodes of the graph to the tests
+    class TestRenderGraph
+        : public LyShine::RenderGraph
+    {
+    public:
+        const AZStd::vector<LyShine::RenderNode*>& GetRenderNodes() const { return m_renderNodes; }
+
+        //! Build the graph the same way the canvas does, by rendering each element between BeginElement and EndElement
+        void Build(AZStd::vector<RenderGraphTestElement>& elements)
+        {
+            ResetGraph();
+            for (RenderGraphTestElement& element : elements)
+            {
+                BeginElement(element.m_entityId);
+                element.Render(*this);
+                EndElement();
+            }
+            SetDirtyFlag(false);
+            FinalizeGraph();
+        }
+
+        bool Patch(AZStd::vector<RenderGraphTestElement>& elements)
+        {
+            return PatchDirtyElements([this, &elements](AZ::EntityId elementId)
+                {
+                    elements[static_cast<size_t>(static_cast<AZ::u64>(elementId)) - 1].Render(*this);
+                });
+        }
+    };
+} // namespace UnitTest
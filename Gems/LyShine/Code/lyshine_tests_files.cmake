@@ -8,6 +8,9 @@
 
 set(FILES
     Tests/LyShineTest.h
+    Tests/RenderGraphTest.h
+    Tests/RenderGraphTest.cpp
+    Tests/RenderGraphBenchmarks.cpp
     Tests/AnimationTest.cpp
     Tests/SpriteTest.cpp
     Tests/SerializationTest.cpp
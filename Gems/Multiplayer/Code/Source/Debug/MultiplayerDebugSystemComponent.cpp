@@ -305,6 +305,15 @@ namespace Multiplayer
                     ImGui::TableNextColumn();
                     ImGui::Text("%lld", aznumeric_cast<AZ::s64>(metrics.m_sendBytesCompressedDelta));
                     ImGui::TableNextRow(); ImGui::TableNextColumn();
+                    ImGui::Text("Send compression ratio");
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", metrics.m_sendBytesUncompressed > 0
+                        ? aznumeric_cast<double>(metrics.m_sendBytes) / aznumeric_cast<double>(metrics.m_sendBytesUncompressed) : 1.0);
+                    ImGui::TableNextRow(); ImGui::TableNextColumn();
+                    ImGui::Text("Total compression time in microseconds");
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%lld", aznumeric_cast<AZ::s64>(metrics.m_sendCompressionTimeUs));
+                    ImGui::TableNextRow(); ImGui::TableNextColumn();
                     ImGui::Text("Total packets resent");
                     ImGui::TableNextColumn();
                     ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_resentPackets));
@@ -325,6 +334,10 @@ namespace Multiplayer
                     ImGui::TableNextColumn();
                     ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_recvBytesUncompressed));
                     ImGui::TableNextRow(); ImGui::TableNextColumn();
+                    ImGui::Text("Total decompression time in microseconds");
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%lld", aznumeric_cast<AZ::s64>(metrics.m_recvDecompressionTimeUs));
+                    ImGui::TableNextRow(); ImGui::TableNextColumn();
                     ImGui::Text("Total packets discarded due to load");
                     ImGui::TableNextColumn();
                     ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_discardedPackets));
@@ -367,6 +367,8 @@ namespace Multiplayer
                 return;
             }
             m_serverSendAccumulator -= serverRateSeconds;
+            // Snapshot where every rewindable entity was during the frame that just completed, so later rewinds can query it exactly
+            m_networkTime.RecordRewindBounds();
             m_networkTime.IncrementHostFrameId();
         }
 
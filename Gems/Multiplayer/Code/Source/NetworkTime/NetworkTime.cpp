@@ -7,6 +7,7 @@
  */
 
 #include <Source/NetworkTime/NetworkTime.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/Components/NetworkTransformComponent.h>
@@ -18,6 +19,7 @@
 namespace Multiplayer
 {
     AZ_CVAR(float, sv_RewindVolumeExtrudeDistance, 50.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The amount to increase rewind volume checks to account for fast moving entities");
+    AZ_CVAR(bool, sv_RewindBoundsHistory, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true the host records the bounds of rewindable entities every frame, so rewinds only sync the entities that overlapped the rewind volume at the rewound frame");
     AZ_CVAR(bool, bg_RewindDebugDraw, false, nullptr, AZ::ConsoleFunctorFlags::Null, "If true enables debug draw of rewind operations");
 
     NetworkTime::NetworkTime()
@@ -93,6 +95,95 @@ namespace Multiplayer
             return;
         }
 
+        const size_t firstRewoundEntity = m_rewoundEntities.size();
+
+        m_rewindHits.clear();
+        if (sv_RewindBoundsHistory && m_rewindBoundsHistory.Query(m_hostFrameId, m_hostBlendFactor, rewindVolume, m_rewindHits))
+        {
+            // The history knows the bounds of every entity at the rewound frame, so only the entities that really overlap are rewound
+            if (bg_RewindDebugDraw)
+            {
+                AzFramework::DebugDisplayRequestBus::BusPtr debugDisplayBus;
+                AzFramework::DebugDisplayRequestBus::Bind(debugDisplayBus, AzFramework::g_defaultSceneEntityDebugDisplayId);
+                if (AzFramework::DebugDisplayRequests* debugDisplay = AzFramework::DebugDisplayRequestBus::FindFirstHandler(debugDisplayBus))
+                {
+                    debugDisplay->SetColor(AZ::Colors::Red);
+                    debugDisplay->DrawWireBox(rewindVolume.GetMin(), rewindVolume.GetMax());
+                }
+            }
+
+            NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+            m_rewoundEntities.reserve(m_rewoundEntities.size() + m_rewindHits.size());
+            for (NetEntityId netEntityId : m_rewindHits)
+            {
+                NetworkEntityHandle entityHandle = networkEntityTracker->Get(netEntityId);
+                if (entityHandle.GetNetBindComponent() != nullptr)
+                {
+                    m_rewoundEntities.push_back(entityHandle);
+                }
+            }
+        }
+        else
+        {
+            GatherRewoundEntitiesFromVisibility(rewindVolume);
+        }
+
+        // Sync the newly rewound entities to the rewound frame in one pass
+        for (size_t index = firstRewoundEntity; index < m_rewoundEntities.size(); ++index)
+        {
+            if (NetBindComponent* netBindComponent = m_rewoundEntities[index].GetNetBindComponent())
+            {
+                netBindComponent->NotifySyncRewindState();
+            }
+        }
+    }
+
+    void NetworkTime::RecordRewindBounds()
+    {
+        AZ_Assert(!IsTimeRewound(), "Rewind bounds can't be recorded under a rewound time scope");
+        if (!sv_RewindBoundsHistory)
+        {
+            return;
+        }
+
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        AzFramework::IEntityBoundsUnion* entityBoundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
+        if (networkEntityTracker == nullptr || entityBoundsUnion == nullptr)
+        {
+            return;
+        }
+
+        // Only entities with a network transform can be rewound, the component lookup is only redone when the tracked entities change
+        if (networkEntityTracker->GetAddChangeDirty() != m_rewindableAddChangeDirty
+            || networkEntityTracker->GetDeleteChangeDirty() != m_rewindableDeleteChangeDirty
+            || networkEntityTracker->size() != m_rewindableTrackedCount)
+        {
+            m_rewindableAddChangeDirty = networkEntityTracker->GetAddChangeDirty();
+            m_rewindableDeleteChangeDirty = networkEntityTracker->GetDeleteChangeDirty();
+            m_rewindableTrackedCount = networkEntityTracker->size();
+            m_rewindableEntities.clear();
+            for (const auto& [netEntityId, entity] : *networkEntityTracker)
+            {
+                if (entity != nullptr && entity->FindComponent<NetworkTransformComponent>() != nullptr)
+                {
+                    m_rewindableEntities.emplace_back(netEntityId, entity);
+                }
+            }
+        }
+
+        m_rewindBoundsHistory.BeginFrame(m_hostFrameId);
+        for (const auto& [netEntityId, entity] : m_rewindableEntities)
+        {
+            if (entity->GetState() == AZ::Entity::State::Active)
+            {
+                m_rewindBoundsHistory.AddBounds(netEntityId, entityBoundsUnion->GetEntityWorldBoundsUnion(entity->GetId()));
+            }
+        }
+        m_rewindBoundsHistory.EndFrame();
+    }
+
+    void NetworkTime::GatherRewoundEntitiesFromVisibility(const AZ::Aabb& rewindVolume)
+    {
         // Since the vis system doesn't support rewound queries, first query with an expanded volume to catch any fast moving entities
         const AZ::Aabb expandedVolume = rewindVolume.GetExpanded(AZ::Vector3(sv_RewindVolumeExtrudeDistance));
 
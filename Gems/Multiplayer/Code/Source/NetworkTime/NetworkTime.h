@@ -10,6 +10,7 @@
 
 #include <Multiplayer/NetworkTime/INetworkTime.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <Source/NetworkTime/RewindBoundsHistory.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/Console/IConsole.h>
 
@@ -38,9 +39,25 @@ namespace Multiplayer
         void ClearRewoundEntities() override;
         //! @}
 
+        //! Records the world bounds of all rewindable entities for the current host frame.
+        //! Should be invoked by the host once all updates of the frame are done, before the host frame is incremented.
+        void RecordRewindBounds();
+
     private:
 
+        //! Collects the entities within the volume by querying the visibility system with a volume extruded to account for
+        //! fast moving entities, used when the rewound host frame is not in the bounds history.
+        void GatherRewoundEntitiesFromVisibility(const AZ::Aabb& rewindVolume);
+
         AZStd::vector<NetworkEntityHandle> m_rewoundEntities;
+        RewindBoundsHistory m_rewindBoundsHistory;
+        AZStd::vector<NetEntityId> m_rewindHits;
+
+        //! Tracked entities with a network transform, rebuilt whenever the network entity tracker changes.
+        AZStd::vector<AZStd::pair<NetEntityId, AZ::Entity*>> m_rewindableEntities;
+        uint32_t m_rewindableAddChangeDirty = 0;
+        uint32_t m_rewindableDeleteChangeDirty = 0;
+        AZStd::size_t m_rewindableTrackedCount = 0;
 
         HostFrameId m_hostFrameId = HostFrameId{ 0 };
         HostFrameId m_unalteredFrameId = HostFrameId{ 0 };
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkTime/RewindBoundsHistory.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    static bool Overlaps(const float entryMin[3], const float entryMax[3], const float volumeMin[3], const float volumeMax[3])
+    {
+        return entryMin[0] <= volumeMax[0] && entryMax[0] >= volumeMin[0]
+            && entryMin[1] <= volumeMax[1] && entryMax[1] >= volumeMin[1]
+            && entryMin[2] <= volumeMax[2] && entryMax[2] >= volumeMin[2];
+    }
+
+    void RewindBoundsHistory::BeginFrame(HostFrameId frameId)
+    {
+        AZ_Assert(m_recordingSnapshot == nullptr, "BeginFrame called without ending the previous frame");
+        m_recordingSnapshot = &m_snapshots[static_cast<uint32_t>(frameId) % RewindHistorySize];
+        m_recordingSnapshot->m_frameId = InvalidHostFrameId; // Not queryable until EndFrame
+        m_recordingSnapshot->m_bounds = AZ::Aabb::CreateNull();
+        m_recordingSnapshot->m_entries.clear();
+        m_recordingFrameId = frameId;
+    }
+
+    void RewindBoundsHistory::AddBounds(NetEntityId netEntityId, const AZ::Aabb& bounds)
+    {
+        AZ_Assert(m_recordingSnapshot != nullptr, "AddBounds called outside of BeginFrame and EndFrame");
+        if (!bounds.IsValid())
+        {
+            return;
+        }
+
+        Entry& entry = m_recordingSnapshot->m_entries.emplace_back();
+        entry.m_netEntityId = netEntityId;
+        bounds.GetMin().StoreToFloat3(entry.m_min);
+        bounds.GetMax().StoreToFloat3(entry.m_max);
+        m_recordingSnapshot->m_bounds.AddAabb(bounds);
+    }
+
+    void RewindBoundsHistory::EndFrame()
+    {
+        AZ_Assert(m_recordingSnapshot != nullptr, "EndFrame called without BeginFrame");
+        AZStd::sort(m_recordingSnapshot->m_entries.begin(), m_recordingSnapshot->m_entries.end(),
+            [](const Entry& lhs, const Entry& rhs) { return lhs.m_netEntityId < rhs.m_netEntityId; });
+        m_recordingSnapshot->m_frameId = m_recordingFrameId;
+        m_recordingSnapshot = nullptr;
+    }
+
+    bool RewindBoundsHistory::Query(HostFrameId frameId, float blendFactor, const AZ::Aabb& volume, AZStd::vector<NetEntityId>& outHits) const
+    {
+        const Snapshot* snapshot = FindSnapshot(frameId);
+        if (snapshot == nullptr)
+        {
+            return false;
+        }
+
+        float volumeMin[3];
+        float volumeMax[3];
+        volume.GetMin().StoreToFloat3(volumeMin);
+        volume.GetMax().StoreToFloat3(volumeMax);
+
+        // Without a blend factor, or a previous frame to blend with, the bounds of the frame are tested as they are
+        const Snapshot* previous = AZ::IsClose(blendFactor, 1.0f) ? nullptr : FindSnapshot(frameId - HostFrameId{ 1 });
+        if (previous == nullptr)
+        {
+            if (!snapshot->m_bounds.Overlaps(volume))
+            {
+                return true;
+            }
+
+            for (const Entry& entry : snapshot->m_entries)
+            {
+                if (Overlaps(entry.m_min, entry.m_max, volumeMin, volumeMax))
+                {
+                    outHits.push_back(entry.m_netEntityId);
+                }
+            }
+            return true;
+        }
+
+        // A blended entry can lie between its two recorded positions, so only the union of both frames is conservative
+        AZ::Aabb sweptBounds = snapshot->m_bounds;
+        sweptBounds.AddAabb(previous->m_bounds);
+        if (!sweptBounds.Overlaps(volume))
+        {
+            return true;
+        }
+
+        // Both snapshots are sorted by NetEntityId, so entities present in both frames are matched in a single pass
+        auto previousEntry = previous->m_entries.begin();
+        const auto previousEnd = previous->m_entries.end();
+        for (const Entry& entry : snapshot->m_entries)
+        {
+            while (previousEntry != previousEnd && previousEntry->m_netEntityId < entry.m_netEntityId)
+            {
+                ++previousEntry;
+            }
+
+            if (previousEntry == previousEnd || previousEntry->m_netEntityId != entry.m_netEntityId)
+            {
+                // The entity didn't exist in the previous frame, there's nothing to blend with
+                if (Overlaps(entry.m_min, entry.m_max, volumeMin, volumeMax))
+                {
+                    outHits.push_back(entry.m_netEntityId);
+                }
+                continue;
+            }
+
+            float blendedMin[3];
+            float blendedMax[3];
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                blendedMin[axis] = previousEntry->m_min[axis] + (entry.m_min[axis] - previousEntry->m_min[axis]) * blendFactor;
+                blendedMax[axis] = previousEntry->m_max[axis] + (entry.m_max[axis] - previousEntry->m_max[axis]) * blendFactor;
+            }
+
+            if (Overlaps(blendedMin, blendedMax, volumeMin, volumeMax))
+            {
+                outHits.push_back(entry.m_netEntityId);
+            }
+        }
+        return true;
+    }
+
+    bool RewindBoundsHistory::HasFrame(HostFrameId frameId) const
+    {
+        return FindSnapshot(frameId) != nullptr;
+    }
+
+    void RewindBoundsHistory::Clear()
+    {
+        for (Snapshot& snapshot : m_snapshots)
+        {
+            snapshot.m_frameId = InvalidHostFrameId;
+            snapshot.m_bounds = AZ::Aabb::CreateNull();
+            snapshot.m_entries.clear();
+        }
+        m_recordingSnapshot = nullptr;
+    }
+
+    const RewindBoundsHistory::Snapshot* RewindBoundsHistory::FindSnapshot(HostFrameId frameId) const
+    {
+        if (frameId == InvalidHostFrameId)
+        {
+            return nullptr;
+        }
+
+        const Snapshot& snapshot = m_snapshots[static_cast<uint32_t>(frameId) % RewindHistorySize];
+        return (snapshot.m_frameId == frameId) ? &snapshot : nullptr;
+    }
+}
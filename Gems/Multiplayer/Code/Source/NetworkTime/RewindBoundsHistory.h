@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    //! @class RewindBoundsHistory
+    //! @brief Keeps a ring of per host frame snapshots of the world bounds of all rewindable entities.
+    //! Unlike the visibility system, which only knows the current bounds of an entity, this can answer which entities
+    //! overlapped a volume at a past host frame, so rewinding doesn't need to query an extruded volume and test every candidate.
+    class RewindBoundsHistory
+    {
+    public:
+        //! Starts the snapshot of the provided host frame, replacing the oldest snapshot once the history is full.
+        //! @param frameId the host frame the bounds recorded until EndFrame belong to
+        void BeginFrame(HostFrameId frameId);
+
+        //! Records the world bounds of an entity in the current snapshot.
+        //! @param netEntityId the entity the bounds belong to, each entity can only be recorded once per frame
+        //! @param bounds      the world bounds of the entity at the current host frame
+        void AddBounds(NetEntityId netEntityId, const AZ::Aabb& bounds);
+
+        //! Finishes the current snapshot, making it available to queries.
+        void EndFrame();
+
+        //! Collects the entities whose bounds overlapped the volume at the provided host frame.
+        //! @param frameId     the host frame to query
+        //! @param blendFactor the factor used to blend between the bounds at the previous and the provided host frame
+        //! @param volume      the volume to test against
+        //! @param outHits     the overlapping entities are appended to this vector
+        //! @return false if the host frame is not in the history, in which case nothing was appended
+        bool Query(HostFrameId frameId, float blendFactor, const AZ::Aabb& volume, AZStd::vector<NetEntityId>& outHits) const;
+
+        //! Returns true if the snapshot of the provided host frame is in the history.
+        bool HasFrame(HostFrameId frameId) const;
+
+        //! Drops every snapshot.
+        void Clear();
+
+    private:
+
+        struct Entry
+        {
+            NetEntityId m_netEntityId;
+            float m_min[3];
+            float m_max[3];
+        };
+
+        struct Snapshot
+        {
+            HostFrameId m_frameId = InvalidHostFrameId;
+            AZ::Aabb m_bounds = AZ::Aabb::CreateNull(); // Union of all the entries, used to reject queries early
+            AZStd::vector<Entry> m_entries; // Sorted by NetEntityId once the frame ends
+        };
+
+        const Snapshot* FindSnapshot(HostFrameId frameId) const;
+
+        // The entry vectors keep their capacity as the ring wraps around, so recording doesn't allocate once warmed up
+        AZStd::array<Snapshot, RewindHistorySize> m_snapshots;
+        Snapshot* m_recordingSnapshot = nullptr;
+        HostFrameId m_recordingFrameId = InvalidHostFrameId;
+    };
+}
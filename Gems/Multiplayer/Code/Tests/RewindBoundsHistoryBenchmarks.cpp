@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <Source/NetworkTime/RewindBoundsHistory.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <benchmark/benchmark.h>
+
+namespace Multiplayer
+{
+    /*
+     * 4096 moving entities with a full rewind history, shot at by 256 shooters each rewinding to a different past frame.
+     * The Extruded benchmark mimics the visibility system path: every entity within the extruded volume at the current frame
+     * is a candidate that has to be rewound to be tested, the History benchmark only returns the entities that really overlap.
+     */
+    class RewindBoundsHistoryBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t EntityCount = 4096;
+        static constexpr uint32_t ShooterCount = 256;
+        static constexpr float ExtrudeDistance = 50.0f; // Default of sv_RewindVolumeExtrudeDistance
+
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        static AZ::Aabb GetBounds(uint32_t entity, uint32_t frame)
+        {
+            // Entities are laid out on a grid 4m apart and move at different speeds
+            const float speed = static_cast<float>(entity % 5) * 0.25f;
+            const AZ::Vector3 position(static_cast<float>(entity % 64) * 4.0f + speed * static_cast<float>(frame), static_cast<float>(entity / 64) * 4.0f, 0.0f);
+            return AZ::Aabb::CreateFromMinMax(position, position + AZ::Vector3(1.0f, 1.0f, 2.0f));
+        }
+
+        void internalSetUp()
+        {
+            m_history = AZStd::make_unique<RewindBoundsHistory>();
+            for (uint32_t frame = 0; frame < RewindHistorySize; ++frame)
+            {
+                m_history->BeginFrame(HostFrameId{ frame });
+                for (uint32_t entity = 0; entity < EntityCount; ++entity)
+                {
+                    m_history->AddBounds(NetEntityId{ entity }, GetBounds(entity, frame));
+                }
+                m_history->EndFrame();
+            }
+
+            // Each shooter rewinds a different amount of frames and sweeps a thin volume through the crowd
+            for (uint32_t shooter = 0; shooter < ShooterCount; ++shooter)
+            {
+                const uint32_t entity = (shooter * 997) % EntityCount;
+                const HostFrameId frame{ RewindHistorySize - 1 - (shooter % 16) };
+                const AZ::Vector3 target = GetBounds(entity, static_cast<uint32_t>(frame)).GetCenter();
+                m_shots.push_back({ frame, AZ::Aabb::CreateFromMinMax(target - AZ::Vector3(8.0f, 0.1f, 0.1f), target + AZ::Vector3(8.0f, 0.1f, 0.1f)) });
+            }
+            m_hits.reserve(EntityCount);
+        }
+
+        void internalTearDown()
+        {
+            m_history.reset();
+            m_shots = {};
+            m_hits = {};
+        }
+
+        struct Shot
+        {
+            HostFrameId m_frameId;
+            AZ::Aabb m_volume;
+        };
+
+        AZStd::unique_ptr<RewindBoundsHistory> m_history;
+        AZStd::vector<Shot> m_shots;
+        AZStd::vector<NetEntityId> m_hits;
+    };
+
+    BENCHMARK_DEFINE_F(RewindBoundsHistoryBenchmark, History)(benchmark::State& state)
+    {
+        size_t rewound = 0;
+        for ([[maybe_unused]] auto value : state)
+        {
+            for (const Shot& shot : m_shots)
+            {
+                m_hits.clear();
+                m_history->Query(shot.m_frameId, 0.5f, shot.m_volume, m_hits);
+                rewound += m_hits.size();
+            }
+            benchmark::DoNotOptimize(m_hits.data());
+        }
+        state.counters["RewoundPerShot"] = benchmark::Counter(static_cast<double>(rewound) / static_cast<double>(state.iterations() * ShooterCount));
+    }
+
+    BENCHMARK_REGISTER_F(RewindBoundsHistoryBenchmark, History)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+
+    BENCHMARK_DEFINE_F(RewindBoundsHistoryBenchmark, Extruded)(benchmark::State& state)
+    {
+        const uint32_t currentFrame = RewindHistorySize - 1;
+        size_t rewound = 0;
+        for ([[maybe_unused]] auto value : state)
+        {
+            for (const Shot& shot : m_shots)
+            {
+                m_hits.clear();
+                const AZ::Aabb expandedVolume = shot.m_volume.GetExpanded(AZ::Vector3(ExtrudeDistance));
+                for (uint32_t entity = 0; entity < EntityCount; ++entity)
+                {
+                    if (AZ::ShapeIntersection::Overlaps(GetBounds(entity, currentFrame), expandedVolume))
+                    {
+                        // Every candidate gets rewound before it can be tested against the real volume
+                        ++rewound;
+                        const AZ::Aabb rewoundBounds = GetBounds(entity, static_cast<uint32_t>(shot.m_frameId));
+                        if (AZ::ShapeIntersection::Overlaps(rewoundBounds, shot.m_volume))
+                        {
+                            m_hits.push_back(NetEntityId{ entity });
+                        }
+                    }
+                }
+            }
+            benchmark::DoNotOptimize(m_hits.data());
+        }
+        state.counters["RewoundPerShot"] = benchmark::Counter(static_cast<double>(rewound) / static_cast<double>(state.iterations() * ShooterCount));
+    }
+
+    BENCHMARK_REGISTER_F(RewindBoundsHistoryBenchmark, Extruded)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+}
+
+#endif
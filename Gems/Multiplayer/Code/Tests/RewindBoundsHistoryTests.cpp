@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkTime/RewindBoundsHistory.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class RewindBoundsHistoryTests
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            m_history = AZStd::make_unique<Multiplayer::RewindBoundsHistory>();
+        }
+
+        void TearDown() override
+        {
+            m_history.reset();
+            AllocatorsFixture::TearDown();
+        }
+
+        static AZ::Aabb UnitBoxAt(float x)
+        {
+            return AZ::Aabb::CreateFromMinMax(AZ::Vector3(x, 0.0f, 0.0f), AZ::Vector3(x + 1.0f, 1.0f, 1.0f));
+        }
+
+        AZStd::unique_ptr<Multiplayer::RewindBoundsHistory> m_history;
+    };
+
+    TEST_F(RewindBoundsHistoryTests, Query_UnrecordedFrame_ReturnsFalse)
+    {
+        AZStd::vector<Multiplayer::NetEntityId> hits;
+        EXPECT_FALSE(m_history->Query(Multiplayer::HostFrameId{ 3 }, 1.0f, UnitBoxAt(0.0f), hits));
+        EXPECT_TRUE(hits.empty());
+    }
+
+    TEST_F(RewindBoundsHistoryTests, Query_RecordedFrame_ReturnsOnlyOverlappingEntities)
+    {
+        m_history->BeginFrame(Multiplayer::HostFrameId{ 5 });
+        m_history->AddBounds(Multiplayer::NetEntityId{ 2 }, UnitBoxAt(10.0f));
+        m_history->AddBounds(Multiplayer::NetEntityId{ 1 }, UnitBoxAt(0.0f));
+        m_history->EndFrame();
+
+        AZStd::vector<Multiplayer::NetEntityId> hits;
+        EXPECT_TRUE(m_history->Query(Multiplayer::HostFrameId{ 5 }, 1.0f, UnitBoxAt(0.5f), hits));
+        ASSERT_EQ(hits.size(), 1u);
+        EXPECT_EQ(hits[0], Multiplayer::NetEntityId{ 1 });
+    }
+
+    TEST_F(RewindBoundsHistoryTests, Query_BlendFactor_TestsInterpolatedBounds)
+    {
+        m_history->BeginFrame(Multiplayer::HostFrameId{ 4 });
+        m_history->AddBounds(Multiplayer::NetEntityId{ 1 }, UnitBoxAt(0.0f));
+        m_history->EndFrame();
+        m_history->BeginFrame(Multiplayer::HostFrameId{ 5 });
+        m_history->AddBounds(Multiplayer::NetEntityId{ 1 }, UnitBoxAt(10.0f));
+        m_history->AddBounds(Multiplayer::NetEntityId{ 2 }, UnitBoxAt(5.0f));
+        m_history->EndFrame();
+
+        // Halfway between the two frames entity 1 is at [5, 6], where it was in neither of the recorded frames
+        const AZ::Aabb volume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(5.2f, 0.2f, 0.2f), AZ::Vector3(5.8f, 0.8f, 0.8f));
+        AZStd::vector<Multiplayer::NetEntityId> hits;
+        EXPECT_TRUE(m_history->Query(Multiplayer::HostFrameId{ 5 }, 0.5f, volume, hits));
+        ASSERT_EQ(hits.size(), 2u);
+        EXPECT_EQ(hits[0], Multiplayer::NetEntityId{ 1 });
+        EXPECT_EQ(hits[1], Multiplayer::NetEntityId{ 2 });
+
+        hits.clear();
+        EXPECT_TRUE(m_history->Query(Multiplayer::HostFrameId{ 5 }, 0.5f, UnitBoxAt(0.0f).GetExpanded(AZ::Vector3(-0.1f)), hits));
+        EXPECT_TRUE(hits.empty());
+    }
+
+    TEST_F(RewindBoundsHistoryTests, Query_BlendFactor_FindsEntityBetweenBothFrameBounds)
+    {
+        // With a single entity neither frame's aggregate bounds touch the volume, only the space swept between them does
+        m_history->BeginFrame(Multiplayer::HostFrameId{ 4 });
+        m_history->AddBounds(Multiplayer::NetEntityId{ 1 }, UnitBoxAt(0.0f));
+        m_history->EndFrame();
+        m_history->BeginFrame(Multiplayer::HostFrameId{ 5 });
+        m_history->AddBounds(Multiplayer::NetEntityId{ 1 }, UnitBoxAt(10.0f));
+        m_history->EndFrame();
+
+        const AZ::Aabb volume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(5.2f, 0.2f, 0.2f), AZ::Vector3(5.8f, 0.8f, 0.8f));
+        AZStd::vector<Multiplayer::NetEntityId> hits;
+        EXPECT_TRUE(m_history->Query(Multiplayer::HostFrameId{ 5 }, 0.5f, volume, hits));
+        ASSERT_EQ(hits.size(), 1u);
+        EXPECT_EQ(hits[0], Multiplayer::NetEntityId{ 1 });
+    }
+
+    TEST_F(RewindBoundsHistoryTests, Record_PastHistorySize_DropsOldestFrame)
+    {
+        for (uint32_t frame = 0; frame <= Multiplayer::RewindHistorySize; ++frame)
+        {
+            m_history->BeginFrame(Multiplayer::HostFrameId{ frame });
+            m_history->AddBounds(Multiplayer::NetEntityId{ 1 }, UnitBoxAt(static_cast<float>(frame)));
+            m_history->EndFrame();
+        }
+
+        EXPECT_FALSE(m_history->HasFrame(Multiplayer::HostFrameId{ 0 }));
+        EXPECT_TRUE(m_history->HasFrame(Multiplayer::HostFrameId{ 1 }));
+        EXPECT_TRUE(m_history->HasFrame(Multiplayer::HostFrameId{ Multiplayer::RewindHistorySize }));
+    }
+}
@@ -126,6 +126,8 @@ set(FILES
     Source/NetworkInput/NetworkInputMigrationVector.cpp
     Source/NetworkTime/NetworkTime.cpp
     Source/NetworkTime/NetworkTime.h
+    Source/NetworkTime/RewindBoundsHistory.cpp
+    Source/NetworkTime/RewindBoundsHistory.h
     Source/Pipeline/NetworkSpawnableHolderComponent.cpp
     Source/Pipeline/NetworkSpawnableHolderComponent.h
     Source/ReplicationWindows/NullReplicationWindow.cpp
@@ -25,6 +25,8 @@ set(FILES
     Tests/NetworkTransformTests.cpp
     Tests/RewindableContainerTests.cpp
     Tests/RewindableObjectTests.cpp
+    Tests/RewindBoundsHistoryBenchmarks.cpp
+    Tests/RewindBoundsHistoryTests.cpp
     Tests/ServerHierarchyTests.cpp
     Tests/TestMultiplayerComponent.h
     Tests/TestMultiplayerComponent.cpp
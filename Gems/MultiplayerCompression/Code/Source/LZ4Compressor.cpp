@@ -13,6 +13,65 @@
 
 namespace MultiplayerCompression
 {
+    LZ4Compressor::LZ4Compressor(LZ4CompressorMode mode, AZStd::shared_ptr<const LZ4Dictionary> dictionary)
+        : m_mode(mode)
+        , m_dictionary(AZStd::move(dictionary))
+    {
+        // ICompressor::Init() is not called by the transports, so all state is created up front
+        switch (m_mode)
+        {
+        case LZ4CompressorMode::Dictionary:
+            if (!m_dictionary || m_dictionary->empty())
+            {
+                AZ_Error("Multiplayer Compressor", false, "Dictionary mode requires a dictionary, falling back to per packet compression");
+                m_mode = LZ4CompressorMode::Packet;
+                break;
+            }
+            m_dictionaryStream = LZ4_createStream();
+            m_compressStream = LZ4_createStream();
+            LZ4_loadDict(m_dictionaryStream, reinterpret_cast<const char*>(m_dictionary->data()), static_cast<int>(m_dictionary->size()));
+            break;
+        case LZ4CompressorMode::Streaming:
+            // Both sides use the same ring buffer size and wrap rule, so the decoder history always mirrors the encoder history
+            m_compressStream = LZ4_createStream();
+            m_decompressStream = LZ4_createStreamDecode();
+            m_compressHistory.resize_no_construct(StreamingHistorySize + MaxStreamingPacketSize);
+            m_decompressHistory.resize_no_construct(StreamingHistorySize + MaxStreamingPacketSize);
+            break;
+        default:
+            break;
+        }
+    }
+
+    LZ4Compressor::~LZ4Compressor()
+    {
+        if (m_dictionaryStream)
+        {
+            LZ4_freeStream(m_dictionaryStream);
+        }
+        if (m_compressStream)
+        {
+            LZ4_freeStream(m_compressStream);
+        }
+        if (m_decompressStream)
+        {
+            LZ4_freeStreamDecode(m_decompressStream);
+        }
+    }
+
+    bool LZ4Compressor::Init()
+    {
+        switch (m_mode)
+        {
+        case LZ4CompressorMode::Dictionary:
+            return m_dictionaryStream != nullptr && m_compressStream != nullptr;
+        case LZ4CompressorMode::Streaming:
+            return m_compressStream != nullptr && m_decompressStream != nullptr;
+        default:
+            return true;
+        }
+    }
+
     size_t LZ4Compressor::GetMaxChunkSize(size_t maxCompSize) const
     {
         return maxCompSize;
@@ -53,19 +112,24 @@ namespace MultiplayerCompression
             return AzNetworking::CompressorError::InsufficientBuffer;
         }
 
+        if (m_mode == LZ4CompressorMode::Streaming && uncompSize > MaxStreamingPacketSize)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input size (%lu) passed to Compress() is greater than max allowed for streaming (%lu)", uncompSize, MaxStreamingPacketSize);
+            return AzNetworking::CompressorError::InsufficientBuffer;
+        }
+
         AZ_Warning("Multiplayer Compressor", compDataSize >= compWorstCaseSize, "Outbuffer size (%lu B) passed to Compress() is less than estimated worst case (%lu B)", compDataSize, compWorstCaseSize);
 
         // Note that this returns a non-negative int so we are narrowing into a size_t here
-        compSize = LZ4_compress_HC(
-            reinterpret_cast<const char*>(uncompData), 
-            reinterpret_cast<char*>(compData), 
+        compSize = CompressBlock(
+            reinterpret_cast<const char*>(uncompData),
             static_cast<int>(uncompSize),
-            static_cast<int>(compDataSize),
-            0);
+            reinterpret_cast<char*>(compData),
+            static_cast<int>(compDataSize));
 
         if (compSize == 0)
         {
-            // LZ4_compress_HC returns a zero value for corrupt data and insufficient buffer
+            // LZ4_compress_HC and LZ4_compress_fast_continue return a zero value for corrupt data and insufficient buffer
             AZ_Warning("Multiplayer Compressor", false, "Compression failed for uncompSize:(%lu B) compDataSize:(%lu B) compSize:(%lu B)", uncompSize, compDataSize, compSize);
             return AzNetworking::CompressorError::CorruptData;
         }
@@ -89,12 +153,12 @@ namespace MultiplayerCompression
             return AzNetworking::CompressorError::Uninitialized;
         }
 
-        const int uncompSize = LZ4_decompress_safe(reinterpret_cast<const char*>(compData), reinterpret_cast<char*>(uncompData), static_cast<int>(compDataSize), static_cast<int>(uncompDataSize));
+        const int uncompSize = DecompressBlock(reinterpret_cast<const char*>(compData), static_cast<int>(compDataSize), reinterpret_cast<char*>(uncompData), static_cast<int>(uncompDataSize));
         consumedSizeOut = compDataSize;
 
         if (uncompSize < 0)
         {
-            // LZ4_decompress_safe returns a negative value for corrupt data and insufficient buffer
+            // LZ4_decompress_safe and its variants return a negative value for corrupt data and insufficient buffer
             AZ_Warning("Multiplayer Compressor", false, "Decompression failed for compDataSize:(%lu B) uncompDataSize:(%lu B) uncompSize:(%d B)", compDataSize, uncompDataSize, uncompSize);
             return AzNetworking::CompressorError::CorruptData;
         }
@@ -103,4 +167,69 @@ namespace MultiplayerCompression
 
         return AzNetworking::CompressorError::Ok;
     }
+
+    int LZ4Compressor::CompressBlock(const char* uncompData, int uncompSize, char* compData, int compDataSize)
+    {
+        switch (m_mode)
+        {
+        case LZ4CompressorMode::Dictionary:
+        {
+            // Restore the pre-hashed dictionary, so every packet is only compressed against the dictionary and remains independent
+            memcpy(m_compressStream, m_dictionaryStream, sizeof(LZ4_stream_t));
+            return LZ4_compress_fast_continue(m_compressStream, uncompData, compData, uncompSize, compDataSize, 1);
+        }
+        case LZ4CompressorMode::Streaming:
+        {
+            // LZ4 references previously compressed data in place, so the input is copied into the history first
+            char* historyData = m_compressHistory.data() + m_compressHistoryOffset;
+            memcpy(historyData, uncompData, uncompSize);
+            const int compSize = LZ4_compress_fast_continue(m_compressStream, historyData, compData, uncompSize, compDataSize, 1);
+
+            m_compressHistoryOffset += uncompSize;
+            if (m_compressHistoryOffset >= StreamingHistorySize)
+            {
+                m_compressHistoryOffset = 0;
+            }
+            return compSize;
+        }
+        default:
+            return LZ4_compress_HC(uncompData, compData, uncompSize, compDataSize, 0);
+        }
+    }
+
+    int LZ4Compressor::DecompressBlock(const char* compData, int compDataSize, char* uncompData, int uncompDataSize)
+    {
+        switch (m_mode)
+        {
+        case LZ4CompressorMode::Dictionary:
+            return LZ4_decompress_safe_usingDict(
+                compData, uncompData, compDataSize, uncompDataSize,
+                reinterpret_cast<const char*>(m_dictionary->data()), static_cast<int>(m_dictionary->size()));
+        case LZ4CompressorMode::Streaming:
+        {
+            char* historyData = m_decompressHistory.data() + m_decompressHistoryOffset;
+            const int uncompSize = LZ4_decompress_safe_continue(
+                m_decompressStream, compData, historyData, compDataSize, static_cast<int>(MaxStreamingPacketSize));
+            if (uncompSize < 0)
+            {
+                return uncompSize;
+            }
+            if (uncompSize > uncompDataSize)
+            {
+                return -1;
+            }
+            memcpy(uncompData, historyData, uncompSize);
+
+            // Mirrors the wrap rule of CompressBlock
+            m_decompressHistoryOffset += uncompSize;
+            if (m_decompressHistoryOffset >= StreamingHistorySize)
+            {
+                m_decompressHistoryOffset = 0;
+            }
+            return uncompSize;
+        }
+        default:
+            return LZ4_decompress_safe(compData, uncompData, compDataSize, uncompDataSize);
+        }
+    }
 }
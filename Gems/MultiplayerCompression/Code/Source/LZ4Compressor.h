@@ -11,12 +11,28 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzNetworking/Framework/ICompressor.h>
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+union LZ4_stream_u;
+union LZ4_streamDecode_u;
 
 namespace MultiplayerCompression
 {
     static const char* CompressorName = "LZ4";
     static const AzNetworking::CompressorType CompressorType = aznumeric_cast<AzNetworking::CompressorType>(static_cast<AZ::u32>(AZ::Crc32(CompressorName)));
 
+    //! How an LZ4Compressor relates the packets it compresses to each other.
+    enum class LZ4CompressorMode
+    {
+        Packet,     //!< Every packet is compressed on its own, with LZ4 HC
+        Dictionary, //!< Every packet is compressed on its own, against a dictionary trained offline on captured traffic
+        Streaming   //!< Every packet is compressed against the history of the connection, only valid for reliable, in-order transports (TCP)
+    };
+
+    //! Raw LZ4 dictionary content, LZ4 only makes use of the last 64KB.
+    using LZ4Dictionary = AZStd::vector<uint8_t>;
+
     /** 
     * Implements an LZ4 Compressor against GridMate's Compressor interface for use with the Multiplayer Gem.
     * Handles edge and error cases specific to LZ4 that are otherwise not covered in GridMate Carrier 
@@ -28,16 +44,46 @@ namespace MultiplayerCompression
     public:
         AZ_CLASS_ALLOCATOR(LZ4Compressor, AZ::SystemAllocator, 0);
 
+        //! Every packet must be smaller than this in streaming mode, matches the largest TCP packet.
+        static constexpr size_t MaxStreamingPacketSize = 16384;
+        //! The history kept by each side of a streaming connection.
+        static constexpr size_t StreamingHistorySize = 64 * 1024;
+
         LZ4Compressor() = default;
+        //! @param dictionary required in Dictionary mode, both ends of a connection must use the same dictionary
+        explicit LZ4Compressor(LZ4CompressorMode mode, AZStd::shared_ptr<const LZ4Dictionary> dictionary = nullptr);
+        ~LZ4Compressor() override;
 
         const char* GetName() const { return CompressorName; }
         AzNetworking::CompressorType GetType() const override { return CompressorType;  };
+        LZ4CompressorMode GetMode() const { return m_mode; }
+        bool RequiresOrderedDelivery() const override { return m_mode == LZ4CompressorMode::Streaming; }
 
-        bool Init() override { return true; }
+        bool Init() override;
         size_t GetMaxChunkSize(size_t maxCompSize) const override;
         size_t GetMaxCompressedBufferSize(size_t uncompSize) const override;
 
         AzNetworking::CompressorError Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize) override;
         AzNetworking::CompressorError Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize) override;
+
+    private:
+        AZ_DISABLE_COPY_MOVE(LZ4Compressor);
+
+        int CompressBlock(const char* uncompData, int uncompSize, char* compData, int compDataSize);
+        int DecompressBlock(const char* compData, int compDataSize, char* uncompData, int uncompDataSize);
+
+        LZ4CompressorMode m_mode = LZ4CompressorMode::Packet;
+        AZStd::shared_ptr<const LZ4Dictionary> m_dictionary;
+
+        // Dictionary mode: the dictionary is hashed once, and the result copied into the working stream for each packet
+        LZ4_stream_u* m_dictionaryStream = nullptr;
+        // Dictionary and Streaming modes
+        LZ4_stream_u* m_compressStream = nullptr;
+        // Streaming mode: LZ4 references previous packets in place, so each side keeps its own copy of them
+        LZ4_streamDecode_u* m_decompressStream = nullptr;
+        AZStd::vector<char> m_compressHistory;
+        AZStd::vector<char> m_decompressHistory;
+        size_t m_compressHistoryOffset = 0;
+        size_t m_decompressHistoryOffset = 0;
     };
 }
@@ -9,17 +9,76 @@
 #include "MultiplayerCompressionFactory.h"
 #include "LZ4Compressor.h"
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace MultiplayerCompression
 {
+    // LZ4 only ever uses the last 64KB of a dictionary, anything larger is a misconfiguration
+    static constexpr size_t MaxDictionaryFileSize = 64 * 1024;
+
+    AZ_CVAR(AZ::CVarFixedString, net_LZ4DictionaryFile, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Raw dictionary of at most 64KB used by the MultiplayerCompressorDictionary compressor, for instance trained on captured packets with "
+        "'zstd --train --maxdict=65536' (the zstd default of 110KB is too large for LZ4). Clients and servers must use the same file.");
+
+    MultiplayerCompressionFactory::MultiplayerCompressionFactory(AZ::Name name, LZ4CompressorMode mode)
+        : m_name(AZStd::move(name))
+        , m_mode(mode)
+    {
+        ;
+    }
+
     AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerCompressionFactory::Create()
     {
-        return AZStd::make_unique<LZ4Compressor>();
+        switch (m_mode)
+        {
+        case LZ4CompressorMode::Dictionary:
+            if (AZStd::shared_ptr<const LZ4Dictionary> dictionary = GetDictionary())
+            {
+                return AZStd::make_unique<LZ4Compressor>(m_mode, AZStd::move(dictionary));
+            }
+            // The missing dictionary has already been reported, plain LZ4 blocks remain decodable by peers that did load it
+            return AZStd::make_unique<LZ4Compressor>();
+        case LZ4CompressorMode::Streaming:
+            return AZStd::make_unique<LZ4Compressor>(m_mode);
+        default:
+            return AZStd::make_unique<LZ4Compressor>();
+        }
     }
 
     AZ::Name MultiplayerCompressionFactory::GetFactoryName() const
     {
         return m_name;
     }
+
+    AZStd::shared_ptr<const LZ4Dictionary> MultiplayerCompressionFactory::GetDictionary()
+    {
+        // Compressors may be created from the listen thread as well as the main thread
+        AZStd::lock_guard<AZStd::mutex> lock(m_dictionaryMutex);
+        if (m_dictionaryLoaded)
+        {
+            return m_dictionary;
+        }
+        m_dictionaryLoaded = true;
+
+        const AZ::CVarFixedString dictionaryFile = net_LZ4DictionaryFile;
+        if (dictionaryFile.empty())
+        {
+            AZ_Error("Multiplayer Compressor", false, "%s requires net_LZ4DictionaryFile to be set", m_name.GetCStr());
+            return nullptr;
+        }
+
+        auto readResult = AZ::Utils::ReadFile<LZ4Dictionary>(dictionaryFile, MaxDictionaryFileSize);
+        if (!readResult.IsSuccess() || readResult.GetValue().empty())
+        {
+            AZ_Error("Multiplayer Compressor", false, "Failed to load compression dictionary %s: %s", dictionaryFile.c_str(),
+                readResult.IsSuccess() ? "file is empty" : readResult.GetError().c_str());
+            return nullptr;
+        }
+
+        m_dictionary = AZStd::make_shared<LZ4Dictionary>(readResult.TakeValue());
+        return m_dictionary;
+    }
 }
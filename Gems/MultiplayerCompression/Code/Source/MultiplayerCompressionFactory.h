@@ -9,15 +9,21 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzNetworking/Framework/ICompressor.h>
 
+#include "LZ4Compressor.h"
+
 namespace MultiplayerCompression
 {
     class MultiplayerCompressionFactory
         : public AzNetworking::ICompressorFactory
     {
     public:
+        MultiplayerCompressionFactory() = default;
+        MultiplayerCompressionFactory(AZ::Name name, LZ4CompressorMode mode);
+
         //! Instantiate a new compressor
         //! @return A unique_ptr to a new Compressor
         AZStd::unique_ptr<AzNetworking::ICompressor> Create() override;
@@ -27,6 +33,14 @@ namespace MultiplayerCompression
         AZ::Name GetFactoryName() const override;
 
     private:
+        //! Loads the dictionary referenced by net_LZ4DictionaryFile, once, and shares it with every compressor.
+        AZStd::shared_ptr<const LZ4Dictionary> GetDictionary();
+
         const AZ::Name m_name = AZ::Name("MultiplayerCompressor");
+        const LZ4CompressorMode m_mode = LZ4CompressorMode::Packet;
+
+        AZStd::mutex m_dictionaryMutex;
+        AZStd::shared_ptr<const LZ4Dictionary> m_dictionary;
+        bool m_dictionaryLoaded = false;
     };
 }
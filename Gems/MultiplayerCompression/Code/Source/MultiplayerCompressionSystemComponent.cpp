@@ -49,13 +49,26 @@ namespace MultiplayerCompression
 
     MultiplayerCompressionSystemComponent::MultiplayerCompressionSystemComponent()
     {
-        m_multiplayerCompressionFactory = new MultiplayerCompressionFactory();
-        AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_multiplayerCompressionFactory);
+        // Selected through net_TcpCompressor and net_UdpCompressor, streaming is only valid for TCP
+        MultiplayerCompressionFactory* factories[] =
+        {
+            new MultiplayerCompressionFactory(),
+            new MultiplayerCompressionFactory(AZ::Name("MultiplayerCompressorDictionary"), LZ4CompressorMode::Dictionary),
+            new MultiplayerCompressionFactory(AZ::Name("MultiplayerCompressorStreaming"), LZ4CompressorMode::Streaming)
+        };
+
+        for (MultiplayerCompressionFactory* factory : factories)
+        {
+            m_factoryNames.push_back(factory->GetFactoryName());
+            AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(factory);
+        }
     }
 
     MultiplayerCompressionSystemComponent::~MultiplayerCompressionSystemComponent()
     {
-        AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_multiplayerCompressionFactory->GetFactoryName());
-        delete m_multiplayerCompressionFactory;
+        for (const AZ::Name& factoryName : m_factoryNames)
+        {
+            AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(factoryName);
+        }
     }
 }
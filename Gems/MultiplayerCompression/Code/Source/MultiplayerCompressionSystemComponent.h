@@ -10,6 +10,7 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
 
 #include <MultiplayerCompressionFactory.h>
 
@@ -40,6 +41,7 @@ namespace MultiplayerCompression
         void Deactivate() override {}
         ////////////////////////////////////////////////////////////////////////
     private:
-        MultiplayerCompressionFactory* m_multiplayerCompressionFactory;
+        //! Ownership of the factories is transferred to AzNetworking on registration, only their names are kept
+        AZStd::vector<AZ::Name> m_factoryNames;
     };
 }
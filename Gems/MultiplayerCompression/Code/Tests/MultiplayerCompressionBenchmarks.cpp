@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <LZ4Compressor.h>
+#include <benchmark/benchmark.h>
+
+namespace MultiplayerCompression
+{
+    //! Replays a corpus of packets resembling entity replication traffic through each compression mode.
+    //! Reports throughput, and the ratio of compressed to uncompressed bytes as the "ratio" counter.
+    class LZ4CompressorBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void RunCorpus(benchmark::State& state, LZ4CompressorMode mode)
+        {
+            LZ4Compressor sender(mode, m_dictionary);
+            LZ4Compressor receiver(mode, m_dictionary);
+            AZStd::vector<uint8_t> compressed(sender.GetMaxCompressedBufferSize(LZ4Compressor::MaxStreamingPacketSize));
+            AZStd::vector<uint8_t> decompressed(LZ4Compressor::MaxStreamingPacketSize);
+
+            size_t uncompressedBytes = 0;
+            size_t compressedBytes = 0;
+            for ([[maybe_unused]] auto value : state)
+            {
+                for (const AZStd::vector<uint8_t>& packet : m_corpus)
+                {
+                    size_t compressedSize = 0;
+                    size_t consumedSize = 0;
+                    size_t uncompressedSize = 0;
+                    sender.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), compressedSize);
+                    receiver.Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size(), consumedSize, uncompressedSize);
+                    benchmark::DoNotOptimize(decompressed.data());
+
+                    uncompressedBytes += packet.size();
+                    compressedBytes += compressedSize;
+                }
+            }
+
+            state.SetBytesProcessed(aznumeric_cast<int64_t>(uncompressedBytes));
+            state.counters["ratio"] = uncompressedBytes > 0 ? aznumeric_cast<double>(compressedBytes) / aznumeric_cast<double>(uncompressedBytes) : 1.0;
+        }
+
+    private:
+        void internalSetUp()
+        {
+            // A few thousand small packets where each entity record only changes slightly from one packet to the next
+            for (uint32_t sequence = 0; sequence < CorpusPacketCount; ++sequence)
+            {
+                AZStd::vector<uint8_t> packet;
+                const uint32_t recordCount = 4 + (sequence % 28);
+                for (uint32_t record = 0; record < recordCount; ++record)
+                {
+                    const uint32_t entityId = (sequence * 7 + record) % 256;
+                    const uint32_t fields[] = { 0xC0FFEE00 + entityId, 0x3F800000 + (sequence & 0xFF), 0x40000000, entityId * 16, 0x00010203 };
+                    const uint8_t* fieldBytes = reinterpret_cast<const uint8_t*>(fields);
+                    packet.insert(packet.end(), fieldBytes, fieldBytes + sizeof(fields));
+                }
+                m_corpus.push_back(AZStd::move(packet));
+            }
+
+            // Stands in for a dictionary trained offline on captured traffic
+            auto dictionary = AZStd::make_shared<LZ4Dictionary>();
+            for (uint32_t packet = 0; packet < CorpusPacketCount && dictionary->size() < 16 * 1024; packet += 37)
+            {
+                dictionary->insert(dictionary->end(), m_corpus[packet].begin(), m_corpus[packet].end());
+            }
+            m_dictionary = AZStd::move(dictionary);
+        }
+
+        void internalTearDown()
+        {
+            m_corpus = {};
+            m_dictionary.reset();
+        }
+
+        static constexpr uint32_t CorpusPacketCount = 4096;
+
+        AZStd::vector<AZStd::vector<uint8_t>> m_corpus;
+        AZStd::shared_ptr<const LZ4Dictionary> m_dictionary;
+    };
+
+    BENCHMARK_F(LZ4CompressorBenchmark, Packet)(benchmark::State& state)
+    {
+        RunCorpus(state, LZ4CompressorMode::Packet);
+    }
+
+    BENCHMARK_F(LZ4CompressorBenchmark, Dictionary)(benchmark::State& state)
+    {
+        RunCorpus(state, LZ4CompressorMode::Dictionary);
+    }
+
+    BENCHMARK_F(LZ4CompressorBenchmark, Streaming)(benchmark::State& state)
+    {
+        RunCorpus(state, LZ4CompressorMode::Streaming);
+    }
+}
+#endif
@@ -13,6 +13,7 @@
 
 #include <AzCore/Compression/Compression.h>
 #include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzTest/AzTest.h>
@@ -126,4 +127,112 @@ TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_NullTest)
     EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::Uninitialized);
 }
 
+// Builds a packet resembling entity replication traffic: a repeating record layout where only a few fields change per packet
+static AZStd::vector<uint8_t> BuildReplicationPacket(uint32_t sequence, size_t recordCount)
+{
+    AZStd::vector<uint8_t> packet;
+    for (uint32_t record = 0; record < recordCount; ++record)
+    {
+        const uint32_t fields[] = { 0xC0FFEE00 + record, 0x3F800000, 0x40000000 + (sequence & 0xF), record * 16, 0x00010203 };
+        const uint8_t* fieldBytes = reinterpret_cast<const uint8_t*>(fields);
+        packet.insert(packet.end(), fieldBytes, fieldBytes + sizeof(fields));
+    }
+    return packet;
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_DictionaryRoundTrip)
+{
+    auto dictionary = AZStd::make_shared<MultiplayerCompression::LZ4Dictionary>(BuildReplicationPacket(0, 64));
+    MultiplayerCompression::LZ4Compressor sender(MultiplayerCompression::LZ4CompressorMode::Dictionary, dictionary);
+    MultiplayerCompression::LZ4Compressor receiver(MultiplayerCompression::LZ4CompressorMode::Dictionary, dictionary);
+    MultiplayerCompression::LZ4Compressor packetCompressor;
+    ASSERT_EQ(sender.GetMode(), MultiplayerCompression::LZ4CompressorMode::Dictionary);
+    EXPECT_TRUE(sender.Init());
+
+    // Packets are decompressed out of order, as they could be over UDP
+    AZStd::vector<AZStd::vector<uint8_t>> packets;
+    AZStd::vector<AZStd::vector<uint8_t>> compressedPackets;
+    for (uint32_t sequence = 1; sequence <= 4; ++sequence)
+    {
+        packets.push_back(BuildReplicationPacket(sequence, 8));
+        AZStd::vector<uint8_t> compressed(sender.GetMaxCompressedBufferSize(packets.back().size()));
+        size_t compressedSize = 0;
+        ASSERT_EQ(sender.Compress(packets.back().data(), packets.back().size(), compressed.data(), compressed.size(), compressedSize), AzNetworking::CompressorError::Ok);
+        compressed.resize(compressedSize);
+        compressedPackets.push_back(AZStd::move(compressed));
+    }
+
+    AZStd::vector<uint8_t> packetModeBuffer(packetCompressor.GetMaxCompressedBufferSize(packets.back().size()));
+    size_t packetModeSize = 0;
+    ASSERT_EQ(packetCompressor.Compress(packets.back().data(), packets.back().size(), packetModeBuffer.data(), packetModeBuffer.size(), packetModeSize), AzNetworking::CompressorError::Ok);
+    EXPECT_LT(compressedPackets.back().size(), packetModeSize);
+
+    for (size_t index = packets.size(); index-- > 0;)
+    {
+        AZStd::vector<uint8_t> decompressed(packets[index].size());
+        size_t consumedSize = 0;
+        size_t uncompressedSize = 0;
+        ASSERT_EQ(receiver.Decompress(compressedPackets[index].data(), compressedPackets[index].size(), decompressed.data(), decompressed.size(), consumedSize, uncompressedSize), AzNetworking::CompressorError::Ok);
+        EXPECT_EQ(consumedSize, compressedPackets[index].size());
+        ASSERT_EQ(uncompressedSize, packets[index].size());
+        EXPECT_EQ(memcmp(decompressed.data(), packets[index].data(), uncompressedSize), 0);
+    }
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_DictionaryMissing_FallsBackToPacket)
+{
+    AZ_TEST_START_TRACE_SUPPRESSION;
+    MultiplayerCompression::LZ4Compressor compressor(MultiplayerCompression::LZ4CompressorMode::Dictionary);
+    AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    EXPECT_EQ(compressor.GetMode(), MultiplayerCompression::LZ4CompressorMode::Packet);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_StreamingRoundTrip)
+{
+    MultiplayerCompression::LZ4Compressor sender(MultiplayerCompression::LZ4CompressorMode::Streaming);
+    MultiplayerCompression::LZ4Compressor receiver(MultiplayerCompression::LZ4CompressorMode::Streaming);
+    EXPECT_TRUE(sender.Init());
+
+    // Enough traffic to wrap the history
+    size_t firstCompressedSize = 0;
+    size_t lastCompressedSize = 0;
+    for (uint32_t sequence = 0; sequence < 200; ++sequence)
+    {
+        const AZStd::vector<uint8_t> packet = BuildReplicationPacket(sequence, 8 + (sequence % 32));
+        AZStd::vector<uint8_t> compressed(sender.GetMaxCompressedBufferSize(packet.size()));
+        size_t compressedSize = 0;
+        ASSERT_EQ(sender.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), compressedSize), AzNetworking::CompressorError::Ok);
+
+        AZStd::vector<uint8_t> decompressed(MultiplayerCompression::LZ4Compressor::MaxStreamingPacketSize);
+        size_t consumedSize = 0;
+        size_t uncompressedSize = 0;
+        ASSERT_EQ(receiver.Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size(), consumedSize, uncompressedSize), AzNetworking::CompressorError::Ok);
+        ASSERT_EQ(uncompressedSize, packet.size());
+        ASSERT_EQ(memcmp(decompressed.data(), packet.data(), uncompressedSize), 0);
+
+        if (sequence == 0)
+        {
+            firstCompressedSize = compressedSize;
+        }
+        else if (sequence == 192)
+        {
+            // Identical to the first packet
+            lastCompressedSize = compressedSize;
+        }
+    }
+
+    // Repeated packets only cost a back reference into the history
+    EXPECT_LT(lastCompressedSize, firstCompressedSize);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_StreamingOversizeTest)
+{
+    MultiplayerCompression::LZ4Compressor compressor(MultiplayerCompression::LZ4CompressorMode::Streaming);
+    AZStd::vector<uint8_t> input(MultiplayerCompression::LZ4Compressor::MaxStreamingPacketSize + 1);
+    AZStd::vector<uint8_t> output(compressor.GetMaxCompressedBufferSize(input.size()));
+    size_t compressedSize = 0;
+
+    EXPECT_EQ(compressor.Compress(input.data(), input.size(), output.data(), output.size(), compressedSize), AzNetworking::CompressorError::InsufficientBuffer);
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -7,5 +7,6 @@
 #
 
 set(FILES
+    Tests/MultiplayerCompressionBenchmarks.cpp
     Tests/MultiplayerCompressionTest.cpp
 )
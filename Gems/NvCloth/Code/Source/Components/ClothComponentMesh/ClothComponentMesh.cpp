@@ -238,6 +238,7 @@ namespace NvCloth
         }
         m_entityId.SetInvalid();
         m_renderDataBuffer = {};
+        m_simulatedNormals.clear();
         m_meshRemappedVertices.clear();
         m_meshNodeInfo = {};
         m_meshClothInfo = {};
@@ -415,7 +416,7 @@ namespace NvCloth
         }
 
         // Calculate normals of the cloth particles (simplified mesh).
-        AZStd::vector<AZ::Vector3> normals;
+        AZStd::vector<AZ::Vector3>& normals = m_simulatedNormals;
         [[maybe_unused]] bool normalsCalculated =
             AZ::Interface<ITangentSpaceHelper>::Get()->CalculateNormals(particles, m_cloth->GetInitialIndices(), normals);
         AZ_Assert(normalsCalculated, "Cloth component mesh failed to calculate normals.");
@@ -114,6 +114,9 @@ namespace NvCloth
         AZ::u32 m_renderDataBufferIndex = 0;
         AZStd::array<RenderData, RenderDataBufferSize> m_renderDataBuffer;
 
+        // Normals of the simulated particles, kept between frames to avoid reallocating them every post-simulation.
+        AZStd::vector<AZ::Vector3> m_simulatedNormals;
+
         // Vertex mapping between full mesh and simplified mesh used in cloth simulation.
         // Negative elements means the vertex has been removed.
         AZStd::vector<int> m_meshRemappedVertices;
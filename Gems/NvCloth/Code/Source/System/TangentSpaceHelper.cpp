@@ -9,12 +9,192 @@
 #include <System/TangentSpaceHelper.h>
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/SimdMath.h>
 
 namespace NvCloth
 {
     namespace
     {
         const float Tolerance = 1e-7f;
+
+        using AZ::Simd::Vec4;
+
+        // The per-frame normal and tangent rebuild of CalculateNormals and CalculateTangentsAndBitagents processes 4 triangles
+        // (or 4 vertices) at once. The positions are transposed into a structure of arrays layout, so each SIMD operation
+        // works on the same component of the 4 elements and no lane is wasted like with the w component of AZ::Vector3.
+        const size_t SimdWidth = 4;
+
+        //! Four 3D vectors in structure of arrays layout.
+        struct Vector3x4
+        {
+            Vec4::FloatType m_x;
+            Vec4::FloatType m_y;
+            Vec4::FloatType m_z;
+        };
+
+        Vector3x4 Splat(const AZ::Vector3& value)
+        {
+            return { Vec4::Splat(value.GetX()), Vec4::Splat(value.GetY()), Vec4::Splat(value.GetZ()) };
+        }
+
+        Vector3x4 Add(const Vector3x4& lhs, const Vector3x4& rhs)
+        {
+            return { Vec4::Add(lhs.m_x, rhs.m_x), Vec4::Add(lhs.m_y, rhs.m_y), Vec4::Add(lhs.m_z, rhs.m_z) };
+        }
+
+        Vector3x4 Sub(const Vector3x4& lhs, const Vector3x4& rhs)
+        {
+            return { Vec4::Sub(lhs.m_x, rhs.m_x), Vec4::Sub(lhs.m_y, rhs.m_y), Vec4::Sub(lhs.m_z, rhs.m_z) };
+        }
+
+        Vector3x4 Mul(const Vector3x4& lhs, Vec4::FloatArgType scale)
+        {
+            return { Vec4::Mul(lhs.m_x, scale), Vec4::Mul(lhs.m_y, scale), Vec4::Mul(lhs.m_z, scale) };
+        }
+
+        Vec4::FloatType Dot(const Vector3x4& lhs, const Vector3x4& rhs)
+        {
+            return Vec4::Madd(lhs.m_z, rhs.m_z, Vec4::Madd(lhs.m_y, rhs.m_y, Vec4::Mul(lhs.m_x, rhs.m_x)));
+        }
+
+        Vector3x4 Cross(const Vector3x4& lhs, const Vector3x4& rhs)
+        {
+            return {
+                Vec4::Sub(Vec4::Mul(lhs.m_y, rhs.m_z), Vec4::Mul(lhs.m_z, rhs.m_y)),
+                Vec4::Sub(Vec4::Mul(lhs.m_z, rhs.m_x), Vec4::Mul(lhs.m_x, rhs.m_z)),
+                Vec4::Sub(Vec4::Mul(lhs.m_x, rhs.m_y), Vec4::Mul(lhs.m_y, rhs.m_x))
+            };
+        }
+
+        //! Picks the lanes of lhs where mask is set and the lanes of rhs elsewhere.
+        Vector3x4 Select(const Vector3x4& lhs, const Vector3x4& rhs, Vec4::FloatArgType mask)
+        {
+            return { Vec4::Select(lhs.m_x, rhs.m_x, mask), Vec4::Select(lhs.m_y, rhs.m_y, mask), Vec4::Select(lhs.m_z, rhs.m_z, mask) };
+        }
+
+        //! Mask of the lanes where all components are within tolerance of zero, like AZ::Vector3::IsZero.
+        Vec4::FloatType IsZero(const Vector3x4& value, float tolerance)
+        {
+            const Vec4::FloatType toleranceVec = Vec4::Splat(tolerance);
+            return Vec4::And(
+                Vec4::And(Vec4::CmpLtEq(Vec4::Abs(value.m_x), toleranceVec), Vec4::CmpLtEq(Vec4::Abs(value.m_y), toleranceVec)),
+                Vec4::CmpLtEq(Vec4::Abs(value.m_z), toleranceVec));
+        }
+
+        //! Mask of the lanes where all components are finite. Infinity and NaN give NaN when subtracted from themselves.
+        Vec4::FloatType IsFinite(const Vector3x4& value)
+        {
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            return Vec4::And(
+                Vec4::And(Vec4::CmpEq(Vec4::Sub(value.m_x, value.m_x), zero), Vec4::CmpEq(Vec4::Sub(value.m_y, value.m_y), zero)),
+                Vec4::CmpEq(Vec4::Sub(value.m_z, value.m_z), zero));
+        }
+
+        //! Same as AZ::Vector3::NormalizeSafe, lanes shorter than tolerance become zero and non-finite lanes stay non-finite.
+        Vector3x4 NormalizeSafe(const Vector3x4& value, float tolerance)
+        {
+            const Vec4::FloatType lengthSq = Dot(value, value);
+            const Vec4::FloatType isTooShort = Vec4::CmpLt(lengthSq, Vec4::Splat(tolerance * tolerance));
+            const Vec4::FloatType invLength = Vec4::AndNot(isTooShort, Vec4::SqrtInv(lengthSq));
+            return Mul(value, invLength);
+        }
+
+        //! Same as AZ::Vector3::AngleSafe, the angle is zero in the lanes where either vector is zero.
+        Vec4::FloatType AngleSafe(const Vector3x4& lhs, const Vector3x4& rhs)
+        {
+            const Vec4::FloatType cosAngle = Vec4::Mul(Dot(lhs, rhs), Vec4::SqrtInv(Vec4::Mul(Dot(lhs, lhs), Dot(rhs, rhs))));
+            const Vec4::FloatType angle = Vec4::Acos(Vec4::Clamp(cosAngle, Vec4::Splat(-1.0f), Vec4::Splat(1.0f)));
+            const Vec4::FloatType hasZero = Vec4::Or(IsZero(lhs, AZ::Constants::FloatEpsilon), IsZero(rhs, AZ::Constants::FloatEpsilon));
+            return Vec4::AndNot(hasZero, angle);
+        }
+
+        //! The data of up to 4 consecutive triangles, the unused lanes repeat the last triangle.
+        struct TriangleBatch
+        {
+            SimIndexType m_indices[3][SimdWidth]; // [vertex in triangle][lane]
+            size_t m_laneCount = 0;
+            Vector3x4 m_positions[3];
+            Vector3x4 m_edges[2];
+            Vec4::FloatType m_vertexWeights[3];
+        };
+
+        void LoadTriangleBatch(
+            size_t firstTriangle,
+            size_t triangleCount,
+            const AZStd::vector<SimIndexType>& indices,
+            const AZStd::vector<SimParticleFormat>& vertices,
+            TriangleBatch& batch)
+        {
+            batch.m_laneCount = AZStd::min(SimdWidth, triangleCount - firstTriangle);
+            for (size_t lane = 0; lane < SimdWidth; ++lane)
+            {
+                const size_t triangle = firstTriangle + AZStd::min(lane, batch.m_laneCount - 1);
+                for (size_t vertexInTriangle = 0; vertexInTriangle < 3; ++vertexInTriangle)
+                {
+                    batch.m_indices[vertexInTriangle][lane] = indices[triangle * 3 + vertexInTriangle];
+                }
+            }
+
+            for (size_t vertexInTriangle = 0; vertexInTriangle < 3; ++vertexInTriangle)
+            {
+                const SimIndexType* laneIndices = batch.m_indices[vertexInTriangle];
+                const Vec4::FloatType rows[SimdWidth] = {
+                    vertices[laneIndices[0]].GetSimdValue(),
+                    vertices[laneIndices[1]].GetSimdValue(),
+                    vertices[laneIndices[2]].GetSimdValue(),
+                    vertices[laneIndices[3]].GetSimdValue()
+                };
+                Vec4::FloatType columns[SimdWidth];
+                Vec4::Mat4x4Transpose(rows, columns);
+                batch.m_positions[vertexInTriangle] = { columns[0], columns[1], columns[2] };
+            }
+
+            const Vector3x4* positions = batch.m_positions;
+            batch.m_edges[0] = Sub(positions[1], positions[0]);
+            batch.m_edges[1] = Sub(positions[2], positions[0]);
+
+            // weight by angle to fix the L-Shape problem, same as GetVertexWeightInTriangle
+            const Vector3x4 edge12 = Sub(positions[2], positions[1]);
+            batch.m_vertexWeights[0] = AngleSafe(batch.m_edges[1], batch.m_edges[0]);
+            batch.m_vertexWeights[1] = AngleSafe(Sub(positions[0], positions[1]), edge12);
+            batch.m_vertexWeights[2] = AngleSafe(Sub(positions[1], positions[2]), Sub(positions[0], positions[2]));
+        }
+
+        //! Adds each lane of value to the element of output indexed by the lane's vertex index.
+        void ScatterAdd(const Vector3x4& value, const TriangleBatch& batch, size_t vertexInTriangle, AZStd::vector<AZ::Vector3>& output)
+        {
+            const Vec4::FloatType columns[SimdWidth] = { value.m_x, value.m_y, value.m_z, Vec4::ZeroFloat() };
+            Vec4::FloatType rows[SimdWidth];
+            Vec4::Mat4x4Transpose(columns, rows);
+            for (size_t lane = 0; lane < batch.m_laneCount; ++lane)
+            {
+                output[batch.m_indices[vertexInTriangle][lane]] += AZ::Vector3(Vec4::ToVec3(rows[lane]));
+            }
+        }
+
+        Vector3x4 LoadVertexBatch(const AZ::Vector3* vectors)
+        {
+            const Vec4::FloatType rows[SimdWidth] = {
+                Vec4::FromVec3(vectors[0].GetSimdValue()),
+                Vec4::FromVec3(vectors[1].GetSimdValue()),
+                Vec4::FromVec3(vectors[2].GetSimdValue()),
+                Vec4::FromVec3(vectors[3].GetSimdValue())
+            };
+            Vec4::FloatType columns[SimdWidth];
+            Vec4::Mat4x4Transpose(rows, columns);
+            return { columns[0], columns[1], columns[2] };
+        }
+
+        void StoreVertexBatch(const Vector3x4& value, AZ::Vector3* vectors)
+        {
+            const Vec4::FloatType columns[SimdWidth] = { value.m_x, value.m_y, value.m_z, Vec4::ZeroFloat() };
+            Vec4::FloatType rows[SimdWidth];
+            Vec4::Mat4x4Transpose(columns, rows);
+            for (size_t i = 0; i < SimdWidth; ++i)
+            {
+                vectors[i] = AZ::Vector3(Vec4::ToVec3(rows[i]));
+            }
+        }
     }
 
     bool TangentSpaceHelper::CalculateNormals(
@@ -39,38 +219,43 @@ namespace NvCloth
         outNormals.resize(vertexCount);
         AZStd::fill(outNormals.begin(), outNormals.end(), AZ::Vector3::CreateZero());
 
-        // calculate the normals per triangle
-        for (size_t i = 0; i < triangleCount; ++i)
+        // calculate the normals per triangle, 4 triangles at a time
+        const Vector3x4 identityNormal = Splat(AZ::Vector3::CreateAxisZ(0.01f));
+        const Vec4::FloatType minWeight = Vec4::Splat(Tolerance);
+        TriangleBatch batch;
+        for (size_t i = 0; i < triangleCount; i += SimdWidth)
         {
-            TriangleIndices triangleIndices;
-            TrianglePositions trianglePositions;
-            TriangleEdges triangleEdges;
-            GetTriangleData(
-                i, indices, vertices,
-                triangleIndices, trianglePositions, triangleEdges);
+            LoadTriangleBatch(i, triangleCount, indices, vertices, batch);
 
-            AZ::Vector3 normal;
-            ComputeNormal(triangleEdges, normal);
+            // Same as ComputeNormal, triangles with parallel edges use the identity normal with low influence.
+            const Vector3x4 normal = Cross(batch.m_edges[0], batch.m_edges[1]);
+            const Vec4::FloatType isDegenerate = IsZero(normal, Tolerance);
+            const Vector3x4 unitNormal = Select(identityNormal, Mul(normal, Vec4::SqrtInv(Dot(normal, normal))), isDegenerate);
 
             // distribute the normals to the vertices.
-            for (AZ::u32 vertexIndexInTriangle = 0; vertexIndexInTriangle < 3; ++vertexIndexInTriangle)
+            for (size_t vertexIndexInTriangle = 0; vertexIndexInTriangle < 3; ++vertexIndexInTriangle)
             {
-                const float weight = GetVertexWeightInTriangle(vertexIndexInTriangle, trianglePositions);
-
-                const SimIndexType vertexIndex = triangleIndices[vertexIndexInTriangle];
-
-                outNormals[vertexIndex] += normal * AZStd::max(weight, Tolerance);
+                const Vec4::FloatType weight = Vec4::Max(batch.m_vertexWeights[vertexIndexInTriangle], minWeight);
+                ScatterAdd(Mul(unitNormal, weight), batch, vertexIndexInTriangle, outNormals);
             }
         }
 
-        // adjust the normals per vertex
-        for (auto& outNormal : outNormals)
+        // adjust the normals per vertex, 4 vertices at a time
+        const Vector3x4 fallbackNormal = Splat(AZ::Vector3::CreateAxisZ());
+        const size_t simdVertexCount = vertexCount - (vertexCount % SimdWidth);
+        for (size_t i = 0; i < simdVertexCount; i += SimdWidth)
         {
-            outNormal.NormalizeSafe(Tolerance);
+            const Vector3x4 normal = NormalizeSafe(LoadVertexBatch(&outNormals[i]), Tolerance);
 
             // Safety check for situations where simulation gets out of control.
             // Particles' positions can have huge floating point values that
             // could lead to non-finite numbers when calculating tangent spaces.
+            StoreVertexBatch(Select(normal, fallbackNormal, IsFinite(normal)), &outNormals[i]);
+        }
+        for (size_t i = simdVertexCount; i < vertexCount; ++i)
+        {
+            AZ::Vector3& outNormal = outNormals[i];
+            outNormal.NormalizeSafe(Tolerance);
             if (!outNormal.IsFinite())
             {
                 outNormal = AZ::Vector3::CreateAxisZ();
@@ -123,40 +308,77 @@ namespace NvCloth
         AZStd::fill(outTangents.begin(), outTangents.end(), AZ::Vector3::CreateZero());
         AZStd::fill(outBitangents.begin(), outBitangents.end(), AZ::Vector3::CreateZero());
 
-        // calculate the base vectors per triangle
-        for (size_t i = 0; i < triangleCount; ++i)
+        // calculate the base vectors per triangle, 4 triangles at a time
+        const Vector3x4 identityTangent = Splat(AZ::Vector3::CreateAxisX());
+        const Vector3x4 identityBitangent = Splat(AZ::Vector3::CreateAxisY());
+        const Vec4::FloatType signMask = Vec4::CastToFloat(Vec4::Splat(static_cast<int32_t>(0x80000000)));
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        TriangleBatch batch;
+        for (size_t i = 0; i < triangleCount; i += SimdWidth)
         {
-            TriangleIndices triangleIndices;
-            TrianglePositions trianglePositions;
-            TriangleEdges triangleEdges;
-            TriangleUVs triangleUVs;
-            GetTriangleData(
-                i, indices, vertices, uvs,
-                triangleIndices, trianglePositions, triangleEdges, triangleUVs);
+            LoadTriangleBatch(i, triangleCount, indices, vertices, batch);
 
-            AZ::Vector3 tangent, bitangent;
-            ComputeTangentAndBitangent(triangleUVs, triangleEdges, tangent, bitangent);
-
-            // distribute the uv vectors to the vertices.
-            for (AZ::u32 vertexIndexInTriangle = 0; vertexIndexInTriangle < 3; ++vertexIndexInTriangle)
+            float deltaU1[SimdWidth], deltaU2[SimdWidth], deltaV1[SimdWidth], deltaV2[SimdWidth];
+            for (size_t lane = 0; lane < SimdWidth; ++lane)
             {
-                const float weight = GetVertexWeightInTriangle(vertexIndexInTriangle, trianglePositions);
+                const SimUVType& uv0 = uvs[batch.m_indices[0][lane]];
+                const SimUVType& uv1 = uvs[batch.m_indices[1][lane]];
+                const SimUVType& uv2 = uvs[batch.m_indices[2][lane]];
+                deltaU1[lane] = uv1.GetX() - uv0.GetX();
+                deltaU2[lane] = uv2.GetX() - uv0.GetX();
+                deltaV1[lane] = uv1.GetY() - uv0.GetY();
+                deltaV2[lane] = uv2.GetY() - uv0.GetY();
+            }
+            const Vec4::FloatType du1 = Vec4::LoadUnaligned(deltaU1);
+            const Vec4::FloatType du2 = Vec4::LoadUnaligned(deltaU2);
+            const Vec4::FloatType dv1 = Vec4::LoadUnaligned(deltaV1);
+            const Vec4::FloatType dv2 = Vec4::LoadUnaligned(deltaV2);
 
-                const SimIndexType vertexIndex = triangleIndices[vertexIndexInTriangle];
+            // Same as ComputeTangentAndBitangent, triangles without uv area use the identity base.
+            const Vec4::FloatType div = Vec4::Sub(Vec4::Mul(du1, dv2), Vec4::Mul(du2, dv1));
+            const Vec4::FloatType isDegenerate = Vec4::CmpLtEq(Vec4::Abs(div), Vec4::Splat(Tolerance));
+            const Vec4::FloatType signDiv = Vec4::Or(Vec4::And(div, signMask), one);
 
-                outTangents[vertexIndex] += tangent * weight;
-                outBitangents[vertexIndex] += bitangent * weight;
+            const Vector3x4 tangent = Mul(Add(Mul(batch.m_edges[0], dv2), Mul(batch.m_edges[1], Vec4::Sub(Vec4::ZeroFloat(), dv1))), signDiv);
+            const Vector3x4 bitangent = Mul(Add(Mul(batch.m_edges[0], Vec4::Sub(Vec4::ZeroFloat(), du2)), Mul(batch.m_edges[1], du1)), signDiv);
+            const Vector3x4 triangleTangent = Select(identityTangent, tangent, isDegenerate);
+            const Vector3x4 triangleBitangent = Select(identityBitangent, bitangent, isDegenerate);
+
+            // distribute the uv vectors to the vertices.
+            for (size_t vertexIndexInTriangle = 0; vertexIndexInTriangle < 3; ++vertexIndexInTriangle)
+            {
+                const Vec4::FloatType weight = batch.m_vertexWeights[vertexIndexInTriangle];
+                ScatterAdd(Mul(triangleTangent, weight), batch, vertexIndexInTriangle, outTangents);
+                ScatterAdd(Mul(triangleBitangent, weight), batch, vertexIndexInTriangle, outBitangents);
             }
         }
 
-        // adjust the base vectors per vertex
-        for (size_t i = 0; i < vertexCount; ++i)
+        // adjust the base vectors per vertex, 4 vertices at a time
+        const Vec4::FloatType minusOne = Vec4::Splat(-1.0f);
+        const size_t simdVertexCount = vertexCount - (vertexCount % SimdWidth);
+        for (size_t i = 0; i < simdVertexCount; i += SimdWidth)
         {
-            AdjustTangentAndBitangent(normals[i], outTangents[i], outBitangents[i]);
+            const Vector3x4 normal = LoadVertexBatch(&normals[i]);
+            Vector3x4 tangent = LoadVertexBatch(&outTangents[i]);
+            const Vector3x4 bitangent = LoadVertexBatch(&outBitangents[i]);
+
+            // Same as AdjustTangentAndBitangent
+            const Vec4::FloatType isLeftHanded = Vec4::CmpLt(Dot(Cross(normal, tangent), bitangent), Vec4::ZeroFloat());
+            const Vec4::FloatType handedness = Vec4::Select(minusOne, one, isLeftHanded);
+            tangent = NormalizeSafe(Sub(tangent, Mul(normal, Dot(normal, tangent))), Tolerance);
+            const Vector3x4 adjustedBitangent = Mul(Cross(normal, tangent), handedness);
 
             // Safety check for situations where simulation gets out of control.
             // Particles' positions can have huge floating point values that
             // could lead to non-finite numbers when calculating tangent spaces.
+            const Vec4::FloatType isFinite = Vec4::And(IsFinite(tangent), IsFinite(adjustedBitangent));
+            StoreVertexBatch(Select(tangent, identityTangent, isFinite), &outTangents[i]);
+            StoreVertexBatch(Select(adjustedBitangent, identityBitangent, isFinite), &outBitangents[i]);
+        }
+        for (size_t i = simdVertexCount; i < vertexCount; ++i)
+        {
+            AdjustTangentAndBitangent(normals[i], outTangents[i], outBitangents[i]);
+
             if (!outTangents[i].IsFinite() ||
                 !outBitangents[i].IsFinite())
             {
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <TriangleInputHelper.h>
+
+#include <System/TangentSpaceHelper.h>
+
+#include <benchmark/benchmark.h>
+
+namespace UnitTest
+{
+    //! Rebuilds the normals, tangents and bitangents of many simulated cloth meshes each frame, the same work the cloth
+    //! components do in their post-simulation, without needing a cloth system or any entities.
+    //! The first argument is the number of cloths, the second one the number of segments along each side of a cloth plane.
+    class NvClothTangentSpaceBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        struct BenchmarkCloth
+        {
+            TriangleInput m_mesh;
+            AZStd::vector<AZ::Vector3> m_normals;
+            AZStd::vector<AZ::Vector3> m_tangents;
+            AZStd::vector<AZ::Vector3> m_bitangents;
+        };
+
+        void internalSetUp(const benchmark::State& state)
+        {
+            m_tangentSpaceHelper = AZStd::make_unique<NvCloth::TangentSpaceHelper>();
+
+            AZ::JobManagerDesc jobManagerDesc;
+            for (unsigned int i = 0; i < AZStd::thread::hardware_concurrency(); ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+
+            const AZ::u32 segments = aznumeric_cast<AZ::u32>(state.range(1));
+            m_cloths.resize(aznumeric_cast<size_t>(state.range(0)));
+            for (BenchmarkCloth& cloth : m_cloths)
+            {
+                cloth.m_mesh = CreatePlane(1.0f, 1.0f, segments, segments);
+                for (NvCloth::SimParticleFormat& vertex : cloth.m_mesh.m_vertices)
+                {
+                    // Add some folds so the tangent frames differ per vertex, like a simulated cloth.
+                    vertex.SetZ(0.1f * sinf(vertex.GetX() * 9.0f) * cosf(vertex.GetY() * 5.0f));
+                }
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_cloths = {};
+            m_jobContext = nullptr;
+            m_jobManager = nullptr;
+            m_tangentSpaceHelper = nullptr;
+        }
+
+        void UpdateCloth(BenchmarkCloth& cloth)
+        {
+            NvCloth::ITangentSpaceHelper* tangentSpaceHelper = m_tangentSpaceHelper.get();
+            tangentSpaceHelper->CalculateNormals(cloth.m_mesh.m_vertices, cloth.m_mesh.m_indices, cloth.m_normals);
+            tangentSpaceHelper->CalculateTangentsAndBitagents(
+                cloth.m_mesh.m_vertices, cloth.m_mesh.m_indices, cloth.m_mesh.m_uvs, cloth.m_normals,
+                cloth.m_tangents, cloth.m_bitangents);
+        }
+
+        AZStd::unique_ptr<NvCloth::TangentSpaceHelper> m_tangentSpaceHelper;
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+        AZStd::vector<BenchmarkCloth> m_cloths;
+    };
+
+    BENCHMARK_DEFINE_F(NvClothTangentSpaceBenchmark, BM_UpdateClothsSerial)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (BenchmarkCloth& cloth : m_cloths)
+            {
+                UpdateCloth(cloth);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(NvClothTangentSpaceBenchmark, BM_UpdateClothsSerial)
+        ->Args({ 1, 64 })
+        ->Args({ 16, 32 })
+        ->Args({ 64, 32 })
+        ->Unit(benchmark::kMicrosecond);
+
+    // One job per cloth, the same way the solver dispatches the post-simulation of its cloths.
+    BENCHMARK_DEFINE_F(NvClothTangentSpaceBenchmark, BM_UpdateClothsParallel)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::JobCompletion jobCompletion(m_jobContext.get());
+            for (BenchmarkCloth& cloth : m_cloths)
+            {
+                AZ::Job* job = AZ::CreateJobFunction(
+                    [this, &cloth]()
+                    {
+                        UpdateCloth(cloth);
+                    },
+                    true, m_jobContext.get());
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(NvClothTangentSpaceBenchmark, BM_UpdateClothsParallel)
+        ->Args({ 1, 64 })
+        ->Args({ 16, 32 })
+        ->Args({ 64, 32 })
+        ->Unit(benchmark::kMicrosecond)
+        ->UseRealTime();
+} // namespace UnitTest
+#endif
@@ -571,4 +571,51 @@ namespace UnitTest
         EXPECT_THAT(bitangents, ::testing::Each(IsCloseTolerance(AZ::Vector3::CreateAxisY(), Tolerance)));
         EXPECT_THAT(normals, ::testing::Each(IsCloseTolerance(AZ::Vector3::CreateAxisX(), Tolerance)));
     }
+
+    TEST(NvClothSystem, TangentSpaceHelper_CalculateNormalsAndTangentsOfWavyPlane_MatchCalculateTangentSpace)
+    {
+        // Segment counts chosen so neither the number of triangles nor the number of vertices is a multiple of 4,
+        // which exercises the remainders of the batched computations.
+        const AZ::u32 segmentsX = 6;
+        const AZ::u32 segmentsY = 5;
+
+        TriangleInput wavyPlane = CreatePlane(2.0f, 1.0f, segmentsX, segmentsY);
+        for (auto& vertex : wavyPlane.m_vertices)
+        {
+            const float height = 0.2f * sinf(vertex.GetX() * 4.0f) * cosf(vertex.GetY() * 3.0f);
+            vertex.SetZ(height);
+        }
+        const size_t numVertices = wavyPlane.m_vertices.size();
+        ASSERT_NE(numVertices % 4, 0);
+        ASSERT_NE((wavyPlane.m_indices.size() / 3) % 4, 0);
+
+        AZStd::vector<AZ::Vector3> expectedTangents;
+        AZStd::vector<AZ::Vector3> expectedBitangents;
+        AZStd::vector<AZ::Vector3> expectedNormals;
+        AZ::Interface<NvCloth::ITangentSpaceHelper>::Get()->CalculateTangentSpace(
+            wavyPlane.m_vertices, wavyPlane.m_indices, wavyPlane.m_uvs,
+            expectedTangents, expectedBitangents, expectedNormals);
+
+        AZStd::vector<AZ::Vector3> normals;
+        bool normalsCalculated = AZ::Interface<NvCloth::ITangentSpaceHelper>::Get()->CalculateNormals(
+            wavyPlane.m_vertices, wavyPlane.m_indices, normals);
+
+        AZStd::vector<AZ::Vector3> tangents;
+        AZStd::vector<AZ::Vector3> bitangents;
+        bool tangentsCalculated = AZ::Interface<NvCloth::ITangentSpaceHelper>::Get()->CalculateTangentsAndBitagents(
+            wavyPlane.m_vertices, wavyPlane.m_indices, wavyPlane.m_uvs, normals,
+            tangents, bitangents);
+
+        EXPECT_TRUE(normalsCalculated);
+        EXPECT_TRUE(tangentsCalculated);
+        ASSERT_EQ(normals.size(), numVertices);
+        ASSERT_EQ(tangents.size(), numVertices);
+        ASSERT_EQ(bitangents.size(), numVertices);
+        for (size_t i = 0; i < numVertices; ++i)
+        {
+            EXPECT_THAT(normals[i], IsCloseTolerance(expectedNormals[i], Tolerance));
+            EXPECT_THAT(tangents[i], IsCloseTolerance(expectedTangents[i], Tolerance));
+            EXPECT_THAT(bitangents[i], IsCloseTolerance(expectedBitangents[i], Tolerance));
+        }
+    }
 } // namespace UnitTest
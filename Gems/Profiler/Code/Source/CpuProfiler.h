@@ -74,6 +74,15 @@ namespace Profiler
 
         virtual bool IsContinuousCaptureInProgress() const = 0;
 
+        //! Begin streaming the profiled regions of all threads to a binary trace file, see TraceRecorder.
+        //! Unlike continuous captures, nothing is kept in memory, so the trace capture can be left running indefinitely.
+        [[nodiscard]] virtual bool BeginTraceCapture(const char* traceFilePath) = 0;
+
+        //! Stop the trace capture, once this returns the trace file is complete.
+        [[nodiscard]] virtual bool EndTraceCapture() = 0;
+
+        [[nodiscard]] virtual bool IsTraceCaptureInProgress() const = 0;
+
         //! Enable/Disable the CpuProfiler
         virtual void SetProfilerEnabled(bool enabled) = 0;
 
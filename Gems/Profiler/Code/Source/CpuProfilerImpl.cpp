@@ -16,6 +16,9 @@
 namespace Profiler
 {
     thread_local CpuTimingLocalStorage* CpuProfilerImpl::ms_threadLocalStorage = nullptr;
+    thread_local uint32_t CpuProfilerImpl::ms_threadLocalStorageGeneration = 0;
+
+    static AZStd::atomic<uint32_t> s_nextRegisteredThreadsGeneration{ 1 };
 
     // --- CpuProfiler ---
 
@@ -63,6 +66,11 @@ namespace Profiler
 
     // --- CpuProfilerImpl ---
 
+    CpuProfilerImpl::CpuProfilerImpl()
+        : m_registeredThreadsGeneration(s_nextRegisteredThreadsGeneration.fetch_add(1))
+    {
+    }
+
     void CpuProfilerImpl::Init()
     {
         AZ::Interface<AZ::Debug::Profiler>::Register(this);
@@ -82,13 +90,16 @@ namespace Profiler
         AZ::Interface<CpuProfiler>::Unregister(this);
         AZ::Interface<AZ::Debug::Profiler>::Unregister(this);
 
+        m_traceRecorder.Stop();
+
         // Wait for the remaining threads that might still be processing its profiling calls
         AZStd::unique_lock<AZStd::shared_mutex> shutdownLock(m_shutdownMutex);
 
         m_enabled = false;
 
-        // Cleanup all TLS
+        // Cleanup all TLS, threads still pointing to it will allocate new storage if the profiler is initialized again
         m_registeredThreads.clear();
+        m_registeredThreadsGeneration = s_nextRegisteredThreadsGeneration.fetch_add(1);
         m_timeRegionMap.clear();
         m_initialized = false;
         m_continuousCaptureInProgress.store(false);
@@ -98,6 +109,12 @@ namespace Profiler
 
     void CpuProfilerImpl::BeginRegion(const AZ::Debug::Budget* budget, const char* eventName)
     {
+        // The trace recorder outlives the recordings and only touches the thread's own state, so it doesn't need the shutdown lock
+        if (m_traceRecorder.IsRecording())
+        {
+            m_traceRecorder.BeginRegion(budget->Name(), eventName);
+        }
+
         // Try to lock here, the shutdownMutex will only be contested when the CpuProfiler is shutting down.
         if (m_shutdownMutex.try_lock_shared())
         {
@@ -117,11 +134,16 @@ namespace Profiler
 
     void CpuProfilerImpl::EndRegion([[maybe_unused]] const AZ::Debug::Budget* budget)
     {
+        if (m_traceRecorder.IsRecording())
+        {
+            m_traceRecorder.EndRegion();
+        }
+
         // Try to lock here, the shutdownMutex will only be contested when the CpuProfiler is shutting down.
         if (m_shutdownMutex.try_lock_shared())
         {
             // guard against enabling mid-marker
-            if (m_enabled && ms_threadLocalStorage != nullptr)
+            if (m_enabled && ms_threadLocalStorage != nullptr && ms_threadLocalStorageGeneration == m_registeredThreadsGeneration)
             {
                 ms_threadLocalStorage->RegionStackPopBack();
             }
@@ -177,6 +199,40 @@ namespace Profiler
         return m_continuousCaptureInProgress.load();
     }
 
+    bool CpuProfilerImpl::BeginTraceCapture(const char* traceFilePath)
+    {
+        if (!m_traceRecorder.Start(traceFilePath))
+        {
+            return false;
+        }
+
+        AZ_TracePrintf("Profiler", "Trace capture started\n");
+        return true;
+    }
+
+    bool CpuProfilerImpl::EndTraceCapture()
+    {
+        if (!m_traceRecorder.IsRecording())
+        {
+            AZ_TracePrintf("Profiler", "Attempting to end a trace capture while one not in progress\n");
+            return false;
+        }
+
+        const bool result = m_traceRecorder.Stop();
+        AZ_TracePrintf("Profiler", "Trace capture ended\n");
+        return result;
+    }
+
+    bool CpuProfilerImpl::IsTraceCaptureInProgress() const
+    {
+        return m_traceRecorder.IsRecording();
+    }
+
+    void CpuProfilerImpl::FlushTraceCapture()
+    {
+        m_traceRecorder.Flush();
+    }
+
     void CpuProfilerImpl::SetProfilerEnabled(bool enabled)
     {
         AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
@@ -252,9 +308,10 @@ namespace Profiler
     void CpuProfilerImpl::RegisterThreadStorage()
     {
         AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
-        if (!ms_threadLocalStorage)
+        if (!ms_threadLocalStorage || ms_threadLocalStorageGeneration != m_registeredThreadsGeneration)
         {
             ms_threadLocalStorage = aznew CpuTimingLocalStorage();
+            ms_threadLocalStorageGeneration = m_registeredThreadsGeneration;
             m_registeredThreads.emplace_back(ms_threadLocalStorage);
         }
     }
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <CpuProfiler.h>
+#include <TraceRecorder.h>
 
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Memory/OSAllocator.h>
@@ -97,7 +98,7 @@ namespace Profiler
         AZ_TYPE_INFO(CpuProfilerImpl, "{10E9D394-FC83-4B45-B2B8-807C6BF07BF0}");
         AZ_CLASS_ALLOCATOR(CpuProfilerImpl, AZ::OSAllocator, 0);
 
-        CpuProfilerImpl() = default;
+        CpuProfilerImpl();
         ~CpuProfilerImpl() = default;
 
         //! Registers the CpuProfilerImpl instance to the interface
@@ -119,6 +120,12 @@ namespace Profiler
         bool BeginContinuousCapture() final override;
         bool EndContinuousCapture(AZStd::ring_buffer<TimeRegionMap>& flushTarget) final override;
         bool IsContinuousCaptureInProgress() const final override;
+        bool BeginTraceCapture(const char* traceFilePath) final override;
+        bool EndTraceCapture() final override;
+        bool IsTraceCaptureInProgress() const final override;
+
+        //! Writes the regions recorded so far by the trace capture to disk, without waiting for the trace recorder's drain thread.
+        void FlushTraceCapture();
         void SetProfilerEnabled(bool enabled) final override;
         bool IsProfilerEnabled() const final override;
 
@@ -139,6 +146,9 @@ namespace Profiler
 
         // Thread local storage, gets lazily allocated when a thread is created
         static thread_local CpuTimingLocalStorage* ms_threadLocalStorage;
+        // Generation of the registered threads the thread local storage belongs to, the storage is released when the generation changes
+        static thread_local uint32_t ms_threadLocalStorageGeneration;
+        uint32_t m_registeredThreadsGeneration = 0;
 
         // Enable/Disables the threads from profiling
         AZStd::atomic_bool m_enabled = false;
@@ -155,6 +165,9 @@ namespace Profiler
         // Stores multiple frames of profiling data, size is controlled by MaxFramesToSave. Flushed when EndContinuousCapture is called.
         // Ring buffer so that we can have fast append of new data + removal of old profiling data with good cache locality.
         AZStd::ring_buffer<TimeRegionMap> m_continuousCaptureData;
+
+        // Streams the regions to disk while a trace capture is in progress, independently of m_enabled
+        TraceRecorder m_traceRecorder;
     };
 
     // Intermediate class to serialize Cpu TimedRegion data.
@@ -8,6 +8,8 @@
 
 #include <ProfilerSystemComponent.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/Path/Path.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
@@ -15,10 +17,42 @@
 #include <AzCore/Serialization/Json/JsonUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
+AZ_CVAR(bool, profiler_streamingCapture, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+    "When enabled, continuous captures stream the profiled regions to a binary trace file instead of keeping every frame in memory. "
+    "The trace can be converted with profiler_convertTrace.");
+
 namespace Profiler
 {
     static constexpr AZ::Crc32 profilerServiceCrc = AZ_CRC_CE("ProfilerService");
 
+    void profiler_convertTrace(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.empty())
+        {
+            AZ_Warning("ProfilerSystemComponent", false, "profiler_convertTrace expects the path of a trace file, and optionally the output path");
+            return;
+        }
+
+        const AZ::IO::Path tracePath(arguments[0]);
+        AZ::IO::Path jsonPath;
+        if (arguments.size() > 1)
+        {
+            jsonPath = arguments[1];
+        }
+        else
+        {
+            jsonPath = tracePath;
+            jsonPath.ReplaceExtension(".json");
+        }
+
+        if (ConvertTraceToChromeJson(tracePath.c_str(), jsonPath.c_str()))
+        {
+            AZ_Printf("ProfilerSystemComponent", "Trace was converted to file [%s]\n", jsonPath.c_str());
+        }
+    }
+    AZ_CONSOLEFREEFUNC(profiler_convertTrace, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Converts a binary trace file to the Chrome trace event format, which can be opened by chrome://tracing and Perfetto");
+
     struct DeplayedFunction
     {
         using func_type = AZStd::function<void()>;
@@ -201,12 +235,34 @@ namespace Profiler
 
     bool ProfilerSystemComponent::StartCapture(AZStd::string outputFilePath)
     {
+        if (profiler_streamingCapture)
+        {
+            AZ::IO::Path tracePath(AZStd::move(outputFilePath));
+            tracePath.ReplaceExtension(Trace::FileExtension);
+            m_captureFile = tracePath.Native();
+            return m_cpuProfiler.BeginTraceCapture(m_captureFile.c_str());
+        }
+
         m_captureFile = AZStd::move(outputFilePath);
         return m_cpuProfiler.BeginContinuousCapture();
     }
 
     bool ProfilerSystemComponent::EndCapture()
     {
+        // The trace was streamed to disk while recording, so there is nothing left to serialize
+        if (m_cpuProfiler.IsTraceCaptureInProgress())
+        {
+            const bool result = m_cpuProfiler.EndTraceCapture();
+            if (result)
+            {
+                AZ_Printf("ProfilerSystemComponent", "Cpu profiling trace was saved to file [%s]\n", m_captureFile.c_str());
+            }
+            AZ::Debug::ProfilerNotificationBus::Broadcast(&AZ::Debug::ProfilerNotificationBus::Events::OnCaptureFinished,
+                result,
+                m_captureFile);
+            return result;
+        }
+
         bool expected = false;
         if (!m_cpuDataSerializationInProgress.compare_exchange_strong(expected, true))
         {
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/time.h>
+
+//! Layout of the binary trace files streamed by the TraceRecorder.
+//! A trace file starts with a FileHeader, followed by any number of chunks. Each chunk starts with a ChunkHeader:
+//! - RegionNames chunks contain m_count RegionNameHeaders, each followed by the group and region names (not null terminated).
+//! - Events chunks contain m_count Events recorded by the thread m_threadId, in the order they were recorded.
+//! The name of a region id is always written before the first chunk that uses it.
+namespace Profiler::Trace
+{
+    static constexpr uint32_t FileMagic = 0x5254334F; // "O3TR"
+    static constexpr uint32_t FileVersion = 1;
+    static constexpr const char* FileExtension = ".cputrace";
+
+    struct FileHeader
+    {
+        uint32_t m_magic = FileMagic;
+        uint32_t m_version = FileVersion;
+        AZStd::sys_time_t m_ticksPerSecond = 0;
+        AZStd::sys_time_t m_startTick = 0; // Ticks of the events are relative to the system clock, this is when the recording started
+    };
+
+    enum class ChunkType : uint32_t
+    {
+        RegionNames = 0,
+        Events = 1
+    };
+
+    struct ChunkHeader
+    {
+        ChunkType m_type = ChunkType::Events;
+        uint32_t m_count = 0;
+        uint64_t m_threadId = 0;
+    };
+
+    struct RegionNameHeader
+    {
+        uint32_t m_regionId = 0;
+        uint16_t m_groupNameLength = 0;
+        uint16_t m_regionNameLength = 0;
+    };
+
+    enum class EventType : uint32_t
+    {
+        Begin = 0,
+        End = 1
+    };
+
+    //! End events don't carry a region id, they always close the last region the thread began.
+    static constexpr uint32_t InvalidRegionId = 0xFFFFFFFF;
+
+    struct Event
+    {
+        AZStd::sys_time_t m_tick = 0;
+        uint32_t m_regionId = InvalidRegionId;
+        EventType m_type = EventType::Begin;
+    };
+    static_assert(sizeof(Event) == 16, "Trace events are written to disk as is, keep them compact");
+} // namespace Profiler::Trace
@@ -0,0 +1,585 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TraceRecorder.h>
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/string/string.h>
+
+namespace Profiler
+{
+    thread_local uint32_t TraceRecorder::ms_threadRecorderId = 0;
+    thread_local TraceRecorder::ThreadState* TraceRecorder::ms_threadState = nullptr;
+
+    static AZStd::atomic<uint32_t> s_nextRecorderId{ 1 };
+
+    // --- TraceEventBuffer ---
+
+    bool TraceEventBuffer::HasSpace(uint32_t eventCount)
+    {
+        const uint32_t head = m_head.load(AZStd::memory_order_relaxed);
+        if (Capacity - (head - m_producerCachedTail) >= eventCount)
+        {
+            return true;
+        }
+
+        // Only synchronize with the consumer when the buffer looks full
+        m_producerCachedTail = m_tail.load(AZStd::memory_order_acquire);
+        return Capacity - (head - m_producerCachedTail) >= eventCount;
+    }
+
+    void TraceEventBuffer::Push(const Trace::Event& event)
+    {
+        const uint32_t head = m_head.load(AZStd::memory_order_relaxed);
+        m_events[head & IndexMask] = event;
+        m_head.store(head + 1, AZStd::memory_order_release);
+    }
+
+    uint32_t TraceEventBuffer::Pop(Trace::Event* outEvents, uint32_t maxCount)
+    {
+        const uint32_t tail = m_tail.load(AZStd::memory_order_relaxed);
+        const uint32_t head = m_head.load(AZStd::memory_order_acquire);
+        const uint32_t count = AZStd::min(head - tail, maxCount);
+        for (uint32_t index = 0; index < count; ++index)
+        {
+            outEvents[index] = m_events[(tail + index) & IndexMask];
+        }
+        m_tail.store(tail + count, AZStd::memory_order_release);
+        return count;
+    }
+
+    void TraceEventBuffer::Discard()
+    {
+        m_tail.store(m_head.load(AZStd::memory_order_acquire), AZStd::memory_order_release);
+    }
+
+    // --- TraceRecorder ---
+
+    TraceRecorder::TraceRecorder()
+        : m_recorderId(s_nextRecorderId.fetch_add(1))
+    {
+    }
+
+    TraceRecorder::~TraceRecorder()
+    {
+        Stop();
+    }
+
+    bool TraceRecorder::Start(const char* filePath)
+    {
+        if (m_recording.load())
+        {
+            AZ_Warning("Profiler", false, "Attempting to start a trace recording while one is already in progress");
+            return false;
+        }
+
+        if (!m_file.Open(filePath,
+            AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Profiler", false, "Failed to create trace file '%s'", filePath);
+            return false;
+        }
+        m_writeFailed = false;
+
+        Trace::FileHeader header;
+        header.m_ticksPerSecond = AZStd::GetTimeTicksPerSecond();
+        header.m_startTick = AZStd::GetTimeNowTicks();
+        Write(&header, sizeof(header));
+
+        // Every trace file contains the names of all the regions it uses
+        {
+            AZStd::scoped_lock lock(m_regionNamesMutex);
+            m_writtenRegionNameCount = 0;
+        }
+
+        // Drop whatever was left over from a previous recording, and let the threads know they need to reset their state
+        {
+            AZStd::scoped_lock lock(m_threadStatesMutex);
+            for (auto& threadState : m_threadStates)
+            {
+                threadState->m_eventBuffer.Discard();
+                threadState->m_droppedEventCount = 0;
+            }
+        }
+        m_sessionId.fetch_add(1);
+        m_recording.store(true);
+
+        m_drainEvents.resize_no_construct(TraceEventBuffer::Capacity);
+
+        AZStd::thread_desc threadDesc;
+        threadDesc.m_name = "Profiler Trace Drain";
+        m_drainThread = AZStd::thread(threadDesc, [this]()
+        {
+            DrainLoop();
+        });
+
+        return true;
+    }
+
+    bool TraceRecorder::Stop()
+    {
+        {
+            AZStd::scoped_lock lock(m_drainMutex);
+            if (!m_recording.load())
+            {
+                return false;
+            }
+            m_recording.store(false);
+        }
+        m_drainCondition.notify_all();
+
+        // The drain thread does a last pass over the buffers before exiting
+        if (m_drainThread.joinable())
+        {
+            m_drainThread.join();
+        }
+        m_file.Close();
+
+        const uint64_t droppedEventCount = GetDroppedEventCount();
+        AZ_Warning("Profiler", droppedEventCount == 0,
+            "%llu trace events were dropped because threads recorded faster than the trace could be written to disk",
+            droppedEventCount);
+        AZ_Warning("Profiler", !m_writeFailed, "Failed to write to the trace file, the trace is incomplete");
+        return !m_writeFailed;
+    }
+
+    void TraceRecorder::Flush()
+    {
+        // The drain mutex is held while draining, so this never races with the drain thread
+        AZStd::scoped_lock lock(m_drainMutex);
+        if (m_recording.load())
+        {
+            DrainBuffers();
+        }
+    }
+
+    uint64_t TraceRecorder::GetDroppedEventCount() const
+    {
+        AZStd::scoped_lock lock(m_threadStatesMutex);
+        uint64_t droppedEventCount = 0;
+        for (const auto& threadState : m_threadStates)
+        {
+            droppedEventCount += threadState->m_droppedEventCount.load(AZStd::memory_order_relaxed);
+        }
+        return droppedEventCount;
+    }
+
+    void TraceRecorder::BeginRegion(const char* groupName, const char* regionName)
+    {
+        ThreadState* threadState = GetThreadState();
+        ++threadState->m_depth;
+        if (threadState->m_dropDepth != 0)
+        {
+            threadState->m_droppedEventCount.fetch_add(2, AZStd::memory_order_relaxed);
+            return;
+        }
+
+        // Always leave room for the end events of the regions that are open, so that every recorded begin event gets its end event
+        if (!threadState->m_eventBuffer.HasSpace(threadState->m_depth + 1))
+        {
+            threadState->m_dropDepth = threadState->m_depth;
+            threadState->m_droppedEventCount.fetch_add(2, AZStd::memory_order_relaxed);
+            return;
+        }
+
+        Trace::Event event;
+        event.m_regionId = InternRegion(*threadState, groupName, regionName);
+        event.m_type = Trace::EventType::Begin;
+        // Get the time last, to leave the recording overhead out of the region
+        event.m_tick = AZStd::GetTimeNowTicks();
+        threadState->m_eventBuffer.Push(event);
+    }
+
+    void TraceRecorder::EndRegion()
+    {
+        // Get the time first, to leave the recording overhead out of the region
+        const AZStd::sys_time_t endTick = AZStd::GetTimeNowTicks();
+
+        ThreadState* threadState = GetThreadState();
+        if (threadState->m_depth == 0)
+        {
+            // The region began before the recording started
+            return;
+        }
+
+        if (threadState->m_dropDepth != 0)
+        {
+            if (threadState->m_dropDepth == threadState->m_depth)
+            {
+                threadState->m_dropDepth = 0;
+            }
+            --threadState->m_depth;
+            return;
+        }
+
+        --threadState->m_depth;
+        Trace::Event event;
+        event.m_tick = endTick;
+        event.m_type = Trace::EventType::End;
+        threadState->m_eventBuffer.Push(event);
+    }
+
+    TraceRecorder::ThreadState* TraceRecorder::GetThreadState()
+    {
+        ThreadState* threadState = (ms_threadRecorderId == m_recorderId) ? ms_threadState : RegisterThreadState();
+
+        // Regions that were open when the previous recording stopped will never be closed in this one
+        if (const uint32_t sessionId = m_sessionId.load(AZStd::memory_order_relaxed); threadState->m_sessionId != sessionId)
+        {
+            threadState->m_sessionId = sessionId;
+            threadState->m_depth = 0;
+            threadState->m_dropDepth = 0;
+        }
+        return threadState;
+    }
+
+    TraceRecorder::ThreadState* TraceRecorder::RegisterThreadState()
+    {
+        const uint64_t threadId = AZStd::hash<AZStd::thread_id>{}(AZStd::this_thread::get_id());
+
+        AZStd::scoped_lock lock(m_threadStatesMutex);
+        ThreadState* threadState = nullptr;
+
+        // The thread may have been recording into another recorder in the meantime
+        for (auto& existingState : m_threadStates)
+        {
+            if (existingState->m_threadId == threadId)
+            {
+                threadState = existingState.get();
+                break;
+            }
+        }
+
+        if (!threadState)
+        {
+            threadState = m_threadStates.emplace_back(aznew ThreadState()).get();
+            threadState->m_threadId = threadId;
+            threadState->m_sessionId = m_sessionId.load();
+        }
+
+        ms_threadRecorderId = m_recorderId;
+        ms_threadState = threadState;
+        return threadState;
+    }
+
+    uint32_t TraceRecorder::InternRegion(ThreadState& threadState, const char* groupName, const char* regionName)
+    {
+        const uintptr_t cacheIndex =
+            ((reinterpret_cast<uintptr_t>(regionName) >> 3) ^ (reinterpret_cast<uintptr_t>(groupName) >> 7)) & (RegionIdCacheSize - 1);
+        CachedRegionId& cachedRegionId = threadState.m_regionIdCache[cacheIndex];
+        if (cachedRegionId.m_regionName == regionName && cachedRegionId.m_groupName == groupName)
+        {
+            return cachedRegionId.m_regionId;
+        }
+
+        uint32_t regionId;
+        {
+            AZStd::scoped_lock lock(m_regionNamesMutex);
+            const CachedTimeRegion::GroupRegionName groupRegionName(groupName, regionName);
+            auto [iter, inserted] = m_regionIds.try_emplace(groupRegionName, aznumeric_cast<uint32_t>(m_regionNames.size()));
+            if (inserted)
+            {
+                m_regionNames.push_back(groupRegionName);
+            }
+            regionId = iter->second;
+        }
+
+        cachedRegionId.m_groupName = groupName;
+        cachedRegionId.m_regionName = regionName;
+        cachedRegionId.m_regionId = regionId;
+        return regionId;
+    }
+
+    void TraceRecorder::DrainLoop()
+    {
+        for (;;)
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_drainMutex);
+            m_drainCondition.wait_for(lock, AZStd::chrono::milliseconds(DrainIntervalMilliseconds), [this]()
+            {
+                return !m_recording.load();
+            });
+
+            const bool stopping = !m_recording.load();
+            DrainBuffers();
+            if (stopping)
+            {
+                break;
+            }
+        }
+    }
+
+    void TraceRecorder::DrainBuffers()
+    {
+        {
+            AZStd::scoped_lock lock(m_threadStatesMutex);
+            m_drainThreadStates.clear();
+            for (auto& threadState : m_threadStates)
+            {
+                m_drainThreadStates.push_back(threadState.get());
+            }
+        }
+
+        for (ThreadState* threadState : m_drainThreadStates)
+        {
+            const uint32_t eventCount = threadState->m_eventBuffer.Pop(m_drainEvents.data(), aznumeric_cast<uint32_t>(m_drainEvents.size()));
+            if (eventCount == 0)
+            {
+                continue;
+            }
+
+            // The regions of the popped events were interned before they were pushed, so their names are written first
+            WriteRegionNames();
+
+            Trace::ChunkHeader chunkHeader;
+            chunkHeader.m_type = Trace::ChunkType::Events;
+            chunkHeader.m_count = eventCount;
+            chunkHeader.m_threadId = threadState->m_threadId;
+            Write(&chunkHeader, sizeof(chunkHeader));
+            Write(m_drainEvents.data(), eventCount * sizeof(Trace::Event));
+        }
+    }
+
+    void TraceRecorder::WriteRegionNames()
+    {
+        m_drainNames.clear();
+        uint32_t nameCount = 0;
+        {
+            AZStd::scoped_lock lock(m_regionNamesMutex);
+            for (; m_writtenRegionNameCount < m_regionNames.size(); ++m_writtenRegionNameCount, ++nameCount)
+            {
+                const CachedTimeRegion::GroupRegionName& groupRegionName = m_regionNames[m_writtenRegionNameCount];
+                const AZStd::string_view groupName = groupRegionName.m_groupName ? groupRegionName.m_groupName : "";
+                const AZStd::string_view regionName = groupRegionName.m_regionName ? groupRegionName.m_regionName : "";
+
+                Trace::RegionNameHeader nameHeader;
+                nameHeader.m_regionId = aznumeric_cast<uint32_t>(m_writtenRegionNameCount);
+                nameHeader.m_groupNameLength = aznumeric_cast<uint16_t>(AZStd::min<size_t>(groupName.size(), AZStd::numeric_limits<uint16_t>::max()));
+                nameHeader.m_regionNameLength = aznumeric_cast<uint16_t>(AZStd::min<size_t>(regionName.size(), AZStd::numeric_limits<uint16_t>::max()));
+
+                const char* headerBytes = reinterpret_cast<const char*>(&nameHeader);
+                m_drainNames.insert(m_drainNames.end(), headerBytes, headerBytes + sizeof(nameHeader));
+                m_drainNames.insert(m_drainNames.end(), groupName.data(), groupName.data() + nameHeader.m_groupNameLength);
+                m_drainNames.insert(m_drainNames.end(), regionName.data(), regionName.data() + nameHeader.m_regionNameLength);
+            }
+        }
+
+        if (nameCount > 0)
+        {
+            Trace::ChunkHeader chunkHeader;
+            chunkHeader.m_type = Trace::ChunkType::RegionNames;
+            chunkHeader.m_count = nameCount;
+            Write(&chunkHeader, sizeof(chunkHeader));
+            Write(m_drainNames.data(), m_drainNames.size());
+        }
+    }
+
+    void TraceRecorder::Write(const void* data, size_t size)
+    {
+        if (!m_writeFailed && m_file.Write(data, size) != size)
+        {
+            m_writeFailed = true;
+        }
+    }
+
+    // --- Chrome trace conversion ---
+
+    namespace
+    {
+        void AppendJsonEscaped(AZStd::string& output, AZStd::string_view text)
+        {
+            for (const char character : text)
+            {
+                switch (character)
+                {
+                case '"':
+                    output += "\\\"";
+                    break;
+                case '\\':
+                    output += "\\\\";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(character) < 0x20)
+                    {
+                        output += AZStd::string::format("\\u%04x", character);
+                    }
+                    else
+                    {
+                        output += character;
+                    }
+                    break;
+                }
+            }
+        }
+
+        class ChromeJsonWriter
+        {
+        public:
+            static constexpr size_t FlushSize = 1024 * 1024;
+
+            explicit ChromeJsonWriter(AZ::IO::SystemFile& file)
+                : m_file(file)
+            {
+                m_buffer.reserve(FlushSize + 1024);
+                m_buffer += "{\"traceEvents\":[";
+            }
+
+            AZStd::string& Begin()
+            {
+                if (m_eventCount++ > 0)
+                {
+                    m_buffer += ",\n";
+                }
+                return m_buffer;
+            }
+
+            bool FlushIfNeeded(bool force = false)
+            {
+                if (force || m_buffer.size() >= FlushSize)
+                {
+                    m_failed |= m_file.Write(m_buffer.data(), m_buffer.size()) != m_buffer.size();
+                    m_buffer.clear();
+                }
+                return !m_failed;
+            }
+
+            bool Finish()
+            {
+                m_buffer += "\n],\"displayTimeUnit\":\"ms\"}\n";
+                return FlushIfNeeded(true);
+            }
+
+        private:
+            AZ::IO::SystemFile& m_file;
+            AZStd::string m_buffer;
+            size_t m_eventCount = 0;
+            bool m_failed = false;
+        };
+    }
+
+    bool ConvertTraceToChromeJson(const char* tracePath, const char* jsonPath)
+    {
+        AZ::IO::SystemFile traceFile;
+        if (!traceFile.Open(tracePath, AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+        {
+            AZ_Warning("Profiler", false, "Failed to open trace file '%s'", tracePath);
+            return false;
+        }
+
+        Trace::FileHeader header;
+        if (traceFile.Read(sizeof(header), &header) != sizeof(header) || header.m_magic != Trace::FileMagic ||
+            header.m_version != Trace::FileVersion || header.m_ticksPerSecond <= 0)
+        {
+            AZ_Warning("Profiler", false, "'%s' is not a supported trace file", tracePath);
+            return false;
+        }
+
+        AZ::IO::SystemFile jsonFile;
+        if (!jsonFile.Open(jsonPath,
+            AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Profiler", false, "Failed to create '%s'", jsonPath);
+            return false;
+        }
+
+        ChromeJsonWriter writer(jsonFile);
+        const double microsecondsPerTick = 1000000.0 / aznumeric_cast<double>(header.m_ticksPerSecond);
+
+        // Pre-formatted name and category fields, indexed by region id
+        AZStd::vector<AZStd::string> regionFields;
+        // Chrome expects small thread ids, so threads are numbered in the order they appear
+        AZStd::unordered_map<uint64_t, uint32_t> threadIndices;
+        AZStd::vector<Trace::Event> events(4096);
+        AZStd::string names;
+
+        Trace::ChunkHeader chunkHeader;
+        while (traceFile.Read(sizeof(chunkHeader), &chunkHeader) == sizeof(chunkHeader))
+        {
+            if (chunkHeader.m_type == Trace::ChunkType::RegionNames)
+            {
+                for (uint32_t nameIndex = 0; nameIndex < chunkHeader.m_count; ++nameIndex)
+                {
+                    Trace::RegionNameHeader nameHeader;
+                    if (traceFile.Read(sizeof(nameHeader), &nameHeader) != sizeof(nameHeader))
+                    {
+                        break;
+                    }
+                    names.resize_no_construct(nameHeader.m_groupNameLength + nameHeader.m_regionNameLength);
+                    if (traceFile.Read(names.size(), names.data()) != names.size())
+                    {
+                        break;
+                    }
+
+                    if (nameHeader.m_regionId >= regionFields.size())
+                    {
+                        regionFields.resize(nameHeader.m_regionId + 1);
+                    }
+                    AZStd::string& fields = regionFields[nameHeader.m_regionId];
+                    fields = ",\"name\":\"";
+                    AppendJsonEscaped(fields, AZStd::string_view(names).substr(nameHeader.m_groupNameLength));
+                    fields += "\",\"cat\":\"";
+                    AppendJsonEscaped(fields, AZStd::string_view(names).substr(0, nameHeader.m_groupNameLength));
+                    fields += "\"";
+                }
+            }
+            else if (chunkHeader.m_type == Trace::ChunkType::Events)
+            {
+                auto [threadIter, inserted] = threadIndices.try_emplace(chunkHeader.m_threadId, aznumeric_cast<uint32_t>(threadIndices.size() + 1));
+                const uint32_t threadIndex = threadIter->second;
+
+                uint32_t remainingCount = chunkHeader.m_count;
+                while (remainingCount > 0)
+                {
+                    const uint32_t readCount = AZStd::min(remainingCount, aznumeric_cast<uint32_t>(events.size()));
+                    const size_t readSize = readCount * sizeof(Trace::Event);
+                    if (traceFile.Read(readSize, events.data()) != readSize)
+                    {
+                        remainingCount = 0;
+                        break;
+                    }
+                    remainingCount -= readCount;
+
+                    for (uint32_t eventIndex = 0; eventIndex < readCount; ++eventIndex)
+                    {
+                        const Trace::Event& event = events[eventIndex];
+                        const double timestamp = aznumeric_cast<double>(event.m_tick - header.m_startTick) * microsecondsPerTick;
+                        AZStd::string& output = writer.Begin();
+                        if (event.m_type == Trace::EventType::Begin)
+                        {
+                            output += AZStd::string::format("{\"ph\":\"B\",\"pid\":0,\"tid\":%u,\"ts\":%.3f", threadIndex, timestamp);
+                            output += event.m_regionId < regionFields.size() ? regionFields[event.m_regionId] : ",\"name\":\"Unknown\"";
+                            output += "}";
+                        }
+                        else
+                        {
+                            output += AZStd::string::format("{\"ph\":\"E\",\"pid\":0,\"tid\":%u,\"ts\":%.3f}", threadIndex, timestamp);
+                        }
+                    }
+
+                    if (!writer.FlushIfNeeded())
+                    {
+                        AZ_Warning("Profiler", false, "Failed to write to '%s'", jsonPath);
+                        return false;
+                    }
+                }
+            }
+            else
+            {
+                AZ_Warning("Profiler", false, "Trace file '%s' is corrupted, the conversion stopped early", tracePath);
+                break;
+            }
+        }
+
+        if (!writer.Finish())
+        {
+            AZ_Warning("Profiler", false, "Failed to write to '%s'", jsonPath);
+            return false;
+        }
+        return true;
+    }
+} // namespace Profiler
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <CpuProfiler.h>
+#include <TraceFormat.h>
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace Profiler
+{
+    //! Single producer, single consumer ring of trace events.
+    //! The thread that owns the buffer is the only one pushing events, the drain thread of the TraceRecorder is the only one popping them.
+    class TraceEventBuffer
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TraceEventBuffer, AZ::OSAllocator, 0);
+
+        static constexpr uint32_t Capacity = 1u << 16;
+
+        //! Producer side, returns true if at least the provided amount of events can be pushed.
+        bool HasSpace(uint32_t eventCount);
+
+        //! Producer side, the caller is expected to have checked HasSpace first.
+        void Push(const Trace::Event& event);
+
+        //! Consumer side, pops up to maxCount events in the order they were pushed and returns the amount of events popped.
+        uint32_t Pop(Trace::Event* outEvents, uint32_t maxCount);
+
+        //! Consumer side, drops all the events that were pushed so far.
+        void Discard();
+
+    private:
+        static constexpr uint32_t IndexMask = Capacity - 1;
+
+        // The indices only ever grow, the unsigned wrap around keeps (head - tail) correct.
+        // Keep them on separate cache lines so the producer and the consumer don't contend.
+        alignas(64) AZStd::atomic<uint32_t> m_head{ 0 };
+        uint32_t m_producerCachedTail = 0; // Last tail seen by the producer, only refreshed when the buffer looks full
+        alignas(64) AZStd::atomic<uint32_t> m_tail{ 0 };
+        alignas(64) Trace::Event m_events[Capacity];
+    };
+
+    //! Low overhead recorder which streams the begin and end events of profiled regions to a binary trace file.
+    //! Each thread records into its own lock-free TraceEventBuffer, region names are interned to ids the first time a thread sees them,
+    //! and a background thread drains the buffers to disk. Since nothing is kept in memory once drained, recordings can be left running
+    //! indefinitely. Use ConvertTraceToChromeJson to view the result.
+    class TraceRecorder
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TraceRecorder, AZ::OSAllocator, 0);
+
+        TraceRecorder();
+        ~TraceRecorder();
+
+        AZ_DISABLE_COPY_MOVE(TraceRecorder);
+
+        //! Creates the trace file and starts recording.
+        bool Start(const char* filePath);
+
+        //! Stops recording, once this returns every recorded event has been written to the trace file.
+        bool Stop();
+
+        //! Writes everything that was recorded so far to the trace file, without waiting for the drain thread.
+        void Flush();
+
+        bool IsRecording() const
+        {
+            return m_recording.load(AZStd::memory_order_relaxed);
+        }
+
+        //! Amount of events dropped during the last recording because a thread recorded faster than the drain thread could keep up.
+        uint64_t GetDroppedEventCount() const;
+
+        //! Records the beginning of a region on the calling thread, the names are assumed to be global strings (ideally literals).
+        void BeginRegion(const char* groupName, const char* regionName);
+
+        //! Records the end of the last region begun on the calling thread.
+        void EndRegion();
+
+    private:
+        static constexpr uint32_t RegionIdCacheSize = 256;
+        static constexpr int DrainIntervalMilliseconds = 10;
+
+        struct CachedRegionId
+        {
+            const char* m_groupName = nullptr;
+            const char* m_regionName = nullptr;
+            uint32_t m_regionId = Trace::InvalidRegionId;
+        };
+
+        // Everything a thread needs to record, only ever touched by that thread except for the event buffer
+        struct ThreadState
+        {
+            AZ_CLASS_ALLOCATOR(ThreadState, AZ::OSAllocator, 0);
+
+            TraceEventBuffer m_eventBuffer;
+            AZStd::array<CachedRegionId, RegionIdCacheSize> m_regionIdCache;
+            uint64_t m_threadId = 0;
+            uint32_t m_sessionId = 0;
+            // Amount of regions currently open on the thread
+            uint32_t m_depth = 0;
+            // When the buffer fills up, the whole region tree starting at this depth is dropped so begin and end events stay paired
+            uint32_t m_dropDepth = 0;
+            AZStd::atomic<uint64_t> m_droppedEventCount{ 0 };
+        };
+
+        ThreadState* GetThreadState();
+        ThreadState* RegisterThreadState();
+        uint32_t InternRegion(ThreadState& threadState, const char* groupName, const char* regionName);
+
+        void DrainLoop();
+        void DrainBuffers();
+        void WriteRegionNames();
+        void Write(const void* data, size_t size);
+
+        // The recorder that the thread's state belongs to, and the state itself
+        static thread_local uint32_t ms_threadRecorderId;
+        static thread_local ThreadState* ms_threadState;
+
+        // Unique for each recorder so the thread local state of a destroyed recorder is never reused
+        const uint32_t m_recorderId;
+        AZStd::atomic<uint32_t> m_sessionId{ 0 };
+        AZStd::atomic_bool m_recording{ false };
+
+        // Thread states are kept alive until the recorder is destroyed, a thread may still be recording while a recording stops
+        AZStd::vector<AZStd::unique_ptr<ThreadState>, AZ::OSStdAllocator> m_threadStates;
+        mutable AZStd::mutex m_threadStatesMutex;
+
+        // Region ids are shared by all threads
+        AZStd::unordered_map<CachedTimeRegion::GroupRegionName, uint32_t, CachedTimeRegion::GroupRegionName::Hash> m_regionIds;
+        AZStd::vector<CachedTimeRegion::GroupRegionName, AZ::OSStdAllocator> m_regionNames;
+        size_t m_writtenRegionNameCount = 0;
+        AZStd::mutex m_regionNamesMutex;
+
+        AZStd::thread m_drainThread;
+        // Held while draining, so the drain thread and Flush are never consuming the event buffers at the same time
+        AZStd::mutex m_drainMutex;
+        AZStd::condition_variable m_drainCondition;
+        AZStd::vector<ThreadState*, AZ::OSStdAllocator> m_drainThreadStates;
+        AZStd::vector<Trace::Event, AZ::OSStdAllocator> m_drainEvents;
+        AZStd::vector<char, AZ::OSStdAllocator> m_drainNames;
+        AZ::IO::SystemFile m_file;
+        bool m_writeFailed = false;
+    };
+
+    //! Converts a trace file streamed by the TraceRecorder to the Chrome trace event JSON format,
+    //! which can be opened by chrome://tracing and Perfetto. The trace is converted in a streaming fashion,
+    //! so the size of the trace isn't limited by the available memory.
+    bool ConvertTraceToChromeJson(const char* tracePath, const char* jsonPath);
+} // namespace Profiler
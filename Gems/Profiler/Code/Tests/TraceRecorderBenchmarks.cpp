@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <CpuProfilerImpl.h>
+
+#include <AzCore/Debug/Budget.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/functional.h>
+#include <AzTest/Utils.h>
+#include <benchmark/benchmark.h>
+
+namespace Profiler
+{
+    //! Measures the overhead of a single profiled scope as seen by the thread being profiled, for each recording mode
+    //! of the CpuProfilerImpl. The recorded data is collected between batches of scopes, outside of the timed section,
+    //! the same way the system tick and the drain thread would while the application runs.
+    class CpuProfilerScopeBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        // Small enough for the regions of a batch to fit in both the per-frame storage and the trace event buffer
+        static constexpr int ScopesPerBatch = 1000;
+
+        void internalSetUp()
+        {
+            m_budget = AZStd::make_unique<AZ::Debug::Budget>("Benchmark");
+            m_profiler = AZStd::make_unique<CpuProfilerImpl>();
+            m_tempDirectory = AZStd::make_unique<AZ::Test::ScopedAutoTempDirectory>();
+        }
+
+        void internalTearDown()
+        {
+            m_profiler.reset();
+            m_tempDirectory.reset();
+            m_budget.reset();
+        }
+
+        void RecordScopes(benchmark::State& state, const AZStd::function<void()>& collect)
+        {
+            for (auto _ : state)
+            {
+                for (int scope = 0; scope < ScopesPerBatch; ++scope)
+                {
+                    m_profiler->BeginRegion(m_budget.get(), "BenchmarkScope");
+                    m_profiler->EndRegion(m_budget.get());
+                }
+
+                state.PauseTiming();
+                collect();
+                state.ResumeTiming();
+            }
+            state.SetItemsProcessed(state.iterations() * ScopesPerBatch);
+        }
+
+        AZStd::unique_ptr<AZ::Debug::Budget> m_budget;
+        AZStd::unique_ptr<CpuProfilerImpl> m_profiler;
+        AZStd::unique_ptr<AZ::Test::ScopedAutoTempDirectory> m_tempDirectory;
+    };
+
+    BENCHMARK_F(CpuProfilerScopeBenchmark, Disabled)(benchmark::State& state)
+    {
+        RecordScopes(state, []() {});
+    }
+
+    BENCHMARK_F(CpuProfilerScopeBenchmark, RegionMap)(benchmark::State& state)
+    {
+        m_profiler->SetProfilerEnabled(true);
+        RecordScopes(state, [this]()
+        {
+            m_profiler->OnSystemTick();
+        });
+        m_profiler->SetProfilerEnabled(false);
+    }
+
+    BENCHMARK_F(CpuProfilerScopeBenchmark, TraceCapture)(benchmark::State& state)
+    {
+        const AZStd::string tracePath = m_tempDirectory->Resolve("benchmark.cputrace");
+        if (!m_profiler->BeginTraceCapture(tracePath.c_str()))
+        {
+            state.SkipWithError("Failed to start the trace capture");
+            return;
+        }
+
+        RecordScopes(state, [this]()
+        {
+            m_profiler->FlushTraceCapture();
+        });
+        if (!m_profiler->EndTraceCapture())
+        {
+            state.SkipWithError("Failed to complete the trace file");
+        }
+    }
+} // namespace Profiler
+#endif
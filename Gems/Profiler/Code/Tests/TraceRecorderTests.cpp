@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TraceRecorder.h>
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+
+namespace UnitTest
+{
+    class TraceRecorderTests
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            m_tempDirectory = AZStd::make_unique<AZ::Test::ScopedAutoTempDirectory>();
+            m_tracePath = m_tempDirectory->Resolve("capture.cputrace");
+            m_jsonPath = m_tempDirectory->Resolve("capture.json");
+        }
+
+        void TearDown() override
+        {
+            m_jsonPath = {};
+            m_tracePath = {};
+            m_tempDirectory.reset();
+            AllocatorsFixture::TearDown();
+        }
+
+        AZStd::string ConvertAndReadJson() const
+        {
+            EXPECT_TRUE(Profiler::ConvertTraceToChromeJson(m_tracePath.c_str(), m_jsonPath.c_str()));
+            AZStd::string json;
+            json.resize_no_construct(AZ::IO::SystemFile::Length(m_jsonPath.c_str()));
+            AZ::IO::SystemFile::Read(m_jsonPath.c_str(), json.data(), json.size());
+            return json;
+        }
+
+        static size_t CountOccurrences(const AZStd::string& text, const char* pattern)
+        {
+            size_t count = 0;
+            for (size_t position = text.find(pattern); position != AZStd::string::npos; position = text.find(pattern, position + 1))
+            {
+                ++count;
+            }
+            return count;
+        }
+
+        AZStd::unique_ptr<AZ::Test::ScopedAutoTempDirectory> m_tempDirectory;
+        AZStd::string m_tracePath;
+        AZStd::string m_jsonPath;
+    };
+
+    TEST_F(TraceRecorderTests, EventBuffer_PushPopPastCapacity_PreservesOrder)
+    {
+        auto eventBuffer = AZStd::make_unique<Profiler::TraceEventBuffer>();
+        Profiler::Trace::Event poppedEvent;
+
+        for (uint32_t index = 0; index < 3 * Profiler::TraceEventBuffer::Capacity; ++index)
+        {
+            ASSERT_TRUE(eventBuffer->HasSpace(1));
+            Profiler::Trace::Event event;
+            event.m_tick = index;
+            event.m_regionId = index;
+            eventBuffer->Push(event);
+
+            ASSERT_EQ(eventBuffer->Pop(&poppedEvent, 1), 1u);
+            EXPECT_EQ(poppedEvent.m_regionId, index);
+        }
+        EXPECT_EQ(eventBuffer->Pop(&poppedEvent, 1), 0u);
+    }
+
+    TEST_F(TraceRecorderTests, EventBuffer_Full_HasNoSpace)
+    {
+        auto eventBuffer = AZStd::make_unique<Profiler::TraceEventBuffer>();
+        for (uint32_t index = 0; index < Profiler::TraceEventBuffer::Capacity; ++index)
+        {
+            eventBuffer->Push({});
+        }
+        EXPECT_FALSE(eventBuffer->HasSpace(1));
+
+        eventBuffer->Discard();
+        EXPECT_TRUE(eventBuffer->HasSpace(Profiler::TraceEventBuffer::Capacity));
+    }
+
+    TEST_F(TraceRecorderTests, Record_NestedRegionsOnMultipleThreads_ConvertsToMatchedChromeEvents)
+    {
+        Profiler::TraceRecorder recorder;
+        ASSERT_TRUE(recorder.Start(m_tracePath.c_str()));
+
+        auto recordRegions = [&recorder]()
+        {
+            for (int index = 0; index < 100; ++index)
+            {
+                recorder.BeginRegion("Group", "Outer");
+                recorder.BeginRegion("Group", "Inner \"quoted\"");
+                recorder.EndRegion();
+                recorder.EndRegion();
+            }
+        };
+        AZStd::thread thread(recordRegions);
+        recordRegions();
+        thread.join();
+
+        EXPECT_TRUE(recorder.Stop());
+        EXPECT_EQ(recorder.GetDroppedEventCount(), 0u);
+
+        const AZStd::string json = ConvertAndReadJson();
+        EXPECT_EQ(CountOccurrences(json, "\"ph\":\"B\""), 400u);
+        EXPECT_EQ(CountOccurrences(json, "\"ph\":\"E\""), 400u);
+        EXPECT_EQ(CountOccurrences(json, "\"name\":\"Outer\""), 200u);
+        EXPECT_EQ(CountOccurrences(json, "\"name\":\"Inner \\\"quoted\\\"\""), 200u);
+        EXPECT_EQ(CountOccurrences(json, "\"tid\":2"), 400u);
+    }
+
+    TEST_F(TraceRecorderTests, Record_RegionBegunBeforeStart_IsIgnored)
+    {
+        Profiler::TraceRecorder recorder;
+        ASSERT_TRUE(recorder.Start(m_tracePath.c_str()));
+        recorder.EndRegion();
+        recorder.BeginRegion("Group", "Region");
+        recorder.EndRegion();
+        EXPECT_TRUE(recorder.Stop());
+
+        const AZStd::string json = ConvertAndReadJson();
+        EXPECT_EQ(CountOccurrences(json, "\"ph\":\"B\""), 1u);
+        EXPECT_EQ(CountOccurrences(json, "\"ph\":\"E\""), 1u);
+    }
+
+    TEST_F(TraceRecorderTests, Record_SecondRecording_OnlyContainsItsOwnRegions)
+    {
+        Profiler::TraceRecorder recorder;
+        ASSERT_TRUE(recorder.Start(m_tracePath.c_str()));
+        recorder.BeginRegion("Group", "First");
+        EXPECT_TRUE(recorder.Stop());
+
+        ASSERT_TRUE(recorder.Start(m_tracePath.c_str()));
+        recorder.EndRegion();
+        recorder.BeginRegion("Group", "Second");
+        recorder.EndRegion();
+        EXPECT_TRUE(recorder.Stop());
+
+        const AZStd::string json = ConvertAndReadJson();
+        EXPECT_EQ(CountOccurrences(json, "\"ph\":\"B\""), 1u);
+        EXPECT_EQ(CountOccurrences(json, "\"ph\":\"E\""), 1u);
+        EXPECT_EQ(CountOccurrences(json, "\"name\":\"Second\""), 1u);
+    }
+} // namespace UnitTest
+
+AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -13,4 +13,7 @@ set(FILES
     Source/CpuProfilerImpl.h
     Source/ProfilerSystemComponent.cpp
     Source/ProfilerSystemComponent.h
+    Source/TraceFormat.h
+    Source/TraceRecorder.cpp
+    Source/TraceRecorder.h
 )
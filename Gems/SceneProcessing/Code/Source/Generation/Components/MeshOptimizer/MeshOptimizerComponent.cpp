@@ -16,6 +16,7 @@
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/list.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/iterator.h>
 #include <AzCore/std/limits.h>
@@ -49,6 +50,7 @@
 #include <SceneAPI/SceneCore/DataTypes/Rules/ISkinRule.h>
 #include <SceneAPI/SceneCore/Events/GenerateEventContext.h>
 #include <SceneAPI/SceneCore/Events/ProcessingResult.h>
+#include <SceneAPI/SceneCore/Utilities/ParallelProcessing.h>
 #include <SceneAPI/SceneCore/Utilities/Reporting.h>
 #include <SceneAPI/SceneCore/Utilities/SceneGraphSelector.h>
 #include <SceneAPI/SceneData/GraphData/BlendShapeData.h>
@@ -321,23 +323,34 @@ namespace AZ::SceneGenerationComponents
             return indexes;
         };
 
-        // Iterate over them. We had to build the array before as this method can insert new nodes, so using the iterator directly would fail.
-        for (const auto& [mesh, nodeIndex] : meshes)
+        // The optimization of a mesh for a mesh group, gathered up front so the meshes can be optimized in parallel.
+        struct MeshOptimization
         {
-            // A Mesh can have multiple child nodes that contain other data streams, like uvs and tangents
-
-            const auto uvDatasView = Containers::MakeDerivedFilterView<IMeshVertexUVData>(childNodes(nodeIndex));
-            const auto tangentDatasView = Containers::MakeDerivedFilterView<IMeshVertexTangentData>(childNodes(nodeIndex));
-            const auto bitangentDatasView = Containers::MakeDerivedFilterView<IMeshVertexBitangentData>(childNodes(nodeIndex));
-            const auto skinWeightDatasView = Containers::MakeDerivedFilterView<ISkinWeightData>(childNodes(nodeIndex));
-            const auto colorDatasView = Containers::MakeDerivedFilterView<IMeshVertexColorData>(childNodes(nodeIndex));
+            const IMeshData* m_mesh = nullptr;
+            NodeIndex m_nodeIndex;
+            const IMeshGroup* m_meshGroup = nullptr;
+            AZStd::string m_name;
+            bool m_hasBlendShapes = false;
 
-            const AZStd::vector<AZStd::reference_wrapper<const IMeshVertexUVData>> uvDatas(uvDatasView.begin(), uvDatasView.end());
-            const AZStd::vector<AZStd::reference_wrapper<const IMeshVertexTangentData>> tangentDatas(tangentDatasView.begin(), tangentDatasView.end());
-            const AZStd::vector<AZStd::reference_wrapper<const IMeshVertexBitangentData>> bitangentDatas(bitangentDatasView.begin(), bitangentDatasView.end());
-            const AZStd::vector<AZStd::reference_wrapper<const ISkinWeightData>> skinWeightDatas(skinWeightDatasView.begin(), skinWeightDatasView.end());
-            const AZStd::vector<AZStd::reference_wrapper<const IMeshVertexColorData>> colorDatas(colorDatasView.begin(), colorDatasView.end());
+            // A Mesh can have multiple child nodes that contain other data streams, like uvs and tangents
+            AZStd::vector<AZStd::reference_wrapper<const IMeshVertexUVData>> m_uvDatas;
+            AZStd::vector<AZStd::reference_wrapper<const IMeshVertexTangentData>> m_tangentDatas;
+            AZStd::vector<AZStd::reference_wrapper<const IMeshVertexBitangentData>> m_bitangentDatas;
+            AZStd::vector<AZStd::reference_wrapper<const ISkinWeightData>> m_skinWeightDatas;
+            AZStd::vector<AZStd::reference_wrapper<const IMeshVertexColorData>> m_colorDatas;
+            AZStd::vector<NodeIndex> m_blendShapeNodeIndexes;
+            AZStd::vector<const IBlendShapeData*> m_blendShapes;
+
+            OptimizedMeshResult<IMeshData> m_optimized;
+            AZStd::vector<AZStd::unique_ptr<IBlendShapeData>> m_optimizedBlendShapes;
+        };
 
+        // Gather the mesh and mesh group pairs to optimize. We had to build the array before as this method inserts new nodes, so using the
+        // iterator directly would fail.
+        AZStd::vector<MeshOptimization> optimizations;
+        AZStd::unordered_set<AZStd::string> optimizedPaths;
+        for (const auto& [mesh, nodeIndex] : meshes)
+        {
             const AZStd::string_view nodePath(graph.GetNodeName(nodeIndex).GetPath(), graph.GetNodeName(nodeIndex).GetPathLength());
 
             for (const IMeshGroup& meshGroup : meshGroups)
@@ -348,87 +361,121 @@ namespace AZ::SceneGenerationComponents
                     continue;
                 }
 
-                const AZStd::string name =
+                AZStd::string name =
                     AZStd::string(graph.GetNodeName(nodeIndex).GetName(), graph.GetNodeName(nodeIndex).GetNameLength()).append(SceneAPI::Utilities::OptimizedMeshSuffix);
-                if (graph.Find(name).IsValid())
+                // Meshes with the same name can live under different parents, so duplicates are detected by the full path of the
+                // optimized node, which is also how SceneGraphSelector::RemapToOptimizedMesh looks it up.
+                AZStd::string optimizedPath = AZStd::string(nodePath).append(SceneAPI::Utilities::OptimizedMeshSuffix);
+                if (graph.Find(optimizedPath).IsValid() || !optimizedPaths.insert(optimizedPath).second)
                 {
-                    AZ_TracePrintf(AZ::SceneAPI::Utilities::LogWindow, "Optimized mesh already exists at '%s', there must be multiple mesh groups that have selected this mesh. Skipping the additional ones.", name.c_str());
+                    AZ_TracePrintf(AZ::SceneAPI::Utilities::LogWindow, "Optimized mesh already exists at '%s', there must be multiple mesh groups that have selected this mesh. Skipping the additional ones.", optimizedPath.c_str());
                     continue;
                 }
 
-                const bool hasBlendShapes = HasAnyBlendShapeChild(graph, nodeIndex);
+                const auto uvDatasView = Containers::MakeDerivedFilterView<IMeshVertexUVData>(childNodes(nodeIndex));
+                const auto tangentDatasView = Containers::MakeDerivedFilterView<IMeshVertexTangentData>(childNodes(nodeIndex));
+                const auto bitangentDatasView = Containers::MakeDerivedFilterView<IMeshVertexBitangentData>(childNodes(nodeIndex));
+                const auto skinWeightDatasView = Containers::MakeDerivedFilterView<ISkinWeightData>(childNodes(nodeIndex));
+                const auto colorDatasView = Containers::MakeDerivedFilterView<IMeshVertexColorData>(childNodes(nodeIndex));
+
+                MeshOptimization& optimization = optimizations.emplace_back();
+                optimization.m_mesh = mesh;
+                optimization.m_nodeIndex = nodeIndex;
+                optimization.m_meshGroup = &meshGroup;
+                optimization.m_name = AZStd::move(name);
+                optimization.m_hasBlendShapes = HasAnyBlendShapeChild(graph, nodeIndex);
+                optimization.m_uvDatas.assign(uvDatasView.begin(), uvDatasView.end());
+                optimization.m_tangentDatas.assign(tangentDatasView.begin(), tangentDatasView.end());
+                optimization.m_bitangentDatas.assign(bitangentDatasView.begin(), bitangentDatasView.end());
+                optimization.m_skinWeightDatas.assign(skinWeightDatasView.begin(), skinWeightDatasView.end());
+                optimization.m_colorDatas.assign(colorDatasView.begin(), colorDatasView.end());
+                optimization.m_blendShapeNodeIndexes = nodeIndexes(Containers::MakeDerivedFilterView<IBlendShapeData>(childNodes(nodeIndex)));
+                for (const NodeIndex& blendShapeNodeIndex : optimization.m_blendShapeNodeIndexes)
+                {
+                    optimization.m_blendShapes.push_back(static_cast<const IBlendShapeData*>(graph.GetNodeContent(blendShapeNodeIndex).get()));
+                }
+            }
+        }
 
-                auto [optimizedMesh, optimizedUVs, optimizedTangents, optimizedBitangents, optimizedVertexColors, optimizedSkinWeights] = OptimizeMesh(mesh, mesh, uvDatas, tangentDatas, bitangentDatas, colorDatas, skinWeightDatas, meshGroup, hasBlendShapes);
+        // Weld and optimize the meshes. This only reads the source nodes and creates new ones that aren't in the graph yet, so every mesh
+        // is done in parallel.
+        SceneAPI::Utilities::ParallelForEachIndex(optimizations.size(), [&optimizations](size_t optimizationIndex)
+        {
+            MeshOptimization& optimization = optimizations[optimizationIndex];
+            optimization.m_optimized = OptimizeMesh(optimization.m_mesh, optimization.m_mesh, optimization.m_uvDatas, optimization.m_tangentDatas,
+                optimization.m_bitangentDatas, optimization.m_colorDatas, optimization.m_skinWeightDatas, *optimization.m_meshGroup, optimization.m_hasBlendShapes);
 
-                AZ_TracePrintf(AZ::SceneAPI::Utilities::LogWindow, "Optimized mesh '%s': Original: %zu vertices -> optimized: %zu vertices, %0.02f%% of the original (hasBlendShapes=%s)",
-                    graph.GetNodeName(nodeIndex).GetName(),
-                    mesh->GetUsedControlPointCount(),
-                    optimizedMesh->GetUsedControlPointCount(),
-                    ((float)optimizedMesh->GetUsedControlPointCount() / (float)mesh->GetUsedControlPointCount()) * 100.0f,
-                    hasBlendShapes ? "Yes" : "No"
-                );
+            for (const IBlendShapeData* blendShapeNode : optimization.m_blendShapes)
+            {
+                auto [optimizedBlendShape, _1, _2, _3 , _4, _5] = OptimizeMesh(blendShapeNode, optimization.m_mesh, {}, {}, {}, {}, {}, *optimization.m_meshGroup, optimization.m_hasBlendShapes);
+                optimization.m_optimizedBlendShapes.emplace_back(AZStd::move(optimizedBlendShape));
+            }
+        });
 
-                const NodeIndex optimizedMeshNodeIndex = graph.AddChild(graph.GetNodeParent(nodeIndex), name.c_str(), AZStd::move(optimizedMesh));
+        // Add the optimized meshes to the graph, in the same order as they were gathered so the resulting graph is always the same.
+        for (MeshOptimization& optimization : optimizations)
+        {
+            const IMeshData* mesh = optimization.m_mesh;
+            const NodeIndex nodeIndex = optimization.m_nodeIndex;
+            auto& [optimizedMesh, optimizedUVs, optimizedTangents, optimizedBitangents, optimizedVertexColors, optimizedSkinWeights] = optimization.m_optimized;
 
-                auto addOptimizedNodes = [&graph, &optimizedMeshNodeIndex](const auto& originalNodeIndexes, auto& optimizedNodes)
-                {
-                    AZ_PUSH_DISABLE_WARNING(, "-Wrange-loop-analysis") // remove when we upgrade from clang 6.0
-                    for (const auto& [originalNodeIndex, optimizedNode] : Containers::Views::MakePairView(originalNodeIndexes, optimizedNodes))
-                    AZ_POP_DISABLE_WARNING
-                    {
-                        const AZStd::string optimizedName {graph.GetNodeName(originalNodeIndex).GetName(), graph.GetNodeName(originalNodeIndex).GetNameLength()};
-                        const NodeIndex optimizedNodeIndex = graph.AddChild(optimizedMeshNodeIndex, optimizedName.c_str(), AZStd::move(optimizedNode));
-                        if (graph.IsNodeEndPoint(originalNodeIndex))
-                        {
-                            graph.MakeEndPoint(optimizedNodeIndex);
-                        }
-                    }
-                };
-                addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexUVData>(childNodes(nodeIndex))), optimizedUVs);
-                addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexTangentData>(childNodes(nodeIndex))), optimizedTangents);
-                addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexBitangentData>(childNodes(nodeIndex))), optimizedBitangents);
-                addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexColorData>(childNodes(nodeIndex))), optimizedVertexColors);
+            AZ_TracePrintf(AZ::SceneAPI::Utilities::LogWindow, "Optimized mesh '%s': Original: %zu vertices -> optimized: %zu vertices, %0.02f%% of the original (hasBlendShapes=%s)",
+                graph.GetNodeName(nodeIndex).GetName(),
+                mesh->GetUsedControlPointCount(),
+                optimizedMesh->GetUsedControlPointCount(),
+                ((float)optimizedMesh->GetUsedControlPointCount() / (float)mesh->GetUsedControlPointCount()) * 100.0f,
+                optimization.m_hasBlendShapes ? "Yes" : "No"
+            );
 
-                if (optimizedSkinWeights)
-                {
-                    const NodeIndex optimizedSkinNodeIndex = graph.AddChild(optimizedMeshNodeIndex, "skinWeights", AZStd::move(optimizedSkinWeights));
-                    graph.MakeEndPoint(optimizedSkinNodeIndex);
-                }
+            const NodeIndex optimizedMeshNodeIndex = graph.AddChild(graph.GetNodeParent(nodeIndex), optimization.m_name.c_str(), AZStd::move(optimizedMesh));
 
-                for (const NodeIndex& blendShapeNodeIndex : nodeIndexes(Containers::MakeDerivedFilterView<IBlendShapeData>(childNodes(nodeIndex))))
+            auto addOptimizedNodes = [&graph, &optimizedMeshNodeIndex](const auto& originalNodeIndexes, auto& optimizedNodes)
+            {
+                AZ_PUSH_DISABLE_WARNING(, "-Wrange-loop-analysis") // remove when we upgrade from clang 6.0
+                for (const auto& [originalNodeIndex, optimizedNode] : Containers::Views::MakePairView(originalNodeIndexes, optimizedNodes))
+                AZ_POP_DISABLE_WARNING
                 {
-                    const IBlendShapeData* blendShapeNode = static_cast<IBlendShapeData*>(graph.GetNodeContent(blendShapeNodeIndex).get());
-                    auto [optimizedBlendShape, _1, _2, _3 , _4, _5] = OptimizeMesh(blendShapeNode, mesh, {}, {}, {}, {}, {}, meshGroup, hasBlendShapes);
-
-                    const AZStd::string optimizedName {graph.GetNodeName(blendShapeNodeIndex).GetName(), graph.GetNodeName(blendShapeNodeIndex).GetNameLength()};
-                    const NodeIndex optimizedNodeIndex = graph.AddChild(optimizedMeshNodeIndex, optimizedName.c_str(), AZStd::move(optimizedBlendShape));
-                    if (graph.IsNodeEndPoint(blendShapeNodeIndex))
+                    const AZStd::string optimizedName {graph.GetNodeName(originalNodeIndex).GetName(), graph.GetNodeName(originalNodeIndex).GetNameLength()};
+                    const NodeIndex optimizedNodeIndex = graph.AddChild(optimizedMeshNodeIndex, optimizedName.c_str(), AZStd::move(optimizedNode));
+                    if (graph.IsNodeEndPoint(originalNodeIndex))
                     {
                         graph.MakeEndPoint(optimizedNodeIndex);
                     }
                 }
+            };
+            addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexUVData>(childNodes(nodeIndex))), optimizedUVs);
+            addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexTangentData>(childNodes(nodeIndex))), optimizedTangents);
+            addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexBitangentData>(childNodes(nodeIndex))), optimizedBitangents);
+            addOptimizedNodes(nodeIndexes(Containers::MakeDerivedFilterView<IMeshVertexColorData>(childNodes(nodeIndex))), optimizedVertexColors);
 
-                const AZStd::array optimizedChildTypes {
-                    azrtti_typeid<IMeshData>(),
-                    azrtti_typeid<IMeshVertexUVData>(),
-                    azrtti_typeid<IMeshVertexTangentData>(),
-                    azrtti_typeid<IMeshVertexBitangentData>(),
-                    azrtti_typeid<IMeshVertexColorData>(),
-                    azrtti_typeid<ISkinWeightData>(),
-                    azrtti_typeid<IBlendShapeData>(),
-                };
-                for (const NodeIndex& childNodeIndex : nodeIndexes(childNodes(nodeIndex)))
-                {
-                    const AZStd::shared_ptr<SceneAPI::DataTypes::IGraphObject>& childNode = graph.GetNodeContent(childNodeIndex);
+            if (optimizedSkinWeights)
+            {
+                const NodeIndex optimizedSkinNodeIndex = graph.AddChild(optimizedMeshNodeIndex, "skinWeights", AZStd::move(optimizedSkinWeights));
+                graph.MakeEndPoint(optimizedSkinNodeIndex);
+            }
 
-                    if (!AZStd::any_of(optimizedChildTypes.begin(), optimizedChildTypes.end(), [&childNode](const AZ::Uuid& typeId) { return AZ::RttiIsTypeOf(typeId, childNode.get()); }))
+            addOptimizedNodes(optimization.m_blendShapeNodeIndexes, optimization.m_optimizedBlendShapes);
+
+            const AZStd::array optimizedChildTypes {
+                azrtti_typeid<IMeshData>(),
+                azrtti_typeid<IMeshVertexUVData>(),
+                azrtti_typeid<IMeshVertexTangentData>(),
+                azrtti_typeid<IMeshVertexBitangentData>(),
+                azrtti_typeid<IMeshVertexColorData>(),
+                azrtti_typeid<ISkinWeightData>(),
+                azrtti_typeid<IBlendShapeData>(),
+            };
+            for (const NodeIndex& childNodeIndex : nodeIndexes(childNodes(nodeIndex)))
+            {
+                const AZStd::shared_ptr<SceneAPI::DataTypes::IGraphObject>& childNode = graph.GetNodeContent(childNodeIndex);
+
+                if (!AZStd::any_of(optimizedChildTypes.begin(), optimizedChildTypes.end(), [&childNode](const AZ::Uuid& typeId) { return AZ::RttiIsTypeOf(typeId, childNode.get()); }))
+                {
+                    const AZStd::string optimizedName {graph.GetNodeName(childNodeIndex).GetName(), graph.GetNodeName(childNodeIndex).GetNameLength()};
+                    const NodeIndex optimizedNodeIndex = graph.AddChild(optimizedMeshNodeIndex, optimizedName.c_str(), childNode);
+                    if (graph.IsNodeEndPoint(childNodeIndex))
                     {
-                        const AZStd::string optimizedName {graph.GetNodeName(childNodeIndex).GetName(), graph.GetNodeName(childNodeIndex).GetNameLength()};
-                        const NodeIndex optimizedNodeIndex = graph.AddChild(optimizedMeshNodeIndex, optimizedName.c_str(), childNode);
-                        if (graph.IsNodeEndPoint(childNodeIndex))
-                        {
-                            graph.MakeEndPoint(optimizedNodeIndex);
-                        }
+                        graph.MakeEndPoint(optimizedNodeIndex);
                     }
                 }
             }
@@ -484,14 +531,7 @@ namespace AZ::SceneGenerationComponents
     }
 
     template<class MeshDataType>
-    AZStd::tuple<
-        AZStd::unique_ptr<MeshDataType>,
-        AZStd::vector<AZStd::unique_ptr<MeshVertexUVData>>,
-        AZStd::vector<AZStd::unique_ptr<MeshVertexTangentData>>,
-        AZStd::vector<AZStd::unique_ptr<MeshVertexBitangentData>>,
-        AZStd::vector<AZStd::unique_ptr<MeshVertexColorData>>,
-        AZStd::unique_ptr<AZ::SceneAPI::DataTypes::ISkinWeightData>
-    > MeshOptimizerComponent::OptimizeMesh(
+    MeshOptimizerComponent::OptimizedMeshResult<MeshDataType> MeshOptimizerComponent::OptimizeMesh(
         const MeshDataType* meshData,
         const IMeshData* baseMesh,
         const AZStd::vector<AZStd::reference_wrapper<const IMeshVertexUVData>>& uvs,
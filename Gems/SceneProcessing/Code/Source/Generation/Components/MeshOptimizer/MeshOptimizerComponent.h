@@ -52,15 +52,20 @@ namespace AZ::SceneGenerationComponents
         static bool HasAnyBlendShapeChild(const AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex);
 
     private:
+        //! The optimized mesh and its optimized vertex data streams, ready to be added to the scene graph.
         template<class MeshDataType>
-        static AZStd::tuple<
+        using OptimizedMeshResult = AZStd::tuple<
             AZStd::unique_ptr<MeshDataType>,
             AZStd::vector<AZStd::unique_ptr<AZ::SceneData::GraphData::MeshVertexUVData>>,
             AZStd::vector<AZStd::unique_ptr<AZ::SceneData::GraphData::MeshVertexTangentData>>,
             AZStd::vector<AZStd::unique_ptr<AZ::SceneData::GraphData::MeshVertexBitangentData>>,
             AZStd::vector<AZStd::unique_ptr<AZ::SceneData::GraphData::MeshVertexColorData>>,
             AZStd::unique_ptr<AZ::SceneAPI::DataTypes::ISkinWeightData>
-        > OptimizeMesh(
+        >;
+
+        //! Only reads the given nodes and returns new ones, so it's safe to call for different meshes in parallel.
+        template<class MeshDataType>
+        static OptimizedMeshResult<MeshDataType> OptimizeMesh(
             const MeshDataType* meshData,
             const SceneAPI::DataTypes::IMeshData* baseMesh,
             const AZStd::vector<AZStd::reference_wrapper<const AZ::SceneAPI::DataTypes::IMeshVertexUVData>>& uvs,
@@ -20,6 +20,7 @@
 #include <SceneAPI/SceneCore/Containers/Views/SceneGraphChildIterator.h>
 #include <SceneAPI/SceneCore/Containers/Views/ConvertIterator.h>
 #include <SceneAPI/SceneCore/Containers/Utilities/Filters.h>
+#include <SceneAPI/SceneCore/Utilities/ParallelProcessing.h>
 #include <SceneAPI/SceneCore/Utilities/Reporting.h>
 #include <SceneAPI/SceneCore/DataTypes/DataTypeUtilities.h>
 #include <SceneAPI/SceneCore/DataTypes/GraphData/IMeshData.h>
@@ -30,6 +31,7 @@
 #include <AzToolsFramework/Debug/TraceContext.h>
 
 #include <AzCore/Math/Vector4.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 
@@ -90,23 +92,34 @@ namespace AZ::SceneGenerationComponents
             meshes.emplace_back(mesh, nodeIndex);
         }
 
-        // Iterate over them. We had to build the array before as this method can insert new nodes, so using the iterator directly would fail.
-        for (auto& [mesh, nodeIndex] : meshes)
+        // Add the tangent and bitangent layers first. We had to build the array before as this inserts new nodes, so using the iterator directly would fail.
+        AZStd::vector<MeshTangentWork> meshWork(meshes.size());
+        for (size_t meshIndex = 0; meshIndex < meshes.size(); ++meshIndex)
         {
-            // Generate tangents for the mesh (if this is desired or needed).
-            if (!GenerateTangentsForMesh(context.GetScene(), nodeIndex, mesh))
-            {
-                return AZ::SceneAPI::Events::ProcessingResult::Failure;
-            }
+            PrepareTangentGeneration(context.GetScene(), meshes[meshIndex].second, meshes[meshIndex].first, meshWork[meshIndex]);
+        }
+
+        // Now that the graph doesn't change anymore generate the tangents. Every mesh only writes to its own layers and blend shapes, so the meshes
+        // are processed in parallel.
+        AZStd::vector<AZ::u8> meshSuccess(meshWork.size(), 0);
+        AZ::SceneAPI::Utilities::ParallelForEachIndex(meshWork.size(), [this, &graph, &meshWork, &meshSuccess](size_t meshIndex)
+        {
+            const MeshTangentWork& work = meshWork[meshIndex];
+            meshSuccess[meshIndex] = GenerateTangentsForMesh(work);
 
             // Now that we have the tangents and bitangents, calculate the tangent w values for the ones that we imported from the scene file, as they only have xyz.
-            UpdateFbxTangentWValues(graph, nodeIndex, mesh);
+            UpdateFbxTangentWValues(graph, work.m_nodeIndex, work.m_meshData);
+        });
+
+        if (AZStd::find(meshSuccess.begin(), meshSuccess.end(), AZ::u8(0)) != meshSuccess.end())
+        {
+            return AZ::SceneAPI::Events::ProcessingResult::Failure;
         }
 
         return AZ::SceneAPI::Events::ProcessingResult::Success;
     }
 
-    void TangentGenerateComponent::UpdateFbxTangentWValues(AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex, const AZ::SceneAPI::DataTypes::IMeshData* meshData)
+    void TangentGenerateComponent::UpdateFbxTangentWValues(AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex, const AZ::SceneAPI::DataTypes::IMeshData* meshData) const
     {
         // Iterate over all UV sets.
         AZ::SceneAPI::DataTypes::IMeshVertexUVData* uvData = FindUvData(graph, nodeIndex, 0);
@@ -175,27 +188,30 @@ namespace AZ::SceneGenerationComponents
         }
     }
 
-    bool TangentGenerateComponent::GenerateTangentsForMesh(AZ::SceneAPI::Containers::Scene& scene, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex, AZ::SceneAPI::DataTypes::IMeshData* meshData)
+    void TangentGenerateComponent::PrepareTangentGeneration(AZ::SceneAPI::Containers::Scene& scene, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
+        AZ::SceneAPI::DataTypes::IMeshData* meshData, MeshTangentWork& outWork)
     {
         AZ::SceneAPI::Containers::SceneGraph& graph = scene.GetGraph();
 
+        outWork.m_meshData = meshData;
+        outWork.m_nodeIndex = nodeIndex;
+
         // Check if we have any UV data, if not, we cannot possibly generate the tangents.
         const size_t uvSetCount = CalcUvSetCount(graph, nodeIndex);
         if (uvSetCount == 0)
         {
             AZ_Warning(AZ::SceneAPI::Utilities::WarningWindow, false, "Cannot generate tangents for this mesh, as it has no UV coordinates.\n");
-            return true; // No fatal error
+            return; // No fatal error
         }
 
         const AZ::SceneAPI::SceneData::TangentsRule* tangentsRule = GetTangentRule(scene);
         const AZ::SceneAPI::DataTypes::TangentGenerationMethod ruleGenerationMethod = tangentsRule ? tangentsRule->GetGenerationMethod() : AZ::SceneAPI::DataTypes::TangentGenerationMethod::FromSourceScene;
+        outWork.m_tSpaceMethod = tangentsRule ? tangentsRule->GetMikkTSpaceMethod() : AZ::SceneAPI::DataTypes::MikkTSpaceMethod::TSpace;
 
         // Find all blend shape data under the mesh. We need to generate the tangent and bitangent for blend shape as well.
-        AZStd::vector<AZ::SceneData::GraphData::BlendShapeData*> blendShapes;
-        FindBlendShapes(graph, nodeIndex, blendShapes);
+        FindBlendShapes(graph, nodeIndex, outWork.m_blendShapes);
 
-        // Generate tangents/bitangents for all uv sets.
-        bool allSuccess = true;
+        // Find or create the tangent/bitangent layers for all uv sets.
         for (size_t uvSetIndex = 0; uvSetIndex < uvSetCount; ++uvSetIndex)
         {
             AZ::SceneAPI::DataTypes::IMeshVertexUVData* uvData = FindUvData(graph, nodeIndex, uvSetIndex);
@@ -255,25 +271,34 @@ namespace AZ::SceneGenerationComponents
             tangentData->SetGenerationMethod(generationMethod);
             bitangentData->SetGenerationMethod(generationMethod);
 
-            switch (generationMethod)
+            outWork.m_uvSets.push_back({ uvData, tangentData, bitangentData, uvSetIndex, generationMethod });
+        }
+    }
+
+    bool TangentGenerateComponent::GenerateTangentsForMesh(const MeshTangentWork& work) const
+    {
+        // Generate tangents/bitangents for all uv sets.
+        // The uv sets run in order as the blend shapes only store a single set of tangents, which is written for every uv set.
+        bool allSuccess = true;
+        for (const UvSetTangentWork& uvSet : work.m_uvSets)
+        {
+            switch (uvSet.m_generationMethod)
             {
             // Generate using MikkT space.
             case AZ::SceneAPI::DataTypes::TangentGenerationMethod::MikkT:
             {
-                const AZ::SceneAPI::DataTypes::MikkTSpaceMethod tSpaceMethod = tangentsRule ? tangentsRule->GetMikkTSpaceMethod() : AZ::SceneAPI::DataTypes::MikkTSpaceMethod::TSpace;
-
-                allSuccess &= AZ::TangentGeneration::Mesh::MikkT::GenerateTangents(meshData, uvData, tangentData, bitangentData, tSpaceMethod);
+                allSuccess &= AZ::TangentGeneration::Mesh::MikkT::GenerateTangents(work.m_meshData, uvSet.m_uvData, uvSet.m_tangentData, uvSet.m_bitangentData, work.m_tSpaceMethod);
 
-                for (AZ::SceneData::GraphData::BlendShapeData* blendShape : blendShapes)
+                for (AZ::SceneData::GraphData::BlendShapeData* blendShape : work.m_blendShapes)
                 {
-                    allSuccess &= AZ::TangentGeneration::BlendShape::MikkT::GenerateTangents(blendShape, uvSetIndex, tSpaceMethod);
+                    allSuccess &= AZ::TangentGeneration::BlendShape::MikkT::GenerateTangents(blendShape, uvSet.m_uvSetIndex, work.m_tSpaceMethod);
                 }
             }
             break;
 
             default:
             {
-                AZ_Assert(false, "Unknown tangent generation method selected (%d) for UV set %d, cannot generate tangents.\n", static_cast<AZ::u32>(generationMethod), uvSetIndex);
+                AZ_Assert(false, "Unknown tangent generation method selected (%d) for UV set %d, cannot generate tangents.\n", static_cast<AZ::u32>(uvSet.m_generationMethod), uvSet.m_uvSetIndex);
                 allSuccess = false;
             }
             }
@@ -55,11 +55,35 @@ namespace AZ::SceneGenerationComponents
         AZ::SceneAPI::Events::ProcessingResult GenerateTangentData(TangentGenerateContext& context);
 
     private:
+        //! Tangent generation for a single UV set, the tangent and bitangent layers are already in the graph.
+        struct UvSetTangentWork
+        {
+            AZ::SceneAPI::DataTypes::IMeshVertexUVData* m_uvData = nullptr;
+            AZ::SceneAPI::DataTypes::IMeshVertexTangentData* m_tangentData = nullptr;
+            AZ::SceneAPI::DataTypes::IMeshVertexBitangentData* m_bitangentData = nullptr;
+            size_t m_uvSetIndex = 0;
+            AZ::SceneAPI::DataTypes::TangentGenerationMethod m_generationMethod = AZ::SceneAPI::DataTypes::TangentGenerationMethod::MikkT;
+        };
+
+        //! Everything needed to generate the tangents of one mesh without touching the scene graph, so meshes can be processed in parallel.
+        struct MeshTangentWork
+        {
+            AZ::SceneAPI::DataTypes::IMeshData* m_meshData = nullptr;
+            AZ::SceneAPI::Containers::SceneGraph::NodeIndex m_nodeIndex;
+            AZ::SceneAPI::DataTypes::MikkTSpaceMethod m_tSpaceMethod = AZ::SceneAPI::DataTypes::MikkTSpaceMethod::TSpace;
+            AZStd::vector<UvSetTangentWork> m_uvSets;
+            AZStd::vector<AZ::SceneData::GraphData::BlendShapeData*> m_blendShapes;
+        };
+
         void FindBlendShapes(
             AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
             AZStd::vector<AZ::SceneData::GraphData::BlendShapeData*>& outBlendShapes) const;
-        bool GenerateTangentsForMesh(AZ::SceneAPI::Containers::Scene& scene, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex, AZ::SceneAPI::DataTypes::IMeshData* meshData);
-        void UpdateFbxTangentWValues(AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex, const AZ::SceneAPI::DataTypes::IMeshData* meshData);
+        //! Adds the missing tangent and bitangent layers of the mesh to the graph and gathers the uv sets that need their tangents generated.
+        void PrepareTangentGeneration(AZ::SceneAPI::Containers::Scene& scene, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
+            AZ::SceneAPI::DataTypes::IMeshData* meshData, MeshTangentWork& outWork);
+        //! Generates the tangents gathered by PrepareTangentGeneration. Only writes to the layers of the mesh, so it's safe to call for different meshes in parallel.
+        bool GenerateTangentsForMesh(const MeshTangentWork& work) const;
+        void UpdateFbxTangentWValues(AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex, const AZ::SceneAPI::DataTypes::IMeshData* meshData) const;
         const AZ::SceneAPI::SceneData::TangentsRule* GetTangentRule(const AZ::SceneAPI::Containers::Scene& scene) const;
 
         size_t CalcUvSetCount(AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex) const;
@@ -28,6 +28,7 @@
 #include <SceneAPI/SceneCore/Events/ExportProductList.h>
 #include <SceneAPI/SceneCore/Events/ExportEventContext.h>
 #include <SceneAPI/SceneCore/Events/SceneSerializationBus.h>
+#include <SceneAPI/SceneCore/Utilities/ParallelProcessing.h>
 #include <SceneAPI/SceneCore/Utilities/Reporting.h>
 #include <SceneAPI/SceneCore/SceneBuilderDependencyBus.h>
 
@@ -317,7 +318,10 @@ namespace SceneBuilder
 
         AZ_TracePrintf(Utilities::LogWindow, "Loading scene.\n");
 
-        SceneSerializationBus::BroadcastResult(result, &SceneSerializationBus::Events::LoadScene, request.m_fullPath, request.m_sourceFileUUID);
+        {
+            Utilities::ScopedPhaseTimer phaseTimer("Load");
+            SceneSerializationBus::BroadcastResult(result, &SceneSerializationBus::Events::LoadScene, request.m_fullPath, request.m_sourceFileUUID);
+        }
         if (!result)
         {
             AZ_TracePrintf(Utilities::ErrorWindow, "Failed to load scene file.\n");
@@ -349,17 +353,35 @@ namespace SceneBuilder
 
         ProcessingResultCombiner result;
         AZ_TracePrintf(Utilities::LogWindow, "Preparing for generation.\n");
-        result += Process<PreGenerateEventContext>(*scene, platformIdentifier);
+        {
+            Utilities::ScopedPhaseTimer phaseTimer("PreGenerate");
+            result += Process<PreGenerateEventContext>(*scene, platformIdentifier);
+        }
         AZ_TracePrintf(Utilities::LogWindow, "Generating...\n");
-        result += Process<GenerateEventContext>(*scene, platformIdentifier);
+        {
+            Utilities::ScopedPhaseTimer phaseTimer("Generate");
+            result += Process<GenerateEventContext>(*scene, platformIdentifier);
+        }
         AZ_TracePrintf(Utilities::LogWindow, "Generating LODs...\n");
-        result += Process<GenerateLODEventContext>(*scene, platformIdentifier);
+        {
+            Utilities::ScopedPhaseTimer phaseTimer("GenerateLOD");
+            result += Process<GenerateLODEventContext>(*scene, platformIdentifier);
+        }
         AZ_TracePrintf(Utilities::LogWindow, "Generating additions...\n");
-        result += Process<GenerateAdditionEventContext>(*scene, platformIdentifier);
+        {
+            Utilities::ScopedPhaseTimer phaseTimer("GenerateAddition");
+            result += Process<GenerateAdditionEventContext>(*scene, platformIdentifier);
+        }
         AZ_TracePrintf(Utilities::LogWindow, "Simplifing scene...\n");
-        result += Process<GenerateSimplificationEventContext>(*scene, platformIdentifier);
+        {
+            Utilities::ScopedPhaseTimer phaseTimer("GenerateSimplification");
+            result += Process<GenerateSimplificationEventContext>(*scene, platformIdentifier);
+        }
         AZ_TracePrintf(Utilities::LogWindow, "Finalizing generation process.\n");
-        result += Process<PostGenerateEventContext>(*scene, platformIdentifier);
+        {
+            Utilities::ScopedPhaseTimer phaseTimer("PostGenerate");
+            result += Process<PostGenerateEventContext>(*scene, platformIdentifier);
+        }
 
         if (result.GetResult() == ProcessingResult::Failure)
         {
@@ -392,11 +414,20 @@ namespace SceneBuilder
         ExportProductList productList;
         ProcessingResultCombiner result;
         AZ_TracePrintf(Utilities::LogWindow, "Preparing for export.\n");
-        result += Process<PreExportEventContext>(productList, outputFolder, *scene, platformIdentifier);
+        {
+            Utilities::ScopedPhaseTimer phaseTimer("PreExport");
+            result += Process<PreExportEventContext>(productList, outputFolder, *scene, platformIdentifier);
+        }
         AZ_TracePrintf(Utilities::LogWindow, "Exporting...\n");
-        result += Process<ExportEventContext>(productList, outputFolder, *scene, platformIdentifier);
+        {
+            Utilities::ScopedPhaseTimer phaseTimer("Export");
+            result += Process<ExportEventContext>(productList, outputFolder, *scene, platformIdentifier);
+        }
         AZ_TracePrintf(Utilities::LogWindow, "Finalizing export process.\n");
-        result += Process<PostExportEventContext>(productList, outputFolder, platformIdentifier);
+        {
+            Utilities::ScopedPhaseTimer phaseTimer("PostExport");
+            result += Process<PostExportEventContext>(productList, outputFolder, platformIdentifier);
+        }
 
         auto itr = request.m_jobDescription.m_jobParameters.find(AZ_CRC_CE("DebugFlag"));
 
@@ -237,6 +237,38 @@ namespace SceneProcessing
         EXPECT_EQ(optimizedMesh->GetVertexCount(), 4);
     }
 
+    TEST_F(VertexDeduplicationFixture, SameNamedMeshesUnderDifferentParents_BothOptimized)
+    {
+        AZ::SceneAPI::Containers::Scene scene("testScene");
+        AZ::SceneAPI::Containers::SceneGraph& graph = scene.GetGraph();
+
+        const auto lod0NodeIndex = graph.AddChild(graph.GetRoot(), "LOD0");
+        const auto lod1NodeIndex = graph.AddChild(graph.GetRoot(), "LOD1");
+        graph.AddChild(lod0NodeIndex, "Body", MakePlaneMesh());
+        graph.AddChild(lod1NodeIndex, "Body", MakePlaneMesh());
+
+        auto meshGroup = AZStd::make_unique<AZ::SceneAPI::SceneData::MeshGroup>();
+        meshGroup->GetSceneNodeSelectionList().AddSelectedNode("LOD0.Body");
+        meshGroup->GetSceneNodeSelectionList().AddSelectedNode("LOD1.Body");
+        scene.GetManifest().AddEntry(AZStd::move(meshGroup));
+
+        AZ::SceneGenerationComponents::MeshOptimizerComponent component;
+        AZ::SceneAPI::Events::GenerateSimplificationEventContext context(scene, "pc");
+        component.OptimizeMeshes(context);
+
+        for (const char* meshPath : { "LOD0.Body", "LOD1.Body" })
+        {
+            AZ::SceneAPI::Containers::SceneGraph::NodeIndex optimizedNodeIndex =
+                graph.Find(AZStd::string(meshPath).append(AZ::SceneAPI::Utilities::OptimizedMeshSuffix));
+            ASSERT_TRUE(optimizedNodeIndex.IsValid()) << "Mesh optimizer did not add an optimized version of " << meshPath;
+
+            const auto& optimizedMesh =
+                AZStd::rtti_pointer_cast<AZ::SceneAPI::DataTypes::IMeshData>(graph.GetNodeContent(optimizedNodeIndex));
+            ASSERT_TRUE(optimizedMesh);
+            EXPECT_EQ(optimizedMesh->GetVertexCount(), 4);
+        }
+    }
+
     TEST_F(VertexDeduplicationFixture, DeduplicatedVerticesKeepUniqueSkinInfluences)
     {
         // Vertices 0,5 and 2,3 have duplicate positions, but unique links,
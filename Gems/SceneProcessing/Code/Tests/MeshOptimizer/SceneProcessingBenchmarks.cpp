@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Module/DynamicModuleHandle.h>
+#include <AzCore/Module/Environment.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <SceneAPI/SceneCore/Containers/Scene.h>
+#include <SceneAPI/SceneCore/Containers/SceneGraph.h>
+#include <SceneAPI/SceneCore/Events/GenerateEventContext.h>
+#include <SceneAPI/SceneData/GraphData/MeshData.h>
+#include <SceneAPI/SceneData/GraphData/MeshVertexUVData.h>
+#include <SceneAPI/SceneData/Groups/MeshGroup.h>
+#include <SceneAPI/SceneData/Rules/TangentsRule.h>
+#include <Generation/Components/MeshOptimizer/MeshOptimizerComponent.h>
+#include <Generation/Components/TangentGenerator/TangentGenerateComponent.h>
+#include <benchmark/benchmark.h>
+
+namespace SceneProcessing
+{
+    //! Runs the tangent generation and mesh optimization steps of the scene builder over a synthetic scene made of many grid meshes,
+    //! similar to a large environment scene file, with the job system set up the same way as in the asset builders.
+    //! The first argument is the number of meshes, the second one the number of quads along each side of a mesh.
+    class SceneProcessingBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void internalSetUp()
+        {
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            for (const char* moduleName : { "SceneCore", "SceneData" })
+            {
+                AZStd::unique_ptr<AZ::DynamicModuleHandle> module = AZ::DynamicModuleHandle::Create(moduleName);
+                if (module && module->Load(false))
+                {
+                    if (auto init = module->GetFunction<AZ::InitializeDynamicModuleFunction>(AZ::InitializeDynamicModuleFunctionName))
+                    {
+                        (*init)(AZ::Environment::GetInstance());
+                    }
+                    m_modules.emplace_back(AZStd::move(module));
+                }
+            }
+
+            AZ::JobManagerDesc jobManagerDesc;
+            for (unsigned int i = 0; i < AZStd::thread::hardware_concurrency(); ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+        }
+
+        void internalTearDown()
+        {
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext = nullptr;
+            m_jobManager = nullptr;
+
+            for (AZStd::unique_ptr<AZ::DynamicModuleHandle>& module : m_modules)
+            {
+                if (auto uninit = module->GetFunction<AZ::UninitializeDynamicModuleFunction>(AZ::UninitializeDynamicModuleFunctionName))
+                {
+                    (*uninit)();
+                }
+                module.reset();
+            }
+            m_modules = {};
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        }
+
+        //! Builds a scene with meshCount unwelded grid meshes with one uv set each, selected by a single mesh group that generates MikkT tangents.
+        static AZStd::unique_ptr<AZ::SceneAPI::Containers::Scene> CreateSyntheticScene(int64_t meshCount, int64_t quadsPerSide)
+        {
+            auto scene = AZStd::make_unique<AZ::SceneAPI::Containers::Scene>("SyntheticScene");
+            AZ::SceneAPI::Containers::SceneGraph& graph = scene->GetGraph();
+
+            auto meshGroup = AZStd::make_unique<AZ::SceneAPI::SceneData::MeshGroup>();
+            meshGroup->GetRuleContainer().AddRule(AZStd::make_shared<AZ::SceneAPI::SceneData::TangentsRule>());
+
+            const float quadSize = 1.0f / static_cast<float>(quadsPerSide);
+            for (int64_t meshIndex = 0; meshIndex < meshCount; ++meshIndex)
+            {
+                auto mesh = AZStd::make_shared<AZ::SceneData::GraphData::MeshData>();
+                auto uvs = AZStd::make_shared<AZ::SceneData::GraphData::MeshVertexUVData>();
+                uvs->ReserveContainerSpace(quadsPerSide * quadsPerSide * 6);
+
+                // Every triangle has its own vertices, like the importers produce, so the optimizer has to weld them.
+                int vertexIndex = 0;
+                for (int64_t y = 0; y < quadsPerSide; ++y)
+                {
+                    for (int64_t x = 0; x < quadsPerSide; ++x)
+                    {
+                        const float left = static_cast<float>(x) * quadSize;
+                        const float bottom = static_cast<float>(y) * quadSize;
+                        const AZ::Vector2 corners[] = {
+                            AZ::Vector2(left, bottom), AZ::Vector2(left + quadSize, bottom), AZ::Vector2(left + quadSize, bottom + quadSize),
+                            AZ::Vector2(left + quadSize, bottom + quadSize), AZ::Vector2(left, bottom + quadSize), AZ::Vector2(left, bottom)
+                        };
+                        for (const AZ::Vector2& corner : corners)
+                        {
+                            // Add a little height variation so the tangent frames differ per vertex.
+                            const float height = 0.05f * sinf(corner.GetX() * 12.0f) * cosf(corner.GetY() * 7.0f);
+                            mesh->AddPosition(AZ::Vector3(corner.GetX(), height, corner.GetY()));
+                            mesh->AddNormal(AZ::Vector3::CreateAxisY());
+                            mesh->SetVertexIndexToControlPointIndexMap(vertexIndex, vertexIndex);
+                            uvs->AppendUV(corner);
+                            ++vertexIndex;
+                        }
+                        const unsigned int first = static_cast<unsigned int>(vertexIndex - 6);
+                        mesh->AddFace({ first, first + 1, first + 2 }, 0);
+                        mesh->AddFace({ first + 3, first + 4, first + 5 }, 0);
+                    }
+                }
+
+                const AZStd::string meshName = AZStd::string::format("Mesh_%lld", static_cast<long long>(meshIndex));
+                const auto meshNodeIndex = graph.AddChild(graph.GetRoot(), meshName.c_str(), AZStd::move(mesh));
+                const auto uvNodeIndex = graph.AddChild(meshNodeIndex, "UV0", AZStd::move(uvs));
+                graph.MakeEndPoint(uvNodeIndex);
+                meshGroup->GetSceneNodeSelectionList().AddSelectedNode(meshName);
+            }
+
+            scene->GetManifest().AddEntry(AZStd::move(meshGroup));
+            return scene;
+        }
+
+        AZStd::vector<AZStd::unique_ptr<AZ::DynamicModuleHandle>> m_modules;
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+    };
+
+    BENCHMARK_DEFINE_F(SceneProcessingBenchmark, BM_GenerateTangents)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            AZStd::unique_ptr<AZ::SceneAPI::Containers::Scene> scene = CreateSyntheticScene(state.range(0), state.range(1));
+            AZ::SceneGenerationComponents::TangentGenerateComponent component;
+            AZ::SceneGenerationComponents::TangentGenerateContext context(*scene);
+            state.ResumeTiming();
+
+            benchmark::DoNotOptimize(component.GenerateTangentData(context));
+
+            state.PauseTiming();
+            scene = nullptr;
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(SceneProcessingBenchmark, BM_GenerateTangents)
+        ->Args({ 16, 64 })
+        ->Args({ 256, 16 })
+        ->Args({ 64, 128 })
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(SceneProcessingBenchmark, BM_OptimizeMeshes)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            AZStd::unique_ptr<AZ::SceneAPI::Containers::Scene> scene = CreateSyntheticScene(state.range(0), state.range(1));
+            AZ::SceneGenerationComponents::MeshOptimizerComponent component;
+            AZ::SceneAPI::Events::GenerateSimplificationEventContext context(*scene, "pc");
+            state.ResumeTiming();
+
+            benchmark::DoNotOptimize(component.OptimizeMeshes(context));
+
+            state.PauseTiming();
+            scene = nullptr;
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(SceneProcessingBenchmark, BM_OptimizeMeshes)
+        ->Args({ 16, 64 })
+        ->Args({ 256, 16 })
+        ->Args({ 64, 128 })
+        ->Unit(benchmark::kMillisecond);
+} // namespace SceneProcessing
+#endif
@@ -13,6 +13,7 @@ set(FILES
     Tests/MeshBuilder/MeshVerticesTests.cpp
     Tests/MeshBuilder/SkinInfluencesTests.cpp
     Tests/MeshOptimizer/HasBlendshapes.cpp
+    Tests/MeshOptimizer/SceneProcessingBenchmarks.cpp
     Tests/SceneBuilder/SceneBuilderPhasesTests.cpp
     Tests/SceneBuilder/SceneBuilderTests.cpp
     Tests/SceneProcessingConfigTest.cpp
@@ -628,6 +628,13 @@ namespace ScriptCanvasBuilder
     ScriptCanvas::Translation::Result TranslateToLua(ScriptCanvas::Grammar::Request& request)
     {
         request.translationTargetFlags = ScriptCanvas::Translation::TargetFlags::Lua;
+
+        // the Lua product is always built, the native source is an optional extra that only pure graphs translate to
+        if (ScriptCanvas::Grammar::g_translateToNativeCpp)
+        {
+            request.translationTargetFlags |= ScriptCanvas::Translation::TargetFlags::Cpp | ScriptCanvas::Translation::TargetFlags::Hpp;
+        }
+
         return ScriptCanvas::Translation::ParseAndTranslateGraph(request);
     }
 }
@@ -19,6 +19,7 @@
 #include <ScriptCanvas/Variable/VariableData.h>
 #include <ScriptCanvas/Execution/ExecutionContext.h>
 #include <ScriptCanvas/Execution/ExecutionObjectCloning.h>
+#include <ScriptCanvas/Execution/Interpreted/ExecutionInterpretedCallPlans.h>
 
 namespace ScriptCanvas
 {
@@ -75,6 +76,8 @@ namespace ScriptCanvas
         AZStd::vector<Execution::CloneSource> m_cloneSources;
         AZStd::vector<AZ::BehaviorValueParameter> m_activationInputStorage;
         Execution::ActivationInputRange m_activationInputRange;
+        // resolved on first dispatch of each handled event, and shared by every instance of the graph
+        Execution::EventCallPlans m_eventCallPlans;
 
         // used to initialize statics only once, and not necessarily on the loading thread
         bool m_areStaticsInitialized = false;
@@ -71,6 +71,11 @@ namespace ScriptCanvas
         m_handler->Disconnect();
     }
 
+    const AZ::BehaviorEBus* EBusHandler::GetEBus() const
+    {
+        return m_ebus;
+    }
+
     const AZStd::string& EBusHandler::GetEBusName() const
     {
         return m_ebus->m_name;
@@ -50,6 +50,8 @@ namespace ScriptCanvas
         
         void Disconnect();
         
+        const AZ::BehaviorEBus* GetEBus() const;
+
         const AZStd::string& GetEBusName() const;
         
         int GetEventIndex(AZStd::string_view eventName) const;
@@ -108,6 +108,11 @@ namespace ScriptCanvas
         return m_outs[index];
     }
 
+    ExecutionStateWeakConstPtr Nodeable::GetExecutionState() const
+    {
+        return m_executionState;
+    }
+
     AZ::EntityId Nodeable::GetScriptCanvasId() const
     {
         return m_executionState->GetScriptCanvasId();
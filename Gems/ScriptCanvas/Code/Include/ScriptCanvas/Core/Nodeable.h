@@ -71,6 +71,8 @@ namespace ScriptCanvas
         
         const Execution::FunctorOut& GetExecutionOutChecked(size_t index) const;
 
+        ExecutionStateWeakConstPtr GetExecutionState() const;
+
         virtual NodePropertyInterface* GetPropertyInterface(AZ::Crc32 /*propertyId*/) { return nullptr; }
 
         AZ::EntityId GetScriptCanvasId() const;
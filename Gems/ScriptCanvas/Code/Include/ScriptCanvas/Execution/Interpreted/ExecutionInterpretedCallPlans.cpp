@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ExecutionInterpretedCallPlans.h"
+
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Script/lua/lua.h>
+
+namespace ExecutionInterpretedCallPlansCpp
+{
+    // these match the string handling of ScriptCanvas::Execution::StackPush
+    void PushCString(lua_State* lua, AZ::BehaviorValueParameter& argument)
+    {
+        lua_pushstring(lua, reinterpret_cast<const char*>(argument.GetValueAddress()));
+    }
+
+    void PushString(lua_State* lua, AZ::BehaviorValueParameter& argument)
+    {
+        auto value = reinterpret_cast<const AZStd::string*>(argument.GetValueAddress());
+        lua_pushlstring(lua, value->data(), value->size());
+    }
+
+    void PushStringView(lua_State* lua, AZ::BehaviorValueParameter& argument)
+    {
+        auto value = reinterpret_cast<const AZStd::string_view*>(argument.GetValueAddress());
+        lua_pushlstring(lua, value->data(), value->size());
+    }
+
+    AZ::LuaPushToStack ResolvePusher(AZ::BehaviorContext* behaviorContext, const AZ::BehaviorValueParameter& argument)
+    {
+        if (argument.m_typeId == azrtti_typeid<const char*>())
+        {
+            return &PushCString;
+        }
+        else if (argument.m_typeId == azrtti_typeid<AZStd::string>())
+        {
+            return &PushString;
+        }
+        else if (argument.m_typeId == azrtti_typeid<AZStd::string_view>())
+        {
+            return &PushStringView;
+        }
+
+        AZ::BehaviorClass* unused = nullptr;
+        AZ::LuaPrepareValue prepareValue = nullptr;
+        AZ::LuaPushToStack pusher = AZ::ToLuaStack(behaviorContext, &argument, &prepareValue, unused);
+        AZ_Assert(pusher != nullptr, "No LuaPushToStack function found for typeid: %s", argument.m_typeId.ToString<AZStd::string>().data());
+        return pusher;
+    }
+}
+
+namespace ScriptCanvas
+{
+    namespace Execution
+    {
+        void EventCallPlan::PushArguments(lua_State* lua, AZ::BehaviorContext* behaviorContext, AZ::BehaviorValueParameter* argsBVPs, int numArguments)
+        {
+            if (!m_isArgumentsResolved)
+            {
+                m_argumentPushers.reserve(numArguments);
+
+                for (int i = 0; i < numArguments; ++i)
+                {
+                    m_argumentPushers.push_back(ExecutionInterpretedCallPlansCpp::ResolvePusher(behaviorContext, argsBVPs[i]));
+                }
+
+                m_isArgumentsResolved = true;
+            }
+
+            AZ_Assert(m_argumentPushers.size() == static_cast<size_t>(numArguments), "EventCallPlan was resolved for %zu arguments, but called with %d", m_argumentPushers.size(), numArguments);
+
+            for (int i = 0; i < numArguments; ++i)
+            {
+                m_argumentPushers[i](lua, argsBVPs[i]);
+            }
+        }
+
+        bool EventCallPlan::ReadResult(lua_State* lua, AZ::BehaviorContext* behaviorContext, int index, AZ::BehaviorValueParameter& resultBVP)
+        {
+            if (!m_isResultResolved)
+            {
+                m_resultLoader = AZ::FromLuaStack(behaviorContext, &resultBVP, m_resultClass);
+                AZ_Assert(m_resultLoader != nullptr, "No LuaLoadFromStack function found for typeid: %s", resultBVP.m_typeId.ToString<AZStd::string>().data());
+                m_isResultResolved = true;
+            }
+
+            return m_resultLoader(lua, index, resultBVP, m_resultClass, nullptr);
+        }
+
+        EventCallPlan& EventCallPlans::FindOrAdd(const AZ::BehaviorEBus* ebus, int eventIndex)
+        {
+            return m_plansByEvent[AZStd::make_pair(ebus, eventIndex)];
+        }
+
+        void EventCallPlans::Clear()
+        {
+            m_plansByEvent.clear();
+        }
+    }
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Script/ScriptContext.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/utils.h>
+
+struct lua_State;
+
+namespace AZ
+{
+    class BehaviorContext;
+    class BehaviorEBus;
+    struct BehaviorValueParameter;
+}
+
+namespace ScriptCanvas
+{
+    namespace Execution
+    {
+        // The Lua stack conversions for the arguments and result of one handled event. These are resolved from the first dispatch
+        // of the event, since the argument types of a BehaviorContext event never change, and are reused by every later dispatch
+        // instead of searching the BehaviorContext for each argument of each call.
+        struct EventCallPlan
+        {
+            AZ_CLASS_ALLOCATOR(EventCallPlan, AZ::SystemAllocator, 0);
+
+            AZStd::vector<AZ::LuaPushToStack> m_argumentPushers;
+            AZ::LuaLoadFromStack m_resultLoader = nullptr;
+            AZ::BehaviorClass* m_resultClass = nullptr;
+            bool m_isArgumentsResolved = false;
+            bool m_isResultResolved = false;
+
+            void PushArguments(lua_State* lua, AZ::BehaviorContext* behaviorContext, AZ::BehaviorValueParameter* argsBVPs, int numArguments);
+
+            bool ReadResult(lua_State* lua, AZ::BehaviorContext* behaviorContext, int index, AZ::BehaviorValueParameter& resultBVP);
+        };
+
+        // All the event call plans of a graph asset, shared by every instance of the graph.
+        // Only handled events have plans. Sent events are dispatched by the generated Lua through the EBus bindings of the
+        // ScriptContext, which resolve the sender and marshal the arguments themselves.
+        // \note plans are only created and used from the thread that owns the Lua context
+        class EventCallPlans
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(EventCallPlans, AZ::SystemAllocator, 0);
+
+            // the returned plan is stable for the lifetime of this object
+            EventCallPlan& FindOrAdd(const AZ::BehaviorEBus* ebus, int eventIndex);
+
+            void Clear();
+
+        private:
+            AZStd::unordered_map<AZStd::pair<const AZ::BehaviorEBus*, int>, EventCallPlan> m_plansByEvent;
+        };
+    }
+}
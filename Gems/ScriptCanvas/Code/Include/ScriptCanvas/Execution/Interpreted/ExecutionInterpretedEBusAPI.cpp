@@ -13,6 +13,7 @@
 #include <AzCore/Script/ScriptSystemBus.h>
 #include <AzCore/Script/lua/lua.h>
 
+#include <ScriptCanvas/Asset/RuntimeAsset.h>
 #include <ScriptCanvas/Core/EBusHandler.h>
 #include <ScriptCanvas/Core/Nodeable.h>
 #include <ScriptCanvas/Core/NodeableOut.h>
@@ -21,8 +22,29 @@
 #include <ScriptCanvas/Execution/NodeableOut/NodeableOutNative.h>
 #include <ScriptCanvas/Grammar/PrimitivesDeclarations.h>
 
+#include "ExecutionInterpretedCallPlans.h"
 #include "ExecutionInterpretedOut.h"
 
+namespace ExecutionInterpretedEBusAPICpp
+{
+    using namespace ScriptCanvas;
+
+    // the plan is shared by every handler of the event in the graph asset, so argument conversions are only resolved once
+    Execution::EventCallPlan* ModEventCallPlan(const EBusHandler& ebusHandler, int eventIndex)
+    {
+        ExecutionStateWeakConstPtr executionState = ebusHandler.GetExecutionState();
+        if (!executionState)
+        {
+            return nullptr;
+        }
+
+        RuntimeAsset* runtimeAsset = executionState->GetRuntimeDataOverrides().m_runtimeAsset.Get();
+        return runtimeAsset
+            ? &runtimeAsset->m_runtimeData.m_eventCallPlans.FindOrAdd(ebusHandler.GetEBus(), eventIndex)
+            : nullptr;
+    }
+}
+
 namespace ScriptCanvas
 {
     namespace Execution
@@ -125,7 +147,7 @@ namespace ScriptCanvas
             // Lua: nodeable, string, lambda, lambda
 
             // route the event handling to the lambda on the top of the stack
-            nodeable->SetExecutionOut(AZ::Crc32(eventIndex), OutInterpreted(lua));
+            nodeable->SetExecutionOut(AZ::Crc32(eventIndex), OutInterpreted(lua, ExecutionInterpretedEBusAPICpp::ModEventCallPlan(*nodeable, eventIndex)));
             // Lua: nodeable, string, lambda
             return 0;
         }
@@ -153,7 +175,7 @@ namespace ScriptCanvas
             // Lua: nodeable, string, lambda, lambda
 
             // route the event handling to the lambda on the top of the stack
-            nodeable->SetExecutionOut(AZ::Crc32(eventIndex), OutInterpretedResult(lua));
+            nodeable->SetExecutionOut(AZ::Crc32(eventIndex), OutInterpretedResult(lua, ExecutionInterpretedEBusAPICpp::ModEventCallPlan(*nodeable, eventIndex)));
             // Lua: nodeable, string, lambda
             return 0;
         }
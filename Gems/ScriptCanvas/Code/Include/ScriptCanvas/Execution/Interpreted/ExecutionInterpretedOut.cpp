@@ -21,6 +21,7 @@
 #include <ScriptCanvas/Grammar/PrimitivesDeclarations.h>
 
 #include "ExecutionInterpretedAPI.h"
+#include "ExecutionInterpretedCallPlans.h"
 
 namespace ExecutionStateInterpretedCpp
 {
@@ -37,9 +38,11 @@ namespace ScriptCanvas
 {
     namespace Execution
     {        
-        OutInterpreted::OutInterpreted(lua_State* lua)
+        OutInterpreted::OutInterpreted(lua_State* lua, EventCallPlan* callPlan)
             : m_lambdaRegistryIndex(ExecutionStateInterpretedCpp::luaL_ref_Checked(lua))
             , m_lua(lua)
+            , m_behaviorContext(AZ::ScriptContext::FromNativeContext(lua)->GetBoundContext())
+            , m_callPlan(callPlan)
         {
         }
 
@@ -65,19 +68,28 @@ namespace ScriptCanvas
             source.m_lambdaRegistryIndex = LUA_NOREF;
             m_lua = source.m_lua;
             source.m_lua = nullptr;
+            m_behaviorContext = source.m_behaviorContext;
+            m_callPlan = source.m_callPlan;
+            source.m_callPlan = nullptr;
             return *this;
         }
 
         void OutInterpreted::operator()(AZ::BehaviorValueParameter* /*resultBVP*/, AZ::BehaviorValueParameter* argsBVPs, int numArguments)
         {
-            auto behaviorContext = AZ::ScriptContext::FromNativeContext(m_lua)->GetBoundContext();
             // Lua:
             lua_rawgeti(m_lua, LUA_REGISTRYINDEX, m_lambdaRegistryIndex);
             // Lua: lambda
 
-            for (int i = 0; i < numArguments; ++i)
+            if (m_callPlan)
             {
-                Execution::StackPush(m_lua, behaviorContext, argsBVPs[i]);
+                m_callPlan->PushArguments(m_lua, m_behaviorContext, argsBVPs, numArguments);
+            }
+            else
+            {
+                for (int i = 0; i < numArguments; ++i)
+                {
+                    Execution::StackPush(m_lua, m_behaviorContext, argsBVPs[i]);
+                }
             }
             // Lua: lambda, args...
             const int result = InterpretedSafeCall(m_lua, numArguments, 0);
@@ -90,9 +102,11 @@ namespace ScriptCanvas
             // Lua:
         }
 
-        OutInterpretedResult::OutInterpretedResult(lua_State* lua)
+        OutInterpretedResult::OutInterpretedResult(lua_State* lua, EventCallPlan* callPlan)
             : m_lambdaRegistryIndex(ExecutionStateInterpretedCpp::luaL_ref_Checked(lua))
             , m_lua(lua)
+            , m_behaviorContext(AZ::ScriptContext::FromNativeContext(lua)->GetBoundContext())
+            , m_callPlan(callPlan)
         {
         }
 
@@ -118,6 +132,9 @@ namespace ScriptCanvas
             source.m_lambdaRegistryIndex = LUA_NOREF;
             m_lua = source.m_lua;
             source.m_lua = nullptr;
+            m_behaviorContext = source.m_behaviorContext;
+            m_callPlan = source.m_callPlan;
+            source.m_callPlan = nullptr;
             return *this;
         }
 
@@ -125,14 +142,20 @@ namespace ScriptCanvas
         {
             AZ_Assert(resultBVP && resultBVP->m_value, "This function is only expected for BehaviorConext bound event handling, and will always have a location for a return value");
 
-            auto behaviorContext = AZ::ScriptContext::FromNativeContext(m_lua)->GetBoundContext();
             // Lua:
             lua_rawgeti(m_lua, LUA_REGISTRYINDEX, m_lambdaRegistryIndex);
             // Lua: lambda
 
-            for (int i = 0; i < numArguments; ++i)
+            if (m_callPlan)
+            {
+                m_callPlan->PushArguments(m_lua, m_behaviorContext, argsBVPs, numArguments);
+            }
+            else
             {
-                Execution::StackPush(m_lua, behaviorContext, argsBVPs[i]);
+                for (int i = 0; i < numArguments; ++i)
+                {
+                    Execution::StackPush(m_lua, m_behaviorContext, argsBVPs[i]);
+                }
             }
             // Lua: lambda, args...
             const int result = InterpretedSafeCall(m_lua, numArguments, 1);
@@ -145,7 +168,14 @@ namespace ScriptCanvas
             else
             {
                 // Lua: result
-                Execution::StackRead(m_lua, behaviorContext, -1, *resultBVP, nullptr);
+                if (m_callPlan)
+                {
+                    m_callPlan->ReadResult(m_lua, m_behaviorContext, -1, *resultBVP);
+                }
+                else
+                {
+                    Execution::StackRead(m_lua, m_behaviorContext, -1, *resultBVP, nullptr);
+                }
                 lua_pop(m_lua, 1);
             }
             // Lua:
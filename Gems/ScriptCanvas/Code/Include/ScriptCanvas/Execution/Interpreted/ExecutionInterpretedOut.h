@@ -15,6 +15,7 @@ struct lua_State;
 
 namespace AZ
 {
+    class BehaviorContext;
     struct BehaviorValueParameter;
 }
 
@@ -22,6 +23,8 @@ namespace ScriptCanvas
 {
     namespace Execution
     {
+        struct EventCallPlan;
+
         struct OutInterpreted
         {
             AZ_TYPE_INFO(OutInterpreted, "{171EC052-7A51-42FB-941C-CFF0F78F9373}");
@@ -29,9 +32,12 @@ namespace ScriptCanvas
 
             int m_lambdaRegistryIndex;
             lua_State* m_lua;
+            AZ::BehaviorContext* m_behaviorContext = nullptr;
+            // optional, shared by all handlers of the same event in a graph asset
+            EventCallPlan* m_callPlan = nullptr;
 
             // assumes a lambda is at the top of the stack and will pop it
-            OutInterpreted(lua_State* lua);
+            OutInterpreted(lua_State* lua, EventCallPlan* callPlan = nullptr);
 
             OutInterpreted(OutInterpreted&& source) noexcept;
 
@@ -53,9 +59,12 @@ namespace ScriptCanvas
 
             int m_lambdaRegistryIndex;
             lua_State* m_lua;
+            AZ::BehaviorContext* m_behaviorContext = nullptr;
+            // optional, shared by all handlers of the same event in a graph asset
+            EventCallPlan* m_callPlan = nullptr;
             
             // assumes a lambda is at the top of the stack and will pop it
-            OutInterpretedResult(lua_State* lua);
+            OutInterpretedResult(lua_State* lua, EventCallPlan* callPlan = nullptr);
 
             OutInterpretedResult(OutInterpretedResult&& source) noexcept;
 
@@ -12,6 +12,7 @@
 #include <ScriptCanvas/Grammar/PrimitivesDeclarations.h>
 
 #include "Execution/Interpreted/ExecutionInterpretedAPI.h"
+#include "Execution/NativeHostDefinitions.h"
 #include "Execution/RuntimeComponent.h"
 
 namespace ScriptCanvas
@@ -40,11 +41,24 @@ namespace ScriptCanvas
 
     ExecutionStateInterpretedPureOnGraphStart::ExecutionStateInterpretedPureOnGraphStart(const ExecutionStateConfig& config)
         : ExecutionStateInterpretedPure(config)
-    {}
+    {
+        // generated native graphs register their start function under the source asset id
+        AZStd::string nativeGraphName = config.asset.GetId().m_guid.ToString<AZStd::string>();
+        if (IsNativeGraphRegistered(nativeGraphName))
+        {
+            m_nativeGraphName = AZStd::move(nativeGraphName);
+        }
+    }
 
     // #functions2 dependency - ctor - args adjust for (pure only) on graph start args
     void ExecutionStateInterpretedPureOnGraphStart::Execute()
     {
+        if (!m_nativeGraphName.empty())
+        {
+            CallNativeGraphStart(m_nativeGraphName, RuntimeContext(m_component->GetEntityId()));
+            return;
+        }
+
         // execute the script in a single call
         auto lua = LoadLuaScript();
         // Lua: graph_VM
@@ -42,5 +42,9 @@ namespace ScriptCanvas
         ExecutionStateInterpretedPureOnGraphStart(const ExecutionStateConfig& config);
 
         void Execute() override;
+
+    private:
+        // the key of the natively compiled start function of this graph, empty if the graph was not compiled to C++
+        AZStd::string m_nativeGraphName;
     };
 } 
@@ -7,7 +7,12 @@
  */
 
 #include "NativeHostDefinitions.h"
+
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <ScriptCanvas/Core/Datum.h>
 
 namespace NativeHostDefinitionsCPP
 {
@@ -33,6 +38,13 @@ namespace ScriptCanvas
         return false;
     }
 
+    bool IsNativeGraphRegistered(AZStd::string_view name)
+    {
+        using namespace NativeHostDefinitionsCPP;
+
+        return s_functionMap.find(name) != s_functionMap.end();
+    }
+
     bool RegisterNativeGraphStart(AZStd::string_view name, GraphStartFunction function)
     {
         using namespace NativeHostDefinitionsCPP;
@@ -62,4 +74,90 @@ namespace ScriptCanvas
         return false;
     }
 
+    const AZ::BehaviorMethod* FindNativeMethod(AZStd::string_view className, AZStd::string_view methodName)
+    {
+        AZ::BehaviorContext* behaviorContext(nullptr);
+        AZ::ComponentApplicationBus::BroadcastResult(behaviorContext, &AZ::ComponentApplicationRequests::GetBehaviorContext);
+        if (!behaviorContext)
+        {
+            AZ_Error("ScriptCanvas", false, "BehaviorContext is required to resolve native method %.*s", aznumeric_cast<int>(methodName.size()), methodName.data());
+            return nullptr;
+        }
+
+        const AZStd::unordered_map<AZStd::string, AZ::BehaviorMethod*>* methods = &behaviorContext->m_methods;
+
+        if (!className.empty())
+        {
+            auto classIter = behaviorContext->m_classes.find(className);
+            if (classIter == behaviorContext->m_classes.end())
+            {
+                AZ_Error("ScriptCanvas", false, "No class by name of %.*s found in the BehaviorContext", aznumeric_cast<int>(className.size()), className.data());
+                return nullptr;
+            }
+
+            methods = &classIter->second->m_methods;
+        }
+
+        auto methodIter = methods->find(methodName);
+        if (methodIter == methods->end())
+        {
+            AZ_Error("ScriptCanvas", false, "No method by name of %.*s found in the BehaviorContext", aznumeric_cast<int>(methodName.size()), methodName.data());
+            return nullptr;
+        }
+
+        return methodIter->second;
+    }
+
+    bool CallNativeMethod(const AZ::BehaviorMethod* method, AZStd::initializer_list<const Datum*> inputs, Datum* result)
+    {
+        if (!method)
+        {
+            return false;
+        }
+
+        if (inputs.size() != method->GetNumArguments() || inputs.size() > k_maxNativeMethodArguments)
+        {
+            AZ_Error("ScriptCanvas", false, "Native call of %s supplied %zu arguments, expected %zu", method->m_name.c_str(), inputs.size(), method->GetNumArguments());
+            return false;
+        }
+
+        AZStd::fixed_vector<AZ::BehaviorValueParameter, k_maxNativeMethodArguments> parameters;
+
+        size_t argumentIndex = 0;
+        for (const Datum* input : inputs)
+        {
+            auto parameter = input->ToBehaviorValueParameter(*method->GetArgument(argumentIndex++));
+            if (!parameter.IsSuccess())
+            {
+                AZ_Error("ScriptCanvas", false, "Native call of %s failed: %s", method->m_name.c_str(), parameter.GetError().c_str());
+                return false;
+            }
+
+            parameters.push_back(parameter.GetValue());
+        }
+
+        const unsigned int parameterCount = aznumeric_cast<unsigned int>(parameters.size());
+
+        if (result && method->HasResult())
+        {
+            auto outcome = Datum::CallBehaviorContextMethodResult(method, method->GetResult(), parameters.data(), parameterCount, method->m_name);
+            if (!outcome.IsSuccess())
+            {
+                AZ_Error("ScriptCanvas", false, "%s", outcome.GetError().c_str());
+                return false;
+            }
+
+            *result = outcome.TakeValue();
+            return true;
+        }
+
+        auto outcome = Datum::CallBehaviorContextMethod(method, parameters.data(), parameterCount);
+        if (!outcome.IsSuccess())
+        {
+            AZ_Error("ScriptCanvas", false, "%s", outcome.GetError().c_str());
+            return false;
+        }
+
+        return true;
+    }
 }
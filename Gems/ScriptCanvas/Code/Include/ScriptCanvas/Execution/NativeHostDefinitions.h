@@ -6,19 +6,43 @@
  *
  */
 
+#pragma once
+
+#include <AzCore/std/containers/initializer_list.h>
+#include <AzCore/std/string/string_view.h>
+
 #include "NativeHostDeclarations.h"
 
+namespace AZ
+{
+    class BehaviorMethod;
+}
+
 namespace ScriptCanvas
 {
+    class Datum;
+
     typedef void (*GraphStartFunction)(const RuntimeContext&);
 
     using GraphStartFunction = void(*)(const RuntimeContext&);
 
+    // the maximum number of arguments a generated native graph can pass to a single BehaviorContext method
+    constexpr size_t k_maxNativeMethodArguments = 16;
+
     bool CallNativeGraphStart(AZStd::string_view name, const RuntimeContext& context);
-    
+
+    bool IsNativeGraphRegistered(AZStd::string_view name);
+
     bool RegisterNativeGraphStart(AZStd::string_view name, GraphStartFunction function);
     
     // this may never have to be necessary
     bool UnregisterNativeGraphStart(AZStd::string_view name);
 
+    // Resolves a BehaviorContext method for generated native graphs. The generated code caches the result in a function local static,
+    // so the lookup is only paid on the first execution. An empty className looks up a global method.
+    const AZ::BehaviorMethod* FindNativeMethod(AZStd::string_view className, AZStd::string_view methodName);
+
+    // Calls a resolved BehaviorContext method directly, without the interpreted marshalling through Lua.
+    // The optional result is written into result, if the method has one.
+    bool CallNativeMethod(const AZ::BehaviorMethod* method, AZStd::initializer_list<const Datum*> inputs, Datum* result = nullptr);
 }
@@ -18,6 +18,7 @@ namespace ScriptCanvas
         AZ_CVAR(bool, g_processingErrorsForUnitTestsEnabled, false, {}, AZ::ConsoleFunctorFlags::Null, "Enable AP processing errors on parse failure for unit tests.");
         AZ_CVAR(bool, g_saveRawTranslationOuputToFile, true, {}, AZ::ConsoleFunctorFlags::Null, "Save out the raw result of translation for debug purposes.");
         AZ_CVAR(bool, g_saveRawTranslationOuputToFileAtPrefabTime, false, {}, AZ::ConsoleFunctorFlags::Null, "Save out the raw result of translation (at prefab time) for debug purposes.");
+        AZ_CVAR(bool, g_translateToNativeCpp, false, {}, AZ::ConsoleFunctorFlags::Null, "Also translate pure graphs to C++, saved with the raw translation output, for compiling into a native module.");
 
         SettingsCache::SettingsCache()
         {
@@ -26,6 +27,7 @@ namespace ScriptCanvas
             m_printAbstractCodeModelAtPrefabTime = g_printAbstractCodeModelAtPrefabTime;
             m_saveRawTranslationOuputToFile = g_saveRawTranslationOuputToFile;
             m_saveRawTranslationOuputToFileAtPrefabTime = g_saveRawTranslationOuputToFileAtPrefabTime;
+            m_translateToNativeCpp = g_translateToNativeCpp;
         }
 
         SettingsCache::~SettingsCache()
@@ -35,6 +37,7 @@ namespace ScriptCanvas
             g_printAbstractCodeModelAtPrefabTime = m_printAbstractCodeModelAtPrefabTime;
             g_saveRawTranslationOuputToFile = m_saveRawTranslationOuputToFile;
             g_saveRawTranslationOuputToFileAtPrefabTime = m_saveRawTranslationOuputToFileAtPrefabTime;
+            g_translateToNativeCpp = m_translateToNativeCpp;
         }
     }
 }
@@ -248,6 +248,7 @@ namespace ScriptCanvas
         AZ_CVAR_EXTERNED(bool, g_processingErrorsForUnitTestsEnabled);
         AZ_CVAR_EXTERNED(bool, g_saveRawTranslationOuputToFile);
         AZ_CVAR_EXTERNED(bool, g_saveRawTranslationOuputToFileAtPrefabTime);
+        AZ_CVAR_EXTERNED(bool, g_translateToNativeCpp);
 
         class SettingsCache
         {
@@ -263,6 +264,7 @@ namespace ScriptCanvas
             bool m_printAbstractCodeModelAtPrefabTime;
             bool m_saveRawTranslationOuputToFile;
             bool m_saveRawTranslationOuputToFileAtPrefabTime;
+            bool m_translateToNativeCpp;
         };
 
         struct DependencyInfo
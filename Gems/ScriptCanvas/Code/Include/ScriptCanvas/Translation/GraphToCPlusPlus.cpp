@@ -8,8 +8,73 @@
 
 #include "GraphToCPlusPlus.h"
 
+#include <AzCore/std/optional.h>
+#include <ScriptCanvas/Core/Node.h>
+#include <ScriptCanvas/Debugger/ValidationEvents/GraphTranslationValidation/GraphTranslationValidations.h>
+#include <ScriptCanvas/Debugger/ValidationEvents/ParsingValidation/ParsingValidations.h>
 #include <ScriptCanvas/Grammar/AbstractCodeModel.h>
+#include <ScriptCanvas/Grammar/ParsingUtilities.h>
 #include <ScriptCanvas/Grammar/Primitives.h>
+#include <ScriptCanvas/Grammar/PrimitivesExecution.h>
+
+namespace GraphToCPlusPlusCpp
+{
+    AZStd::string ToStringLiteral(AZStd::string_view value)
+    {
+        AZStd::string literal = "\"";
+
+        for (char character : value)
+        {
+            switch (character)
+            {
+            case '\"':
+                literal += "\\\"";
+                break;
+            case '\\':
+                literal += "\\\\";
+                break;
+            case '\n':
+                literal += "\\n";
+                break;
+            case '\r':
+                literal += "\\r";
+                break;
+            case '\t':
+                literal += "\\t";
+                break;
+            default:
+                literal += character;
+                break;
+            }
+        }
+
+        literal += "\"";
+        return literal;
+    }
+
+    // returns the constructor argument of a Datum that holds the same value as the source, or nothing if the type can't be written as a literal
+    AZStd::optional<AZStd::string> ToNativeInitializer(const ScriptCanvas::Datum& datum)
+    {
+        using namespace ScriptCanvas;
+
+        const Data::Type type = datum.GetType();
+
+        if (type == Data::Type::Number())
+        {
+            return AZStd::string::format("Data::NumberType(%.17g)", *datum.GetAs<Data::NumberType>());
+        }
+        else if (type == Data::Type::Boolean())
+        {
+            return AZStd::string(*datum.GetAs<Data::BooleanType>() ? "true" : "false");
+        }
+        else if (type == Data::Type::String())
+        {
+            return AZStd::string::format("Data::StringType(%s)", ToStringLiteral(*datum.GetAs<Data::StringType>()).c_str());
+        }
+
+        return AZStd::nullopt;
+    }
+}
 
 namespace ScriptCanvas
 {
@@ -20,6 +85,7 @@ namespace ScriptCanvas
             Configuration configuration;
             configuration.m_blockCommentClose = "*/";
             configuration.m_blockCommentOpen = "/*";
+            configuration.m_lexicalScopeDelimiter = ".";
             configuration.m_namespaceClose = "}";
             configuration.m_namespaceOpen = "{";
             configuration.m_namespaceOpenPrefix = "namespace";
@@ -30,45 +96,138 @@ namespace ScriptCanvas
         }
 
         GraphToCPlusPlus::GraphToCPlusPlus(const Grammar::AbstractCodeModel& model)
-            : GraphToX(CreateCPlusPluseConfig(), model) 
+            : GraphToX(CreateCPlusPluseConfig(), model)
         {
-            WriteHeaderDotH();
-            WriteHeaderDotCPP();
-            
-            TranslateDependenciesDotH();
-            TranslateDependenciesDotCPP();
-                        
-            TranslateNamespaceOpen();
+            MarkTranslationStart();
+
+            if (CheckNativeSupport())
             {
-                TranslateClassOpen();
+                WriteHeader();
+                TranslateDependencies();
+
+                TranslateNamespaceOpen();
                 {
-                    TranslateVariables();
-                    TranslateHandlers();
-                    TranslateConstruction();
-                    TranslateDestruction();
-                    TranslateStartNode();
+                    TranslateClassOpen();
+                    {
+                        TranslateStartNode();
+                    }
+                    TranslateClassClose();
+                    TranslateRegistration();
                 }
-                TranslateClassClose();
+                TranslateNamespaceClose();
             }
-            TranslateNamespaceClose();
+
+            MarkTranslationStop();
         }
 
-        AZ::Outcome<void, AZStd::pair<AZStd::string, AZStd::string>> GraphToCPlusPlus::Translate(const Grammar::AbstractCodeModel& model, AZStd::string& dotH, AZStd::string& dotCPP)
+        AZ::Outcome<AZStd::pair<TargetResult, TargetResult>, ErrorList> GraphToCPlusPlus::Translate(const Grammar::AbstractCodeModel& model)
         {
             GraphToCPlusPlus translation(model);
 
             if (translation.IsSuccessfull())
             {
-                dotH = AZStd::move(translation.m_dotH.MoveOutput());
-                dotCPP = AZStd::move(translation.m_dotCPP.MoveOutput());
-                return AZ::Success();
+                TargetResult dotH;
+                dotH.m_text = translation.m_dotH.MoveOutput();
+                dotH.m_subgraphInterface = model.GetInterface();
+                dotH.m_duration = translation.GetTranslationDuration();
+
+                TargetResult dotCPP;
+                dotCPP.m_text = translation.m_dotCPP.MoveOutput();
+                dotCPP.m_runtimeInputs.CopyFrom(model.GetRuntimeInputs());
+                dotCPP.m_runtimeInputs.m_executionSelection = Grammar::ExecutionStateSelection::InterpretedPureOnGraphStart;
+                dotCPP.m_debugMap = model.GetDebugMap();
+                dotCPP.m_subgraphInterface = model.GetInterface();
+                dotCPP.m_duration = translation.GetTranslationDuration();
+
+                return AZ::Success(AZStd::make_pair(AZStd::move(dotH), AZStd::move(dotCPP)));
             }
             else
             {
-                return AZ::Failure(AZStd::make_pair(AZStd::string(".h errors"), AZStd::string(".cpp errors")));
+                return AZ::Failure(translation.MoveErrors());
             }
         }
 
+        bool GraphToCPlusPlus::CheckNativeSupport()
+        {
+            // Native translation currently covers pure graphs that execute once on graph start. Everything else stays on the
+            // interpreted path until the native runtime supports per-entity state, handlers and nodeables.
+            auto reject = [this](const char* reason)
+            {
+                AddError(nullptr, aznew Internal::ParseError(AZ::EntityId(), AZStd::string::format("Native translation unsupported: %s", reason)));
+                return false;
+            };
+
+            if (m_model.GetExecutionCharacteristics() != Grammar::ExecutionCharacteristics::Pure || m_model.IsPerEntityDataRequired())
+            {
+                return reject("the graph requires per-entity data");
+            }
+
+            if (!m_model.GetStart())
+            {
+                return reject("the graph has no OnGraphStart");
+            }
+
+            if (!m_model.GetFunctions().empty() || m_model.IsUserNodeable())
+            {
+                return reject("the graph defines functions");
+            }
+
+            if (!m_model.GetEBusHandlings().empty() || !m_model.GetEventHandlings().empty())
+            {
+                return reject("the graph handles events");
+            }
+
+            if (!m_model.GetNodeableParse().empty())
+            {
+                return reject("the graph contains nodeables");
+            }
+
+            if (!m_model.GetStaticVariablesNames().empty())
+            {
+                return reject("the graph requires static initialization");
+            }
+
+            // the native start function receives only the RuntimeContext, not the activation arguments the interpreted start is given
+            const Grammar::ParsedRuntimeInputs& runtimeInputs = m_model.GetRuntimeInputs();
+            if (!runtimeInputs.m_variables.empty() || !runtimeInputs.m_entityIds.empty())
+            {
+                return reject("the graph requires construction input");
+            }
+
+            if (!m_model.GetOrderedDependencies().source.userSubgraphs.empty())
+            {
+                return reject("the graph depends on other graphs");
+            }
+
+            return true;
+        }
+
+        AZStd::string GraphToCPlusPlus::MoveLiteral(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr input)
+        {
+            const bool isNamed = input->m_source != execution || input->m_requiresCreationFunction;
+
+            if (isNamed)
+            {
+                if (input->m_isMember)
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), "Native translation unsupported: member variable input"));
+                }
+
+                return input->m_name;
+            }
+
+            auto initializer = GraphToCPlusPlusCpp::ToNativeInitializer(input->m_datum);
+            if (!initializer)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), AZStd::string::format("Native translation unsupported: literal input of type %s", Data::GetName(input->m_datum.GetType()).c_str())));
+                return {};
+            }
+
+            AZStd::string literalName = AZStd::string::format("literal_%zu", m_literalCount++);
+            m_dotCPP.WriteLineIndented("const Datum %s(%s);", literalName.c_str(), initializer->c_str());
+            return literalName;
+        }
+
         void GraphToCPlusPlus::TranslateClassClose()
         {
             m_dotH.Outdent();
@@ -89,11 +248,6 @@ namespace ScriptCanvas
             m_dotH.Indent();
         }
 
-        void GraphToCPlusPlus::TranslateConstruction()
-        {
-
-        }
-
         void GraphToCPlusPlus::TranslateDependencies()
         {
             TranslateDependenciesDotH();
@@ -102,22 +256,170 @@ namespace ScriptCanvas
 
         void GraphToCPlusPlus::TranslateDependenciesDotH()
         {
-
+            m_dotH.WriteLine("#include <ScriptCanvas/Execution/NativeHostDeclarations.h>");
+            m_dotH.WriteNewLine();
         }
 
         void GraphToCPlusPlus::TranslateDependenciesDotCPP()
         {
-
+            m_dotCPP.WriteLine("#include <ScriptCanvas/Core/Datum.h>");
+            m_dotCPP.WriteLine("#include <ScriptCanvas/Execution/NativeHostDefinitions.h>");
+            m_dotCPP.WriteNewLine();
         }
 
-        void GraphToCPlusPlus::TranslateDestruction()
+        void GraphToCPlusPlus::TranslateExecutionTreeEntry(Grammar::ExecutionTreeConstPtr execution)
         {
+            switch (execution->GetSymbol())
+            {
+            case Grammar::Symbol::FunctionCall:
+            case Grammar::Symbol::VariableAssignment:
+                TranslateExecutionTreeFunctionCall(execution);
+                break;
+
+            case Grammar::Symbol::VariableDeclaration:
+                WriteVariableDeclaration(execution->GetInput(0).m_value);
+                break;
+
+            case Grammar::Symbol::IfCondition:
+            {
+                const AZStd::string condition = MoveLiteral(execution, execution->GetInput(0).m_value);
+                m_dotCPP.WriteLineIndented("if (*%s.GetAs<Data::BooleanType>())", condition.c_str());
+
+                for (size_t childIndex = 0; childIndex < execution->GetChildrenCount(); ++childIndex)
+                {
+                    if (childIndex > 0)
+                    {
+                        m_dotCPP.WriteLineIndented("else");
+                    }
+
+                    OpenScope(m_dotCPP);
+                    const auto& child = execution->GetChild(childIndex);
+                    if (child.m_execution && !child.m_execution->IsInternalOut())
+                    {
+                        TranslateExecutionTreeEntry(child.m_execution);
+                    }
+                    CloseScope(m_dotCPP);
+                }
+                // the children have been written inside the branches
+                return;
+            }
+
+            default:
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId()
+                    , AZStd::string::format("Native translation unsupported: %s", Grammar::GetSymbolName(execution->GetSymbol()))));
+                return;
+            }
 
+            for (size_t childIndex = 0; childIndex < execution->GetChildrenCount(); ++childIndex)
+            {
+                const auto& child = execution->GetChild(childIndex);
+
+                if (child.m_execution && !child.m_execution->IsInternalOut())
+                {
+                    TranslateExecutionTreeEntry(child.m_execution);
+                }
+            }
         }
-                
-        void GraphToCPlusPlus::TranslateHandlers()
+
+        void GraphToCPlusPlus::TranslateExecutionTreeFunctionCall(Grammar::ExecutionTreeConstPtr execution)
         {
+            if (Grammar::IsUserFunctionCall(execution)
+            || Grammar::IsEventConnectCall(execution)
+            || Grammar::IsEventDisconnectCall(execution)
+            || Grammar::IsLogicalExpression(execution)
+            || Grammar::IsWrittenMathExpression(execution)
+            || Grammar::IsOperatorArithmetic(execution)
+            || Grammar::IsExecutedPropertyExtraction(execution)
+            || Grammar::IsGlobalPropertyRead(execution)
+            || Grammar::IsClassPropertyRead(execution)
+            || Grammar::IsClassPropertyWrite(execution)
+            || !execution->GetConversions().empty()
+            || execution->GetEventType() != EventType::Count
+            || execution->GetNameLexicalScope().m_type == Grammar::LexicalScopeType::Variable)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), AZStd::string::format("Native translation unsupported: call to %s", execution->GetName().c_str())));
+                return;
+            }
+
+            const AZStd::vector<AZStd::pair<const Slot*, Grammar::OutputAssignmentConstPtr>>* output = execution->GetChildrenCount() == 1 ? &execution->GetChild(0).m_output : nullptr;
+
+            if (output && output->size() > 1)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), "Native translation unsupported: multiple return values"));
+                return;
+            }
+
+            Grammar::OutputAssignmentConstPtr result = output && !output->empty() ? output->front().second : nullptr;
+
+            if (result)
+            {
+                if (result->m_source->m_isMember || !result->m_sourceConversions.empty())
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), "Native translation unsupported: output assignment"));
+                    return;
+                }
+
+                if (result->m_source->m_source == execution)
+                {
+                    m_dotCPP.WriteLineIndented("Datum %s;", result->m_source->m_name.c_str());
+                }
+            }
+
+            AZStd::vector<AZStd::string> inputs;
+            for (size_t inputIndex = 0; inputIndex < execution->GetInputCount(); ++inputIndex)
+            {
+                inputs.push_back(MoveLiteral(execution, execution->GetInput(inputIndex).m_value));
+            }
+
+            if (Grammar::IsVariableGet(execution) || Grammar::IsVariableSet(execution) || execution->GetSymbol() == Grammar::Symbol::VariableAssignment)
+            {
+                if (result && !inputs.empty())
+                {
+                    m_dotCPP.WriteLineIndented("%s = %s;", result->m_source->m_name.c_str(), inputs.front().c_str());
+                }
+            }
+            else
+            {
+                const AZStd::string name = execution->GetName();
+                if (name.empty())
+                {
+                    AddError(execution, aznew InvalidFunctionCallNameValidation(execution->GetId().m_node->GetEntityId(), execution->GetId().m_slot->GetId()));
+                    return;
+                }
 
+                const Grammar::LexicalScope& lexicalScope = execution->GetNameLexicalScope();
+                const AZStd::string className = lexicalScope.m_type == Grammar::LexicalScopeType::Class || lexicalScope.m_type == Grammar::LexicalScopeType::Namespace
+                    ? ResolveScope(lexicalScope.m_namespaces)
+                    : AZStd::string();
+
+                // the method is resolved once, on first execution, and called directly afterwards
+                const AZStd::string methodName = AZStd::string::format("s_method_%zu", m_methodCount++);
+                m_dotCPP.WriteLineIndented("static const AZ::BehaviorMethod* %s = FindNativeMethod(%s, %s);"
+                    , methodName.c_str()
+                    , GraphToCPlusPlusCpp::ToStringLiteral(className).c_str()
+                    , GraphToCPlusPlusCpp::ToStringLiteral(name).c_str());
+
+                m_dotCPP.WriteIndented("CallNativeMethod(%s, {", methodName.c_str());
+                for (size_t inputIndex = 0; inputIndex < inputs.size(); ++inputIndex)
+                {
+                    m_dotCPP.Write(inputIndex == 0 ? " &%s" : ", &%s", inputs[inputIndex].c_str());
+                }
+                m_dotCPP.WriteLine(inputs.empty() ? "}, %s%s);" : " }, %s%s);", result ? "&" : "nullptr", result ? result->m_source->m_name.c_str() : "");
+            }
+
+            if (result)
+            {
+                for (const auto& assignment : result->m_assignments)
+                {
+                    if (assignment->m_isMember)
+                    {
+                        AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), "Native translation unsupported: member variable assignment"));
+                        return;
+                    }
+
+                    m_dotCPP.WriteLineIndented("%s = %s;", assignment->m_name.c_str(), result->m_source->m_name.c_str());
+                }
+            }
         }
 
         void GraphToCPlusPlus::TranslateNamespaceOpen()
@@ -130,45 +432,53 @@ namespace ScriptCanvas
 
         void GraphToCPlusPlus::TranslateNamespaceClose()
         {
-            CloseNamespace(m_dotH, "ScriptCanvas");
             CloseNamespace(m_dotH, GetAutoNativeNamespace());
-            CloseNamespace(m_dotCPP, "ScriptCanvas");
+            CloseNamespace(m_dotH, "ScriptCanvas");
             CloseNamespace(m_dotCPP, GetAutoNativeNamespace());
+            CloseNamespace(m_dotCPP, "ScriptCanvas");
+        }
+
+        void GraphToCPlusPlus::TranslateRegistration()
+        {
+            // registration happens when the generated module is loaded, the runtime selects the native start function by the
+            // source asset id of the graph it is about to execute
+            m_dotCPP.WriteNewLine();
+            m_dotCPP.WriteLineIndented("static const bool s_%sRegistered = RegisterNativeGraphStart(%s, &%s::%s);"
+                , Grammar::ToIdentifier(GetGraphName()).c_str()
+                , GraphToCPlusPlusCpp::ToStringLiteral(m_model.GetSource().m_assetId.m_guid.ToString<AZStd::string>()).c_str()
+                , GetGraphName().data()
+                , Grammar::k_OnGraphStartFunctionName);
         }
 
         void GraphToCPlusPlus::TranslateStartNode()
         {
-            // write a start function
-            const Node* startNode = nullptr;
-            
-            if (startNode)
-            {
-                { // .h
-                    m_dotH.WriteIndent();
-                    m_dotH.WriteLine("public: static void %s(const RuntimeContext& context);", Grammar::k_OnGraphStartFunctionName);
-                }
-                
-                { // .cpp
-                    m_dotCPP.WriteIndent();
-                    m_dotCPP.WriteLine("void %s::%s(const RuntimeContext& context)", GetGraphName().data(), Grammar::k_OnGraphStartFunctionName);
-                    OpenScope(m_dotCPP);
+            Grammar::ExecutionTreeConstPtr start = m_model.GetStart();
+
+            { // .h
+                m_dotH.WriteLineIndented("public: static void %s(const RuntimeContext& context);", Grammar::k_OnGraphStartFunctionName);
+            }
+
+            { // .cpp
+                m_dotCPP.WriteLineIndented("void %s::%s([[maybe_unused]] const RuntimeContext& context)", GetGraphName().data(), Grammar::k_OnGraphStartFunctionName);
+                OpenScope(m_dotCPP);
+                {
+                    if (const auto localVariables = m_model.GetLocalVariables(start))
                     {
-                        m_dotCPP.WriteIndent();
-                        m_dotCPP.WriteLine("AZ_TracePrintf(\"ScriptCanvas\", \"This call wasn't generated from parsing a print node!\");");
-                        m_dotCPP.WriteLine("LogNotificationBus::Event(context.GetGraphId(), &LogNotifications::LogMessage, \"This call wasn't generated from parsing a print node!\");");
-                        // get the related function call and call it
-                        // with possible appropriate variables
+                        for (const auto& variable : *localVariables)
+                        {
+                            WriteVariableDeclaration(variable);
+                        }
+                    }
+
+                    if (start->GetChildrenCount() > 0 && start->GetChild(0).m_execution)
+                    {
+                        TranslateExecutionTreeEntry(start->GetChild(0).m_execution);
                     }
-                    CloseScope(m_dotCPP);
                 }
+                CloseScope(m_dotCPP);
             }
         }
 
-        void GraphToCPlusPlus::TranslateVariables()
-        {
-
-        }
-
         void GraphToCPlusPlus::WriteHeader()
         {
             WriteHeaderDotH();
@@ -193,9 +503,20 @@ namespace ScriptCanvas
             m_dotH.WriteNewLine();
             WriteDoNotModify(m_dotH);
             m_dotH.WriteNewLine();
-            m_dotH.WriteLine("#include <Execution/NativeHostDeclarations.h>");
-            m_dotH.WriteNewLine();
         }
 
-    } 
-} 
+        void GraphToCPlusPlus::WriteVariableDeclaration(Grammar::VariableConstPtr variable)
+        {
+            auto initializer = GraphToCPlusPlusCpp::ToNativeInitializer(variable->m_datum);
+            if (!initializer)
+            {
+                AddError(nullptr, aznew Internal::ParseError(AZ::EntityId(), AZStd::string::format("Native translation unsupported: variable %s of type %s"
+                    , variable->m_name.c_str(), Data::GetName(variable->m_datum.GetType()).c_str())));
+                return;
+            }
+
+            m_dotCPP.WriteLineIndented("Datum %s(%s);", variable->m_name.c_str(), initializer->c_str());
+        }
+
+    }
+}
@@ -10,6 +10,9 @@
 
 #include <AzCore/Outcome/Outcome.h>
 
+#include <ScriptCanvas/Grammar/PrimitivesDeclarations.h>
+
+#include "TranslationResult.h"
 #include "TranslationUtilities.h"
 #include "GraphToX.h"
 
@@ -24,37 +27,43 @@ namespace ScriptCanvas
 
     namespace Translation
     {
+        // Translates pure graphs into native C++ that calls the resolved AZ::BehaviorMethod targets directly,
+        // bypassing the Lua VM. Any construct that isn't supported natively is reported as an error,
+        // which leaves the graph on the interpreted (Lua) path.
         class GraphToCPlusPlus
             : public GraphToX
         {
         public:
-            static AZ::Outcome<void, AZStd::pair<AZStd::string, AZStd::string>> Translate(const Grammar::AbstractCodeModel& model, AZStd::string& dotH, AZStd::string& dotCPP);
-            
-            AZ_INLINE bool IsSuccessfull() const { return false;  }
-        private:         
+            // on success, the first result is the .h, the second the .cpp
+            static AZ::Outcome<AZStd::pair<TargetResult, TargetResult>, ErrorList> Translate(const Grammar::AbstractCodeModel& model);
+
+        private:
             // cpp only
             Writer m_dotH;
             Writer m_dotCPP;
-            
+            size_t m_methodCount = 0;
+            size_t m_literalCount = 0;
+
             GraphToCPlusPlus(const Grammar::AbstractCodeModel& model);
 
+            bool CheckNativeSupport();
+            AZStd::string MoveLiteral(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr input);
             void TranslateClassClose();
             void TranslateClassOpen();
-            void TranslateConstruction();
             void TranslateDependencies();
             void TranslateDependenciesDotH();
             void TranslateDependenciesDotCPP();
-            void TranslateDestruction();
-            void TranslateFunctions();
-            void TranslateHandlers();
+            void TranslateExecutionTreeEntry(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeFunctionCall(Grammar::ExecutionTreeConstPtr execution);
             void TranslateNamespaceOpen();
             void TranslateNamespaceClose();
+            void TranslateRegistration();
             void TranslateStartNode();
-            void TranslateVariables();
             void WriteHeader(); // Write, not translate, because this should be less dependent on the contents of the graph
             void WriteHeaderDotH(); // Write, not translate, because this should be less dependent on the contents of the graph
             void WriteHeaderDotCPP(); // Write, not translate, because this should be less dependent on the contents of the graph
+            void WriteVariableDeclaration(Grammar::VariableConstPtr variable);
         };
-    } 
+    }
 
 }
@@ -27,40 +27,39 @@ namespace TranslationCPP
     using namespace ScriptCanvas;
     using namespace ScriptCanvas::Translation;
 
-    /*
-    AZ::Outcome<AZStd::pair<AZStd::string, AZStd::string>, AZStd::pair<AZStd::string, AZStd::string>> ToCPlusPlus(const Grammar::AbstractCodeModel& model, bool rawSave = false)
+    AZ::Outcome<AZStd::pair<TargetResult, TargetResult>, ErrorList> ToCPlusPlus(const Grammar::AbstractCodeModel& model, bool rawSave = false)
     {
-        AZStd::string dotH, dotCPP;
-        auto outcome = GraphToCPlusPlus::Translate(model, dotH, dotCPP);
+        auto outcome = GraphToCPlusPlus::Translate(model);
         if (outcome.IsSuccess())
         {
+            auto& dotHAndDotCPP = outcome.GetValue();
 #if defined(SCRIPT_CANVAS_PRINT_FILES_CONSOLE)
             AZ_TracePrintf("ScriptCanvas", "\n\n *** .h file ***\n\n");
-            AZ_TracePrintf("ScriptCanvas", dotH.data());
+            AZ_TracePrintf("ScriptCanvas", dotHAndDotCPP.first.m_text.data());
             AZ_TracePrintf("ScriptCanvas", "\n\n *** .cpp file *\n\n");
-            AZ_TracePrintf("ScriptCanvas", dotCPP.data());
+            AZ_TracePrintf("ScriptCanvas", dotHAndDotCPP.second.m_text.data());
             AZ_TracePrintf("ScriptCanvas", "\n\n");
 #endif
             if (rawSave)
             {
-                auto saveOutcome = SaveDotH(model.GetSource(), dotH);
+                auto saveOutcome = SaveDotH(model.GetSource(), dotHAndDotCPP.first.m_text);
                 if (saveOutcome.IsSuccess())
                 {
-                    saveOutcome = SaveDotCPP(model.GetSource(), dotCPP);
+                    saveOutcome = SaveDotCPP(model.GetSource(), dotHAndDotCPP.second.m_text);
                 }
                 if (!saveOutcome.IsSuccess())
                 {
                     AZ_TracePrintf("Save failed %s", saveOutcome.GetError().data());
                 }
             }
-            return AZ::Success(AZStd::make_pair(AZStd::move(dotH), AZStd::move(dotCPP)));
+
+            return AZ::Success(outcome.TakeValue());
         }
         else
         {
             return AZ::Failure(outcome.TakeError());
         }
     }
-    */
 
     AZ::Outcome<TargetResult, ErrorList> ToLua(const Grammar::AbstractCodeModel& model, bool rawSave = false)
     {
@@ -134,32 +133,24 @@ namespace ScriptCanvas
                     }
                 }
 
-                // Translation to C++ (executed via BehaviorContext calls) has been demonstrated in the past and is partially in progress.
-                // These calls allow for users to execute multiple translations from the same abstract code model.
-                // More work is required to complete all the latest features of the ACM, and do integrate output files into the build.
-                // 
-                //                 if (targetFlags & (TargetFlags::Cpp | TargetFlags::Hpp))
-                //                 {
-                //                     auto outcomeCPP = TranslationCPP::ToCPlusPlus(*model.get(), rawSave);
-                //                     if (outcomeCPP.IsSuccess())
-                //                     {
-                //                         auto hppAndCpp = outcomeCPP.TakeValue();
-                //                         
-                //                         TargetResult cppResult;
-                //                         cppResult.m_text = AZStd::move(hppAndCpp.first);
-                //                         translations.emplace(TargetFlags::Hpp, AZStd::move(cppResult));
-                //                         TargetResult hppResult;
-                //                         hppResult.m_text = AZStd::move(hppAndCpp.second);
-                //                         translations.emplace(TargetFlags::Cpp, AZStd::move(hppResult));
-                //                     }
-                //                     else
-                //                     {
-                //                         auto hppAndCpp = outcomeCPP.TakeError();
-                //                         errors.emplace(TargetFlags::Hpp, AZStd::move(hppAndCpp.first));
-                //                         errors.emplace(TargetFlags::Cpp, AZStd::move(hppAndCpp.second));
-                //                     }
-                //                 }
-
+                // Translation to C++ calls the BehaviorContext methods directly. Graphs that use constructs the native
+                // translation doesn't support yet report errors for the Cpp/Hpp targets, and remain on the Lua path.
+                if (request.translationTargetFlags & (TargetFlags::Cpp | TargetFlags::Hpp))
+                {
+                    auto outcomeCPP = TranslationCPP::ToCPlusPlus(*model.get(), request.rawSaveDebugOutput);
+                    if (outcomeCPP.IsSuccess())
+                    {
+                        auto dotHAndDotCPP = outcomeCPP.TakeValue();
+                        translations.emplace(TargetFlags::Hpp, AZStd::move(dotHAndDotCPP.first));
+                        translations.emplace(TargetFlags::Cpp, AZStd::move(dotHAndDotCPP.second));
+                    }
+                    else
+                    {
+                        auto errorList = outcomeCPP.TakeError();
+                        errors.emplace(TargetFlags::Hpp, errorList);
+                        errors.emplace(TargetFlags::Cpp, AZStd::move(errorList));
+                    }
+                }
             }
 
             return Result(model, AZStd::move(translations), AZStd::move(errors));
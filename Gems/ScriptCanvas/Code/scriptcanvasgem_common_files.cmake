@@ -72,6 +72,7 @@ set(FILES
     Include/ScriptCanvas/Execution/NativeHostDefinitions.cpp
     Include/ScriptCanvas/Execution/RuntimeComponent.cpp
     Include/ScriptCanvas/Execution/Interpreted/ExecutionInterpretedAPI.cpp
+    Include/ScriptCanvas/Execution/Interpreted/ExecutionInterpretedCallPlans.cpp
     Include/ScriptCanvas/Execution/Interpreted/ExecutionInterpretedCloningAPI.cpp
     Include/ScriptCanvas/Execution/Interpreted/ExecutionInterpretedDebugAPI.cpp
     Include/ScriptCanvas/Execution/Interpreted/ExecutionInterpretedEBusAPI.cpp
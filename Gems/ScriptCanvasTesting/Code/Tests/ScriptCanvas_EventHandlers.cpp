@@ -6,12 +6,104 @@
  *
  */
 
+#include <AzCore/Script/ScriptContext.h>
+#include <AzCore/Script/lua/lua.h>
+#include <ScriptCanvas/Execution/Interpreted/ExecutionInterpretedCallPlans.h>
+#include <ScriptCanvas/Execution/Interpreted/ExecutionInterpretedOut.h>
 #include <Source/Framework/ScriptCanvasTestFixture.h>
 #include <Source/Framework/ScriptCanvasTestUtilities.h>
 
 using namespace ScriptCanvasTests;
 using namespace ScriptCanvas;
 
+namespace EventHandlersTestCPP
+{
+    struct RecordedArguments
+    {
+        double m_number = 0.0;
+        AZStd::string m_text;
+        bool m_flag = false;
+    };
+
+    // dispatches a handled event with a number, a string and a bool to the global Lua function RecordArguments
+    RecordedArguments DispatchRecordArguments(lua_State* lua, Execution::EventCallPlan* callPlan, double number, AZStd::string text, bool flag)
+    {
+        lua_getglobal(lua, "RecordArguments");
+        Execution::OutInterpreted out(lua, callPlan);
+
+        AZ::BehaviorValueParameter arguments[] = { AZ::BehaviorValueParameter(&number), AZ::BehaviorValueParameter(&text), AZ::BehaviorValueParameter(&flag) };
+        out(nullptr, arguments, 3);
+
+        RecordedArguments recorded;
+        lua_getglobal(lua, "recordedArguments");
+        lua_rawgeti(lua, -1, 1);
+        recorded.m_number = lua_tonumber(lua, -1);
+        lua_rawgeti(lua, -2, 2);
+        recorded.m_text = lua_tostring(lua, -1);
+        lua_rawgeti(lua, -3, 3);
+        recorded.m_flag = lua_toboolean(lua, -1) != 0;
+        lua_pop(lua, 4);
+        return recorded;
+    }
+
+    // dispatches a handled event that returns a number to the global Lua function ReturnDoubled
+    double DispatchReturnDoubled(lua_State* lua, Execution::EventCallPlan* callPlan, double value)
+    {
+        lua_getglobal(lua, "ReturnDoubled");
+        Execution::OutInterpretedResult out(lua, callPlan);
+
+        double result = 0.0;
+        AZ::BehaviorValueParameter resultBVP(&result);
+        AZ::BehaviorValueParameter argument(&value);
+        out(&resultBVP, &argument, 1);
+        return result;
+    }
+}
+
+TEST_F(ScriptCanvasTestFixture, EventCallPlan_HandledEventArguments_MatchUncachedDispatch)
+{
+    using namespace EventHandlersTestCPP;
+
+    AZ::ScriptContext scriptContext;
+    scriptContext.BindTo(m_behaviorContext);
+    ASSERT_TRUE(scriptContext.Execute("function RecordArguments(...) recordedArguments = { ... } end"));
+    lua_State* lua = scriptContext.GetNativeContext();
+
+    Execution::EventCallPlan callPlan;
+    const RecordedArguments uncached = DispatchRecordArguments(lua, nullptr, 3.5, "handled", true);
+    const RecordedArguments resolving = DispatchRecordArguments(lua, &callPlan, 3.5, "handled", true);
+    EXPECT_TRUE(callPlan.m_isArgumentsResolved);
+    EXPECT_EQ(callPlan.m_argumentPushers.size(), 3u);
+
+    EXPECT_DOUBLE_EQ(resolving.m_number, uncached.m_number);
+    EXPECT_EQ(resolving.m_text, uncached.m_text);
+    EXPECT_EQ(resolving.m_flag, uncached.m_flag);
+
+    // later dispatches reuse the resolved conversions with new values
+    const RecordedArguments cached = DispatchRecordArguments(lua, &callPlan, -2.0, "cached", false);
+    EXPECT_DOUBLE_EQ(cached.m_number, -2.0);
+    EXPECT_EQ(cached.m_text, "cached");
+    EXPECT_FALSE(cached.m_flag);
+    EXPECT_EQ(lua_gettop(lua), 0);
+}
+
+TEST_F(ScriptCanvasTestFixture, EventCallPlan_HandledEventResult_MatchesUncachedDispatch)
+{
+    using namespace EventHandlersTestCPP;
+
+    AZ::ScriptContext scriptContext;
+    scriptContext.BindTo(m_behaviorContext);
+    ASSERT_TRUE(scriptContext.Execute("function ReturnDoubled(value) return value * 2 end"));
+    lua_State* lua = scriptContext.GetNativeContext();
+
+    Execution::EventCallPlan callPlan;
+    EXPECT_DOUBLE_EQ(DispatchReturnDoubled(lua, nullptr, 4.0), 8.0);
+    EXPECT_DOUBLE_EQ(DispatchReturnDoubled(lua, &callPlan, 4.0), 8.0);
+    EXPECT_TRUE(callPlan.m_isResultResolved);
+    EXPECT_DOUBLE_EQ(DispatchReturnDoubled(lua, &callPlan, -1.5), -3.0);
+    EXPECT_EQ(lua_gettop(lua), 0);
+}
+
 TEST_F(ScriptCanvasTestFixture, StringMethodCStyle2CStyle)
 {
     RunUnitTestGraph("LY_SC_UnitTest_StringMethodCStyle2CStyle", ExecutionMode::Interpreted);
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <ScriptCanvas/Execution/NativeHostDefinitions.h>
+#include <ScriptCanvas/Libraries/Core/Start.h>
+#include <ScriptCanvas/Translation/Translation.h>
+#include <ScriptCanvas/Translation/TranslationResult.h>
+#include <Source/Framework/ScriptCanvasTestFixture.h>
+#include <Source/Framework/ScriptCanvasTestUtilities.h>
+
+using namespace ScriptCanvasTests;
+
+namespace NativeTranslationTestCPP
+{
+    struct NativeTranslationTestObject
+    {
+        AZ_TYPE_INFO(NativeTranslationTestObject, "{0F3E1B6A-7C52-4D8E-9A31-5B2C6E8D4F17}");
+
+        static double s_total;
+
+        static double Accumulate(double value)
+        {
+            s_total += value;
+            return s_total;
+        }
+
+        static void Reflect(AZ::BehaviorContext* behaviorContext)
+        {
+            if (behaviorContext->m_classes.find("NativeTranslationTestObject") == behaviorContext->m_classes.end())
+            {
+                behaviorContext->Class<NativeTranslationTestObject>("NativeTranslationTestObject")
+                    ->Method("Accumulate", &NativeTranslationTestObject::Accumulate)
+                    ;
+            }
+        }
+    };
+
+    double NativeTranslationTestObject::s_total = 0.0;
+
+    AZ::EntityId s_startedGraphId;
+    int s_startCount = 0;
+
+    void OnGraphStart(const ScriptCanvas::RuntimeContext& context)
+    {
+        s_startedGraphId = context.GetGraphId();
+        ++s_startCount;
+    }
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeGraphStart_RegisteredByName_CalledWithContextUntilUnregistered)
+{
+    using namespace NativeTranslationTestCPP;
+
+    const AZStd::string name = AZ::Uuid::CreateRandom().ToString<AZStd::string>();
+    s_startCount = 0;
+
+    EXPECT_FALSE(ScriptCanvas::IsNativeGraphRegistered(name));
+    EXPECT_TRUE(ScriptCanvas::RegisterNativeGraphStart(name, &OnGraphStart));
+    EXPECT_FALSE(ScriptCanvas::RegisterNativeGraphStart(name, &OnGraphStart));
+    EXPECT_TRUE(ScriptCanvas::IsNativeGraphRegistered(name));
+
+    const AZ::EntityId graphId(AZ::Entity::MakeId());
+    EXPECT_TRUE(ScriptCanvas::CallNativeGraphStart(name, ScriptCanvas::RuntimeContext(graphId)));
+    EXPECT_EQ(s_startCount, 1);
+    EXPECT_EQ(s_startedGraphId, graphId);
+
+    EXPECT_TRUE(ScriptCanvas::UnregisterNativeGraphStart(name));
+    EXPECT_FALSE(ScriptCanvas::IsNativeGraphRegistered(name));
+    EXPECT_FALSE(ScriptCanvas::CallNativeGraphStart(name, ScriptCanvas::RuntimeContext(graphId)));
+    EXPECT_EQ(s_startCount, 1);
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeMethod_FoundInBehaviorContext_CalledWithDatumArguments)
+{
+    using namespace NativeTranslationTestCPP;
+
+    NativeTranslationTestObject::Reflect(m_behaviorContext);
+    NativeTranslationTestObject::s_total = 1.0;
+
+    const AZ::BehaviorMethod* method = ScriptCanvas::FindNativeMethod("NativeTranslationTestObject", "Accumulate");
+    ASSERT_NE(method, nullptr);
+
+    const ScriptCanvas::Datum input(ScriptCanvas::Data::NumberType(2.0));
+    ScriptCanvas::Datum result;
+    EXPECT_TRUE(ScriptCanvas::CallNativeMethod(method, { &input }, &result));
+    ASSERT_NE(result.GetAs<ScriptCanvas::Data::NumberType>(), nullptr);
+    EXPECT_DOUBLE_EQ(*result.GetAs<ScriptCanvas::Data::NumberType>(), 3.0);
+
+    // a mismatched argument count is reported instead of calling the method
+    AZ_TEST_START_TRACE_SUPPRESSION;
+    EXPECT_FALSE(ScriptCanvas::CallNativeMethod(method, {}, &result));
+    AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    EXPECT_DOUBLE_EQ(NativeTranslationTestObject::s_total, 3.0);
+
+    AZ_TEST_START_TRACE_SUPPRESSION;
+    EXPECT_EQ(ScriptCanvas::FindNativeMethod("NativeTranslationTestObject", "Missing"), nullptr);
+    AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeTranslation_PureGraphOnGraphStart_TranslatesToRegisteredDirectCalls)
+{
+    using namespace NativeTranslationTestCPP;
+    using namespace ScriptCanvas;
+
+    NativeTranslationTestObject::Reflect(m_behaviorContext);
+
+    Graph* graph = nullptr;
+    SystemRequestBus::BroadcastResult(graph, &SystemRequests::MakeGraph);
+    ASSERT_NE(graph, nullptr);
+    graph->GetEntity()->Init();
+
+    const ScriptCanvasId& graphUniqueId = graph->GetScriptCanvasId();
+
+    AZ::EntityId startID;
+    CreateTestNode<Nodes::Core::Start>(graphUniqueId, startID);
+    const AZ::EntityId accumulateID = CreateClassFunctionNode(graphUniqueId, "NativeTranslationTestObject", "Accumulate");
+    EXPECT_TRUE(Connect(*graph, startID, "Out", accumulateID, "In"));
+
+    const AZ::Data::AssetId assetId(AZ::Uuid::CreateRandom());
+    Grammar::Request request;
+    request.scriptAssetId = assetId;
+    request.graph = graph;
+    request.name = "NativeTranslationPureGraph";
+    request.addDebugInformation = false;
+
+    const Translation::Result result = Translation::ToCPlusPlus(request);
+    EXPECT_TRUE(result.IsSuccess(Translation::TargetFlags::Cpp).IsSuccess());
+    EXPECT_TRUE(result.IsSuccess(Translation::TargetFlags::Hpp).IsSuccess());
+
+    auto dotCPP = result.m_translations.find(Translation::TargetFlags::Cpp);
+    ASSERT_NE(dotCPP, result.m_translations.end());
+    const AZStd::string& text = dotCPP->second.m_text;
+
+    // the method is resolved once and called directly, and the start function is registered under the source asset id
+    EXPECT_NE(text.find("FindNativeMethod("), AZStd::string::npos);
+    EXPECT_NE(text.find("\"Accumulate\""), AZStd::string::npos);
+    EXPECT_NE(text.find("CallNativeMethod("), AZStd::string::npos);
+    EXPECT_NE(text.find(AZStd::string::format("RegisterNativeGraphStart(\"%s\"", assetId.m_guid.ToString<AZStd::string>().c_str())), AZStd::string::npos);
+    EXPECT_EQ(dotCPP->second.m_runtimeInputs.m_executionSelection, Grammar::ExecutionStateSelection::InterpretedPureOnGraphStart);
+
+    delete graph->GetEntity();
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeTranslation_GraphWithoutOnGraphStart_ReportsUnsupported)
+{
+    using namespace NativeTranslationTestCPP;
+    using namespace ScriptCanvas;
+
+    NativeTranslationTestObject::Reflect(m_behaviorContext);
+
+    Graph* graph = nullptr;
+    SystemRequestBus::BroadcastResult(graph, &SystemRequests::MakeGraph);
+    ASSERT_NE(graph, nullptr);
+    graph->GetEntity()->Init();
+
+    CreateClassFunctionNode(graph->GetScriptCanvasId(), "NativeTranslationTestObject", "Accumulate");
+
+    Grammar::Request request;
+    request.scriptAssetId = AZ::Data::AssetId(AZ::Uuid::CreateRandom());
+    request.graph = graph;
+    request.name = "NativeTranslationNoStartGraph";
+    request.addDebugInformation = false;
+
+    // the graph stays on the interpreted path, no native source is produced
+    AZ_TEST_START_TRACE_SUPPRESSION;
+    const Translation::Result result = Translation::ToCPlusPlus(request);
+    AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+    EXPECT_FALSE(result.IsSuccess(Translation::TargetFlags::Cpp).IsSuccess());
+    EXPECT_EQ(result.m_translations.find(Translation::TargetFlags::Cpp), result.m_translations.end());
+
+    delete graph->GetEntity();
+}
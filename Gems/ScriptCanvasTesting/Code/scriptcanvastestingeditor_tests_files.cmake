@@ -22,6 +22,7 @@ set(FILES
     Tests/ScriptCanvas_EventHandlers.cpp
     Tests/ScriptCanvas_Math.cpp
     Tests/ScriptCanvas_MethodOverload.cpp
+    Tests/ScriptCanvas_NativeTranslation.cpp
     Tests/ScriptCanvas_NodeGenerics.cpp
     Tests/ScriptCanvas_Regressions.cpp
     Tests/ScriptCanvas_RuntimeInterpreted.cpp